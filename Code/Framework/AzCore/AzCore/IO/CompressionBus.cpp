@@ -18,6 +18,7 @@ namespace AZ::IO
     CompressionInfo& CompressionInfo::operator=(CompressionInfo&& rhs)
     {
         m_decompressor = AZStd::move(rhs.m_decompressor);
+        m_streamingDecompressor = AZStd::move(rhs.m_streamingDecompressor);
         m_archiveFilename = AZStd::move(rhs.m_archiveFilename);
         m_compressionTag = rhs.m_compressionTag;
         m_offset = rhs.m_offset;
@@ -12,6 +12,7 @@
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string_view.h>
 
 namespace AZ
@@ -34,6 +35,22 @@ namespace AZ
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
+        //! Incrementally decompresses a file from consecutive chunks of its compressed data. This allows decompression to start
+        //! before the entire file has been read and avoids having to keep the entire compressed file in memory.
+        class StreamingDecompressor
+        {
+        public:
+            virtual ~StreamingDecompressor() = default;
+
+            //! Decompresses data until either all compressed data has been consumed or the uncompressed buffer is full. Compressed
+            //! data that wasn't consumed needs to be provided again in the next call. Once all compressed data has been provided,
+            //! calling with no compressed data writes out any decompressed data that's still buffered by the decompressor.
+            //! Returns false if the compressed data can't be decompressed.
+            virtual bool Decompress(const void* compressed, size_t compressedSize, size_t& compressedConsumed,
+                void* uncompressed, size_t uncompressedSize, size_t& uncompressedWritten) = 0;
+        };
+        using CreateStreamingDecompressorFunc = AZStd::function<AZStd::unique_ptr<StreamingDecompressor>(const CompressionInfo& info)>;
+
         struct CompressionInfo
         {
             CompressionInfo() = default;
@@ -47,6 +64,9 @@ namespace AZ
             RequestPath m_archiveFilename;
             //< The function to use to decompress the data.
             DecompressionFunc m_decompressor;
+            //< Optional function to create a decompressor that can decompress the data in chunks. If not set, or if it returns null,
+            //< the data is decompressed in a single call to m_decompressor.
+            CreateStreamingDecompressorFunc m_streamingDecompressor;
             //< Tag that uniquely identifies the compressor responsible for decompressing the referenced data.
             CompressionTag m_compressionTag{ 0 };
             //! Offset into the archive file for the found file.
@@ -12,11 +12,10 @@
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
-#include <AzCore/Jobs/JobContext.h>
-#include <AzCore/Jobs/JobFunction.h>
-#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/typetraits/decay.h>
@@ -27,7 +26,7 @@ namespace AZ::IO
         const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
     {
         auto stackEntry = AZStd::make_shared<FullFileDecompressor>(
-            m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize), m_streamingChunkSizeKib * 1024);
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -39,7 +38,8 @@ namespace AZ::IO
             serializeContext->Class<FullFileDecompressorConfig, IStreamerStackConfig>()
                 ->Version(1)
                 ->Field("MaxNumReads", &FullFileDecompressorConfig::m_maxNumReads)
-                ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs);
+                ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs)
+                ->Field("StreamingChunkSizeKib", &FullFileDecompressorConfig::m_streamingChunkSizeKib);
         }
     }
 
@@ -48,32 +48,38 @@ namespace AZ::IO
     static constexpr char ReadBoundName[] = "Read bound";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
+    // The maximum size of the buffer that decompressed data in front of the read offset is written to before it's discarded.
+    static constexpr size_t MaxDiscardBufferSize = 64 * 1024;
+
+    bool FullFileDecompressor::StreamInformation::IsActive() const
+    {
+        return !!m_waitRequest;
+    }
+
     bool FullFileDecompressor::DecompressionInformation::IsProcessing() const
     {
         return !!m_compressedData;
     }
 
-    FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+    FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 streamingChunkSize)
         : StreamStackEntry("Full file decompressor")
         , m_maxNumReads(maxNumReads)
         , m_maxNumJobs(maxNumJobs)
         , m_alignment(alignment)
     {
-        JobManagerDesc jobDesc;
-            jobDesc.m_jobManagerName = "Full File Decompressor";
-        u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
-        for (u32 i = 0; i < numThreads; ++i)
+        // Chunks other than the first start at an aligned offset, so reads are only offset when reading the start of a file.
+        if (streamingChunkSize > 0)
         {
-            jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+            m_streamingChunkSize = AZ_SIZE_ALIGN_UP(streamingChunkSize, alignment);
         }
-        m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
-        m_decompressionjobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
 
         m_processingJobs = AZStd::make_unique<DecompressionInformation[]>(maxNumJobs);
+        m_streams = AZStd::make_unique<StreamInformation[]>(maxNumReads);
 
         m_readBuffers = AZStd::make_unique<Buffer[]>(maxNumReads);
         m_readRequests = AZStd::make_unique<FileRequest*[]>(maxNumReads);
         m_readBufferStatus = AZStd::make_unique<ReadBufferStatus[]>(maxNumReads);
+        m_readChunks = AZStd::make_unique<ChunkInformation[]>(maxNumReads);
         for (u32 i = 0; i < maxNumReads; ++i)
         {
             m_readBufferStatus[i] = ReadBufferStatus::Unused;
@@ -137,13 +143,19 @@ namespace AZ::IO
     {
         bool result = false;
         // First queue jobs as this might open up new read slots.
-        if (m_numInFlightReads > 0 && m_numRunningJobs < m_maxNumJobs)
+        if (m_numPendingDecompression > 0)
         {
             result = StartDecompressions();
         }
 
+        // Continue reading files that are already being decompressed before starting on new files.
+        if (m_numInFlightReads < m_maxNumReads)
+        {
+            result = StartChunkReads() || result;
+        }
+
         // Queue as many new reads as possible.
-        while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads)
+        while (!m_pendingReads.empty() && m_numInFlightReads < m_maxNumReads && m_numActiveStreams < m_maxNumReads)
         {
             StartArchiveRead(m_pendingReads.front());
             m_pendingReads.pop_front();
@@ -205,12 +217,7 @@ namespace AZ::IO
         {
             if (m_processingJobs[i].IsProcessing())
             {
-                FileRequest* compressedRequest = m_processingJobs[i].m_waitRequest->GetParent();
-                AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
-                auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
-                AZ_Assert(data, "Compressed request in the decompression queue in FullFileDecompressor didn't contain compression read data.");
-
-                size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                size_t bytesToDecompress = m_processingJobs[i].m_compressedSize;
                 auto decompressionDuration = AZStd::chrono::microseconds(
                     aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
                 auto timeInProcessing = now - m_processingJobs[i].m_jobStartTime;
@@ -258,16 +265,16 @@ namespace AZ::IO
             baseTime += decompressionDelay; // The average time it takes for the job system to pick up the decompression job.
 
             // Calculate the amount of time it will take to decompress the data.
-            FileRequest* compressedRequest = m_readRequests[i]->GetParent();
-            auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
-
-            size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+            size_t bytesToDecompress = m_readChunks[i].m_compressedSize;
             auto decompressionDuration = AZStd::chrono::microseconds(
                 aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
             smallestDecompressionDuration = AZStd::min(smallestDecompressionDuration, decompressionDuration);
             baseTime += decompressionDuration;
 
-            m_readRequests[i]->SetEstimatedCompletion(baseTime);
+            if (m_readRequests[i])
+            {
+                m_readRequests[i]->SetEstimatedCompletion(baseTime);
+            }
         }
         if (smallestDecompressionDuration != AZStd::chrono::microseconds::max())
         {
@@ -335,16 +342,26 @@ namespace AZ::IO
                 "The total amount of memory in megabytes used by the decompressor. This is dependent on the compressed file sizes and may "
                 "improve by reducing the file sizes of the largest files in the archive."));
 
-            double averageJobStartDelay = m_decompressionJobDelayMicroSec.CalculateAverage() * usToMs;
+            statistics.push_back(Statistic::CreateInteger(
+                m_name, "Active streams", m_numActiveStreams,
+                "The number of files that are being read and decompressed. Files are decompressed in chunks as they're read if the "
+                "archive supports streaming decompression, otherwise a file is decompressed once it has been fully read."));
+
+            double averageQueuedTime = m_decompressionJobDelayMicroSec.CalculateAverage() * usToMs;
             statistics.push_back(Statistic::CreateFloat(
-                m_name, "Decompression job delay (avg. ms)", averageJobStartDelay,
-                "The amount of time in milliseconds between queuing a decompression job and it starting. If this is too long it may "
-                "indicate that the job system is too saturated to pick decompression jobs."));
+                m_name, "Decompression queued time (avg. ms)", averageQueuedTime,
+                "The amount of time in milliseconds between queuing a decompression task and it starting. If this is too long it may "
+                "indicate that the task executor is too saturated to pick up decompression tasks."));
+            double averageActiveTime = m_decompressionDurationMicroSec.CalculateAverage() * usToMs;
+            statistics.push_back(Statistic::CreateFloat(
+                m_name, "Decompression active time (avg. ms)", averageActiveTime,
+                "The amount of time in milliseconds that a decompression task runs for. This covers a single chunk for files that are "
+                "decompressed while streaming and the entire file otherwise."));
 
             u64 totalBytesDecompressed = m_bytesDecompressed.GetTotal();
             double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
             statistics.push_back(Statistic::CreateBytesPerSecond(
-                m_name, "Decompression Speed per job", totalBytesDecompressed / totalDecompressionTimeSec,
+                m_name, "Decompression Speed per task", totalBytesDecompressed / totalDecompressionTimeSec,
                 "The average speed that the decompressor can handle. If this is not higher than the average read "
                 "speed than decompressing can't keep up with file reads. Increasing the number of jobs can help hide this issue, but only "
                 "for parallel reads, while individual reads will still remain decompression bound."));
@@ -373,9 +390,36 @@ namespace AZ::IO
             m_pendingFileExistChecks.empty() &&
             m_numInFlightReads == 0 &&
             m_numPendingDecompression == 0 &&
+            m_numActiveStreams == 0 &&
             m_numRunningJobs == 0;
     }
 
+    bool FullFileDecompressor::NeedsMoreChunks(const StreamInformation& stream) const
+    {
+        if (stream.m_status != IStreamerTypes::RequestStatus::Completed || stream.m_nextChunkToRead >= stream.m_numChunks)
+        {
+            return false;
+        }
+        // Streamed reads stop as soon as all data up to the end of the read has been decompressed.
+        auto data = AZStd::get_if<Requests::CompressedReadData>(&stream.m_waitRequest->GetParent()->GetCommand());
+        return !stream.m_decompressor || stream.m_uncompressedPosition < data->m_readOffset + data->m_readSize;
+    }
+
+    void FullFileDecompressor::GetChunkRange(const CompressionInfo& info, u32 chunkIndex, u32 numChunks, u64& offset, u64& size) const
+    {
+        if (numChunks == 1)
+        {
+            offset = info.m_offset;
+            size = info.m_compressedSize;
+            return;
+        }
+
+        u64 alignedStart = AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<u64>(m_alignment));
+        u64 end = info.m_offset + info.m_compressedSize;
+        offset = AZStd::max<u64>(info.m_offset, alignedStart + (aznumeric_cast<u64>(chunkIndex) * m_streamingChunkSize));
+        size = AZStd::min<u64>(end, alignedStart + (aznumeric_cast<u64>(chunkIndex + 1) * m_streamingChunkSize)) - offset;
+    }
+
     void FullFileDecompressor::PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data)
     {
         CompressionInfo info;
@@ -518,28 +562,106 @@ namespace AZ::IO
 
         for (u32 i = 0; i < m_maxNumReads; ++i)
         {
-            if (m_readBufferStatus[i] == ReadBufferStatus::Unused)
+            StreamInformation& stream = m_streams[i];
+            if (!stream.IsActive())
             {
                 auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedReadRequest->GetCommand());
                 AZ_Assert(data, "Compressed request that's starting a read in FullFileDecompressor didn't contain compression read data.");
                 AZ_Assert(data->m_compressionInfo.m_decompressor,
                     "FileRequest for FullFileDecompressor is missing a decompression callback.");
 
+                CompressionInfo& info = data->m_compressionInfo;
+
+                // Add this wait so the compressed request isn't completed in between reading and decompressing chunks. It's
+                // completed once all chunks have been processed.
+                stream.m_waitRequest = m_context->GetNewInternalRequest();
+                stream.m_waitRequest->CreateWait(compressedReadRequest);
+                stream.m_status = IStreamerTypes::RequestStatus::Completed;
+                stream.m_uncompressedPosition = 0;
+                stream.m_numChunks = 1;
+                stream.m_nextChunkToRead = 0;
+                stream.m_nextChunkToDecompress = 0;
+                stream.m_numOutstandingChunks = 0;
+                stream.m_isDecompressing = false;
+
+                if (m_streamingChunkSize > 0 && info.m_streamingDecompressor && info.m_compressedSize > m_streamingChunkSize)
+                {
+                    stream.m_decompressor = info.m_streamingDecompressor(info);
+                    if (stream.m_decompressor)
+                    {
+                        u64 alignedStart = AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<u64>(m_alignment));
+                        u64 streamedSize = (info.m_offset + info.m_compressedSize) - alignedStart;
+                        stream.m_numChunks = aznumeric_cast<u32>((streamedSize + m_streamingChunkSize - 1) / m_streamingChunkSize);
+                        if (data->m_readOffset > 0)
+                        {
+                            stream.m_discardBufferSize = AZStd::min(MaxDiscardBufferSize, aznumeric_cast<size_t>(data->m_readOffset));
+                            stream.m_discardBuffer = AZStd::unique_ptr<u8[]>(new u8[stream.m_discardBufferSize]);
+                            m_memoryUsage += stream.m_discardBufferSize;
+                        }
+                    }
+                }
+
+                ++m_numActiveStreams;
+                StartChunkRead(i);
+                return;
+            }
+        }
+        AZ_Assert(false, "%u of %u streams are used in the FullFileDecompressor, but no inactive stream was found.", m_numActiveStreams, m_maxNumReads);
+    }
+
+    bool FullFileDecompressor::StartChunkReads()
+    {
+        bool queuedReads = false;
+        for (u32 streamSlot = 0; streamSlot < m_maxNumReads; ++streamSlot)
+        {
+            StreamInformation& stream = m_streams[streamSlot];
+            while (stream.IsActive() && m_numInFlightReads < m_maxNumReads && NeedsMoreChunks(stream))
+            {
+                StartChunkRead(streamSlot);
+                queuedReads = true;
+            }
+        }
+        return queuedReads;
+    }
+
+    void FullFileDecompressor::StartChunkRead(u32 streamSlot)
+    {
+        for (u32 i = 0; i < m_maxNumReads; ++i)
+        {
+            if (m_readBufferStatus[i] == ReadBufferStatus::Unused)
+            {
+                StreamInformation& stream = m_streams[streamSlot];
+                FileRequest* compressedReadRequest = stream.m_waitRequest->GetParent();
+                auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedReadRequest->GetCommand());
+                AZ_Assert(data, "Compressed request that's starting a read in FullFileDecompressor didn't contain compression read data.");
+
                 CompressionInfo& info = data->m_compressionInfo;
                 AZ_Assert(info.m_decompressor, "FullFileDecompressor is planning to a queue a request for reading but couldn't find a decompressor.");
 
+                u32 chunkIndex = stream.m_nextChunkToRead++;
+                u64 chunkOffset;
+                u64 chunkSize;
+                GetChunkRange(info, chunkIndex, stream.m_numChunks, chunkOffset, chunkSize);
+
                 // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
                 // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
                 // the BlockCache's prolog and epilog are read into aligned buffers.
-                size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                size_t offsetAdjustment = chunkOffset - AZ_SIZE_ALIGN_DOWN(chunkOffset, aznumeric_cast<size_t>(m_alignment));
+                size_t bufferSize = AZ_SIZE_ALIGN_UP((chunkSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
                 m_readBuffers[i] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
                     bufferSize, m_alignment));
                 m_memoryUsage += bufferSize;
 
+                ChunkInformation& chunk = m_readChunks[i];
+                chunk.m_compressedSize = chunkSize;
+                chunk.m_bufferSize = bufferSize;
+                chunk.m_alignmentOffset = aznumeric_caster(offsetAdjustment);
+                chunk.m_streamSlot = streamSlot;
+                chunk.m_chunkIndex = chunkIndex;
+
                 FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
                 archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + offsetAdjustment, bufferSize, info.m_archiveFilename,
-                    info.m_offset, info.m_compressedSize, info.m_isSharedPak);
+                    chunkOffset, chunkSize, info.m_isSharedPak);
                 archiveReadRequest->SetCompletionCallback(
                     [this, readSlot = i](FileRequest& request)
                     {
@@ -550,6 +672,7 @@ namespace AZ::IO
 
                 m_readRequests[i] = archiveReadRequest;
                 m_readBufferStatus[i] = ReadBufferStatus::ReadInFlight;
+                ++stream.m_numOutstandingChunks;
 
                 AZ_Assert(m_numInFlightReads < m_maxNumReads,
                     "A FileRequest was queued for reading in FullFileDecompressor, but there's no slots available.");
@@ -565,48 +688,56 @@ namespace AZ::IO
     {
         AZ_Assert(m_readRequests[readSlot] == readRequest,
             "Request in the archive read slot isn't the same as request that's being completed.");
+        AZ_Assert(readRequest->GetParent(), "Read requests started by FullFileDecompressor is missing a parent request.");
 
-        FileRequest* compressedRequest = readRequest->GetParent();
-        AZ_Assert(compressedRequest, "Read requests started by FullFileDecompressor is missing a parent request.");
-
+        m_readRequests[readSlot] = nullptr;
         if (readRequest->GetStatus() == IStreamerTypes::RequestStatus::Completed)
         {
             m_readBufferStatus[readSlot] = ReadBufferStatus::PendingDecompression;
             ++m_numPendingDecompression;
-
-            // Add this wait so the compressed request isn't fully completed yet as only the read part is done. The
-            // job thread will finish this wait, which in turn will trigger this function again on the main streaming thread.
-            FileRequest* waitRequest = m_context->GetNewInternalRequest();
-            waitRequest->CreateWait(compressedRequest);
-            m_readRequests[readSlot] = waitRequest;
         }
         else
         {
-            auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
-            AZ_Assert(data, "Compressed request in FullFileDecompressor that finished unsuccessfully didn't contain compression read data.");
-            CompressionInfo& info = data->m_compressionInfo;
-            size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-            size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
-            m_memoryUsage -= bufferSize;
-
-            if (m_readBuffers[readSlot] != nullptr)
+            u32 streamSlot = m_readChunks[readSlot].m_streamSlot;
+            StreamInformation& stream = m_streams[streamSlot];
+            if (stream.m_status == IStreamerTypes::RequestStatus::Completed)
             {
-                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_readBuffers[readSlot], bufferSize, m_alignment);
-                m_readBuffers[readSlot] = nullptr;
+                stream.m_status = readRequest->GetStatus();
             }
-            m_readRequests[readSlot] = nullptr;
-            m_readBufferStatus[readSlot] = ReadBufferStatus::Unused;
-            AZ_Assert(m_numInFlightReads > 0,
-                "Trying to decrement a read request after it was canceled or failed in FullFileDecompressor, "
-                "but no read requests are supposed to be queued.");
-            m_numInFlightReads--;
+
+            ReleaseReadSlot(readSlot);
+            AZ_Assert(stream.m_numOutstandingChunks > 0, "A chunk read failed in FullFileDecompressor, but its stream has no outstanding chunks.");
+            --stream.m_numOutstandingChunks;
+            TryFinishStream(streamSlot);
         }
     }
 
+    void FullFileDecompressor::ReleaseReadSlot(u32 readSlot)
+    {
+        if (m_readBuffers[readSlot] != nullptr)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(
+                m_readBuffers[readSlot], m_readChunks[readSlot].m_bufferSize, m_alignment);
+            m_readBuffers[readSlot] = nullptr;
+            m_memoryUsage -= m_readChunks[readSlot].m_bufferSize;
+        }
+
+        if (m_readBufferStatus[readSlot] == ReadBufferStatus::PendingDecompression)
+        {
+            AZ_Assert(m_numPendingDecompression > 0,
+                "Trying to release a read slot pending decompression in FullFileDecompressor, but none are supposed to be pending.");
+            --m_numPendingDecompression;
+        }
+        m_readRequests[readSlot] = nullptr;
+        m_readBufferStatus[readSlot] = ReadBufferStatus::Unused;
+        AZ_Assert(m_numInFlightReads > 0,
+            "Trying to decrement a read request in FullFileDecompressor, but no read requests are supposed to be queued.");
+        m_numInFlightReads--;
+    }
+
     bool FullFileDecompressor::StartDecompressions()
     {
         bool queuedJobs = false;
-        u32 jobSlot = 0;
         for (u32 readSlot = 0; readSlot < m_maxNumReads; ++readSlot)
         {
             // Find completed read.
@@ -615,20 +746,43 @@ namespace AZ::IO
                 continue;
             }
 
+            ChunkInformation& chunk = m_readChunks[readSlot];
+            u32 streamSlot = chunk.m_streamSlot;
+            StreamInformation& stream = m_streams[streamSlot];
+            FileRequest* compressedRequest = stream.m_waitRequest->GetParent();
+            auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+            AZ_Assert(data, "Compressed request in FullFileDecompressor that's starting decompression didn't contain compression read data.");
+            AZ_Assert(data->m_compressionInfo.m_decompressor, "FullFileDecompressor is queuing a decompression job but couldn't find a decompressor.");
+
+            // Chunks that were read after a chunk failed or after the end of the read was decompressed are no longer needed.
+            bool isStreamEnded = stream.m_status != IStreamerTypes::RequestStatus::Completed ||
+                (stream.m_decompressor && stream.m_uncompressedPosition >= data->m_readOffset + data->m_readSize);
+            if (isStreamEnded)
+            {
+                ReleaseReadSlot(readSlot);
+                --stream.m_numOutstandingChunks;
+                TryFinishStream(streamSlot);
+                queuedJobs = true;
+                continue;
+            }
+
+            // Chunks of a file are decompressed one at a time and in order.
+            if (stream.m_isDecompressing || chunk.m_chunkIndex != stream.m_nextChunkToDecompress || m_numRunningJobs == m_maxNumJobs)
+            {
+                continue;
+            }
+
             // Find decompression slot
-            for (; jobSlot < m_maxNumJobs; ++jobSlot)
+            for (u32 jobSlot = 0; jobSlot < m_maxNumJobs; ++jobSlot)
             {
                 if (m_processingJobs[jobSlot].IsProcessing())
                 {
                     continue;
                 }
 
-                FileRequest* waitRequest = m_readRequests[readSlot];
-                AZ_Assert(AZStd::holds_alternative<Requests::WaitData>(waitRequest->GetCommand()),
-                    "File request waiting for decompression wasn't marked as being a wait operation.");
-                FileRequest* compressedRequest = waitRequest->GetParent();
-                AZ_Assert(compressedRequest, "Read requests started by FullFileDecompressor is missing a parent request.");
-
+                // The task will finish this wait, which in turn will trigger FinishDecompression on the main streaming thread.
+                FileRequest* waitRequest = m_context->GetNewInternalRequest();
+                waitRequest->CreateWait(compressedRequest);
                 waitRequest->SetCompletionCallback([this, jobSlot](FileRequest& request)
                     {
                         AZ_PROFILE_FUNCTION(AzCore);
@@ -641,69 +795,71 @@ namespace AZ::IO
                 info.m_jobStartTime = info.m_queueStartTime; // Set these to the same in case the scheduler requests an update before the job has started.
                 info.m_compressedData = m_readBuffers[readSlot]; // Transfer ownership of the pointer.
                 m_readBuffers[readSlot] = nullptr;
-
-                AZ::Job* decompressionJob;
-                auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
-                AZ_Assert(data, "Compressed request in FullFileDecompressor that's starting decompression didn't contain compression read data.");
-                AZ_Assert(data->m_compressionInfo.m_decompressor, "FullFileDecompressor is queuing a decompression job but couldn't find a decompressor.");
-
-                info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
-                    AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
-
-                if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                info.m_compressedSize = chunk.m_compressedSize;
+                info.m_bufferSize = chunk.m_bufferSize;
+                info.m_alignmentOffset = chunk.m_alignmentOffset;
+                info.m_streamSlot = streamSlot;
+                info.m_streamingDecompressor = stream.m_decompressor.get();
+                info.m_discardBuffer = stream.m_discardBuffer.get();
+                info.m_discardBufferSize = stream.m_discardBufferSize;
+                info.m_uncompressedPosition = stream.m_uncompressedPosition;
+                info.m_isLastChunk = chunk.m_chunkIndex + 1 == stream.m_numChunks;
+
+                stream.m_isDecompressing = true;
+                stream.m_nextChunkToDecompress++;
+
+                AZ::TaskGraph taskGraph{ "Full File Decompression" };
+                if (info.m_streamingDecompressor)
                 {
-                    auto job = [this, &info]()
-                    {
-                        FullDecompression(m_context, info);
-                    };
-                    decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                    taskGraph.AddTask(m_decompressionTaskDescriptor, [this, &info]()
+                        {
+                            StreamingDecompression(m_context, info);
+                        });
+                }
+                else if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                {
+                    taskGraph.AddTask(m_decompressionTaskDescriptor, [this, &info]()
+                        {
+                            FullDecompression(m_context, info);
+                        });
                 }
                 else
                 {
                     m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
-                    auto job = [this, &info]()
-                    {
-                        PartialDecompression(m_context, info);
-                    };
-                    decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                    taskGraph.AddTask(m_decompressionTaskDescriptor, [this, &info]()
+                        {
+                            PartialDecompression(m_context, info);
+                        });
                 }
-                --m_numPendingDecompression;
                 ++m_numRunningJobs;
-                decompressionJob->Start();
+                // The buffer has been handed over to the job, so only the slot is released.
+                ReleaseReadSlot(readSlot);
 
-                m_readRequests[readSlot] = nullptr;
-                m_readBufferStatus[readSlot] = ReadBufferStatus::Unused;
-                AZ_Assert(m_numInFlightReads > 0, "Trying to decrement a read request after it's queued for decompression in FullFileDecompressor, but no read requests are supposed to be queued.");
-                m_numInFlightReads--;
+                taskGraph.Detach();
+                taskGraph.SubmitOnExecutor(GetTaskExecutor());
 
                 queuedJobs = true;
                 break;
             }
-
-            if (m_numInFlightReads == 0 || m_numRunningJobs == m_maxNumJobs)
-            {
-                return queuedJobs;
-            }
         }
         return queuedJobs;
     }
 
-    void FullFileDecompressor::FinishDecompression([[maybe_unused]] FileRequest* waitRequest, u32 jobSlot)
+    void FullFileDecompressor::FinishDecompression(FileRequest* waitRequest, u32 jobSlot)
     {
         DecompressionInformation& jobInfo = m_processingJobs[jobSlot];
         AZ_Assert(jobInfo.m_waitRequest == waitRequest, "Job slot didn't contain the expected wait request.");
 
         auto endTime = AZStd::chrono::steady_clock::now();
 
-        FileRequest* compressedRequest = jobInfo.m_waitRequest->GetParent();
+        StreamInformation& stream = m_streams[jobInfo.m_streamSlot];
+        FileRequest* compressedRequest = stream.m_waitRequest->GetParent();
         AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
         auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
         AZ_Assert(data, "Compressed request in FullFileDecompressor that completed decompression didn't contain compression read data.");
-        CompressionInfo& info = data->m_compressionInfo;
-        size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-        size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
-        m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
+        m_memoryUsage -= jobInfo.m_bufferSize;
+        if (!jobInfo.m_streamingDecompressor &&
+            (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize))
         {
             m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
         }
@@ -712,13 +868,56 @@ namespace AZ::IO
             jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
         m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
             endTime - jobInfo.m_jobStartTime).count());
-        m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+        m_bytesDecompressed.PushEntry(jobInfo.m_compressedSize);
 
-        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, jobInfo.m_bufferSize, m_alignment);
         jobInfo.m_compressedData = nullptr;
         AZ_Assert(m_numRunningJobs > 0, "About to complete a decompression job, but the internal count doesn't see a running job.");
         --m_numRunningJobs;
-        return;
+
+        stream.m_isDecompressing = false;
+        stream.m_uncompressedPosition = jobInfo.m_uncompressedPosition;
+        if (waitRequest->GetStatus() != IStreamerTypes::RequestStatus::Completed)
+        {
+            stream.m_status = waitRequest->GetStatus();
+        }
+        AZ_Assert(stream.m_numOutstandingChunks > 0, "A chunk finished decompressing in FullFileDecompressor, but its stream has no outstanding chunks.");
+        --stream.m_numOutstandingChunks;
+        TryFinishStream(jobInfo.m_streamSlot);
+    }
+
+    void FullFileDecompressor::TryFinishStream(u32 streamSlot)
+    {
+        StreamInformation& stream = m_streams[streamSlot];
+        if (stream.m_numOutstandingChunks > 0 || NeedsMoreChunks(stream))
+        {
+            return;
+        }
+
+        stream.m_waitRequest->SetStatus(stream.m_status);
+        m_context->MarkRequestAsCompleted(stream.m_waitRequest);
+        stream.m_waitRequest = nullptr;
+        stream.m_decompressor.reset();
+        stream.m_discardBuffer.reset();
+        m_memoryUsage -= stream.m_discardBufferSize;
+        stream.m_discardBufferSize = 0;
+
+        AZ_Assert(m_numActiveStreams > 0, "About to complete a stream, but the internal count doesn't see an active stream.");
+        --m_numActiveStreams;
+    }
+
+    TaskExecutor& FullFileDecompressor::GetTaskExecutor()
+    {
+        if (AZ::Interface<AZ::TaskGraphActiveInterface>::Get())
+        {
+            return TaskExecutor::Instance();
+        }
+
+        if (!m_fallbackTaskExecutor)
+        {
+            m_fallbackTaskExecutor = AZStd::make_unique<TaskExecutor>(AZ::GetMin(m_maxNumJobs, AZStd::thread::hardware_concurrency()));
+        }
+        return *m_fallbackTaskExecutor;
     }
 
     void FullFileDecompressor::FullDecompression(StreamerContext* context, DecompressionInformation& info)
@@ -741,6 +940,7 @@ namespace AZ::IO
         bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
             compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+        info.m_uncompressedPosition = compressionInfo.m_uncompressedSize;
 
         context->MarkRequestAsCompleted(info.m_waitRequest);
         context->WakeUpSchedulingThread();
@@ -761,6 +961,7 @@ namespace AZ::IO
         bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
             compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+        info.m_uncompressedPosition = compressionInfo.m_uncompressedSize;
 
         memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
 
@@ -768,6 +969,69 @@ namespace AZ::IO
         context->WakeUpSchedulingThread();
     }
 
+    void FullFileDecompressor::StreamingDecompression(StreamerContext* context, DecompressionInformation& info)
+    {
+        info.m_jobStartTime = AZStd::chrono::steady_clock::now();
+
+        FileRequest* compressedRequest = info.m_waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in FullFileDecompressor that's running streaming decompression didn't contain compression read data.");
+        AZ_Assert(info.m_streamingDecompressor, "Streaming decompressor job started, but there's no streaming decompressor assigned.");
+
+        const u8* compressed = info.m_compressedData + info.m_alignmentOffset;
+        size_t compressedRemaining = info.m_compressedSize;
+        const u64 readEnd = request->m_readOffset + request->m_readSize;
+        bool success = true;
+        while (info.m_uncompressedPosition < readEnd)
+        {
+            // Data in front of the read offset is decompressed into a scratch buffer and discarded, while the requested data is
+            // decompressed directly into the output buffer.
+            u8* uncompressed;
+            size_t uncompressedSize;
+            if (info.m_uncompressedPosition < request->m_readOffset)
+            {
+                AZ_Assert(info.m_discardBuffer, "Streaming decompressor needs to skip data, but there's no discard buffer.");
+                uncompressed = info.m_discardBuffer;
+                uncompressedSize = aznumeric_cast<size_t>(
+                    AZStd::min<u64>(info.m_discardBufferSize, request->m_readOffset - info.m_uncompressedPosition));
+            }
+            else
+            {
+                uncompressed = reinterpret_cast<u8*>(request->m_output) + (info.m_uncompressedPosition - request->m_readOffset);
+                uncompressedSize = aznumeric_cast<size_t>(readEnd - info.m_uncompressedPosition);
+            }
+
+            size_t consumed = 0;
+            size_t written = 0;
+            if (!info.m_streamingDecompressor->Decompress(compressed, compressedRemaining, consumed, uncompressed, uncompressedSize, written))
+            {
+                success = false;
+                break;
+            }
+            compressed += consumed;
+            compressedRemaining -= consumed;
+            info.m_uncompressedPosition += written;
+
+            if (consumed == 0 && written == 0)
+            {
+                // No more progress can be made until the next chunk arrives. If there's still compressed data left, the
+                // decompressor is stuck on data it can't decompress.
+                success = compressedRemaining == 0;
+                break;
+            }
+        }
+
+        if (info.m_isLastChunk && info.m_uncompressedPosition < readEnd)
+        {
+            success = false;
+        }
+        info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+
+        context->MarkRequestAsCompleted(info.m_waitRequest);
+        context->WakeUpSchedulingThread();
+    }
+
     void FullFileDecompressor::Report(const Requests::ReportData& data) const
     {
         switch (data.m_reportType)
@@ -777,11 +1041,14 @@ namespace AZ::IO
                 m_name, "Max number of reads", m_maxNumReads, "The maximum number of parallel reads this decompressor node will support."));
             data.m_output.push_back(Statistic::CreateInteger(
                 m_name, "Max number of jobs", m_maxNumJobs,
-                "The maximum number of decompression jobs that can run in parallel. A thread per job will be used. A dedicated job system "
-                "is used as not to interfere with the regular job/task system, but this does add additional thread scheduling work to the "
-                "operating system and may impact how stable the performance on the rest of the engine is. If there are functions that "
-                "periodically take much longer, look for excessive context switches by the operating systems and if found lowering this "
-                "value may help reduce those at the cost or streaming speeds."));
+                "The maximum number of decompression tasks that can run in parallel. Decompression shares the task executor with the rest "
+                "of the engine, so raising this value allows more files to be decompressed at the same time, at the cost of leaving fewer "
+                "task threads available to other systems while a large number of files is being streamed."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Streaming chunk size", m_streamingChunkSize,
+                "The size of the chunks that compressed files are read in if their decompressor supports streaming. Smaller chunks reduce "
+                "the memory used for reading and allow decompression to start earlier, but increase the number of reads and tasks. "
+                "Files are read and decompressed in full if this is zero."));
             data.m_output.push_back(Statistic::CreateByteSize(
                 m_name, "Alignment", m_alignment,
                 "The alignment for read buffer. This allows enough memory to be reserved in the read buffer to allow for alignment to "
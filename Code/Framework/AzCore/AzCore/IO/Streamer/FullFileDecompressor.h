@@ -8,12 +8,13 @@
 
 #pragma once
 
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
-#include <AzCore/Jobs/JobManager.h>
-#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -42,22 +43,30 @@ namespace AZ::IO
         u32 m_maxNumReads{ 2 };
         //! Maximum number of decompression jobs that can run simultaneously.
         u32 m_maxNumJobs{ 2 };
+        //! Size of the chunks that files are read in if their decompressor supports streaming. Set to 0 to always read and
+        //! decompress files in full.
+        u32 m_streamingChunkSizeKib{ 512 };
     };
 
     //! Entry in the streaming stack that decompresses files from an archive that are stored
     //! as single files and without equally distributed seek points.
     //! Because the target archive has compressed the entire file, it needs to be decompressed
-    //! completely, so even if the file is partially read, it needs to be fully loaded. This
-    //! also means that there's no upper limit to the memory so every decompression job will
-    //! need to allocate memory as a temporary buffer (in-place decompression is not supported).
-    //! Finally, the lack of an upper limit also means that the duration of the decompression job
-    //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
-    //! the main job system from working.
+    //! from the start, so even if the file is partially read, all data up to the end of the read
+    //! needs to be decompressed.
+    //! If the archive provides a streaming decompressor, files are read in chunks and every chunk
+    //! is decompressed directly into the output buffer as soon as it has been read, which limits
+    //! the memory used to the chunks in flight and allows reading and decompressing to overlap.
+    //! Otherwise the entire file is read into a temporary buffer and decompressed in one go, which
+    //! for partial reads also requires a temporary buffer for the decompressed file.
+    //! Decompression runs as tasks on the global task executor, with no more than the maximum number
+    //! of jobs running at the same time. If the task graph isn't active, a private executor is used.
     class FullFileDecompressor
         : public StreamStackEntry
     {
     public:
-        FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
+        static constexpr u32 DefaultStreamingChunkSize = 512 * 1024;
+
+        FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, u32 streamingChunkSize = DefaultStreamingChunkSize);
         ~FullFileDecompressor() override = default;
 
         void PrepareRequest(FileRequest* request) override;
@@ -80,6 +89,36 @@ namespace AZ::IO
             PendingDecompression
         };
 
+        //! Information about the part of a compressed file that has been read into a read slot.
+        struct ChunkInformation
+        {
+            size_t m_compressedSize{ 0 };
+            size_t m_bufferSize{ 0 };
+            u32 m_alignmentOffset{ 0 };
+            u32 m_streamSlot{ 0 };
+            u32 m_chunkIndex{ 0 };
+        };
+
+        //! A compressed file that's being read and decompressed. Files are read as one or more chunks, which are
+        //! decompressed one at a time and in order.
+        struct StreamInformation
+        {
+            bool IsActive() const;
+
+            AZStd::unique_ptr<StreamingDecompressor> m_decompressor; //!< Null if the file is read as a single chunk.
+            AZStd::unique_ptr<u8[]> m_discardBuffer; //!< Target for decompressed data in front of the read offset.
+            // Wait request that keeps the compressed request from completing until all chunks have been processed.
+            FileRequest* m_waitRequest{ nullptr };
+            size_t m_discardBufferSize{ 0 };
+            u64 m_uncompressedPosition{ 0 };
+            u32 m_numChunks{ 0 };
+            u32 m_nextChunkToRead{ 0 };
+            u32 m_nextChunkToDecompress{ 0 };
+            u32 m_numOutstandingChunks{ 0 }; //!< Number of chunks that are being read, waiting for decompression or decompressing.
+            IStreamerTypes::RequestStatus m_status{ IStreamerTypes::RequestStatus::Completed };
+            bool m_isDecompressing{ false };
+        };
+
         struct DecompressionInformation
         {
             bool IsProcessing() const;
@@ -88,10 +127,20 @@ namespace AZ::IO
             AZStd::chrono::steady_clock::time_point m_jobStartTime;
             Buffer m_compressedData{ nullptr };
             FileRequest* m_waitRequest{ nullptr };
+            StreamingDecompressor* m_streamingDecompressor{ nullptr };
+            u8* m_discardBuffer{ nullptr };
+            size_t m_discardBufferSize{ 0 };
+            size_t m_compressedSize{ 0 };
+            size_t m_bufferSize{ 0 };
+            u64 m_uncompressedPosition{ 0 };
             u32 m_alignmentOffset{ 0 };
+            u32 m_streamSlot{ 0 };
+            bool m_isLastChunk{ false };
         };
 
         bool IsIdle() const;
+        bool NeedsMoreChunks(const StreamInformation& stream) const;
+        void GetChunkRange(const CompressionInfo& info, u32 chunkIndex, u32 numChunks, u64& offset, u64& size) const;
 
         void PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data);
         void PrepareDedicatedCache(FileRequest* request, const RequestPath& path);
@@ -101,12 +150,18 @@ namespace AZ::IO
             AZStd::chrono::microseconds decompressionDelay, double totalDecompressionDurationUs, double totalBytesDecompressed) const;
 
         void StartArchiveRead(FileRequest* compressedReadRequest);
+        bool StartChunkReads();
+        void StartChunkRead(u32 streamSlot);
         void FinishArchiveRead(FileRequest* readRequest, u32 readSlot);
+        void ReleaseReadSlot(u32 readSlot);
         bool StartDecompressions();
         void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
+        void TryFinishStream(u32 streamSlot);
+        TaskExecutor& GetTaskExecutor();
 
         static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
         static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+        static void StreamingDecompression(StreamerContext* context, DecompressionInformation& info);
 
         void Report(const Requests::ReportData& data) const;
 
@@ -122,20 +177,25 @@ namespace AZ::IO
 #endif
 
         AZStd::unique_ptr<Buffer[]> m_readBuffers;
-        // Nullptr if not reading, the read request if reading the file and the wait request for decompression when waiting on decompression.
+        // Nullptr if not reading and the read request if reading a chunk of the file.
         AZStd::unique_ptr<FileRequest*[]> m_readRequests;
         AZStd::unique_ptr<ReadBufferStatus[]> m_readBufferStatus;
+        AZStd::unique_ptr<ChunkInformation[]> m_readChunks;
 
+        AZStd::unique_ptr<StreamInformation[]> m_streams;
         AZStd::unique_ptr<DecompressionInformation[]> m_processingJobs;
-        AZStd::unique_ptr<JobManager> m_decompressionJobManager;
-        AZStd::unique_ptr<JobContext> m_decompressionjobContext;
+        // Only created if the task graph isn't active, as decompression would otherwise run on the global task executor.
+        AZStd::unique_ptr<TaskExecutor> m_fallbackTaskExecutor;
+        TaskDescriptor m_decompressionTaskDescriptor{ "Decompress file", "Full File Decompressor" };
 
         size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
         u32 m_maxNumReads{ 2 };
         u32 m_numInFlightReads{ 0 };
         u32 m_numPendingDecompression{ 0 };
+        u32 m_numActiveStreams{ 0 };
         u32 m_maxNumJobs{ 1 };
         u32 m_numRunningJobs{ 0 };
         u32 m_alignment{ 0 };
+        u32 m_streamingChunkSize{ 0 };
     };
 } // namespace AZ::IO
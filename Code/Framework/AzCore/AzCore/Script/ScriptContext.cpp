@@ -5880,6 +5880,24 @@ LUA_API const Node* lua_getDummyNode()
         lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::GarbageCollectStepWithBudget(AZStd::chrono::microseconds budget)
+    {
+        // a step size of 0 performs a single basic step, the smallest amount of work the collector can do
+        constexpr int basicStepSize = 0;
+        const AZStd::chrono::steady_clock::time_point deadline = AZStd::chrono::steady_clock::now() + budget;
+
+        do
+        {
+            if (lua_gc(m_impl->m_lua, LUA_GCSTEP, basicStepSize))
+            {
+                return true;
+            }
+        } while (AZStd::chrono::steady_clock::now() < deadline);
+
+        return false;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     size_t ScriptContext::GetMemoryUsage() const
     {
@@ -19,6 +19,7 @@
 #include <AzCore/std/typetraits/is_convertible.h>
 #include <AzCore/std/utils.h>
 #include <AzCore/std/any.h>
+#include <AzCore/std/chrono/chrono.h>
 
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/list.h>
@@ -868,6 +869,13 @@ namespace AZ
          */
         void GarbageCollectStep(int numberOfSteps = 2);
 
+        /**
+         * Step the garbage collector in small increments until the time budget is spent, or the current collection cycle
+         * completes. Unlike GarbageCollectStep, the cost per call is bounded regardless of how much garbage was produced.
+         * Returns true if a collection cycle completed.
+         */
+        bool GarbageCollectStepWithBudget(AZStd::chrono::microseconds budget);
+
         lua_State* NativeContext();
 
         //////////////////////////////////////////////////////////////////////////
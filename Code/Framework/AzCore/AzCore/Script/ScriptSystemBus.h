@@ -84,6 +84,12 @@ namespace AZ
         /// Step GC 
         virtual void GarbageCollectStep(int numberOfSteps) = 0;
 
+        /**
+         * Sets how long the garbage collector of a context may run each system tick. When the budget is zero the context
+         * steps the collector by its garbage collector step count instead.
+         */
+        virtual void SetGarbageCollectorBudget(AZStd::chrono::microseconds budget, ScriptContextId id) = 0;
+
         /**
          * Load script asset into the a context.
          * If the load succeeds, the script table will be on top of the stack
@@ -310,7 +310,14 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        if (contextContainer.m_garbageCollectorBudget.count() > 0)
+        {
+            contextContainer.m_context->GarbageCollectStepWithBudget(contextContainer.m_garbageCollectorBudget);
+        }
+        else
+        {
+            contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        }
     }
 }
 
@@ -344,6 +351,18 @@ void ScriptSystemComponent::GarbageCollectStep(int numberOfSteps)
     }
 }
 
+//=========================================================================
+// SetGarbageCollectorBudget
+//=========================================================================
+void ScriptSystemComponent::SetGarbageCollectorBudget(AZStd::chrono::microseconds budget, ScriptContextId id)
+{
+    ContextContainer* container = GetContextContainer(id);
+    if (container)
+    {
+        container->m_garbageCollectorBudget = budget;
+    }
+}
+
 bool ScriptSystemComponent::Load(const Data::Asset<ScriptAsset>& asset, const char* mode, ScriptContextId id)
 {
     return LoadAndGetNativeContext(asset, mode, id).status != ScriptLoadResult::Status::Failed;
@@ -60,6 +60,7 @@ namespace AZ
 
         void GarbageCollect() override;
         void GarbageCollectStep(int numberOfSteps) override;
+        void SetGarbageCollectorBudget(AZStd::chrono::microseconds budget, ScriptContextId id = ScriptContextIds::DefaultScriptContextId) override;
 
         bool Load(const Data::Asset<ScriptAsset>& asset, const char* mode, ScriptContextId id) override;
         ScriptLoadResult LoadAndGetNativeContext(const Data::Asset<ScriptAsset>& asset, const char* mode, ScriptContextId id) override;
@@ -130,6 +131,7 @@ namespace AZ
             ScriptContext* m_context = nullptr;
             bool m_isOwner = true;
             int m_garbageCollectorSteps = 0;
+            AZStd::chrono::microseconds m_garbageCollectorBudget{ 0 }; ///< When non zero, the time the collector may run each tick
             AZStd::unordered_map<Uuid, LoadedScriptInfo> m_loadedScripts;
             AZStd::unordered_map<Uuid, Data::Asset<ScriptAsset>> m_trackedScripts;
             AZStd::recursive_mutex m_loadedScriptsMutex;
@@ -147,6 +149,7 @@ namespace AZ
                 m_context = rhs.m_context;
                 m_isOwner = rhs.m_isOwner;
                 m_garbageCollectorSteps = rhs.m_garbageCollectorSteps;
+                m_garbageCollectorBudget = rhs.m_garbageCollectorBudget;
 
                 {
                     AZStd::lock_guard<AZStd::recursive_mutex> myLock(m_loadedScriptsMutex);
@@ -4192,6 +4192,25 @@ ramenShop.handler:Connect(4);
         m_script->Execute("AZTestAssert(ScriptClass == nil)");
     }
 
+    TEST_F(BaseScriptTest, GarbageCollectStepWithBudget_RepeatedCalls_CompletesCyclesAndFreesGarbage)
+    {
+        m_script->Execute("garbage = {} for i = 1, 10000 do garbage[i] = { i } end garbage = nil");
+        const size_t memoryUsageWithGarbage = m_script->GetMemoryUsage();
+
+        // the garbage may have been marked by a cycle that was already in progress, so it is only freed by the next one
+        int completedCycles = 0;
+        for (int step = 0; step < 100000 && completedCycles < 2; ++step)
+        {
+            if (m_script->GarbageCollectStepWithBudget(AZStd::chrono::microseconds(100)))
+            {
+                ++completedCycles;
+            }
+        }
+
+        EXPECT_EQ(completedCycles, 2);
+        EXPECT_LT(m_script->GetMemoryUsage(), memoryUsageWithGarbage);
+    }
+
     class MathScriptTest
         : public BaseScriptTest
     {
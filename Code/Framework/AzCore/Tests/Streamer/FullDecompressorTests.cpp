@@ -71,13 +71,38 @@ namespace AZ::IO
             UnitTest::LeakDetectionFixture::TearDown();
         }
 
-        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        class CopyStreamingDecompressor
+            : public StreamingDecompressor
+        {
+        public:
+            bool Decompress(const void* compressed, size_t compressedSize, size_t& compressedConsumed,
+                void* uncompressed, size_t uncompressedSize, size_t& uncompressedWritten) override
+            {
+                size_t size = AZStd::min(compressedSize, uncompressedSize);
+                memcpy(uncompressed, compressed, size);
+                compressedConsumed = size;
+                uncompressedWritten = size;
+                return true;
+            }
+        };
+
+        class CorruptedStreamingDecompressor
+            : public StreamingDecompressor
+        {
+        public:
+            bool Decompress(const void*, size_t, size_t&, void*, size_t, size_t&) override
+            {
+                return false;
+            }
+        };
+
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, u32 streamingChunkSize = FullFileDecompressor::DefaultStreamingChunkSize)
         {
             m_buffer = new u32[m_fakeFileLength >> 2];
 
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_decompressor = AZStd::make_shared<FullFileDecompressor>(maxNumReads, maxNumJobs,
-                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment, streamingChunkSize);
 
             m_context = new StreamerContext();
             m_decompressor->SetContext(*m_context);
@@ -89,7 +114,7 @@ namespace AZ::IO
             SetupEnvironment(1, 1);
         }
 
-        void MockReadCalls(ReadResult mockResult)
+        void MockReadCalls(ReadResult mockResult, const ::testing::Cardinality& numReads = ::testing::Exactly(1))
         {
             using ::testing::_;
             using ::testing::AnyNumber;
@@ -98,7 +123,7 @@ namespace AZ::IO
             EXPECT_CALL(*m_mock, ExecuteRequests())
                 .WillOnce(Return(true))
                 .WillRepeatedly(Return(false));
-            EXPECT_CALL(*m_mock, QueueRequest(_));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(numReads);
             EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
 
             switch (mockResult)
@@ -163,7 +188,8 @@ namespace AZ::IO
             return false;
         }
 
-        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult)
+        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult,
+            bool useStreamingDecompressor = false)
         {
             CompressionInfo compressionInfo;
             compressionInfo.m_compressedSize = m_fakeFileLength;
@@ -183,6 +209,18 @@ namespace AZ::IO
                         compressed, compressedSize, uncompressed, uncompressedBufferSize);
                 };
             }
+            if (useStreamingDecompressor)
+            {
+                bool isCorrupted = compressionState == CompressionState::Corrupted;
+                compressionInfo.m_streamingDecompressor = [isCorrupted](const CompressionInfo&) -> AZStd::unique_ptr<StreamingDecompressor>
+                {
+                    if (isCorrupted)
+                    {
+                        return AZStd::make_unique<CorruptedStreamingDecompressor>();
+                    }
+                    return AZStd::make_unique<CopyStreamingDecompressor>();
+                };
+            }
 
             FileRequest* request = m_context->GetNewInternalRequest();
             request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, offset, size);
@@ -293,6 +331,7 @@ namespace AZ::IO
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        static constexpr u32 m_streamingChunkSize{ 64 * 1024 };
     };
 
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
@@ -348,6 +387,37 @@ namespace AZ::IO
         ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, StreamedRead_FullReadAndDecompressData_ReadInChunksAndSuccessfullyReadData)
+    {
+        SetupEnvironment(2, 2, m_streamingChunkSize);
+        MockReadCalls(ReadResult::Success, ::testing::Exactly(aznumeric_cast<int>(m_fakeFileLength / m_streamingChunkSize)));
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, true);
+        VerifyReadBuffer(0, m_fakeFileLength);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, StreamedRead_PartialReadAndDecompressData_StopsReadingAfterEndOfRead)
+    {
+        SetupEnvironment(1, 1, m_streamingChunkSize);
+        // Three chunks are needed, and one more may have been read ahead while the last needed chunk was decompressing.
+        MockReadCalls(ReadResult::Success, ::testing::Between(3, 4));
+        ProcessCompressedRead(256, 2 * m_streamingChunkSize, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, true);
+        VerifyReadBuffer(256, 2 * m_streamingChunkSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, StreamedRead_FailedRead_FailureIsDetectedAndReported)
+    {
+        SetupEnvironment(1, 1, m_streamingChunkSize);
+        MockReadCalls(ReadResult::Failed);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Failed, true);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, StreamedRead_CorruptedArchiveRead_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment(1, 1, m_streamingChunkSize);
+        MockReadCalls(ReadResult::Success, ::testing::Between(1, 2));
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed, true);
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_MultipleRequestsWithSingleJob_AllRequestsComplete)
     {
         SetupEnvironment(4, 1);
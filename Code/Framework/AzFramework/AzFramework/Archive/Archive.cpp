@@ -2020,6 +2020,10 @@ namespace AZ::IO
                     size_t nSizeUncompressed = uncompressedBufferSize;
                     return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize) == 0;
                 };
+                info.m_streamingDecompressor = []([[maybe_unused]] const AZ::IO::CompressionInfo& info)->AZStd::unique_ptr<AZ::IO::StreamingDecompressor>
+                {
+                    return AZStd::make_unique<ZipDir::ZipRawStreamingDecompressor>();
+                };
             }
         }
     }
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/limits.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/IArchive.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -554,6 +555,139 @@ namespace AZ::IO::ZipDir
         return nReturnCode;
     }
 
+    ZipRawStreamingDecompressor::~ZipRawStreamingDecompressor()
+    {
+        if (m_zlibStream)
+        {
+            inflateEnd(m_zlibStream.get());
+        }
+        if (m_zstdStream)
+        {
+            ZSTD_freeDStream(m_zstdStream);
+        }
+        if (m_lz4Context)
+        {
+            LZ4F_freeDecompressionContext(m_lz4Context);
+        }
+    }
+
+    bool ZipRawStreamingDecompressor::Initialize(const void* compressed, size_t compressedSize)
+    {
+        //check first 4 bytes to see what compression codec was used
+        if (compressedSize >= sizeof(uint32_t) && CompressionCodec::TestForZSTDMagic(compressed))
+        {
+            m_codec = Codec::Zstd;
+            m_zstdStream = ZSTD_createDStream();
+            if (!m_zstdStream)
+            {
+                AZ_Error("ZipDirStructures", false, "Error creating zstd decompression stream.");
+                return false;
+            }
+            return true;
+        }
+        else if (compressedSize >= sizeof(uint32_t) && CompressionCodec::TestForLZ4Magic(compressed))
+        {
+            m_codec = Codec::Lz4;
+            size_t result = LZ4F_createDecompressionContext(&m_lz4Context, LZ4F_VERSION);
+            if (LZ4F_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error creating lz4 decompression context: %s", LZ4F_getErrorName(result));
+                m_lz4Context = nullptr;
+                return false;
+            }
+            return true;
+        }
+
+        //fallback to zlib
+        m_codec = Codec::Zlib;
+        m_zlibStream = AZStd::make_unique<z_stream>();
+        m_zlibStream->zalloc = &ZipDirStructuresInternal::ZlibAlloc;
+        m_zlibStream->zfree = &ZipDirStructuresInternal::ZlibFree;
+        m_zlibStream->opaque = &AZ::AllocatorInstance<AZ::OSAllocator>::Get();
+        if (inflateInit2(m_zlibStream.get(), -MAX_WBITS) != Z_OK)
+        {
+            m_zlibStream.reset();
+            return false;
+        }
+        return true;
+    }
+
+    bool ZipRawStreamingDecompressor::Decompress(const void* compressed, size_t compressedSize, size_t& compressedConsumed,
+        void* uncompressed, size_t uncompressedSize, size_t& uncompressedWritten)
+    {
+        compressedConsumed = 0;
+        uncompressedWritten = 0;
+
+        if (m_codec == Codec::Unknown)
+        {
+            if (compressedSize == 0)
+            {
+                return true;
+            }
+            if (!Initialize(compressed, compressedSize))
+            {
+                return false;
+            }
+        }
+
+        switch (m_codec)
+        {
+        case Codec::Zstd:
+        {
+            ZSTD_inBuffer input{ compressed, compressedSize, 0 };
+            ZSTD_outBuffer output{ uncompressed, uncompressedSize, 0 };
+            size_t result = ZSTD_decompressStream(m_zstdStream, &output, &input);
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error decompressing using zstd: %s", ZSTD_getErrorName(result));
+                return false;
+            }
+            compressedConsumed = input.pos;
+            uncompressedWritten = output.pos;
+            return true;
+        }
+        case Codec::Lz4:
+        {
+            size_t dstSize = uncompressedSize;
+            size_t srcSize = compressedSize;
+            size_t result = LZ4F_decompress(m_lz4Context, uncompressed, &dstSize, compressed, &srcSize, nullptr);
+            if (LZ4F_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error decompressing using lz4: %s", LZ4F_getErrorName(result));
+                return false;
+            }
+            compressedConsumed = srcSize;
+            uncompressedWritten = dstSize;
+            return true;
+        }
+        case Codec::Zlib:
+        {
+            if (m_isFinished)
+            {
+                // Anything after the end of the deflate stream isn't part of the file.
+                return true;
+            }
+
+            // zlib counts in 32 bits, so larger buffers are processed over multiple calls.
+            uInt inputSize = aznumeric_cast<uInt>(AZStd::min<size_t>(compressedSize, AZStd::numeric_limits<uInt>::max()));
+            uInt outputSize = aznumeric_cast<uInt>(AZStd::min<size_t>(uncompressedSize, AZStd::numeric_limits<uInt>::max()));
+            m_zlibStream->next_in = const_cast<Bytef*>(static_cast<const Bytef*>(compressed));
+            m_zlibStream->avail_in = inputSize;
+            m_zlibStream->next_out = static_cast<Bytef*>(uncompressed);
+            m_zlibStream->avail_out = outputSize;
+
+            int result = inflate(m_zlibStream.get(), Z_NO_FLUSH);
+            compressedConsumed = inputSize - m_zlibStream->avail_in;
+            uncompressedWritten = outputSize - m_zlibStream->avail_out;
+            m_isFinished = result == Z_STREAM_END;
+            // Z_BUF_ERROR only indicates that no progress could be made with the provided buffers.
+            return result == Z_OK || result == Z_STREAM_END || result == Z_BUF_ERROR;
+        }
+        default:
+            return false;
+        }
+    }
+
     // compresses the raw data into raw data. The buffer for compressed data itself with the heap passed. Uses method 8 (deflate)
     // returns one of the Z_* errors (Z_OK upon success)
     int ZipRawCompress(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel)
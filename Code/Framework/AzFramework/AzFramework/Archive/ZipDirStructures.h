@@ -13,9 +13,12 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
 #if AZ_TRAIT_USE_WINDOWS_FILE_API && AZ_TRAIT_OS_IS_HOST_OS_PLATFORM
@@ -24,6 +27,8 @@
 
 
 struct z_stream_s;
+struct ZSTD_DCtx_s;
+struct LZ4F_dctx_s;
 
 namespace AZ::IO
 {
@@ -147,6 +152,38 @@ namespace AZ::IO::ZipDir
     // returns one of the Z_* errors (Z_OK upon success)
     int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize);
 
+    // Uncompresses raw data in the Zip file in consecutive chunks, so a file can be decompressed while it's being read.
+    // The compression codec is detected from the start of the data the same way ZipRawUncompress does.
+    class ZipRawStreamingDecompressor
+        : public AZ::IO::StreamingDecompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZipRawStreamingDecompressor, AZ::SystemAllocator);
+
+        ZipRawStreamingDecompressor() = default;
+        ~ZipRawStreamingDecompressor() override;
+
+        bool Decompress(const void* compressed, size_t compressedSize, size_t& compressedConsumed,
+            void* uncompressed, size_t uncompressedSize, size_t& uncompressedWritten) override;
+
+    private:
+        enum class Codec : uint8_t
+        {
+            Unknown,
+            Zlib,
+            Zstd,
+            Lz4
+        };
+
+        bool Initialize(const void* compressed, size_t compressedSize);
+
+        AZStd::unique_ptr<z_stream_s> m_zlibStream;
+        ZSTD_DCtx_s* m_zstdStream = nullptr;
+        LZ4F_dctx_s* m_lz4Context = nullptr;
+        Codec m_codec = Codec::Unknown;
+        bool m_isFinished = false;
+    };
+
     // compresses the raw data into raw data. The buffer for compressed data itself with the heap passed. Uses method 8 (deflate)
     // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
     int ZipRawCompress(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
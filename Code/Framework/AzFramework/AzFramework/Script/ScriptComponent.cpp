@@ -431,6 +431,92 @@ namespace AzFramework
             LSV_END_VARIABLE(-2);
             return 0;
         }
+
+        //=========================================================================
+        // IsInstancedSubtableKey
+        // Subtables are copied per instance, except for metatables and the property table (handled \ref CreatePropertyGroup)
+        //=========================================================================
+        static bool IsInstancedSubtableKey(lua_State* lua, int keyIndex, int propertyTableNameIndex)
+        {
+            switch (lua_type(lua, keyIndex))
+            {
+            case LUA_TSTRING:
+            {
+                const char* tableName = lua_tostring(lua, keyIndex);
+                return strncmp(tableName, "__", 2) != 0 && !lua_rawequal(lua, keyIndex, propertyTableNameIndex);
+            }
+            case LUA_TNUMBER:
+                return true;
+            default:
+                AZ_Warning("Script", false, "Tables associated with non string/number keys are not copied, thus are shared by all instances.");
+                return false;
+            }
+        }
+
+        static void HookSourceTable(lua_State* lua, int sourceTable, int propertyTableNameIndex);
+
+        //=========================================================================
+        // Prototype__Index
+        // Reads through to the source table (upvalue 1). The first time a subtable of the source is read, an instance
+        // subtable is created in its place, so that modifications are isolated to the instance (copy on write of the
+        // subtables, which are only paid for by instances that use them).
+        // Like the script table is for the entity table, the source subtable is the metatable of the instance subtable,
+        // so any metamethods it defines (__tostring, __eq, __call...) apply to the instance subtable as well.
+        // NOTE: Until it's first read, a subtable isn't in the instance table, so rawget and pairs on the instance table
+        // don't see it. Values that aren't tables were never copied into the instance table.
+        //=========================================================================
+        static int Prototype__Index(lua_State* lua)
+        {
+            LSV_BEGIN(lua, 1);
+
+            // Stack: instanceTable key
+            lua_pushvalue(lua, 2);
+            lua_gettable(lua, lua_upvalueindex(1)); // Stack: instanceTable key sourceValue
+
+            if (lua_istable(lua, -1) && IsInstancedSubtableKey(lua, 2, lua_upvalueindex(2)))
+            {
+                const int sourceSubtable = lua_gettop(lua);
+                HookSourceTable(lua, sourceSubtable, lua_upvalueindex(2));
+
+                lua_createtable(lua, 0, 0); // Stack: instanceTable key sourceSubtable instanceSubtable
+                lua_pushvalue(lua, sourceSubtable);
+                lua_setmetatable(lua, -2);  // setmetatable(instanceSubtable, sourceSubtable)
+
+                lua_pushvalue(lua, 2);
+                lua_pushvalue(lua, -2);
+                lua_rawset(lua, 1);         // instanceTable[key] = instanceSubtable
+
+                lua_remove(lua, -2);        // Stack: instanceTable key instanceSubtable
+            }
+
+            return 1;
+        }
+
+        //=========================================================================
+        // HookSourceTable
+        // Prepares a table to be used as the metatable of its instance copies, by pointing its __index to itself through
+        // Prototype__Index. The table is shared by all instances, so this is only done the first time.
+        //=========================================================================
+        static void HookSourceTable(lua_State* lua, int sourceTable, int propertyTableNameIndex)
+        {
+            LSV_BEGIN(lua, 0);
+            sourceTable = lua_absindex(lua, sourceTable);
+            propertyTableNameIndex = lua_absindex(lua, propertyTableNameIndex);
+
+            lua_pushliteral(lua, "__index");
+            lua_rawget(lua, sourceTable);
+            const bool isHooked = lua_tocfunction(lua, -1) == &Prototype__Index;
+            lua_pop(lua, 1);
+
+            if (!isHooked)
+            {
+                lua_pushliteral(lua, "__index");
+                lua_pushvalue(lua, sourceTable);
+                lua_pushvalue(lua, propertyTableNameIndex);
+                lua_pushcclosure(lua, &Prototype__Index, 2);
+                lua_rawset(lua, sourceTable);   // sourceTable.__index = Prototype__Index(sourceTable)
+            }
+        }
     } // namespace Internal
 
     // The code will create a table with uniqueEntityName which has
@@ -616,104 +702,47 @@ namespace AzFramework
             return false;
         }
 
-        // Point the __index of the Script table to itself
-        // because it will be used as a metatable
+        // The script table is loaded once per context and shared by all instances, only hook it the first time
         // Stack = ScriptRootTable
-        lua_pushliteral(lua, "__index");  // Stack = ScriptRootTable __index
-        lua_pushvalue(lua, -2);  // Stack = ScriptRootTable __index CopyOfScriptRootTable
-
-        // raw set: t[k] = v, where t is the value at the given index, v is the value at the top of the stack, and k is the value just below the top.  Both key and value are popped off the stack.
-        // ie: ScriptRootTable[__index] = CopyOfScriptRootTable
-        // Since __index value is a table and not a function, the final result is the result of indexing this table with key. However, this indexing is regular, not raw, and therefore can trigger another metamethod.
-        lua_rawset(lua, -3);  // Stack = ScriptRootTable
-
-        // load Property table name
-        lua_pushlstring(lua, m_properties.m_name.c_str(), m_properties.m_name.length());  // Stack = ScriptRootTable "Properties"
-        lua_rawget(lua, -2);  // Stack = ScriptRootTable ThisScriptPropertiesTable
-        if (lua_istable(lua, -1))
-        {
-            // This property table will be used a metatable from all instances
-            // set the __index so we can read values in case we change the script
-            // after we export the component
-            lua_pushliteral(lua, "__index");
-            lua_pushcclosure(lua, &Internal::Properties__Index, 0);
-            lua_rawset(lua, -3);
-
-            lua_pushliteral(lua, "__newindex");
-            lua_pushcclosure(lua, &Internal::Properties__NewIndex, 0);
-            lua_rawset(lua, -3);
-        }
-        lua_pop(lua, 1); // pop the properties table (or the nil value)
-        // Leave the script table on the stack for CreateEntityTable().
-
-        return true;
-    }
-
-    //=========================================================================
-    // CopyEntityTables
-    // Mirror source entity's subtables (excluding property table, which is handled \ref CreatePropertyGroup)
-    // The goal is to ensure that if we modify any table, modifications are isolated to the instance (not the global/shared entity table)
-    // In addition set to entity tables as a metatable so cloned tables for read-only operations.
-    //=========================================================================
-    void CopyAndHookEntityTables(lua_State* lua, int sourceTable, int targetTable, const char* propertyTableName)
-    {
-        LSV_BEGIN(lua, 0);
+        lua_pushliteral(lua, "__index");
+        lua_rawget(lua, -2);
+        const bool isScriptTableHooked = lua_tocfunction(lua, -1) == &Internal::Prototype__Index;
+        lua_pop(lua, 1);
 
-        lua_pushnil(lua); // first key
-        while (lua_next(lua, sourceTable))
+        if (!isScriptTableHooked)
         {
+            // The script table will be used as the metatable of entity tables, point its __index to the script table,
+            // through Internal::Prototype__Index which gives each entity table its own copy of the subtables it reads
+            lua_pushliteral(lua, "__index");  // Stack = ScriptRootTable __index
+            lua_pushvalue(lua, -2);  // Stack = ScriptRootTable __index CopyOfScriptRootTable
+            lua_pushlstring(lua, m_properties.m_name.c_str(), m_properties.m_name.length());  // Stack = ScriptRootTable __index CopyOfScriptRootTable "Properties"
+            lua_pushcclosure(lua, &Internal::Prototype__Index, 2);  // Stack = ScriptRootTable __index Prototype__Index
+
+            // raw set: t[k] = v, where t is the value at the given index, v is the value at the top of the stack, and k is the value just below the top.  Both key and value are popped off the stack.
+            // ie: ScriptRootTable[__index] = Prototype__Index
+            lua_rawset(lua, -3);  // Stack = ScriptRootTable
+
+            // load Property table name
+            lua_pushlstring(lua, m_properties.m_name.c_str(), m_properties.m_name.length());  // Stack = ScriptRootTable "Properties"
+            lua_rawget(lua, -2);  // Stack = ScriptRootTable ThisScriptPropertiesTable
             if (lua_istable(lua, -1))
             {
-                int keyType = lua_type(lua, -2);
-                switch (keyType)
-                {
-                    case LUA_TSTRING:
-                    {
-                        const char* tableName = lua_tolstring(lua, -2, nullptr);
-                        if (strncmp(tableName, "__", 2) == 0 || // skip metatables
-                            strcmp(tableName, propertyTableName) == 0) // Skip the Properties table
-                        {
-                            break;
-                        }
-                        // else fall through
-                    }
-
-                    case LUA_TNUMBER:
-                    {
-                        // stack: source subtable, source key
-
-                        // Create the target subtable.
-                        lua_createtable(lua, 0, 0);
-                        lua_pushvalue(lua, -3);             // push source subtable key
-                        lua_pushvalue(lua, -2);             // push new subtable instance
-                        lua_rawset(lua, targetTable);       // targetTable.subtableKey = newSubTable
-
-                        // The source subtable will be used as a metatable, so set its __index to itself.
-                        lua_pushliteral(lua, "__index");    // push __index key
-                        lua_pushvalue(lua, -3);             // push the source subtable
-                        lua_rawset(lua, -1);                // sourceSubtable.__index = sourceSubtable;
-
-                        // Set the target subtable's metatable to the source subtable.
-                        lua_pushvalue(lua, -2);             // push the source subtable
-                        lua_setmetatable(lua, -2);          // setmetatable(targetSubtable, sourceSubtable)
-
-                        int newTarget = lua_gettop(lua);
-                        int newSource = newTarget - 1;
-                        CopyAndHookEntityTables(lua, newSource, newTarget, propertyTableName);
-
-                        lua_pop(lua, 1); // pop the new table
-                    } break;
+                // This property table will be used a metatable from all instances
+                // set the __index so we can read values in case we change the script
+                // after we export the component
+                lua_pushliteral(lua, "__index");
+                lua_pushcclosure(lua, &Internal::Properties__Index, 0);
+                lua_rawset(lua, -3);
 
-                    default:
-                    {
-                        AZ_Warning("Script", false, "Tables associated with non string/number keys are not copied, thus will be lost in new instances.");
-                    } break;
-                }
+                lua_pushliteral(lua, "__newindex");
+                lua_pushcclosure(lua, &Internal::Properties__NewIndex, 0);
+                lua_rawset(lua, -3);
             }
-
-            lua_pop(lua, 1); // pop the value
-            // leave the key for next iteration
+            lua_pop(lua, 1); // pop the properties table (or the nil value)
         }
+        // Leave the script table on the stack for CreateEntityTable().
+
+        return true;
     }
 
     //=========================================================================
@@ -749,8 +778,7 @@ namespace AzFramework
             // Stack: ScriptRootTable PropertiesTable EntityTable{ PropertiesTable{__index __newIndex Meta{CopyOfPropertiesTable}} }
         }
 
-        // replicate other tables to make sure we have table per instance.
-        CopyAndHookEntityTables(lua, baseStackIndex, lua_gettop(lua), m_properties.m_name.c_str());
+        // other subtables are copied into the entity table when they are first read, by the __index of the script table
 
         // set my entity id
         lua_pushliteral(lua, "entityId"); // Stack: ScriptRootTable PropertiesTable EntityTable{ PropertiesTable{__index __newIndex Meta{CopyOfPropertiesTable}} } "entityId"
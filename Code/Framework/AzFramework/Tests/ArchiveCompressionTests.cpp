@@ -17,6 +17,7 @@
 #include <AzFramework/Archive/ArchiveFileIO.h>
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 
 namespace UnitTest
 {
@@ -445,4 +446,169 @@ namespace UnitTest
             std::tuple(AZ::IO::INestedArchive::FLAGS_READ_ONLY, AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_BEST, 1111, 10, 1),
             std::tuple(static_cast<AZ::IO::INestedArchive::EPakFlags>(0), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_BEST, 1111, 10, 1)
         ));
+
+    // Compresses a buffer the same way the zip archive compresses its entries. Returns Z_OK (0) on success.
+    using ZipRawCompressFunction = int (*)(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+
+    struct StreamingDecompressionCodec
+    {
+        const char* m_name;
+        ZipRawCompressFunction m_compress;
+        // Offset of a header byte which makes the entry invalid when it's overwritten with 0xFF.
+        size_t m_corruptOffset;
+    };
+
+    class ZipRawStreamingDecompressorTestFixture
+        : public LeakDetectionFixture
+        , public ::testing::WithParamInterface<AZStd::tuple<StreamingDecompressionCodec, size_t, size_t>>
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            // Compressible, but not so repetitive that the whole file fits in a handful of compressed bytes.
+            m_uncompressed.reserve(256 * 1024);
+            for (size_t index = 0; m_uncompressed.size() < 256 * 1024; ++index)
+            {
+                const AZStd::string line = AZStd::string::format("line %zu of the streaming decompression test: %zu\n", index, (index * 2654435761u) % 1000);
+                m_uncompressed.insert(m_uncompressed.end(), line.begin(), line.end());
+            }
+
+            const StreamingDecompressionCodec& codec = AZStd::get<0>(GetParam());
+            size_t compressedSize = m_uncompressed.size() * 2 + 1024;
+            m_compressed.resize_no_construct(compressedSize);
+            ASSERT_EQ(0, codec.m_compress(m_uncompressed.data(), &compressedSize, m_compressed.data(), m_uncompressed.size(), 6));
+            m_compressed.resize(compressedSize);
+        }
+
+        // Feeds the compressed data to the decompressor in chunks of chunkSize, the way the streamer hands over each read as it
+        // lands, and collects the output in blocks of at most outputBlockSize. Returns false if the decompressor reported an error.
+        static bool StreamDecompress(AZStd::span<const uint8_t> compressed, size_t chunkSize, size_t outputBlockSize,
+            size_t uncompressedSize, AZStd::vector<uint8_t>& output)
+        {
+            AZ::IO::ZipDir::ZipRawStreamingDecompressor decompressor;
+            output.clear();
+
+            auto decompressStep = [&](const uint8_t* input, size_t inputSize, size_t& consumed, size_t& written)
+            {
+                const size_t outputOffset = output.size();
+                const size_t outputSize = AZStd::min(outputBlockSize, uncompressedSize - outputOffset);
+                output.resize(outputOffset + outputSize);
+                const bool result = decompressor.Decompress(input, inputSize, consumed, output.data() + outputOffset, outputSize, written);
+                output.resize(outputOffset + (result ? written : 0));
+                return result;
+            };
+
+            size_t offset = 0;
+            while (offset < compressed.size() && output.size() < uncompressedSize)
+            {
+                const size_t chunkEnd = AZStd::min(offset + chunkSize, compressed.size());
+                while (offset < chunkEnd && output.size() < uncompressedSize)
+                {
+                    size_t consumed = 0;
+                    size_t written = 0;
+                    if (!decompressStep(compressed.data() + offset, chunkEnd - offset, consumed, written))
+                    {
+                        return false;
+                    }
+                    if (consumed == 0 && written == 0)
+                    {
+                        // The decompressor can't make any progress with the data it has, e.g. past the end of the stream.
+                        return true;
+                    }
+                    offset += consumed;
+                }
+            }
+
+            // Codecs can hold back output until more is asked for, even once all the input has been consumed.
+            while (output.size() < uncompressedSize)
+            {
+                size_t consumed = 0;
+                size_t written = 0;
+                if (!decompressStep(compressed.data() + compressed.size(), 0, consumed, written))
+                {
+                    return false;
+                }
+                if (written == 0)
+                {
+                    break;
+                }
+            }
+            return true;
+        }
+
+        AZStd::vector<uint8_t> m_uncompressed;
+        AZStd::vector<uint8_t> m_compressed;
+    };
+
+    TEST_P(ZipRawStreamingDecompressorTestFixture, Decompress_ChunkedEntry_MatchesOriginalData)
+    {
+        const size_t chunkSize = AZStd::get<1>(GetParam());
+        const size_t outputBlockSize = AZStd::get<2>(GetParam());
+
+        AZStd::vector<uint8_t> output;
+        ASSERT_TRUE(StreamDecompress(m_compressed, chunkSize, outputBlockSize, m_uncompressed.size(), output));
+        ASSERT_EQ(m_uncompressed.size(), output.size());
+        EXPECT_TRUE(m_uncompressed == output);
+    }
+
+    TEST_P(ZipRawStreamingDecompressorTestFixture, Decompress_TruncatedEntry_DoesNotProduceAllData)
+    {
+        const size_t chunkSize = AZStd::get<1>(GetParam());
+        const size_t outputBlockSize = AZStd::get<2>(GetParam());
+
+        AZStd::span<const uint8_t> truncated(m_compressed.data(), m_compressed.size() / 2);
+        AZStd::vector<uint8_t> output;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        const bool result = StreamDecompress(truncated, chunkSize, outputBlockSize, m_uncompressed.size(), output);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+        // Either the decompressor reports the error, or it runs out of data before the end of the file, which the caller detects.
+        if (result)
+        {
+            EXPECT_LT(output.size(), m_uncompressed.size());
+        }
+        // Whatever was produced must still be correct.
+        EXPECT_TRUE(AZStd::equal(output.begin(), output.end(), m_uncompressed.begin()));
+    }
+
+    TEST_P(ZipRawStreamingDecompressorTestFixture, Decompress_CorruptEntry_ReportsError)
+    {
+        const StreamingDecompressionCodec& codec = AZStd::get<0>(GetParam());
+        const size_t chunkSize = AZStd::get<1>(GetParam());
+        const size_t outputBlockSize = AZStd::get<2>(GetParam());
+
+        ASSERT_LT(codec.m_corruptOffset, m_compressed.size());
+        m_compressed[codec.m_corruptOffset] = 0xFF;
+
+        AZStd::vector<uint8_t> output;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        const bool result = StreamDecompress(m_compressed, chunkSize, outputBlockSize, m_uncompressed.size(), output);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_FALSE(result);
+    }
+
+    // Overwriting these bytes with 0xFF gives an invalid deflate block type, a zstd frame header with its reserved bit set,
+    // and an lz4 frame with an unsupported version.
+    static const StreamingDecompressionCodec s_streamingDecompressionCodecs[] = {
+        { "Zlib", &AZ::IO::ZipDir::ZipRawCompress, 0 },
+        { "Zstd", &AZ::IO::ZipDir::ZipRawCompressZSTD, 4 },
+        { "Lz4", &AZ::IO::ZipDir::ZipRawCompressLZ4, 4 }
+    };
+
+    INSTANTIATE_TEST_CASE_P(
+        ZipRawStreamingDecompressor,
+        ZipRawStreamingDecompressorTestFixture,
+        ::testing::Combine(
+            ::testing::ValuesIn(s_streamingDecompressionCodecs),
+            // Chunk sizes, from single bytes to the whole entry at once.
+            ::testing::Values(size_t{ 1 }, size_t{ 4093 }, size_t{ 64 * 1024 }, size_t{ 16 * 1024 * 1024 }),
+            // Output block sizes, smaller and larger than a codec's internal block.
+            ::testing::Values(size_t{ 1000 }, size_t{ 1024 * 1024 })),
+        [](const ::testing::TestParamInfo<ZipRawStreamingDecompressorTestFixture::ParamType>& info) -> std::string
+        {
+            return AZStd::string::format("%s_Chunk%zu_Output%zu", AZStd::get<0>(info.param).m_name,
+                AZStd::get<1>(info.param), AZStd::get<2>(info.param)).c_str();
+        });
 }
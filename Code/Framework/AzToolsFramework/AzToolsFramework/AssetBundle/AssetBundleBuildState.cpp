@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzFramework/StringFunc/StringFunc.h>
+#include <AzToolsFramework/Asset/AssetBundler.h>
+#include <AzToolsFramework/Asset/AssetSeedManager.h>
+#include <AzToolsFramework/AssetBundle/AssetBundleBuildState.h>
+
+namespace AzToolsFramework
+{
+    namespace
+    {
+        const char* LogWindowName = "AssetBundle";
+
+        constexpr const char* PlatformMember = "platform";
+        constexpr const char* BundleVersionMember = "bundleVersion";
+        constexpr const char* MaxBundleSizeMember = "maxBundleSizeInMB";
+        constexpr const char* LevelDirsMember = "levelDirs";
+        constexpr const char* BundlesMember = "bundles";
+        constexpr const char* FilesMember = "files";
+        constexpr const char* PathMember = "path";
+        constexpr const char* AssetIdMember = "assetId";
+        constexpr const char* SizeMember = "size";
+        constexpr const char* ModificationTimeMember = "modificationTime";
+        constexpr const char* HashMember = "hash";
+
+        bool HasSameSettings(const AssetBundleBuildState& lhs, const AssetBundleBuildState& rhs)
+        {
+            return lhs.m_platform == rhs.m_platform && lhs.m_bundleVersion == rhs.m_bundleVersion
+                && lhs.m_maxBundleSizeInMB == rhs.m_maxBundleSizeInMB && lhs.m_levelDirs == rhs.m_levelDirs;
+        }
+
+        bool IsSameFile(const AssetBundleBuildState::FileState& lhs, const AssetBundleBuildState::FileState& rhs)
+        {
+            return lhs.m_hash == rhs.m_hash && lhs.m_assetId == rhs.m_assetId;
+        }
+
+        bool ReadStrings(const rapidjson::Value& value, AZStd::vector<AZStd::string>& outStrings)
+        {
+            for (const rapidjson::Value& element : value.GetArray())
+            {
+                if (!element.IsString())
+                {
+                    return false;
+                }
+                outStrings.emplace_back(element.GetString());
+            }
+            return true;
+        }
+
+        rapidjson::Value WriteStrings(const AZStd::vector<AZStd::string>& strings, rapidjson::Document::AllocatorType& allocator)
+        {
+            rapidjson::Value value(rapidjson::kArrayType);
+            for (const AZStd::string& string : strings)
+            {
+                value.PushBack(rapidjson::Value(string.c_str(), allocator), allocator);
+            }
+            return value;
+        }
+
+        bool ReadBuildState(const rapidjson::Document& document, AssetBundleBuildState& outBuildState)
+        {
+            if (!document.IsObject() || !document.HasMember(PlatformMember) || !document[PlatformMember].IsString()
+                || !document.HasMember(BundleVersionMember) || !document[BundleVersionMember].IsInt()
+                || !document.HasMember(MaxBundleSizeMember) || !document[MaxBundleSizeMember].IsUint64()
+                || !document.HasMember(LevelDirsMember) || !document[LevelDirsMember].IsArray()
+                || !document.HasMember(BundlesMember) || !document[BundlesMember].IsArray()
+                || !document.HasMember(FilesMember) || !document[FilesMember].IsArray())
+            {
+                return false;
+            }
+
+            outBuildState.m_platform = document[PlatformMember].GetString();
+            outBuildState.m_bundleVersion = document[BundleVersionMember].GetInt();
+            outBuildState.m_maxBundleSizeInMB = document[MaxBundleSizeMember].GetUint64();
+
+            if (!ReadStrings(document[LevelDirsMember], outBuildState.m_levelDirs)
+                || !ReadStrings(document[BundlesMember], outBuildState.m_bundleNames))
+            {
+                return false;
+            }
+
+            for (const rapidjson::Value& file : document[FilesMember].GetArray())
+            {
+                if (!file.IsObject() || !file.HasMember(PathMember) || !file[PathMember].IsString()
+                    || !file.HasMember(AssetIdMember) || !file[AssetIdMember].IsString()
+                    || !file.HasMember(SizeMember) || !file[SizeMember].IsUint64()
+                    || !file.HasMember(ModificationTimeMember) || !file[ModificationTimeMember].IsUint64()
+                    || !file.HasMember(HashMember) || !file[HashMember].IsString())
+                {
+                    return false;
+                }
+                outBuildState.m_files.push_back({ file[PathMember].GetString(), AZ::Data::AssetId::CreateString(file[AssetIdMember].GetString()),
+                    file[SizeMember].GetUint64(), file[ModificationTimeMember].GetUint64(), file[HashMember].GetString() });
+            }
+            return true;
+        }
+    } // namespace
+
+    bool AssetBundleBuildState::HasSameInputs(const AssetBundleBuildState& other) const
+    {
+        if (!HasSameSettings(*this, other) || m_files.size() != other.m_files.size())
+        {
+            return false;
+        }
+
+        // the order matters too, since it decides which files go in which rollover bundle.
+        for (size_t idx = 0; idx < m_files.size(); ++idx)
+        {
+            if (m_files[idx].m_path != other.m_files[idx].m_path || !IsSameFile(m_files[idx], other.m_files[idx]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool AssetBundleBuildState::Load(const AZStd::string& filePath)
+    {
+        *this = {};
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(filePath);
+        if (!readResult.IsSuccess())
+        {
+            return false;
+        }
+
+        // read into a separate build state, so that a file that is only partly valid doesn't leave stale hashes behind.
+        AssetBundleBuildState buildState;
+        if (!ReadBuildState(readResult.GetValue(), buildState))
+        {
+            return false;
+        }
+
+        *this = AZStd::move(buildState);
+        return true;
+    }
+
+    bool AssetBundleBuildState::Save(const AZStd::string& filePath) const
+    {
+        rapidjson::Document document(rapidjson::kObjectType);
+        auto& allocator = document.GetAllocator();
+
+        rapidjson::Value files(rapidjson::kArrayType);
+        for (const FileState& fileState : m_files)
+        {
+            rapidjson::Value file(rapidjson::kObjectType);
+            file.AddMember(rapidjson::StringRef(PathMember), rapidjson::Value(fileState.m_path.c_str(), allocator), allocator);
+            file.AddMember(rapidjson::StringRef(AssetIdMember),
+                rapidjson::Value(fileState.m_assetId.ToString<AZStd::string>().c_str(), allocator), allocator);
+            file.AddMember(rapidjson::StringRef(SizeMember), rapidjson::Value(fileState.m_size), allocator);
+            file.AddMember(rapidjson::StringRef(ModificationTimeMember), rapidjson::Value(fileState.m_modificationTime), allocator);
+            file.AddMember(rapidjson::StringRef(HashMember), rapidjson::Value(fileState.m_hash.c_str(), allocator), allocator);
+            files.PushBack(file, allocator);
+        }
+
+        document.AddMember(rapidjson::StringRef(PlatformMember), rapidjson::Value(m_platform.c_str(), allocator), allocator);
+        document.AddMember(rapidjson::StringRef(BundleVersionMember), rapidjson::Value(m_bundleVersion), allocator);
+        document.AddMember(rapidjson::StringRef(MaxBundleSizeMember), rapidjson::Value(m_maxBundleSizeInMB), allocator);
+        document.AddMember(rapidjson::StringRef(LevelDirsMember), WriteStrings(m_levelDirs, allocator), allocator);
+        document.AddMember(rapidjson::StringRef(BundlesMember), WriteStrings(m_bundleNames, allocator), allocator);
+        document.AddMember(rapidjson::StringRef(FilesMember), files, allocator);
+
+        return AZ::JsonSerializationUtils::WriteJsonFile(document, filePath).IsSuccess();
+    }
+
+    AZStd::string ComputeAssetBundleFileHash(const AZStd::string& filePath)
+    {
+        AZ::IO::FileIOStream fileStream;
+        if (!fileStream.Open(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary))
+        {
+            return {};
+        }
+
+        AZ::Sha1 hash;
+        constexpr AZ::IO::SizeType ReadBlockSize = 1024 * 1024;
+        AZStd::vector<uint8_t> buffer;
+        buffer.resize_no_construct(ReadBlockSize);
+        AZ::IO::SizeType bytesRemaining = fileStream.GetLength();
+        while (bytesRemaining > 0)
+        {
+            const AZ::IO::SizeType bytesToRead = AZStd::min(bytesRemaining, ReadBlockSize);
+            if (fileStream.Read(bytesToRead, buffer.data()) != bytesToRead)
+            {
+                return {};
+            }
+            hash.ProcessBytes(reinterpret_cast<const AZStd::byte*>(buffer.data()), bytesToRead);
+            bytesRemaining -= bytesToRead;
+        }
+
+        AZ::u32 digest[5] = { 0 };
+        hash.GetDigest(digest);
+        return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
+    bool MakeAssetBundleBuildState(const AssetBundleSettings& assetBundleSettings, const AssetFileInfoList& assetFileInfoList,
+        const AZStd::vector<AZ::IO::Path>& levelDirs, const AZStd::string& assetAlias, const AssetBundleBuildState& previousBuildState,
+        AssetBundleBuildState& outBuildState)
+    {
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+
+        AZStd::unordered_map<AZStd::string, const AssetBundleBuildState::FileState*> previousFiles;
+        for (const AssetBundleBuildState::FileState& fileState : previousBuildState.m_files)
+        {
+            previousFiles[fileState.m_path] = &fileState;
+        }
+
+        outBuildState.m_platform = assetBundleSettings.m_platform;
+        outBuildState.m_bundleVersion = assetBundleSettings.m_bundleVersion;
+        outBuildState.m_maxBundleSizeInMB = assetBundleSettings.m_maxBundleSizeInMB;
+        for (const AZ::IO::Path& levelDir : levelDirs)
+        {
+            outBuildState.m_levelDirs.push_back(levelDir.Native());
+        }
+        outBuildState.m_files.reserve(assetFileInfoList.m_fileInfoList.size());
+
+        for (const AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        {
+            AZStd::string fullAssetFilePath;
+            AzFramework::StringFunc::Path::Join(assetAlias.c_str(), assetFileInfo.m_assetRelativePath.c_str(), fullAssetFilePath);
+
+            AssetBundleBuildState::FileState fileState;
+            fileState.m_path = assetFileInfo.m_assetRelativePath;
+            fileState.m_assetId = assetFileInfo.m_assetId;
+            fileState.m_modificationTime = fileIO->ModificationTime(fullAssetFilePath.c_str());
+            if (!fileIO->Size(fullAssetFilePath.c_str(), fileState.m_size))
+            {
+                AZ_Error(LogWindowName, false, "Unable to find size of file (%s).\n", fullAssetFilePath.c_str());
+                return false;
+            }
+
+            // The hash recorded in the asset list isn't used, since it describes the file as it was when the list was generated,
+            // while the bundle gets the file as it is now. The modification time in the list can't tell the two apart,
+            // because it is read from the relative path of the file rather than from the file in the cache.
+            auto previousFile = previousFiles.find(fileState.m_path);
+            if (previousFile != previousFiles.end() && previousFile->second->m_size == fileState.m_size
+                && previousFile->second->m_modificationTime == fileState.m_modificationTime && fileState.m_modificationTime != 0)
+            {
+                fileState.m_hash = previousFile->second->m_hash;
+            }
+            else
+            {
+                fileState.m_hash = ComputeAssetBundleFileHash(fullAssetFilePath);
+                if (fileState.m_hash.empty())
+                {
+                    AZ_Error(LogWindowName, false, "Unable to read file (%s).\n", fullAssetFilePath.c_str());
+                    return false;
+                }
+            }
+
+            outBuildState.m_files.push_back(AZStd::move(fileState));
+        }
+        return true;
+    }
+
+    AssetBundleBuildStateChanges GetAssetBundleBuildStateChanges(const AssetBundleBuildState& previousBuildState,
+        const AssetBundleBuildState& buildState)
+    {
+        AssetBundleBuildStateChanges changes;
+        changes.m_settingsChanged = !HasSameSettings(previousBuildState, buildState);
+
+        AZStd::unordered_map<AZStd::string, const AssetBundleBuildState::FileState*> previousFiles;
+        for (const AssetBundleBuildState::FileState& fileState : previousBuildState.m_files)
+        {
+            previousFiles[fileState.m_path] = &fileState;
+        }
+
+        for (const AssetBundleBuildState::FileState& fileState : buildState.m_files)
+        {
+            auto previousFile = previousFiles.find(fileState.m_path);
+            if (previousFile == previousFiles.end())
+            {
+                changes.m_added.push_back(fileState.m_path);
+            }
+            else
+            {
+                if (!IsSameFile(*previousFile->second, fileState))
+                {
+                    changes.m_changed.push_back(fileState.m_path);
+                }
+                previousFiles.erase(previousFile);
+            }
+        }
+
+        // whatever is left over was in the previous build only
+        for (const AssetBundleBuildState::FileState& fileState : previousBuildState.m_files)
+        {
+            if (previousFiles.erase(fileState.m_path) != 0)
+            {
+                changes.m_removed.push_back(fileState.m_path);
+            }
+        }
+        return changes;
+    }
+} // namespace AzToolsFramework
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AzToolsFramework
+{
+    class AssetBundleSettings;
+    class AssetFileInfoList;
+
+    //! What a bundle was built from, saved next to the bundle so that the next build can tell whether anything changed.
+    //! Besides the contents of the files, this covers their asset ids and the level folders, which end up in the delta catalog
+    //! and the manifest of the bundle. The size and modification time of every file are kept along with its hash,
+    //! so that the hash of a file that hasn't been touched since the last build doesn't have to be computed again.
+    struct AssetBundleBuildState
+    {
+        struct FileState
+        {
+            AZStd::string m_path;
+            AZ::Data::AssetId m_assetId;
+            AZ::u64 m_size = 0;
+            AZ::u64 m_modificationTime = 0;
+            AZStd::string m_hash;
+        };
+
+        //! Returns true if a bundle built from other would be the same as one built from this.
+        bool HasSameInputs(const AssetBundleBuildState& other) const;
+
+        //! Reads the build state from a file. Returns false, and leaves this build state empty,
+        //! if the file is missing or isn't a valid build state.
+        bool Load(const AZStd::string& filePath);
+        bool Save(const AZStd::string& filePath) const;
+
+        AZStd::string m_platform;
+        int m_bundleVersion = 0;
+        AZ::u64 m_maxBundleSizeInMB = 0;
+        AZStd::vector<AZStd::string> m_levelDirs; // the level folders listed in the manifest of the parent bundle
+        AZStd::vector<AZStd::string> m_bundleNames; // the parent bundle first, followed by its rollover bundles
+        AZStd::vector<FileState> m_files;
+    };
+
+    //! The differences between two build states of the same bundle.
+    struct AssetBundleBuildStateChanges
+    {
+        bool HasChanges() const
+        {
+            return m_settingsChanged || !m_added.empty() || !m_changed.empty() || !m_removed.empty();
+        }
+
+        AZStd::vector<AZStd::string> m_added;
+        AZStd::vector<AZStd::string> m_changed;
+        AZStd::vector<AZStd::string> m_removed;
+        bool m_settingsChanged = false;
+    };
+
+    //! Returns the SHA1 of the contents of the file as a hex string, or an empty string if it can't be read.
+    AZStd::string ComputeAssetBundleFileHash(const AZStd::string& filePath);
+
+    //! Collects the state of the files that are going into a bundle, relative to assetAlias, along with the level folders
+    //! that go into its manifest. Hashes are taken from the previous build state for files whose size and modification time
+    //! haven't changed.
+    bool MakeAssetBundleBuildState(const AssetBundleSettings& assetBundleSettings, const AssetFileInfoList& assetFileInfoList,
+        const AZStd::vector<AZ::IO::Path>& levelDirs, const AZStd::string& assetAlias, const AssetBundleBuildState& previousBuildState,
+        AssetBundleBuildState& outBuildState);
+
+    //! Returns which files were added to, removed from or changed in a bundle between two of its build states.
+    //! A file counts as changed if either its contents or its asset id changed.
+    AssetBundleBuildStateChanges GetAssetBundleBuildStateChanges(const AssetBundleBuildState& previousBuildState,
+        const AssetBundleBuildState& buildState);
+} // namespace AzToolsFramework
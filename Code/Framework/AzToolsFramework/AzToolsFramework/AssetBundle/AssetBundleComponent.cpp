@@ -18,6 +18,7 @@
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzToolsFramework/AssetBundle/AssetBundleBuildState.h>
 #include <AzToolsFramework/AssetBundle/AssetBundleComponent.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <AzToolsFramework/Asset/AssetSeedManager.h>
@@ -29,6 +30,7 @@ namespace AzToolsFramework
 {
     const char* logWindowName = "AssetBundle";
     const char tempBundleFileSuffix[] = "_temp";
+    const char bundleBuildStateFileSuffix[] = ".buildstate";
     const int NumOfBytesInMB = 1024 * 1024;
     const int ManifestFileSizeBufferInBytes = 10 * 1024; // 10 KB
     const float AssetCatalogFileSizeBufferPercentage = 1.0f;
@@ -88,6 +90,64 @@ namespace AzToolsFramework
         bool m_result = false;
     };
 
+    //! Logs which files were added to, removed from or changed in a bundle since it was last built.
+    //! Returns the folders of the levels in the list, which the manifest of the parent bundle lists.
+    //! Levels saved as prefabs don't have a level.pak, so there is nothing to list for them.
+    AZStd::vector<AZ::IO::Path> GetLevelDirs(const AssetFileInfoList& assetFileInfoList)
+    {
+        AZStd::vector<AZ::IO::Path> levelDirs;
+
+        bool usePrefabSystemForLevels = false;
+        AzFramework::ApplicationRequests::Bus::BroadcastResult(
+            usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
+        if (usePrefabSystemForLevels)
+        {
+            return levelDirs;
+        }
+
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        {
+            if (AzFramework::StringFunc::EndsWith(assetFileInfo.m_assetRelativePath, "level.pak"))
+            {
+                AZStd::string levelFolder;
+                AzFramework::StringFunc::Path::GetFolderPath(assetFileInfo.m_assetRelativePath.c_str(), levelFolder);
+                AzFramework::StringFunc::RelativePath::Normalize(levelFolder);
+                if (AzFramework::StringFunc::LastCharacter(levelFolder.c_str()) == AZ_CORRECT_FILESYSTEM_SEPARATOR)
+                {
+                    AzFramework::StringFunc::RChop(levelFolder, 1);
+                }
+                levelDirs.emplace_back(levelFolder);
+            }
+        }
+        return levelDirs;
+    }
+
+    void ReportBuildStateChanges(const AssetBundleBuildState& previousBuildState, const AssetBundleBuildState& buildState, const AZStd::string& bundleFilePath)
+    {
+        const AssetBundleBuildStateChanges changes = GetAssetBundleBuildStateChanges(previousBuildState, buildState);
+
+        AZStd::string report;
+        for (const AZStd::string& path : changes.m_added)
+        {
+            report += AZStd::string::format("    added   %s\n", path.c_str());
+        }
+        for (const AZStd::string& path : changes.m_changed)
+        {
+            report += AZStd::string::format("    changed %s\n", path.c_str());
+        }
+        for (const AZStd::string& path : changes.m_removed)
+        {
+            report += AZStd::string::format("    removed %s\n", path.c_str());
+        }
+
+        AZ_TracePrintf(logWindowName, "Bundle (%s) changed since it was last built: %zu files added, %zu changed, %zu removed.\n%s",
+            bundleFilePath.c_str(), changes.m_added.size(), changes.m_changed.size(), changes.m_removed.size(), report.c_str());
+        if (changes.m_settingsChanged)
+        {
+            AZ_TracePrintf(logWindowName, "Bundle (%s) settings changed since it was last built.\n", bundleFilePath.c_str());
+        }
+    }
+
     
     void AssetBundleComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -263,7 +323,7 @@ namespace AzToolsFramework
         AZStd::string tempBundleFilePath = bundleFilePath.Native() + "_temp";
 
         AZStd::vector<AZStd::string> dependentBundleNames;
-        AZStd::vector<AZ::IO::Path> levelDirs;
+        const AZStd::vector<AZ::IO::Path> levelDirs = GetLevelDirs(assetFileInfoList);
         AZStd::vector<AZStd::pair<AZStd::string, AZStd::string>> bundlePathDeltaCatalogPair;
         bundlePathDeltaCatalogPair.emplace_back(tempBundleFilePath, DeltaCatalogName);
 
@@ -284,6 +344,43 @@ namespace AzToolsFramework
 
         AZStd::string assetAlias = PlatformAddressedAssetCatalog::GetAssetRootForPlatform(platformId);
 
+        // Compare what the bundle would be built from with what it was built from last time,
+        // and leave it alone if nothing changed and all of its files are still there.
+        const AZStd::string buildStateFilePath = bundleFilePath.Native() + bundleBuildStateFileSuffix;
+        AssetBundleBuildState previousBuildState;
+        const bool hasPreviousBuildState = fileIO->Exists(bundleFilePath.c_str()) && previousBuildState.Load(buildStateFilePath);
+
+        AssetBundleBuildState buildState;
+        if (!MakeAssetBundleBuildState(assetBundleSettings, assetFileInfoList, levelDirs, assetAlias, previousBuildState, buildState))
+        {
+            return false;
+        }
+
+        if (hasPreviousBuildState)
+        {
+            const bool allBundlesExist = AZStd::all_of(previousBuildState.m_bundleNames.begin(), previousBuildState.m_bundleNames.end(),
+                [&bundleFolder, fileIO](const AZStd::string& bundleName)
+                {
+                    AZStd::string bundleNameFilePath;
+                    AzFramework::StringFunc::Path::ConstructFull(bundleFolder.c_str(), bundleName.c_str(), bundleNameFilePath, true);
+                    return fileIO->Exists(bundleNameFilePath.c_str());
+                });
+
+            if (allBundlesExist && buildState.HasSameInputs(previousBuildState))
+            {
+                AZ_TracePrintf(logWindowName, "Bundle (%s) is up to date.\n", bundleFilePath.c_str());
+                return true;
+            }
+
+            ReportBuildStateChanges(previousBuildState, buildState, bundleFilePath.Native());
+        }
+
+        // the build state is written again once the new bundle is in place, so that it can never describe a partly built bundle.
+        if (fileIO->Exists(buildStateFilePath.c_str()))
+        {
+            fileIO->Remove(buildStateFilePath.c_str());
+        }
+
         if (fileIO->Exists(bundleFilePath.c_str()))
         {
             // This will delete both the parent bundle as well as all the dependent bundles mentioned in the manifest file of the parent bundle.
@@ -293,10 +390,6 @@ namespace AzToolsFramework
             }
         }
 
-        bool usePrefabSystemForLevels = false;
-        AzFramework::ApplicationRequests::Bus::BroadcastResult(
-            usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
-
         for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
         {
             AZ::u64 fileSize = 0;
@@ -313,18 +406,6 @@ namespace AzToolsFramework
                 AZ_Warning(logWindowName, false, "File (%s) size (%d) is bigger than the max bundle size (%d).\n", assetFileInfo.m_assetRelativePath.c_str(), fileSize, maxSizeInBytes);
             }
 
-            if (!usePrefabSystemForLevels && (AzFramework::StringFunc::EndsWith(assetFileInfo.m_assetRelativePath, "level.pak")))
-            {
-                AZStd::string levelFolder;
-                AzFramework::StringFunc::Path::GetFolderPath(assetFileInfo.m_assetRelativePath.c_str(), levelFolder);
-                AzFramework::StringFunc::RelativePath::Normalize(levelFolder);
-                if (AzFramework::StringFunc::LastCharacter(levelFolder.c_str()) == AZ_CORRECT_FILESYSTEM_SEPARATOR)
-                {
-                    AzFramework::StringFunc::RChop(levelFolder, 1);
-                }
-                levelDirs.emplace_back(levelFolder);
-            }
-
             totalFileSize += fileSize;
 
             if (!MaxSizeExceeded(totalFileSize, bundleSize, assetCatalogFileSizeBuffer, maxSizeInBytes))
@@ -432,6 +513,14 @@ namespace AzToolsFramework
             }
         }
 
+        buildState.m_bundleNames.emplace_back(CreateAssetBundleFileName(bundleFilePath.Native(), 0));
+        buildState.m_bundleNames.insert(buildState.m_bundleNames.end(), dependentBundleNames.begin(), dependentBundleNames.end());
+        if (!buildState.Save(buildStateFilePath))
+        {
+            // the bundle itself is fine, it will just be rebuilt next time.
+            AZ_Warning(logWindowName, false, "Failed to save the build state of bundle (%s) to (%s).\n", bundleFilePath.c_str(), buildStateFilePath.c_str());
+        }
+
         return true;
     }
 
@@ -34,12 +34,14 @@ namespace AzToolsFramework
             // when you add a table, be sure to add it here to check the database for corruption
             static const char* EXPECTED_TABLES[] = {
                 "BuilderInfo",
+                "FileHashes",
                 "Files",
                 "Jobs",
                 "LegacySubIDs",
                 "MissingProductDependencies",
                 "ProductDependencies",
                 "Products",
+                "ScanDirectories",
                 "ScanFolders",
                 "SourceDependency",
                 "Sources",
@@ -130,6 +132,11 @@ namespace AzToolsFramework
 
             static const auto s_queryStatsTable = MakeSqlQuery(QUERY_STATS_TABLE, QUERY_STATS_TABLE_STATEMENT, LOG_NAME);
 
+            static const char* QUERY_FILEHASHES_TABLE = "AzToolsFramework::AssetDatabase::QueryFileHashesTable";
+            static const char* QUERY_FILEHASHES_TABLE_STATEMENT = "SELECT * from FileHashes;";
+
+            static const auto s_queryFileHashesTable = MakeSqlQuery(QUERY_FILEHASHES_TABLE, QUERY_FILEHASHES_TABLE_STATEMENT, LOG_NAME);
+
             //////////////////////////////////////////////////////////////////////////
             //projection and combination queries
 
@@ -997,6 +1004,17 @@ namespace AzToolsFramework
             static const auto s_queryStatLikeStatName= MakeSqlQuery(
                 QUERY_STAT_LIKE_STATNAME, QUERY_STAT_LIKE_STATNAME_STATEMENT, LOG_NAME, SqlParam<const char*>(":statname"));
 
+            static const char* QUERY_SCANDIRECTORIES_BY_SCANFOLDERID = "AzToolsFramework::AssetDatabase::QueryScanDirectoriesByScanFolderID";
+            static const char* QUERY_SCANDIRECTORIES_BY_SCANFOLDERID_STATEMENT =
+                "SELECT * FROM ScanDirectories WHERE "
+                "ScanFolderPK = :scanfolderid;";
+
+            static const auto s_queryScanDirectoriesByScanfolderid = MakeSqlQuery(
+                QUERY_SCANDIRECTORIES_BY_SCANFOLDERID,
+                QUERY_SCANDIRECTORIES_BY_SCANFOLDERID_STATEMENT,
+                LOG_NAME,
+                SqlParam<AZ::s64>(":scanfolderid"));
+
             void PopulateJobInfo(AzToolsFramework::AssetSystem::JobInfo& jobinfo, JobDatabaseEntry& jobDatabaseEntry)
             {
                 jobinfo.m_platform = AZStd::move(jobDatabaseEntry.m_platform);
@@ -1044,6 +1062,8 @@ namespace AzToolsFramework
             bool GetCombinedDependencyResult(const char* callName, SQLite::Statement* statement, AssetDatabaseConnection::combinedProductDependencyHandler handler);
             bool GetFileResult(const char* callName, SQLite::Statement* statement, AssetDatabaseConnection::fileHandler handler);
             bool GetStatResult(const char* callName, SQLite::Statement* statement, AssetDatabaseConnection::statHandler handler);
+            bool GetScanDirectoryResult(const char* callName, SQLite::Statement* statement, AssetDatabaseConnection::scanDirectoryHandler handler);
+            bool GetFileHashResult(const char* callName, SQLite::Statement* statement, AssetDatabaseConnection::fileHashHandler handler);
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -1761,6 +1781,71 @@ namespace AzToolsFramework
                 MakeColumn("LastLogTime", m_lastLogTime));
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        // ScanDirectoryDatabaseEntry
+        bool ScanDirectoryDatabaseEntry::operator==(const ScanDirectoryDatabaseEntry& other) const
+        {
+            return m_scanFolderPK == other.m_scanFolderPK
+                && m_directoryName == other.m_directoryName
+                && m_modTime == other.m_modTime
+                && m_entries == other.m_entries;
+        }
+
+        AZStd::string ScanDirectoryDatabaseEntry::ToString() const
+        {
+            return AZStd::string::format(
+                "ScanDirectoryDatabaseEntry id: %" PRId64 " scanfolderpk: %" PRId64 " directoryname: %s modtime: %" PRIu64 " entries: %zu bytes",
+                aznumeric_cast<int64_t>(m_scanDirectoryID),
+                aznumeric_cast<int64_t>(m_scanFolderPK),
+                m_directoryName.c_str(),
+                aznumeric_cast<uint64_t>(m_modTime),
+                m_entries.size());
+        }
+
+        auto ScanDirectoryDatabaseEntry::GetColumns()
+        {
+            return MakeColumns(
+                MakeColumn("ScanDirectoryID", m_scanDirectoryID),
+                MakeColumn("ScanFolderPK", m_scanFolderPK),
+                MakeColumn("DirectoryName", m_directoryName),
+                MakeColumn("ModTime", m_modTime),
+                MakeColumn("Entries", m_entries));
+        }
+
+        //////////////////////////////////////////////////////////////////////////
+        // FileHashDatabaseEntry
+        bool FileHashDatabaseEntry::operator==(const FileHashDatabaseEntry& other) const
+        {
+            return m_filePath == other.m_filePath
+                && m_fileSize == other.m_fileSize
+                && m_modTime == other.m_modTime
+                && m_fileIdentity == other.m_fileIdentity
+                && m_hash == other.m_hash;
+        }
+
+        AZStd::string FileHashDatabaseEntry::ToString() const
+        {
+            return AZStd::string::format(
+                "FileHashDatabaseEntry id: %" PRId64 " filepath: %s filesize: %" PRIu64 " modtime: %" PRIu64 " fileidentity: %" PRIu64 " hash: %" PRIu64,
+                aznumeric_cast<int64_t>(m_fileHashID),
+                m_filePath.c_str(),
+                aznumeric_cast<uint64_t>(m_fileSize),
+                aznumeric_cast<uint64_t>(m_modTime),
+                aznumeric_cast<uint64_t>(m_fileIdentity),
+                aznumeric_cast<uint64_t>(m_hash));
+        }
+
+        auto FileHashDatabaseEntry::GetColumns()
+        {
+            return MakeColumns(
+                MakeColumn("FileHashID", m_fileHashID),
+                MakeColumn("FilePath", m_filePath),
+                MakeColumn("FileSize", m_fileSize),
+                MakeColumn("ModTime", m_modTime),
+                MakeColumn("FileIdentity", m_fileIdentity),
+                MakeColumn("Hash", m_hash));
+        }
+
         //////////////////////////////////////////////////////////////////////////
         //AssetDatabaseConnection
         AssetDatabaseConnection::AssetDatabaseConnection()
@@ -1886,6 +1971,7 @@ namespace AzToolsFramework
             AddStatement(m_databaseConnection, s_queryProductdependenciesTable);
             AddStatement(m_databaseConnection, s_queryFilesTable);
             AddStatement(m_databaseConnection, s_queryStatsTable);
+            AddStatement(m_databaseConnection, s_queryFileHashesTable);
 
             //////////////////////////////////////////////////////////////////////////
             //projection and combination queries
@@ -1993,6 +2079,8 @@ namespace AzToolsFramework
             AddStatement(m_databaseConnection, s_queryStatByStatName);
             AddStatement(m_databaseConnection, s_queryStatLikeStatName);
 
+            AddStatement(m_databaseConnection, s_queryScanDirectoriesByScanfolderid);
+
             AddStatement(m_databaseConnection, s_queryBuilderInfoTable);
         }
 
@@ -2096,6 +2184,11 @@ namespace AzToolsFramework
             return s_queryStatsTable.BindAndQuery(*m_databaseConnection, handler, &GetStatResult);
         }
 
+        bool AssetDatabaseConnection::QueryFileHashesTable(fileHashHandler handler)
+        {
+            return s_queryFileHashesTable.BindAndQuery(*m_databaseConnection, handler, &GetFileHashResult);
+        }
+
         bool AssetDatabaseConnection::QueryScanFolderByScanFolderID(AZ::s64 scanfolderid, scanFolderHandler handler)
         {
             return s_queryScanfolderByScanfolderid.BindAndQuery(*m_databaseConnection, handler, &GetScanFolderResult, scanfolderid);
@@ -2822,6 +2915,11 @@ namespace AzToolsFramework
             return s_queryStatLikeStatName.BindAndQuery(*m_databaseConnection, handler, &GetStatResult, statName);
         }
 
+        bool AssetDatabaseConnection::QueryScanDirectoriesByScanFolderID(AZ::s64 scanFolderID, scanDirectoryHandler handler)
+        {
+            return s_queryScanDirectoriesByScanfolderid.BindAndQuery(*m_databaseConnection, handler, &GetScanDirectoryResult, scanFolderID);
+        }
+
         void AssetDatabaseConnection::SetQueryLogging(bool enableLogging)
         {
             if (enableLogging)
@@ -3171,6 +3269,16 @@ namespace AzToolsFramework
                 return GetResult(callName, statement, handler);
             }
 
+            bool GetScanDirectoryResult(const char* callName, SQLite::Statement* statement, AssetDatabaseConnection::scanDirectoryHandler handler)
+            {
+                return GetResult(callName, statement, handler);
+            }
+
+            bool GetFileHashResult(const char* callName, SQLite::Statement* statement, AssetDatabaseConnection::fileHashHandler handler)
+            {
+                return GetResult(callName, statement, handler);
+            }
+
             bool GetJobResultSimple(const char* name, Statement* statement, AssetDatabaseConnection::jobHandler handler)
             {
                 return GetJobResult(name, statement, handler);
@@ -75,6 +75,8 @@ namespace AzToolsFramework
             NewMaterialTypeBuildPipeline,
             AddedJobFailureSourceColumn,
             AddedMissingDependenciesIndex,
+            AddedScanDirectoriesTable,
+            AddedFileHashesTable,
             //Add all new versions before this
             DatabaseVersionCount,
             LatestVersion = DatabaseVersionCount - 1
@@ -451,6 +453,61 @@ namespace AzToolsFramework
 
         typedef AZStd::vector<StatDatabaseEntry> StatDatabaseEntryContainer;
 
+        //////////////////////////////////////////////////////////////////////////
+        // ScanDirectoryDatabaseEntry
+        //! The state of a directory as seen by the last asset scan, used to skip listing directories that have not changed since.
+        class ScanDirectoryDatabaseEntry
+        {
+        public:
+            ScanDirectoryDatabaseEntry() = default;
+
+            ScanDirectoryDatabaseEntry(const ScanDirectoryDatabaseEntry& other) = default;
+            ScanDirectoryDatabaseEntry(ScanDirectoryDatabaseEntry&& other) = default;
+
+            ScanDirectoryDatabaseEntry& operator=(ScanDirectoryDatabaseEntry&& other) = default;
+            ScanDirectoryDatabaseEntry& operator=(const ScanDirectoryDatabaseEntry& other) = default;
+            bool operator==(const ScanDirectoryDatabaseEntry& other) const;
+
+            AZStd::string ToString() const;
+            auto GetColumns();
+
+            AZ::s64 m_scanDirectoryID = InvalidEntryId;
+            AZ::s64 m_scanFolderPK = InvalidEntryId;
+            AZStd::string m_directoryName; // relative to the scan folder, empty for the scan folder itself
+            AZ::u64 m_modTime{};
+            AZStd::string m_entries; // the serialized listing of the directory, owned by the asset scanner
+        };
+
+        typedef AZStd::vector<ScanDirectoryDatabaseEntry> ScanDirectoryDatabaseEntryContainer;
+
+        //////////////////////////////////////////////////////////////////////////
+        // FileHashDatabaseEntry
+        //! The content hash of a file, which remains valid for as long as the size, modification time and identity of the file are unchanged.
+        class FileHashDatabaseEntry
+        {
+        public:
+            FileHashDatabaseEntry() = default;
+
+            FileHashDatabaseEntry(const FileHashDatabaseEntry& other) = default;
+            FileHashDatabaseEntry(FileHashDatabaseEntry&& other) = default;
+
+            FileHashDatabaseEntry& operator=(FileHashDatabaseEntry&& other) = default;
+            FileHashDatabaseEntry& operator=(const FileHashDatabaseEntry& other) = default;
+            bool operator==(const FileHashDatabaseEntry& other) const;
+
+            AZStd::string ToString() const;
+            auto GetColumns();
+
+            AZ::s64 m_fileHashID = InvalidEntryId;
+            AZStd::string m_filePath; // the normalized absolute path of the file
+            AZ::u64 m_fileSize{};
+            AZ::u64 m_modTime{};
+            AZ::u64 m_fileIdentity{}; // the inode or file index of the file, 0 where the platform doesn't provide one
+            AZ::u64 m_hash{};
+        };
+
+        typedef AZStd::vector<FileHashDatabaseEntry> FileHashDatabaseEntryContainer;
+
         //////////////////////////////////////////////////////////////////////////
         //AssetDatabaseConnection
         //! The Connection class represents a read-only connection to the asset database specifically
@@ -514,6 +571,8 @@ namespace AzToolsFramework
             using BuilderInfoHandler = std::function<bool(BuilderInfoEntry&&)>;
             using fileHandler = AZStd::function<bool(FileDatabaseEntry& entry)>;
             using statHandler = AZStd::function<bool(StatDatabaseEntry& entry)>;
+            using scanDirectoryHandler = AZStd::function<bool(ScanDirectoryDatabaseEntry& entry)>;
+            using fileHashHandler = AZStd::function<bool(FileHashDatabaseEntry& entry)>;
 
             //////////////////////////////////////////////////////////////////
             //Query entire table
@@ -527,6 +586,7 @@ namespace AzToolsFramework
             bool QueryBuilderInfoTable(const BuilderInfoHandler& handler);
             bool QueryFilesTable(fileHandler handler);
             bool QueryStatsTable(statHandler handler);
+            bool QueryFileHashesTable(fileHashHandler handler);
 
             //////////////////////////////////////////////////////////////////////////
             //Queries
@@ -689,6 +749,9 @@ namespace AzToolsFramework
             bool QueryStatByStatName(const char* statName, statHandler handler);
             bool QueryStatLikeStatName(const char* statName, statHandler handler);
 
+            //ScanDirectory
+            bool QueryScanDirectoriesByScanFolderID(AZ::s64 scanFolderID, scanDirectoryHandler handler);
+
             //////////////////////////////////////////////////////////////////////////
 
             void SetQueryLogging(bool enableLogging);
@@ -101,6 +101,10 @@ namespace AzToolsFramework
             // you still don't lose data if the application crashes, only if you literally lose power while the disk is writing.
             // and because you're in WAL mode, you only lose the current transaction anyway.
             sqlite3_exec(m_db, "PRAGMA synchronous = 0;", NULL, NULL, NULL);
+
+            // several connections write to the same database (and writes are grouped into larger transactions), so
+            // rather than failing immediately with SQLITE_BUSY, wait a while for the other writer to commit.
+            sqlite3_busy_timeout(m_db, 5000);
             return      (res == SQLITE_OK);
         }
 
@@ -111,6 +115,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -221,27 +226,62 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+
+            // SQLite does not allow BEGIN inside of a transaction, so nested transactions become savepoints.
+            // This lets callers group many writes which each use their own ScopedTransaction into one commit.
+            if (m_transactionDepth++ == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT nested_%d;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
         }
 
         void Connection::CommitTransaction()
         {
             AZ_Assert(m_db, "CommitTransaction:  Database is not open!");
-            if (!m_db)
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is in progress!");
+            if ((!m_db) || (m_transactionDepth <= 0))
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+
+            if (m_transactionDepth == 1)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string release = AZStd::string::format("RELEASE SAVEPOINT nested_%d;", m_transactionDepth);
+                sqlite3_exec(m_db, release.c_str(), NULL, NULL, NULL);
+            }
+            --m_transactionDepth;
         }
 
         void Connection::RollbackTransaction()
         {
             AZ_Assert(m_db, "RollbackTransaction:  Database is not open!");
-            if (!m_db)
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction is in progress!");
+            if ((!m_db) || (m_transactionDepth <= 0))
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+
+            if (m_transactionDepth == 1)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // rolling back to a savepoint leaves it on the stack, so it has to be released as well.
+                AZStd::string rollback = AZStd::string::format(
+                    "ROLLBACK TO SAVEPOINT nested_%d; RELEASE SAVEPOINT nested_%d;", m_transactionDepth, m_transactionDepth);
+                sqlite3_exec(m_db, rollback.c_str(), NULL, NULL, NULL);
+            }
+            --m_transactionDepth;
         }
 
         void Connection::Vacuum()
@@ -54,6 +54,8 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions may be nested.  Only the outermost transaction is written to the database on commit,
+            //! inner transactions are savepoints which can be rolled back without affecting the outer one.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -95,6 +97,7 @@ namespace AzToolsFramework
 
         private:
             sqlite3* m_db;
+            int m_transactionDepth = 0;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
         };
@@ -133,6 +133,8 @@ set(FILES
     Thumbnails/ThumbnailWidget.cpp
     Thumbnails/ThumbnailWidget.h
     AssetBundle/AssetBundleAPI.h
+    AssetBundle/AssetBundleBuildState.cpp
+    AssetBundle/AssetBundleBuildState.h
     AssetBundle/AssetBundleComponent.cpp
     AssetBundle/AssetBundleComponent.h
     AssetDatabase/AssetDatabaseConnection.cpp
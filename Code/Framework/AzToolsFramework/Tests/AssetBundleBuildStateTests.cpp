@@ -0,0 +1,460 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/Asset/AssetCatalog.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AZTestShared/Utils/Utils.h>
+#include <AzToolsFramework/Asset/AssetBundler.h>
+#include <AzToolsFramework/Asset/AssetSeedManager.h>
+#include <AzToolsFramework/AssetBundle/AssetBundleAPI.h>
+#include <AzToolsFramework/AssetBundle/AssetBundleBuildState.h>
+#include <AzToolsFramework/AssetCatalog/PlatformAddressedAssetCatalog.h>
+#include <AzToolsFramework/UnitTest/ToolsTestApplication.h>
+
+namespace UnitTest
+{
+    class AssetBundleBuildStateTest
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_localFileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            m_priorFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_localFileIO.get());
+
+            m_assetAlias = m_tempDir.GetDirectory();
+            m_settings.m_platform = "pc";
+
+            WriteAsset("first.bin", "first asset");
+            WriteAsset("second.bin", "second asset");
+            WriteAsset("third.bin", "third asset");
+        }
+
+        void TearDown() override
+        {
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            AZ::IO::FileIOBase::SetInstance(m_priorFileIO);
+            m_localFileIO.reset();
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        void WriteAsset(const char* relativePath, AZStd::string_view content)
+        {
+            ASSERT_TRUE(AZ::Utils::WriteFile(content, m_tempDir.Resolve(relativePath).Native()).IsSuccess());
+        }
+
+        AzToolsFramework::AssetFileInfoList MakeFileInfoList(AZStd::initializer_list<const char*> relativePaths)
+        {
+            AzToolsFramework::AssetFileInfoList assetFileInfoList;
+            for (const char* relativePath : relativePaths)
+            {
+                AzToolsFramework::AssetFileInfo assetFileInfo;
+                assetFileInfo.m_assetRelativePath = relativePath;
+                assetFileInfo.m_assetId = AZ::Data::AssetId(AZ::Uuid::CreateName(relativePath), 0);
+                assetFileInfoList.m_fileInfoList.push_back(assetFileInfo);
+            }
+            return assetFileInfoList;
+        }
+
+        AzToolsFramework::AssetBundleBuildState MakeBuildState(const AzToolsFramework::AssetFileInfoList& assetFileInfoList,
+            const AzToolsFramework::AssetBundleBuildState& previousBuildState = {})
+        {
+            AzToolsFramework::AssetBundleBuildState buildState;
+            EXPECT_TRUE(AzToolsFramework::MakeAssetBundleBuildState(
+                m_settings, assetFileInfoList, m_levelDirs, m_assetAlias, previousBuildState, buildState));
+            return buildState;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDir;
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_localFileIO;
+        AZ::IO::FileIOBase* m_priorFileIO = nullptr;
+        AZStd::string m_assetAlias;
+        AzToolsFramework::AssetBundleSettings m_settings;
+        AZStd::vector<AZ::IO::Path> m_levelDirs;
+    };
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_UnchangedInputs_HasSameInputsAndNoChanges)
+    {
+        const auto assetFileInfoList = MakeFileInfoList({ "first.bin", "second.bin", "third.bin" });
+        const auto previousBuildState = MakeBuildState(assetFileInfoList);
+        const auto buildState = MakeBuildState(assetFileInfoList, previousBuildState);
+
+        ASSERT_EQ(buildState.m_files.size(), 3u);
+        EXPECT_TRUE(buildState.HasSameInputs(previousBuildState));
+        EXPECT_FALSE(AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState).HasChanges());
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_UntouchedFile_ReusesPreviousHash)
+    {
+        const auto assetFileInfoList = MakeFileInfoList({ "first.bin" });
+        auto previousBuildState = MakeBuildState(assetFileInfoList);
+        ASSERT_EQ(previousBuildState.m_files.size(), 1u);
+        previousBuildState.m_files[0].m_hash = "previous";
+
+        // the size and modification time are unchanged, so the file isn't read again.
+        const auto buildState = MakeBuildState(assetFileInfoList, previousBuildState);
+        ASSERT_EQ(buildState.m_files.size(), 1u);
+        EXPECT_EQ(buildState.m_files[0].m_hash, "previous");
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_ModificationTimeDiffers_RehashesFile)
+    {
+        const auto assetFileInfoList = MakeFileInfoList({ "first.bin" });
+        const auto expectedBuildState = MakeBuildState(assetFileInfoList);
+        auto previousBuildState = expectedBuildState;
+        ASSERT_EQ(previousBuildState.m_files.size(), 1u);
+        previousBuildState.m_files[0].m_modificationTime += 1;
+        previousBuildState.m_files[0].m_hash = "previous";
+
+        const auto buildState = MakeBuildState(assetFileInfoList, previousBuildState);
+        ASSERT_EQ(buildState.m_files.size(), 1u);
+        EXPECT_EQ(buildState.m_files[0].m_hash, expectedBuildState.m_files[0].m_hash);
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_ChangedFile_ReportedAsChanged)
+    {
+        const auto assetFileInfoList = MakeFileInfoList({ "first.bin", "second.bin", "third.bin" });
+        const auto previousBuildState = MakeBuildState(assetFileInfoList);
+        WriteAsset("second.bin", "second asset, with new content");
+        const auto buildState = MakeBuildState(assetFileInfoList, previousBuildState);
+
+        EXPECT_FALSE(buildState.HasSameInputs(previousBuildState));
+        const auto changes = AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState);
+        EXPECT_FALSE(changes.m_settingsChanged);
+        EXPECT_TRUE(changes.m_added.empty());
+        EXPECT_TRUE(changes.m_removed.empty());
+        ASSERT_EQ(changes.m_changed.size(), 1u);
+        EXPECT_EQ(changes.m_changed[0], "second.bin");
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_ChangedAssetId_ReportedAsChanged)
+    {
+        auto assetFileInfoList = MakeFileInfoList({ "first.bin", "second.bin" });
+        const auto previousBuildState = MakeBuildState(assetFileInfoList);
+
+        // the contents are the same, but the delta catalog of the bundle would map the file to another asset.
+        assetFileInfoList.m_fileInfoList[1].m_assetId.m_subId = 1;
+        const auto buildState = MakeBuildState(assetFileInfoList, previousBuildState);
+
+        EXPECT_FALSE(buildState.HasSameInputs(previousBuildState));
+        const auto changes = AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState);
+        EXPECT_FALSE(changes.m_settingsChanged);
+        EXPECT_TRUE(changes.m_added.empty());
+        EXPECT_TRUE(changes.m_removed.empty());
+        ASSERT_EQ(changes.m_changed.size(), 1u);
+        EXPECT_EQ(changes.m_changed[0], "second.bin");
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_AddedFile_ReportedAsAdded)
+    {
+        const auto previousBuildState = MakeBuildState(MakeFileInfoList({ "first.bin", "second.bin" }));
+        const auto buildState = MakeBuildState(MakeFileInfoList({ "first.bin", "second.bin", "third.bin" }), previousBuildState);
+
+        EXPECT_FALSE(buildState.HasSameInputs(previousBuildState));
+        const auto changes = AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState);
+        EXPECT_FALSE(changes.m_settingsChanged);
+        EXPECT_TRUE(changes.m_changed.empty());
+        EXPECT_TRUE(changes.m_removed.empty());
+        ASSERT_EQ(changes.m_added.size(), 1u);
+        EXPECT_EQ(changes.m_added[0], "third.bin");
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_RemovedFile_ReportedAsRemoved)
+    {
+        const auto previousBuildState = MakeBuildState(MakeFileInfoList({ "first.bin", "second.bin", "third.bin" }));
+        const auto buildState = MakeBuildState(MakeFileInfoList({ "first.bin", "third.bin" }), previousBuildState);
+
+        EXPECT_FALSE(buildState.HasSameInputs(previousBuildState));
+        const auto changes = AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState);
+        EXPECT_FALSE(changes.m_settingsChanged);
+        EXPECT_TRUE(changes.m_added.empty());
+        EXPECT_TRUE(changes.m_changed.empty());
+        ASSERT_EQ(changes.m_removed.size(), 1u);
+        EXPECT_EQ(changes.m_removed[0], "second.bin");
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_ReorderedFiles_DoesNotHaveSameInputs)
+    {
+        const auto previousBuildState = MakeBuildState(MakeFileInfoList({ "first.bin", "second.bin" }));
+        const auto buildState = MakeBuildState(MakeFileInfoList({ "second.bin", "first.bin" }), previousBuildState);
+
+        // the same files in a different order can be split into rollover bundles differently.
+        EXPECT_FALSE(buildState.HasSameInputs(previousBuildState));
+        EXPECT_FALSE(AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState).HasChanges());
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_ChangedSettings_ReportedAsSettingsChanged)
+    {
+        const auto assetFileInfoList = MakeFileInfoList({ "first.bin", "second.bin" });
+        const auto previousBuildState = MakeBuildState(assetFileInfoList);
+        m_settings.m_maxBundleSizeInMB = 1;
+        const auto buildState = MakeBuildState(assetFileInfoList, previousBuildState);
+
+        EXPECT_FALSE(buildState.HasSameInputs(previousBuildState));
+        const auto changes = AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState);
+        EXPECT_TRUE(changes.m_settingsChanged);
+        EXPECT_TRUE(changes.m_added.empty());
+        EXPECT_TRUE(changes.m_changed.empty());
+        EXPECT_TRUE(changes.m_removed.empty());
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_ChangedLevelDirs_ReportedAsSettingsChanged)
+    {
+        const auto assetFileInfoList = MakeFileInfoList({ "first.bin", "second.bin" });
+        const auto previousBuildState = MakeBuildState(assetFileInfoList);
+
+        // the level folders only go into the manifest of the bundle.
+        m_levelDirs = { "levels/first" };
+        const auto buildState = MakeBuildState(assetFileInfoList, previousBuildState);
+
+        EXPECT_FALSE(buildState.HasSameInputs(previousBuildState));
+        const auto changes = AzToolsFramework::GetAssetBundleBuildStateChanges(previousBuildState, buildState);
+        EXPECT_TRUE(changes.m_settingsChanged);
+        EXPECT_TRUE(changes.m_added.empty());
+        EXPECT_TRUE(changes.m_changed.empty());
+        EXPECT_TRUE(changes.m_removed.empty());
+    }
+
+    TEST_F(AssetBundleBuildStateTest, MakeBuildState_MissingFile_Fails)
+    {
+        AzToolsFramework::AssetBundleBuildState buildState;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AzToolsFramework::MakeAssetBundleBuildState(
+            m_settings, MakeFileInfoList({ "first.bin", "missing.bin" }), m_levelDirs, m_assetAlias, {}, buildState));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(AssetBundleBuildStateTest, SaveAndLoad_RoundTrip_PreservesBuildState)
+    {
+        m_levelDirs = { "levels/first", "levels/second" };
+        auto buildState = MakeBuildState(MakeFileInfoList({ "first.bin", "second.bin", "third.bin" }));
+        buildState.m_bundleNames = { "test.pak", "test__1.pak" };
+        const AZStd::string buildStateFilePath = m_tempDir.Resolve("test.pak.buildstate").Native();
+        ASSERT_TRUE(buildState.Save(buildStateFilePath));
+
+        AzToolsFramework::AssetBundleBuildState loadedBuildState;
+        ASSERT_TRUE(loadedBuildState.Load(buildStateFilePath));
+        EXPECT_TRUE(loadedBuildState.HasSameInputs(buildState));
+        EXPECT_EQ(loadedBuildState.m_levelDirs, buildState.m_levelDirs);
+        EXPECT_EQ(loadedBuildState.m_bundleNames, buildState.m_bundleNames);
+        ASSERT_EQ(loadedBuildState.m_files.size(), buildState.m_files.size());
+        for (size_t idx = 0; idx < buildState.m_files.size(); ++idx)
+        {
+            EXPECT_EQ(loadedBuildState.m_files[idx].m_assetId, buildState.m_files[idx].m_assetId);
+            EXPECT_EQ(loadedBuildState.m_files[idx].m_size, buildState.m_files[idx].m_size);
+            EXPECT_EQ(loadedBuildState.m_files[idx].m_modificationTime, buildState.m_files[idx].m_modificationTime);
+        }
+    }
+
+    TEST_F(AssetBundleBuildStateTest, Load_MissingFile_Fails)
+    {
+        AzToolsFramework::AssetBundleBuildState buildState;
+        EXPECT_FALSE(buildState.Load(m_tempDir.Resolve("missing.pak.buildstate").Native()));
+        EXPECT_TRUE(buildState.m_files.empty());
+    }
+
+    TEST_F(AssetBundleBuildStateTest, Load_InvalidJson_Fails)
+    {
+        const AZStd::string buildStateFilePath = m_tempDir.Resolve("test.pak.buildstate").Native();
+        ASSERT_TRUE(AZ::Utils::WriteFile(R"({ "platform": "pc", "files": [ )", buildStateFilePath).IsSuccess());
+
+        AzToolsFramework::AssetBundleBuildState buildState;
+        EXPECT_FALSE(buildState.Load(buildStateFilePath));
+        EXPECT_TRUE(buildState.m_files.empty());
+    }
+
+    TEST_F(AssetBundleBuildStateTest, Load_FileEntryMissingHash_FailsAndLeavesBuildStateEmpty)
+    {
+        const AZStd::string buildStateFilePath = m_tempDir.Resolve("test.pak.buildstate").Native();
+        ASSERT_TRUE(AZ::Utils::WriteFile(R"({
+                "platform": "pc",
+                "bundleVersion": 2,
+                "maxBundleSizeInMB": 2048,
+                "levelDirs": [],
+                "bundles": [ "test.pak" ],
+                "files": [
+                    { "path": "first.bin", "assetId": "{01234567-89AB-CDEF-0123-456789ABCDEF}:0", "size": 11, "modificationTime": 1, "hash": "0123456789" },
+                    { "path": "second.bin", "assetId": "{01234567-89AB-CDEF-0123-456789ABCDEF}:1", "size": 12, "modificationTime": 1 }
+                ]
+            })", buildStateFilePath).IsSuccess());
+
+        // a partly read build state must not be used to skip hashing the files it does list.
+        AzToolsFramework::AssetBundleBuildState buildState;
+        EXPECT_FALSE(buildState.Load(buildStateFilePath));
+        EXPECT_TRUE(buildState.m_platform.empty());
+        EXPECT_TRUE(buildState.m_bundleNames.empty());
+        EXPECT_TRUE(buildState.m_files.empty());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class BM_AssetBundleBuildState
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        static constexpr size_t FileSize = 64 * 1024;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            SetUpHelper(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            SetUpHelper(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            TearDownHelper(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            TearDownHelper(state);
+        }
+
+        void SetUpHelper(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            constexpr size_t MaxCommandArgsCount = 128;
+            using FixedValueString = AZ::SettingsRegistryInterface::FixedValueString;
+            using ArgumentContainer = AZStd::fixed_vector<char*, MaxCommandArgsCount>;
+            // The first command line argument is assumed to be the executable name so add a blank entry for it
+            ArgumentContainer argContainer{ {} };
+
+            m_tempDir = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            auto projectPathOverride = FixedValueString::format(R"(--project-path="%s")", m_tempDir->GetDirectory());
+            argContainer.push_back(projectPathOverride.data());
+            m_application = AZStd::make_unique<UnitTest::ToolsTestApplication>(
+                "AssetBundleBuildStateBenchmark", aznumeric_caster(argContainer.size()), argContainer.data());
+
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application->Start(AzFramework::Application::Descriptor(), startupParameters);
+            // Without this, the user settings component would attempt to save on finalize/shutdown.
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            // write the assets into the cache of the pc platform and list them in its catalog.
+            const AZ::IO::Path assetRoot = AzToolsFramework::PlatformAddressedAssetCatalog::GetAssetRootForPlatform(AzFramework::PlatformId::PC);
+            AzFramework::AssetRegistry assetRegistry;
+            AZStd::vector<AZ::Data::AssetId> assetIds;
+
+            AZStd::string content(FileSize, '\0');
+            const size_t fileCount = static_cast<size_t>(state.range(0));
+            for (size_t fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+            {
+                // give every file its own content, so that none of them hash the same.
+                for (size_t idx = 0; idx < content.size(); ++idx)
+                {
+                    content[idx] = static_cast<char>((idx * 31 + fileIndex) & 0xff);
+                }
+
+                AZ::Data::AssetInfo assetInfo;
+                assetInfo.m_assetId = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 0);
+                assetInfo.m_relativePath = AZStd::string::format("asset%zu.bin", fileIndex);
+                assetInfo.m_sizeBytes = FileSize;
+                AZ::Utils::WriteFile(content, (assetRoot / assetInfo.m_relativePath).Native());
+                assetRegistry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+                assetIds.push_back(assetInfo.m_assetId);
+            }
+
+            AzFramework::AssetCatalog assetCatalog(false);
+            assetCatalog.SaveCatalog(
+                AzToolsFramework::PlatformAddressedAssetCatalog::GetCatalogRegistryPathForPlatform(AzFramework::PlatformId::PC).c_str(),
+                &assetRegistry);
+            m_pcCatalog = AZStd::make_unique<AzToolsFramework::PlatformAddressedAssetCatalog>(AzFramework::PlatformId::PC);
+
+            // the list is made the same way the asset bundler makes it from a seed list.
+            AzToolsFramework::AssetSeedManager assetSeedManager;
+            for (const AZ::Data::AssetId& assetId : assetIds)
+            {
+                assetSeedManager.AddSeedAsset(assetId, AzFramework::PlatformFlags::Platform_PC);
+            }
+            m_assetFileInfoList = assetSeedManager.GetDependencyList(AzFramework::PlatformId::PC);
+
+            m_settings.m_platform = "pc";
+            m_settings.m_bundleFilePath = (AZ::IO::Path(m_tempDir->GetDirectory()) / "Bundles" / "test.pak").Native();
+            m_buildStateFilePath = m_settings.m_bundleFilePath + ".buildstate";
+        }
+
+        void TearDownHelper(const benchmark::State& state)
+        {
+            m_assetFileInfoList = {};
+            m_settings = {};
+            m_buildStateFilePath = {};
+            m_pcCatalog.reset();
+            m_application->Stop();
+            m_application.reset();
+            m_tempDir.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        bool CreateAssetBundle()
+        {
+            bool result = false;
+            AzToolsFramework::AssetBundleCommandsBus::BroadcastResult(result,
+                &AzToolsFramework::AssetBundleCommandsBus::Events::CreateAssetBundleFromList, m_settings, m_assetFileInfoList);
+            return result;
+        }
+
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDir;
+        AZStd::unique_ptr<UnitTest::ToolsTestApplication> m_application;
+        AZStd::unique_ptr<AzToolsFramework::PlatformAddressedAssetCatalog> m_pcCatalog;
+        AzToolsFramework::AssetBundleSettings m_settings;
+        AzToolsFramework::AssetFileInfoList m_assetFileInfoList;
+        AZStd::string m_buildStateFilePath;
+    };
+
+    // Without a build state every file is hashed and the bundle is built again, as on the first build of a bundle.
+    BENCHMARK_DEFINE_F(BM_AssetBundleBuildState, FullBuild)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            AZ::IO::SystemFile::Delete(m_buildStateFilePath.c_str());
+            state.ResumeTiming();
+
+            benchmark::DoNotOptimize(CreateAssetBundle());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * FileSize);
+    }
+    BENCHMARK_REGISTER_F(BM_AssetBundleBuildState, FullBuild)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond);
+
+    // With the build state of an unchanged bundle, only the size and modification time of every file are checked
+    // and the bundle is left alone.
+    BENCHMARK_DEFINE_F(BM_AssetBundleBuildState, IncrementalBuild)(benchmark::State& state)
+    {
+        CreateAssetBundle();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(CreateAssetBundle());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * state.range(0) * FileSize);
+    }
+    BENCHMARK_REGISTER_F(BM_AssetBundleBuildState, IncrementalBuild)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Asset/AssetManagerComponent.h>
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/Script/ScriptAsset.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/ScriptSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Script/ScriptComponent.h>
+
+namespace Benchmark
+{
+    // A typical gameplay script, with properties and state subtables that are only read by some of its instances
+    static constexpr const char* ScriptComponentBenchmarkScript = R"LUA(
+        local spawned = {
+            Properties = {
+                speed = { default = 2.0 },
+                health = { default = 100 },
+            },
+            state = {
+                movement = { velocity = 0.0, direction = 1 },
+                combat = { target = nil, cooldown = 0.0 },
+            },
+            config = {
+                limits = { min = 0, max = 10 },
+                names = { "a", "b", "c" },
+            },
+        }
+        function spawned:OnActivate()
+            self.state.movement.velocity = self.Properties.speed
+        end
+        function spawned:OnDeactivate()
+        end
+        return spawned
+    )LUA";
+
+    class BM_ScriptComponent
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            SetUpHelper(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            SetUpHelper(state);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            TearDownHelper(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            TearDownHelper(state);
+        }
+
+        void SetUpHelper(const benchmark::State& state)
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZ::ComponentApplication::Descriptor appDesc;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_app = AZStd::make_unique<AZ::ComponentApplication>();
+            AZ::Entity* systemEntity = m_app->Create(appDesc, startupParameters);
+
+            systemEntity->CreateComponent(AZ::TypeId{ "{CAE3A025-FAC9-4537-B39E-0A800A2326DF}" }); // JobManager component
+            systemEntity->CreateComponent<AZ::StreamerComponent>();
+            systemEntity->CreateComponent<AZ::AssetManagerComponent>();
+            systemEntity->CreateComponent<AZ::ScriptSystemComponent>();
+            systemEntity->Init();
+            systemEntity->Activate();
+
+            m_app->RegisterComponentDescriptor(AzFramework::ScriptComponent::CreateDescriptor());
+
+            AZ::ScriptContext* scriptContext = nullptr;
+            AZ::ScriptSystemRequestBus::BroadcastResult(
+                scriptContext, &AZ::ScriptSystemRequestBus::Events::GetContext, AZ::ScriptContextIds::DefaultScriptContextId);
+
+            AzFramework::ScriptCompileRequest compileRequest;
+            compileRequest.m_errorWindow = "ScriptComponentBenchmarks";
+            AZ::IO::MemoryStream inputStream(ScriptComponentBenchmarkScript, strlen(ScriptComponentBenchmarkScript));
+            compileRequest.m_input = &inputStream;
+
+            if (AzFramework::CompileScript(compileRequest, *scriptContext))
+            {
+                m_scriptAsset = AZ::Data::AssetManager::Instance().CreateAsset<AZ::ScriptAsset>(AZ::Data::AssetId(AZ::Uuid::CreateRandom()));
+                m_scriptAsset.SetAutoLoadBehavior(AZ::Data::AssetLoadBehavior::PreLoad);
+                m_scriptAsset.Get()->m_data = compileRequest.m_luaScriptDataOut;
+                AZ::Data::AssetManagerBus::Broadcast(&AZ::Data::AssetManagerBus::Events::OnAssetReady, m_scriptAsset);
+                m_app->Tick();
+                m_app->TickSystem();
+            }
+        }
+
+        void TearDownHelper(const benchmark::State& state)
+        {
+            m_scriptAsset.Reset();
+            m_app->Destroy();
+            m_app.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_app;
+        AZ::Data::Asset<AZ::ScriptAsset> m_scriptAsset;
+    };
+
+    BENCHMARK_DEFINE_F(BM_ScriptComponent, SpawnScriptedEntities)(benchmark::State& state)
+    {
+        const size_t entityCount = aznumeric_cast<size_t>(state.range());
+        AZStd::vector<AZ::Entity*> entities;
+        entities.reserve(entityCount);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            for (size_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+            {
+                auto* entity = aznew AZ::Entity();
+                entity->CreateComponent<AzFramework::ScriptComponent>()->SetScript(m_scriptAsset);
+                entity->Init();
+                entities.push_back(entity);
+            }
+            state.ResumeTiming();
+
+            for (AZ::Entity* entity : entities)
+            {
+                entity->Activate();
+            }
+
+            state.PauseTiming();
+            for (AZ::Entity* entity : entities)
+            {
+                delete entity;
+            }
+            entities.clear();
+            m_app->TickSystem(); // collects the garbage of the destroyed entity tables
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * entityCount);
+    }
+    BENCHMARK_REGISTER_F(BM_ScriptComponent, SpawnScriptedEntities)
+        ->Arg(100)
+        ->Arg(10000)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif
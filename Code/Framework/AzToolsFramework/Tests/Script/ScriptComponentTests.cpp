@@ -159,6 +159,111 @@ namespace UnitTest
     }
 
 
+    TEST_F(ScriptComponentTest, ScriptInstancesDontShareSubtables)
+    {
+        // subtables are copied into an instance when they are first read, make sure writes by one instance are not seen by another
+        m_behaviorContext->Property("globalMySubValue", BehaviorValueProperty(&mySubValue));
+        const AZStd::string script = "local test = {\
+                        state = {\
+                            mysubstate = {\
+                               mysubvalue = 2,\
+                            },\
+                          },\
+                        }\
+                        function test:OnActivate()\
+                          self.state.mysubstate.mysubvalue = self.state.mysubstate.mysubvalue + 1\
+                          globalMySubValue = self.state.mysubstate.mysubvalue\
+                        end\
+                        return test;";
+
+        auto scriptAssetOpt = CreateAndLoadScriptAsset(script, *m_scriptContext);
+        AZ_TEST_ASSERT(scriptAssetOpt);
+        auto& scriptAsset = *scriptAssetOpt;
+
+        auto* entity1 = aznew Entity();
+        entity1->CreateComponent<ScriptComponent>()->SetScript(scriptAsset);
+        entity1->Init();
+        entity1->Activate();
+        EXPECT_EQ(3, mySubValue);
+
+        auto* entity2 = aznew Entity();
+        entity2->CreateComponent<ScriptComponent>()->SetScript(scriptAsset);
+        entity2->Init();
+        entity2->Activate();
+        EXPECT_EQ(3, mySubValue);
+
+        delete entity1;
+        delete entity2;
+    }
+
+    TEST_F(ScriptComponentTest, ScriptInstanceSubtablesKeepMetamethods)
+    {
+        // the source subtable is the metatable of the instance subtable, so the metamethods it defines apply to the instance subtable
+        m_behaviorContext->Property("globalMySubValue", BehaviorValueProperty(&mySubValue));
+        const AZStd::string script = "local test = {\
+                        state = {\
+                            value = 2,\
+                            __tostring = function(t) return 'state' end,\
+                            __eq = function(a, b) return a.value == b.value end,\
+                            __call = function(t, x) return t.value + x end,\
+                          },\
+                        }\
+                        function test:OnActivate()\
+                          local passed = 0\
+                          if tostring(self.state) == 'state' then passed = passed + 1 end\
+                          if self.state(1) == 3 then passed = passed + 1 end\
+                          if self.state == setmetatable({}, getmetatable(self.state)) then passed = passed + 1 end\
+                          globalMySubValue = passed\
+                        end\
+                        return test;";
+
+        auto scriptAssetOpt = CreateAndLoadScriptAsset(script, *m_scriptContext);
+        AZ_TEST_ASSERT(scriptAssetOpt);
+        auto& scriptAsset = *scriptAssetOpt;
+
+        auto* entity = aznew Entity();
+        entity->CreateComponent<ScriptComponent>()->SetScript(scriptAsset);
+        entity->Init();
+        entity->Activate();
+        EXPECT_EQ(3, mySubValue);
+
+        delete entity;
+    }
+
+    TEST_F(ScriptComponentTest, ScriptInstanceSubtablesAreAddedOnFirstRead)
+    {
+        // a subtable is only added to the instance table the first time it's read, so it isn't seen by rawget or pairs before that
+        m_behaviorContext->Property("globalMySubValue", BehaviorValueProperty(&mySubValue));
+        const AZStd::string script = "local test = {\
+                        state = {\
+                            value = 2,\
+                          },\
+                        }\
+                        function test:OnActivate()\
+                          local passed = 0\
+                          if rawget(self, 'state') == nil then passed = passed + 1 end\
+                          local state = self.state\
+                          if rawget(self, 'state') == state and state.value == 2 then passed = passed + 1 end\
+                          local found = false\
+                          for key, value in pairs(self) do if key == 'state' and value == state then found = true end end\
+                          if found then passed = passed + 1 end\
+                          globalMySubValue = passed\
+                        end\
+                        return test;";
+
+        auto scriptAssetOpt = CreateAndLoadScriptAsset(script, *m_scriptContext);
+        AZ_TEST_ASSERT(scriptAssetOpt);
+        auto& scriptAsset = *scriptAssetOpt;
+
+        auto* entity = aznew Entity();
+        entity->CreateComponent<ScriptComponent>()->SetScript(scriptAsset);
+        entity->Init();
+        entity->Activate();
+        EXPECT_EQ(3, mySubValue);
+
+        delete entity;
+    }
+
     TEST_F(ScriptComponentTest, ScriptReloads)
     {
         // Test script reload
@@ -15,6 +15,7 @@ set(FILES
     ActionManager/MenuManagerTests.cpp
     ActionManager/ToolBarManagerTests.cpp
     ArchiveTests.cpp
+    AssetBundleBuildStateTests.cpp
     AssetFileInfoListComparison.cpp
     AssetSeedManager.cpp
     AssetSystemMocks.h
@@ -170,6 +171,7 @@ set(FILES
     PythonBindingTests.cpp
     QtWidgetLimitsTests.cpp
     Script/LuaEditorSystemComponentTests.cpp
+    Script/ScriptComponentBenchmarks.cpp
     Script/ScriptComponentTests.cpp
     Script/ScriptEntityTests.cpp
     Slice.cpp
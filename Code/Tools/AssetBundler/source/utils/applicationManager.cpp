@@ -16,6 +16,7 @@
 #include <AzCore/Module/DynamicModuleHandle.h>
 #include <AzCore/Module/ModuleManagerBus.h>
 #include <AzCore/Slice/SliceSystemComponent.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
@@ -2228,6 +2229,7 @@ namespace AssetBundler
                 }
 
                 AZ_TracePrintf(AssetBundler::AppWindowName, "Creating Bundle ( %s )...\n", bundleFilePath.AbsolutePath().c_str());
+                const AZStd::chrono::steady_clock::time_point startTime = AZStd::chrono::steady_clock::now();
                 bool result = false;
                 AssetBundleCommandsBus::BroadcastResult(result, &AssetBundleCommandsBus::Events::CreateAssetBundle, bundleSettings.first);
                 if (!result)
@@ -2236,7 +2238,9 @@ namespace AssetBundler
                     failureCount.fetch_add(1, AZStd::memory_order::memory_order_relaxed);
                     return;
                 }
-                AZ_TracePrintf(AssetBundler::AppWindowName, "Bundle ( %s ) created successfully!\n", bundleFilePath.AbsolutePath().c_str());
+                // bundles that haven't changed since they were last built are skipped, so this shows what an incremental run saves.
+                const AZStd::chrono::duration<float> elapsedTime = AZStd::chrono::steady_clock::now() - startTime;
+                AZ_TracePrintf(AssetBundler::AppWindowName, "Bundle ( %s ) created successfully in %.2f seconds!\n", bundleFilePath.AbsolutePath().c_str(), elapsedTime.count());
             });
 
         return failureCount == 0;
@@ -10,4 +10,6 @@ set(FILES
     native/FileWatcher/FileWatcher_linux.cpp
     native/FileWatcher/FileWatcher_linux.h
     native/FileWatcher/FileWatcher_platform.h
+    native/utilities/FileIdentity_linux.cpp
+    native/utilities/SystemMemory_linux.cpp
 )
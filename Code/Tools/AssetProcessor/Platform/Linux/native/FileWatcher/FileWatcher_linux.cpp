@@ -12,6 +12,7 @@
 #include <native/FileWatcher/FileWatcher_platform.h>
 
 #include <QDirIterator>
+#include <QElapsedTimer>
 #include <QHash>
 #include <QFileInfo>
 
@@ -60,6 +61,37 @@ static constexpr size_t s_inotifyMaxEntries = 1024 * 16;         // Control the
 static constexpr size_t s_inotifyEventSize = sizeof(struct inotify_event);
 static constexpr size_t s_inotifyReadBufferSize = s_inotifyMaxEntries * s_inotifyEventSize;
 
+// Changes are coalesced into batches which are sent once no event has arrived for this long after the first one
+// in the batch, or once the batch is this large, whichever comes first.  This keeps a large checkout from posting
+// one event per file to the main thread.
+static constexpr qint64 s_batchWindowMS = 50;
+static constexpr int s_maxBatchSize = 10000;
+
+// Returns the deepest directory containing both of the given absolute directories,
+// or an empty string if they only share the file system root.
+static QString CommonAncestor(const QString& first, const QString& second)
+{
+    const int maxLength = AZStd::min(first.length(), second.length());
+    int length = 0;
+    while ((length < maxLength) && (first[length] == second[length]))
+    {
+        ++length;
+    }
+
+    if ((length == first.length()) && ((length == second.length()) || (second[length] == '/')))
+    {
+        return first;
+    }
+    if ((length == second.length()) && (first[length] == '/'))
+    {
+        return second;
+    }
+
+    // the common prefix may end in the middle of a directory name, so cut it back to the last whole directory.
+    const int lastSeparator = first.lastIndexOf('/', length - 1);
+    return (lastSeparator > 0) ? first.left(lastSeparator) : QString();
+}
+
 bool FileWatcher::PlatformImplementation::Initialize()
 {
     if (m_inotifyHandle < 0)
@@ -108,6 +140,124 @@ void FileWatcher::PlatformImplementation::Finalize()
     }
     m_handleToFolderMap.clear();
     m_alreadyNotifiedCreate.clear();
+    m_pendingChanges.clear();
+    m_pendingChangeIndex.clear();
+    m_pendingChangesRoot.clear();
+    m_pendingDirectoryMoves.clear();
+    m_renamedWatchHandles.clear();
+}
+
+void FileWatcher::PlatformImplementation::QueueChange(FileChange::Type type, const QString& path)
+{
+    if (type == FileChange::Type::Modified)
+    {
+        // inotify reports a modification for every write to a file, only the first of a run of them is worth sending.
+        auto lastChange = m_pendingChangeIndex.constFind(path);
+        if ((lastChange != m_pendingChangeIndex.constEnd()) && (m_pendingChanges[lastChange.value()].m_type == FileChange::Type::Modified))
+        {
+            return;
+        }
+    }
+
+    m_pendingChangeIndex[path] = m_pendingChanges.size();
+    m_pendingChanges.push_back({ type, path });
+
+    // remember where the changes in this batch are happening, in case the queue overflows.
+    const QString directory = QFileInfo(path).path();
+    m_pendingChangesRoot = (m_pendingChanges.size() == 1) ? directory : CommonAncestor(m_pendingChangesRoot, directory);
+}
+
+void FileWatcher::PlatformImplementation::RenameWatchedSubtree(const QString& oldPath, const QString& newPath)
+{
+    const QString oldPrefix = oldPath + '/';
+    for (auto it = m_handleToFolderMap.begin(); it != m_handleToFolderMap.end(); ++it)
+    {
+        if (it.value() == oldPath)
+        {
+            it.value() = newPath;
+            m_renamedWatchHandles.insert(it.key());
+        }
+        else if (it.value().startsWith(oldPrefix))
+        {
+            it.value() = newPath + it.value().mid(oldPath.length());
+        }
+    }
+    DEBUG_FILEWATCHER("renamed watches of (%s) to (%s)\n", oldPath.toUtf8().constData(), newPath.toUtf8().constData());
+}
+
+void FileWatcher::PlatformImplementation::RemoveWatchedSubtree(const QString& path)
+{
+    if ((m_inotifyHandle < 0) || (path.isEmpty()))
+    {
+        return;
+    }
+
+    const QString prefix = path + '/';
+    for (auto it = m_handleToFolderMap.begin(); it != m_handleToFolderMap.end();)
+    {
+        if ((it.value() == path) || (it.value().startsWith(prefix)))
+        {
+            inotify_rm_watch(m_inotifyHandle, it.key());
+            it = m_handleToFolderMap.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void FileWatcher::PlatformImplementation::RescanSubtree(const QString& path, bool recursive, FileWatcher& source)
+{
+    DEBUG_FILEWATCHER("rescanning (%s) after the event queue overflowed\n", path.toUtf8().constData());
+
+    // Note that these are not added to m_alreadyNotifiedCreate: most of these files already existed, and will never
+    // get a create event to remove them from it again.  A file created right as the queue overflowed may be reported twice.
+    auto queueAdded = [this](const QString& addedPath)
+    {
+        if (!m_alreadyNotifiedCreate.contains(addedPath))
+        {
+            QueueChange(FileChange::Type::Added, addedPath);
+        }
+    };
+
+    QList<QString> dirsToList;
+    dirsToList.push_back(path);
+
+    QDirIterator dirIter(
+        path, QDir::NoDotAndDotDot | QDir::Dirs,
+        (recursive ? QDirIterator::Subdirectories : QDirIterator::NoIteratorFlags) | QDirIterator::FollowSymlinks);
+
+    while (dirIter.hasNext())
+    {
+        QString dirPath = dirIter.next();
+        if (source.IsExcluded(dirPath))
+        {
+            continue;
+        }
+
+        queueAdded(dirPath);
+
+        if (recursive)
+        {
+            // establishes the watches on directories whose creation was lost, the rest already have one (EEXIST).
+            TryToWatch(dirPath, nullptr);
+            dirsToList.push_back(dirPath);
+        }
+    }
+
+    for (const QString& dirPath : dirsToList)
+    {
+        QFileInfoList filesInDir = QDir(dirPath).entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+        for (const QFileInfo& fileInfo : filesInDir)
+        {
+            QString filePath = fileInfo.absoluteFilePath();
+            if (!source.IsExcluded(filePath))
+            {
+                queueAdded(filePath);
+            }
+        }
+    }
 }
 
 bool FileWatcher::PlatformImplementation::TryToWatch(const QString &pathStr, int* errnoPtr)
@@ -200,8 +350,8 @@ void FileWatcher::PlatformImplementation::AddWatchFolder(QString folder, bool re
         {
             if (!m_alreadyNotifiedCreate.contains(dirPath))
             {
-                DEBUG_FILEWATCHER("%s rawFileAdded for root AddWatchFolder\n", dirPath.toUtf8().constData());
-                source.rawFileAdded(dirPath, {});
+                DEBUG_FILEWATCHER("%s queued as added for root AddWatchFolder\n", dirPath.toUtf8().constData());
+                QueueChange(FileChange::Type::Added, dirPath);
                 m_alreadyNotifiedCreate.insert(dirPath);
             }
         }
@@ -256,8 +406,8 @@ void FileWatcher::PlatformImplementation::AddWatchFolder(QString folder, bool re
 
                 if (!m_alreadyNotifiedCreate.contains(filePath))
                 {
-                    DEBUG_FILEWATCHER("%s rawFileAdded via recursive directory crawl for file\n", filePath.toUtf8().constData());
-                    source.rawFileAdded(filePath, {});
+                    DEBUG_FILEWATCHER("%s queued as added via recursive directory crawl for file\n", filePath.toUtf8().constData());
+                    QueueChange(FileChange::Type::Added, filePath);
                     m_alreadyNotifiedCreate.insert(filePath);
                 }
             }
@@ -321,6 +471,31 @@ void FileWatcher::WatchFolderLoop()
     constexpr const nfds_t nfds = 2;
     struct pollfd fds[nfds];
 
+    // Changes are filtered here rather than on the main thread, and sent as a single batch.
+    auto sendPendingChanges = [this]()
+    {
+        FileChangeList changes;
+        changes.reserve(m_platformImpl->m_pendingChanges.size());
+        for (FileChange& change : m_platformImpl->m_pendingChanges)
+        {
+            if (ShouldReport(change.m_filePath))
+            {
+                changes.push_back(AZStd::move(change));
+            }
+        }
+        m_platformImpl->m_pendingChanges.clear();
+        m_platformImpl->m_pendingChangeIndex.clear();
+        m_platformImpl->m_pendingChangesRoot.clear();
+
+        if (!changes.isEmpty())
+        {
+            DEBUG_FILEWATCHER("sending a batch of %i changes\n", static_cast<int>(changes.size()));
+            rawFilesChanged(changes, {});
+        }
+    };
+
+    QElapsedTimer batchTimer;
+
     m_startedSignal = true; // signal that we are no longer going to drop any events.
 
     while (!m_shutdownThreadSignal)
@@ -332,12 +507,26 @@ void FileWatcher::WatchFolderLoop()
         fds[1].fd = m_platformImpl->m_inotifyHandle; 
         fds[1].events = POLLIN;
 
-        int numPollEvents = poll(fds, nfds, -1);
+        // with changes waiting to be sent, only wait for more until the batch window has elapsed.
+        int timeoutMS = -1;
+        if (!m_platformImpl->m_pendingChanges.isEmpty())
+        {
+            timeoutMS = static_cast<int>(AZStd::max<qint64>(s_batchWindowMS - batchTimer.elapsed(), 0));
+        }
+
+        int numPollEvents = poll(fds, nfds, timeoutMS);
         if (numPollEvents == -1) 
         {
             break; // error polling.
         }
 
+        if (numPollEvents == 0)
+        {
+            // the stream of events paused
+            sendPendingChanges();
+            continue;
+        }
+
         // were we woken up by the wake thread event?
         if (fds[0].revents & POLLIN)
         {
@@ -367,11 +556,37 @@ void FileWatcher::WatchFolderLoop()
 
         cycleCount++;
 
+        if (m_platformImpl->m_pendingChanges.isEmpty())
+        {
+            batchTimer.start();
+        }
+
         for (size_t index=0; index<bytesRead;)
         {
             const auto* event = reinterpret_cast<inotify_event*>(&eventBuffer[index]);
 
-            if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE | IN_DELETE_SELF | IN_MOVE_SELF ))
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                // The kernel dropped events because they arrived faster than they were read, and there is no way to know
+                // which ones.  Rescan the smallest subtree containing the changes of this batch (during a large checkout or
+                // copy, that is where the rest of the burst went), or every watched folder if there were no changes yet.
+                const QString changedRoot = m_platformImpl->m_pendingChangesRoot;
+                AZ_TracePrintf("FileWatcher", "The inotify event queue overflowed, rescanning %s\n",
+                    changedRoot.isEmpty() ? "all watched folders" : changedRoot.toUtf8().constData());
+
+                for (const WatchRoot& watchRoot : m_folderWatchRoots)
+                {
+                    if ((changedRoot.isEmpty()) || (watchRoot.m_directory == changedRoot) || (watchRoot.m_directory.startsWith(changedRoot + '/')))
+                    {
+                        m_platformImpl->RescanSubtree(watchRoot.m_directory, watchRoot.m_recursive, *this);
+                    }
+                    else if ((watchRoot.m_recursive) && (changedRoot.startsWith(watchRoot.m_directory + '/')))
+                    {
+                        m_platformImpl->RescanSubtree(changedRoot, true, *this);
+                    }
+                }
+            }
+            else if (event->mask & (IN_CREATE | IN_DELETE | IN_MODIFY | IN_MOVE | IN_DELETE_SELF | IN_MOVE_SELF ))
             {
                 // note that the event->name coming in is relative to the thing being watched.  Since we watch folders,
                 // for the folder itself, this will be blank, for files in it, it will be the file name.
@@ -391,48 +606,67 @@ void FileWatcher::WatchFolderLoop()
                     
                     if (event->mask & IN_ISDIR)
                     {
+                        // a directory renamed inside of the watched tree arrives as an IN_MOVED_FROM / IN_MOVED_TO pair sharing a cookie.
+                        // Its watches (and those of everything in it) moved along with it, so it does not need to be crawled again.
+                        const QString movedFromPath = (event->mask & IN_MOVED_TO) ? m_platformImpl->m_pendingDirectoryMoves.take(event->cookie) : QString();
+                        bool watchesRenamed = false;
+
                         // for directories, we only care about create or delete, not modify
                         // so we only need to add a watch to them if they may have children we're interested in.
                         // this is only the case if they are either a child of a recursive root folder, or if they are a child
                         // of some non-root folder (because that infers that their parent is recursive)
                         if ((isChildOfRecursiveRootFolder) || (!isChildOfRootFolder))
                         {
-                            // note that we check IsExcluded inside AddWatchFolder, but its also checked inside all the
-                            // raw*** functions like rawFileAdded.  Since IsExcluded is expensive, we check it once here
-                            // and if so, we don't send it to AddWatchFolder and we don't send it to the raw file queue either,
+                            // note that we check IsExcluded inside AddWatchFolder, but its also checked again before the
+                            // batch is sent.  Since IsExcluded is expensive, we check it once here
+                            // and if so, we don't send it to AddWatchFolder and we don't queue it either,
                             // avoiding multiple redundant IsExcluded calls.
                             if (!IsExcluded(pathStr))
                             {
                                 // first, notify about the folder itself, to keep things in order (ie, parent folders then child folders, then files):
                                 if (!m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr))
                                 {
-                                    DEBUG_FILEWATCHER("sending rawFileAdded(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
-                                    rawFileAdded(pathStr, {});
+                                    DEBUG_FILEWATCHER("queueing added(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
+                                    m_platformImpl->QueueChange(FileChange::Type::Added, pathStr);
                                 }
 
-                                // when a folder is MOVED, we don't notify for all the files inside that folder, only
-                                // the folder itself, so as to be consistent with other implementations and the API Contract:
-                                bool shouldNotifyAllFilesInFolder = (event->mask & IN_MOVED_TO) == 0;
-                                m_platformImpl->AddWatchFolder(pathStr, true, *this, shouldNotifyAllFilesInFolder);
+                                if (!movedFromPath.isEmpty())
+                                {
+                                    m_platformImpl->RenameWatchedSubtree(movedFromPath, pathStr);
+                                    watchesRenamed = true;
+                                }
+                                else
+                                {
+                                    // when a folder is MOVED, we don't notify for all the files inside that folder, only
+                                    // the folder itself, so as to be consistent with other implementations and the API Contract:
+                                    bool shouldNotifyAllFilesInFolder = (event->mask & IN_MOVED_TO) == 0;
+                                    m_platformImpl->AddWatchFolder(pathStr, true, *this, shouldNotifyAllFilesInFolder);
+                                }
                             }
                             else
                             {
                                 DEBUG_FILEWATCHER("'%s'excluded during notify event - dropping \n", pathStr.toUtf8().constData());
                             }
                         }
+
+                        if ((!movedFromPath.isEmpty()) && (!watchesRenamed))
+                        {
+                            // moved somewhere that should not be watched
+                            m_platformImpl->RemoveWatchedSubtree(movedFromPath);
+                        }
                     }
                     else
                     {
-                        // if we get here, we're looking at a file create/move.  In that case, we always send the notify.  
-                        // note that rawFileAdded will eventually check it for ignore anyway.
+                        // if we get here, we're looking at a file create/move.  In that case, we always queue the notify.  
+                        // note that it will be checked for exclusion before the batch is sent anyway.
                         if (!m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr))
                         {
-                            DEBUG_FILEWATCHER("sending rawFileAdded(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
-                            rawFileAdded(pathStr, {});
+                            DEBUG_FILEWATCHER("queueing added(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
+                            m_platformImpl->QueueChange(FileChange::Type::Added, pathStr);
                         }
                         else
                         {
-                            DEBUG_FILEWATCHER("SKIPPING sending rawFileAdded(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
+                            DEBUG_FILEWATCHER("SKIPPING queueing added(%s) from file monitor cycle: %i \n", pathStr.toUtf8().constData(), cycleCount);
                         }
                     }
                 }
@@ -440,31 +674,63 @@ void FileWatcher::WatchFolderLoop()
                 if (event->mask & (IN_DELETE | IN_MOVED_FROM))
                 {
                     DEBUG_FILEWATCHER("notify event is IN_DELETE | IN_MOVED_FROM: %s (from '%s' - handle %i) cycle: %i\n", pathStr.toUtf8().constData(), event->name, event->wd, cycleCount);
-                    DEBUG_FILEWATCHER("sending rawFileRemoved(%s)\n", pathStr.toUtf8().constData());
+                    DEBUG_FILEWATCHER("queueing removed(%s)\n", pathStr.toUtf8().constData());
+                    if ((event->mask & IN_MOVED_FROM) && (event->mask & IN_ISDIR))
+                    {
+                        m_platformImpl->m_pendingDirectoryMoves[event->cookie] = pathStr;
+                    }
                     m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr);
-                    rawFileRemoved(pathStr, {});
+                    m_platformImpl->QueueChange(FileChange::Type::Removed, pathStr);
                 }
 
                 if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF))
                 {
                     // This is called on the actual watched folder being moved out, or deleted.
                     // Because we only watch folders, not files, we can assume that the object that this event is coming from is a folder.
-
-                    // If its a move as opposed to delete, it will also be accompanied by a IN_MOVED_FROM and IN_MOVED_TO, so we should 
-                    // uninstall any watch here, since IN_MOVED_TO will install a new one if necessary.
                     DEBUG_FILEWATCHER("notify event is IN_MOVE_SELF | IN_DELETE_SELF: %s (from '%s' handle %i ) cycle: %i \n", pathStr.toUtf8().constData(), event->name, event->wd, cycleCount);
-                    DEBUG_FILEWATCHER("removing watch dir (%s)\n", pathStr.toUtf8().constData());
                     m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr);
-                    m_platformImpl->RemoveWatchFolder(event->wd);
+
+                    if (event->mask & IN_MOVE_SELF)
+                    {
+                        // IN_MOVE_SELF follows the IN_MOVED_FROM / IN_MOVED_TO pair.  If the pair matched, the watch was renamed
+                        // and is kept.  Otherwise the folder left the watched tree, and the watches of everything in it go too.
+                        if (!m_platformImpl->m_renamedWatchHandles.remove(event->wd))
+                        {
+                            DEBUG_FILEWATCHER("removing watch subtree (%s)\n", pathStr.toUtf8().constData());
+                            const QString movedPath = m_platformImpl->m_handleToFolderMap.value(event->wd);
+                            for (auto it = m_platformImpl->m_pendingDirectoryMoves.begin(); it != m_platformImpl->m_pendingDirectoryMoves.end();)
+                            {
+                                if (it.value() == movedPath)
+                                {
+                                    it = m_platformImpl->m_pendingDirectoryMoves.erase(it);
+                                }
+                                else
+                                {
+                                    ++it;
+                                }
+                            }
+                            m_platformImpl->RemoveWatchedSubtree(movedPath);
+                        }
+                    }
+                    else
+                    {
+                        DEBUG_FILEWATCHER("removing watch dir (%s)\n", pathStr.toUtf8().constData());
+                        m_platformImpl->RemoveWatchFolder(event->wd);
+                    }
                 }
                 if (event->mask & IN_MODIFY)
                 {
-                    DEBUG_FILEWATCHER("notify event is modify, sending rawFileModified: '%s' (from event-Name '%s') cycle: %i mask 0x%08x\n", pathStr.toUtf8().constData(), event->name, cycleCount, event->mask);
+                    DEBUG_FILEWATCHER("notify event is modify, queueing modified: '%s' (from event-Name '%s') cycle: %i mask 0x%08x\n", pathStr.toUtf8().constData(), event->name, cycleCount, event->mask);
                     m_platformImpl->m_alreadyNotifiedCreate.remove(pathStr);
-                    rawFileModified(pathStr, {});
+                    m_platformImpl->QueueChange(FileChange::Type::Modified, pathStr);
                 }
             }
             index += s_inotifyEventSize + event->len;
         }
+
+        if ((m_platformImpl->m_pendingChanges.size() >= s_maxBatchSize) || (batchTimer.elapsed() >= s_batchWindowMS))
+        {
+            sendPendingChanges();
+        }
     }
 }
@@ -29,6 +29,21 @@ public:
     //! @return Was the watch successful?
     bool TryToWatch(const QString &path, int* errnoPtr = nullptr);
 
+    //! Queues a change to be sent with the next batch.  A modification is dropped when the last change
+    //! queued for the same path was also a modification, since consumers only read the file once the batch arrives.
+    void QueueChange(FileChange::Type type, const QString& path);
+
+    //! Points the watches of a directory that was renamed inside the watched tree, and of every directory under it,
+    //! at their new paths, instead of removing them and crawling the directory again.
+    void RenameWatchedSubtree(const QString& oldPath, const QString& newPath);
+
+    //! Removes the watches of a directory and every directory under it.
+    void RemoveWatchedSubtree(const QString& path);
+
+    //! Recovers from events lost when the inotify queue overflowed: establishes any missing watches under the
+    //! given directory and queues every file and directory in it as added.
+    void RescanSubtree(const QString& path, bool recursive, FileWatcher& source);
+
     // This handle represents the handle to the entire notify tree.
     // Individual watches will be added to this same handle.
     int                         m_inotifyHandle = -1;
@@ -38,4 +53,14 @@ public:
     
     QHash<int, QString>         m_handleToFolderMap;
     QSet<QString>               m_alreadyNotifiedCreate;
+
+    // The batch of changes which will be sent once the stream of events pauses (or the batch gets too large).
+    FileChangeList              m_pendingChanges;
+    QHash<QString, int>         m_pendingChangeIndex; // path -> index in m_pendingChanges of the last change to that path
+    QString                     m_pendingChangesRoot; // the deepest directory containing all of the pending changes
+
+    // IN_MOVED_FROM cookie -> the path a directory was moved away from, waiting for the matching IN_MOVED_TO
+    QHash<AZ::u32, QString>     m_pendingDirectoryMoves;
+    // watches which have moved along with their renamed directory, so their IN_MOVE_SELF must not remove them
+    QSet<int>                   m_renamedWatchHandles;
 };
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/assetUtils.h>
+
+#include <sys/stat.h>
+
+namespace AssetUtilities
+{
+    AZ::u64 GetFileIdentity(const char* filePath)
+    {
+        struct stat fileStat;
+        if (!filePath || stat(filePath, &fileStat) != 0)
+        {
+            return 0;
+        }
+
+        // the device is folded into the high bits, so that files with the same inode on different volumes are told apart
+        return static_cast<AZ::u64>(fileStat.st_ino) ^ (static_cast<AZ::u64>(fileStat.st_dev) << 48);
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/assetUtils.h>
+
+#include <stdio.h>
+
+namespace AssetUtilities
+{
+    AZ::u64 GetAvailablePhysicalMemory()
+    {
+        FILE* memInfo = fopen("/proc/meminfo", "r");
+        if (!memInfo)
+        {
+            return 0;
+        }
+
+        // MemAvailable counts the free memory plus the caches the kernel can drop, which is what a new process can use
+        AZ::u64 availableBytes = 0;
+        char line[256];
+        while (fgets(line, sizeof(line), memInfo))
+        {
+            unsigned long long availableKB = 0;
+            if (sscanf(line, "MemAvailable: %llu kB", &availableKB) == 1)
+            {
+                availableBytes = static_cast<AZ::u64>(availableKB) * 1024;
+                break;
+            }
+        }
+        fclose(memInfo);
+        return availableBytes;
+    }
+}
@@ -10,4 +10,6 @@ set(FILES
     native/FileWatcher/FileWatcher_macos.cpp
     native/FileWatcher/FileWatcher_mac.h
     native/FileWatcher/FileWatcher_platform.h
+    native/utilities/FileIdentity_mac.cpp
+    native/utilities/SystemMemory_mac.cpp
 )
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/assetUtils.h>
+
+#include <mach/mach.h>
+
+namespace AssetUtilities
+{
+    AZ::u64 GetAvailablePhysicalMemory()
+    {
+        vm_size_t pageSize = 0;
+        vm_statistics64_data_t vmStats;
+        mach_msg_type_number_t count = HOST_VM_INFO64_COUNT;
+        mach_port_t host = mach_host_self();
+        if (host_page_size(host, &pageSize) != KERN_SUCCESS
+            || host_statistics64(host, HOST_VM_INFO64, reinterpret_cast<host_info64_t>(&vmStats), &count) != KERN_SUCCESS)
+        {
+            return 0;
+        }
+
+        // inactive pages can be reclaimed without swapping, so they count as available along with the free ones
+        return static_cast<AZ::u64>(vmStats.free_count + vmStats.inactive_count) * pageSize;
+    }
+}
@@ -10,4 +10,6 @@ set(FILES
     native/FileWatcher/FileWatcher_platform.h
     native/FileWatcher/FileWatcher_windows.cpp
     native/FileWatcher/FileWatcher_windows.h
+    native/utilities/FileIdentity_windows.cpp
+    native/utilities/SystemMemory_windows.cpp
 )
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/assetUtils.h>
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+
+namespace AssetUtilities
+{
+    AZ::u64 GetFileIdentity(const char* filePath)
+    {
+        if (!filePath)
+        {
+            return 0;
+        }
+
+        AZStd::wstring filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+
+        // no access rights are needed to query the file information, which avoids conflicts with other processes using the file
+        HANDLE fileHandle = ::CreateFileW(
+            filePathW.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return 0;
+        }
+
+        BY_HANDLE_FILE_INFORMATION fileInformation;
+        const bool succeeded = ::GetFileInformationByHandle(fileHandle, &fileInformation) != 0;
+        ::CloseHandle(fileHandle);
+        if (!succeeded)
+        {
+            return 0;
+        }
+
+        // the volume serial number is folded into the high bits, so that files with the same index on different volumes are told apart
+        const AZ::u64 fileIndex = (static_cast<AZ::u64>(fileInformation.nFileIndexHigh) << 32) | fileInformation.nFileIndexLow;
+        return fileIndex ^ (static_cast<AZ::u64>(fileInformation.dwVolumeSerialNumber) << 32);
+    }
+}
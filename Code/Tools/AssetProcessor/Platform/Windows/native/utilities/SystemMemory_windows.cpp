@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/assetUtils.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AssetUtilities
+{
+    AZ::u64 GetAvailablePhysicalMemory()
+    {
+        MEMORYSTATUSEX memoryStatus;
+        memoryStatus.dwLength = sizeof(memoryStatus);
+        if (!::GlobalMemoryStatusEx(&memoryStatus))
+        {
+            return 0;
+        }
+        return static_cast<AZ::u64>(memoryStatus.ullAvailPhys);
+    }
+}
@@ -53,6 +53,8 @@ set(FILES
     native/FileWatcher/FileWatcherBase.h
     native/InternalBuilders/SettingsRegistryBuilder.cpp
     native/InternalBuilders/SettingsRegistryBuilder.h
+    native/resourcecompiler/JobCostHistory.cpp
+    native/resourcecompiler/JobCostHistory.h
     native/resourcecompiler/JobsModel.cpp
     native/resourcecompiler/JobsModel.h
     native/resourcecompiler/RCBuilder.cpp
@@ -95,6 +97,8 @@ set(FILES
     native/utilities/BuilderManager.inl
     native/utilities/ByteArrayStream.cpp
     native/utilities/ByteArrayStream.h
+    native/utilities/ContentAddressedJobCache.cpp
+    native/utilities/ContentAddressedJobCache.h
     native/utilities/IniConfiguration.cpp
     native/utilities/IniConfiguration.h
     native/utilities/JobDiagnosticTracker.cpp
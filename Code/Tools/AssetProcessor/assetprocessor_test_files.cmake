@@ -21,6 +21,7 @@ set(FILES
     native/tests/assetdatabase/AssetDatabaseTest.cpp
     native/tests/resourcecompiler/RCControllerTest.cpp
     native/tests/resourcecompiler/RCControllerTest.h
+    native/tests/resourcecompiler/JobCostHistoryTest.cpp
     native/tests/resourcecompiler/RCJobTest.cpp
     native/tests/assetBuilderSDK/assetBuilderSDKTest.h
     native/tests/assetBuilderSDK/assetBuilderSDKTest.cpp
@@ -181,6 +181,28 @@ namespace AssetProcessor
             "    LastLogTime    INTEGER NOT NULL "
             ");";
 
+        static const char* CREATE_SCANDIRECTORIES_TABLE = "AssetProcessor::CreateScanDirectoriesTable";
+        static const char* CREATE_SCANDIRECTORIES_TABLE_STATEMENT =
+            "CREATE TABLE IF NOT EXISTS ScanDirectories( "
+            "    ScanDirectoryID    INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "    ScanFolderPK       INTEGER NOT NULL, "
+            "    DirectoryName      TEXT NOT NULL collate nocase, "
+            "    ModTime            INTEGER NOT NULL, "
+            "    Entries            TEXT NOT NULL, "
+            "    UNIQUE (ScanFolderPK, DirectoryName), "
+            "    FOREIGN KEY (ScanFolderPK) REFERENCES "
+            "       ScanFolders(ScanFolderID) ON DELETE CASCADE);";
+
+        static const char* CREATE_FILEHASHES_TABLE = "AssetProcessor::CreateFileHashesTable";
+        static const char* CREATE_FILEHASHES_TABLE_STATEMENT =
+            "CREATE TABLE IF NOT EXISTS FileHashes( "
+            "    FileHashID     INTEGER PRIMARY KEY AUTOINCREMENT, "
+            "    FilePath       TEXT NOT NULL UNIQUE, "
+            "    FileSize       INTEGER NOT NULL, "
+            "    ModTime        INTEGER NOT NULL, "
+            "    FileIdentity   INTEGER NOT NULL, "
+            "    Hash           INTEGER NOT NULL);";
+
         //////////////////////////////////////////////////////////////////////////
         //indices
         static const char* CREATEINDEX_DEPENDSONSOURCE_SOURCEDEPENDENCY = "AssetProcesser::CreateIndexDependsOnSource_SourceDependency";
@@ -826,6 +848,41 @@ namespace AssetProcessor
             SqlParam<AZ::s64>(":statvalue"),
             SqlParam<AZ::s64>(":lastlogtime"));
 
+        static const char* REPLACE_SCANDIRECTORY = "AssetProcessor::ReplaceScanDirectory";
+        static const char* REPLACE_SCANDIRECTORY_STATEMENT =
+            "REPLACE INTO ScanDirectories (ScanFolderPK, DirectoryName, ModTime, Entries) "
+            "VALUES (:scanfolderpk, :directoryname, :modtime, :entries);";
+        static const auto s_ReplaceScanDirectoryQuery = MakeSqlQuery(REPLACE_SCANDIRECTORY, REPLACE_SCANDIRECTORY_STATEMENT, LOG_NAME,
+            SqlParam<AZ::s64>(":scanfolderpk"),
+            SqlParam<const char*>(":directoryname"),
+            SqlParam<AZ::u64>(":modtime"),
+            SqlParam<const char*>(":entries"));
+
+        static const char* DELETE_SCANDIRECTORY = "AssetProcessor::DeleteScanDirectory";
+        static const char* DELETE_SCANDIRECTORY_STATEMENT =
+            "DELETE FROM ScanDirectories WHERE "
+            "ScanDirectoryID = :scandirectoryid;";
+        static const auto s_DeleteScanDirectoryQuery = MakeSqlQuery(DELETE_SCANDIRECTORY, DELETE_SCANDIRECTORY_STATEMENT, LOG_NAME,
+            SqlParam<AZ::s64>(":scandirectoryid"));
+
+        static const char* REPLACE_FILEHASH = "AssetProcessor::ReplaceFileHash";
+        static const char* REPLACE_FILEHASH_STATEMENT =
+            "REPLACE INTO FileHashes (FilePath, FileSize, ModTime, FileIdentity, Hash) "
+            "VALUES (:filepath, :filesize, :modtime, :fileidentity, :hash);";
+        static const auto s_ReplaceFileHashQuery = MakeSqlQuery(REPLACE_FILEHASH, REPLACE_FILEHASH_STATEMENT, LOG_NAME,
+            SqlParam<const char*>(":filepath"),
+            SqlParam<AZ::u64>(":filesize"),
+            SqlParam<AZ::u64>(":modtime"),
+            SqlParam<AZ::u64>(":fileidentity"),
+            SqlParam<AZ::u64>(":hash"));
+
+        static const char* DELETE_FILEHASH_BY_FILEPATH = "AssetProcessor::DeleteFileHashByFilePath";
+        static const char* DELETE_FILEHASH_BY_FILEPATH_STATEMENT =
+            "DELETE FROM FileHashes WHERE "
+            "FilePath = :filepath;";
+        static const auto s_DeleteFileHashByFilePathQuery = MakeSqlQuery(DELETE_FILEHASH_BY_FILEPATH, DELETE_FILEHASH_BY_FILEPATH_STATEMENT, LOG_NAME,
+            SqlParam<const char*>(":filepath"));
+
         static const char* CREATEINDEX_SOURCEDEPENDENCY_SOURCE = "AssetProcesser::CreateIndexSourceSourceDependency";
         static const char* CREATEINDEX_SOURCEDEPENDENCY_SOURCE_STATEMENT =
             "CREATE INDEX IF NOT EXISTS Source_SourceDependency ON SourceDependency (Source);";
@@ -1227,6 +1284,26 @@ namespace AssetProcessor
             }
         }
 
+        if (foundVersion == DatabaseVersion::AddedMissingDependenciesIndex)
+        {
+            if (m_databaseConnection->ExecuteOneOffStatement(CREATE_SCANDIRECTORIES_TABLE))
+            {
+                foundVersion = DatabaseVersion::AddedScanDirectoriesTable;
+                AZ_TracePrintf(
+                    AssetProcessor::ConsoleChannel, "Upgraded Asset Database to version %i (AddedScanDirectoriesTable)\n", foundVersion);
+            }
+        }
+
+        if (foundVersion == DatabaseVersion::AddedScanDirectoriesTable)
+        {
+            if (m_databaseConnection->ExecuteOneOffStatement(CREATE_FILEHASHES_TABLE))
+            {
+                foundVersion = DatabaseVersion::AddedFileHashesTable;
+                AZ_TracePrintf(
+                    AssetProcessor::ConsoleChannel, "Upgraded Asset Database to version %i (AddedFileHashesTable)\n", foundVersion);
+            }
+        }
+
         if (foundVersion == CurrentDatabaseVersion())
         {
             dropAllTables = false;
@@ -1461,6 +1538,24 @@ namespace AssetProcessor
 
         m_databaseConnection->AddStatement(REPLACE_STAT, REPLACE_STAT_STATEMENT);
 
+        // ---------------------------------------------------------------------------------------------
+        //                  ScanDirectories table
+        // ---------------------------------------------------------------------------------------------
+        m_databaseConnection->AddStatement(CREATE_SCANDIRECTORIES_TABLE, CREATE_SCANDIRECTORIES_TABLE_STATEMENT);
+        m_createStatements.push_back(CREATE_SCANDIRECTORIES_TABLE);
+
+        m_databaseConnection->AddStatement(REPLACE_SCANDIRECTORY, REPLACE_SCANDIRECTORY_STATEMENT);
+        m_databaseConnection->AddStatement(DELETE_SCANDIRECTORY, DELETE_SCANDIRECTORY_STATEMENT);
+
+        // ---------------------------------------------------------------------------------------------
+        //                  FileHashes table
+        // ---------------------------------------------------------------------------------------------
+        m_databaseConnection->AddStatement(CREATE_FILEHASHES_TABLE, CREATE_FILEHASHES_TABLE_STATEMENT);
+        m_createStatements.push_back(CREATE_FILEHASHES_TABLE);
+
+        m_databaseConnection->AddStatement(REPLACE_FILEHASH, REPLACE_FILEHASH_STATEMENT);
+        m_databaseConnection->AddStatement(DELETE_FILEHASH_BY_FILEPATH, DELETE_FILEHASH_BY_FILEPATH_STATEMENT);
+
         // ---------------------------------------------------------------------------------------------
         //                   Indices
         // ---------------------------------------------------------------------------------------------
@@ -1540,6 +1635,25 @@ namespace AssetProcessor
         }
     }
 
+    AssetDatabaseConnection::ScopedWriteBatch::ScopedWriteBatch(AssetDatabaseConnection& connection)
+    {
+        if (connection.m_databaseConnection)
+        {
+            m_transaction = AZStd::make_unique<ScopedTransaction>(connection.m_databaseConnection);
+        }
+    }
+
+    AssetDatabaseConnection::ScopedWriteBatch::~ScopedWriteBatch() = default;
+
+    void AssetDatabaseConnection::ScopedWriteBatch::Commit()
+    {
+        if (m_transaction)
+        {
+            m_transaction->Commit();
+            m_transaction.reset();
+        }
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -3475,6 +3589,82 @@ namespace AssetProcessor
         return s_ReplaceStatQuery.BindAndStep(*m_databaseConnection, stat.m_statName.c_str(), stat.m_statValue, stat.m_lastLogTime);
     }
 
+    bool AssetDatabaseConnection::GetScanDirectoriesByScanFolderId(AZ::s64 scanFolderId, ScanDirectoryDatabaseEntryContainer& container)
+    {
+        bool found = false;
+        bool succeeded = QueryScanDirectoriesByScanFolderID(
+            scanFolderId,
+            [&](ScanDirectoryDatabaseEntry& scanDirectory)
+            {
+                found = true;
+                container.emplace_back() = AZStd::move(scanDirectory);
+                return true; // return true to continue iterating over additional results, we are populating a container
+            });
+        return found && succeeded;
+    }
+
+    bool AssetDatabaseConnection::UpdateScanDirectories(
+        const ScanDirectoryDatabaseEntryContainer& changedEntries, const AZStd::vector<AZ::s64>& removedScanDirectoryIds)
+    {
+        // Skip creating and committing a scoped transaction, if there is nothing to update.
+        if (changedEntries.empty() && removedScanDirectoryIds.empty())
+        {
+            return true;
+        }
+        ScopedTransaction transaction(m_databaseConnection);
+
+        for (AZ::s64 scanDirectoryId : removedScanDirectoryIds)
+        {
+            if (!s_DeleteScanDirectoryQuery.BindAndStep(*m_databaseConnection, scanDirectoryId))
+            {
+                return false;
+            }
+        }
+
+        for (const ScanDirectoryDatabaseEntry& entry : changedEntries)
+        {
+            if (!s_ReplaceScanDirectoryQuery.BindAndStep(
+                    *m_databaseConnection, entry.m_scanFolderPK, entry.m_directoryName.c_str(), entry.m_modTime, entry.m_entries.c_str()))
+            {
+                return false;
+            }
+        }
+
+        transaction.Commit();
+        return true;
+    }
+
+    bool AssetDatabaseConnection::UpdateFileHashes(
+        const FileHashDatabaseEntryContainer& changedEntries, const AZStd::vector<AZStd::string>& removedFilePaths)
+    {
+        // Skip creating and committing a scoped transaction, if there is nothing to update.
+        if (changedEntries.empty() && removedFilePaths.empty())
+        {
+            return true;
+        }
+        ScopedTransaction transaction(m_databaseConnection);
+
+        for (const AZStd::string& filePath : removedFilePaths)
+        {
+            if (!s_DeleteFileHashByFilePathQuery.BindAndStep(*m_databaseConnection, filePath.c_str()))
+            {
+                return false;
+            }
+        }
+
+        for (const FileHashDatabaseEntry& entry : changedEntries)
+        {
+            if (!s_ReplaceFileHashQuery.BindAndStep(
+                    *m_databaseConnection, entry.m_filePath.c_str(), entry.m_fileSize, entry.m_modTime, entry.m_fileIdentity, entry.m_hash))
+            {
+                return false;
+            }
+        }
+
+        transaction.Commit();
+        return true;
+    }
+
     bool AssetDatabaseConnection::SetBuilderInfoTable(AzToolsFramework::AssetDatabase::BuilderInfoEntryContainer& newEntries)
     {
         ScopedTransaction transaction(m_databaseConnection);
@@ -12,6 +12,7 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
 
 #include <QtCore/QSet>
@@ -22,6 +23,11 @@
 
 class QStringList;
 
+namespace AzToolsFramework::SQLite
+{
+    class ScopedTransaction;
+}
+
 namespace AssetProcessor
 {
     //! the Asset Processor's database manager's job is to create and modify the actual underlying
@@ -45,6 +51,23 @@ namespace AssetProcessor
         }
         void VacuumAndAnalyze();
 
+        //! Groups every write made through this connection while it is in scope into a single transaction,
+        //! instead of one transaction per Set/Remove call.  An individual write which fails is still rolled back on its own.
+        //! Other connections see none of the batch until Commit() is called, and destroying an uncommitted batch discards it.
+        class ScopedWriteBatch
+        {
+        public:
+            explicit ScopedWriteBatch(AssetDatabaseConnection& connection);
+            ~ScopedWriteBatch();
+            void Commit();
+
+            ScopedWriteBatch(const ScopedWriteBatch&) = delete;
+            ScopedWriteBatch& operator=(const ScopedWriteBatch&) = delete;
+
+        private:
+            AZStd::unique_ptr<AzToolsFramework::SQLite::ScopedTransaction> m_transaction;
+        };
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase(bool ignoreFutureAssetDBVersionError) override;
@@ -239,6 +262,19 @@ namespace AssetProcessor
         bool GetStatByStatName(QString statName, AzToolsFramework::AssetDatabase::StatDatabaseEntryContainer& container);
         bool GetStatLikeStatName(QString statName, AzToolsFramework::AssetDatabase::StatDatabaseEntryContainer& container);
         bool ReplaceStat(AzToolsFramework::AssetDatabase::StatDatabaseEntry& stat);
+
+        //ScanDirectories
+        bool GetScanDirectoriesByScanFolderId(AZ::s64 scanFolderId, AzToolsFramework::AssetDatabase::ScanDirectoryDatabaseEntryContainer& container);
+        // replaces the changed directories and removes the directories that no longer exist, in a single transaction
+        bool UpdateScanDirectories(
+            const AzToolsFramework::AssetDatabase::ScanDirectoryDatabaseEntryContainer& changedEntries,
+            const AZStd::vector<AZ::s64>& removedScanDirectoryIds);
+
+        //FileHashes
+        // replaces the changed hashes and removes the hashes of files that no longer exist, in a single transaction
+        bool UpdateFileHashes(
+            const AzToolsFramework::AssetDatabase::FileHashDatabaseEntryContainer& changedEntries,
+            const AZStd::vector<AZStd::string>& removedFilePaths);
     protected:
         void SetDatabaseVersion(AzToolsFramework::AssetDatabase::DatabaseVersion ver);
         void ExecuteCreateStatements();
@@ -7,13 +7,111 @@
  */
 
 #include "FileStateCache.h"
+#include "native/AssetDatabase/AssetDatabase.h"
 #include "native/utilities/assetUtils.h"
+#include "native/utilities/StatsCapture.h"
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
 #include <AssetProcessor_Traits_Platform.h>
 
 #include <QDir>
+#include <QVector>
+#include <QtConcurrent/QtConcurrentMap>
 
 namespace AssetProcessor
 {
+    namespace FileStateCachePrivate
+    {
+        // A file that was modified this close to when it was hashed may be modified again without its modification time changing,
+        // on file systems with a coarse timestamp resolution, so its hash is only kept for this session.
+        constexpr qint64 RacyModificationIntervalMs = 2000;
+    }
+
+    FileStateCache::FileStateCache() = default;
+
+    FileStateCache::~FileStateCache()
+    {
+        SaveFileHashCache(false);
+    }
+
+    bool FileStateCache::LoadFileHashCache()
+    {
+        auto databaseConnection = AZStd::make_unique<AssetDatabaseConnection>();
+        if (!databaseConnection->OpenDatabase())
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to open the asset database, file hashes will not be cached between sessions.\n");
+            return false;
+        }
+
+        LockGuardType scopeLock(m_mapMutex);
+        m_databaseConnection = AZStd::move(databaseConnection);
+        m_fileHashRecords.clear();
+        m_databaseConnection->QueryFileHashesTable(
+            [this](AzToolsFramework::AssetDatabase::FileHashDatabaseEntry& entry)
+            {
+                m_fileHashRecords.insert(
+                    QString::fromUtf8(entry.m_filePath.c_str(), aznumeric_cast<int>(entry.m_filePath.size())),
+                    { entry.m_fileSize, entry.m_modTime, entry.m_fileIdentity, entry.m_hash });
+                return true;
+            });
+        m_fileHashCacheLoaded = true;
+        m_fileHashCachePruned = false;
+        return true;
+    }
+
+    void FileStateCache::SaveFileHashCache(bool pruneMissingFiles)
+    {
+        AzToolsFramework::AssetDatabase::FileHashDatabaseEntryContainer changedEntries;
+        AZStd::vector<AZStd::string> removedFilePaths;
+        {
+            LockGuardType scopeLock(m_mapMutex);
+            if (!m_fileHashCacheLoaded)
+            {
+                return;
+            }
+
+            if (pruneMissingFiles && !m_fileHashCachePruned)
+            {
+                // forget the files that were deleted while the Asset Processor was not running
+                for (auto itr = m_fileHashRecords.begin(); itr != m_fileHashRecords.end();)
+                {
+                    if (!m_fileInfoMap.contains(itr.key()))
+                    {
+                        m_changedFileHashRecords.remove(itr.key());
+                        m_removedFileHashRecords.insert(itr.key());
+                        itr = m_fileHashRecords.erase(itr);
+                        continue;
+                    }
+                    ++itr;
+                }
+                m_fileHashCachePruned = true;
+            }
+
+            changedEntries.reserve(m_changedFileHashRecords.size());
+            for (auto itr = m_changedFileHashRecords.begin(); itr != m_changedFileHashRecords.end(); ++itr)
+            {
+                AzToolsFramework::AssetDatabase::FileHashDatabaseEntry& entry = changedEntries.emplace_back();
+                entry.m_filePath = itr.key().toUtf8().constData();
+                entry.m_fileSize = itr.value().m_fileSize;
+                entry.m_modTime = itr.value().m_modTime;
+                entry.m_fileIdentity = itr.value().m_fileIdentity;
+                entry.m_hash = itr.value().m_hash;
+            }
+
+            removedFilePaths.reserve(m_removedFileHashRecords.size());
+            for (const QString& key : m_removedFileHashRecords)
+            {
+                removedFilePaths.push_back(key.toUtf8().constData());
+            }
+
+            m_changedFileHashRecords.clear();
+            m_removedFileHashRecords.clear();
+        }
+
+        if (!m_databaseConnection->UpdateFileHashes(changedEntries, removedFilePaths))
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to record the file hashes in the asset database.\n");
+        }
+    }
 
     bool FileStateCache::GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const
     {
@@ -57,7 +155,8 @@ namespace AssetProcessor
     bool FileStateCache::GetHash(const QString& absolutePath, FileHash* foundHash)
     {
         LockGuardType scopeLock(m_mapMutex);
-        auto fileInfoItr = m_fileInfoMap.find(PathToKey(absolutePath));
+        QString key = PathToKey(absolutePath);
+        auto fileInfoItr = m_fileInfoMap.find(key);
 
         if(fileInfoItr == m_fileInfoMap.end())
         {
@@ -65,7 +164,7 @@ namespace AssetProcessor
             return false;
         }
 
-        auto itr = m_fileHashMap.find(PathToKey(absolutePath));
+        auto itr = m_fileHashMap.find(key);
 
         if (itr != m_fileHashMap.end())
         {
@@ -73,13 +172,150 @@ namespace AssetProcessor
             return true;
         }
 
-        // There's no hash stored yet or its been invalidated, calculate it
+        // There's no hash stored yet or its been invalidated, check whether it was recorded by an earlier session
+        const AZ::u64 fileIdentity = m_fileHashCacheLoaded ? AssetUtilities::GetFileIdentity(absolutePath.toUtf8().constData()) : 0;
+        if (FindRecordedHash(key, fileInfoItr.value(), fileIdentity, *foundHash))
+        {
+            m_fileHashMap[key] = *foundHash;
+            return true;
+        }
+
+        // otherwise calculate it
         *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
 
-        m_fileHashMap[PathToKey(absolutePath)] = *foundHash;
+        StoreComputedHash(key, fileInfoItr.value(), fileIdentity, *foundHash);
+        return true;
+    }
+
+    void FileStateCache::PrecomputeHashes(const QSet<AssetFileInfo>& infoSet)
+    {
+        if (!AssetUtilities::ShouldUseFileHashing())
+        {
+            return;
+        }
+
+        struct PendingHash
+        {
+            QString m_key;
+            QString m_absolutePath;
+            FileStateInfo m_fileInfo;
+        };
+
+        QVector<PendingHash> pendingHashes;
+        {
+            LockGuardType scopeLock(m_mapMutex);
+            for (const AssetFileInfo& info : infoSet)
+            {
+                if (info.m_isDirectory)
+                {
+                    continue;
+                }
+
+                QString key = PathToKey(info.m_filePath);
+                auto fileInfoItr = m_fileInfoMap.find(key);
+                if (fileInfoItr != m_fileInfoMap.end() && !m_fileHashMap.contains(key))
+                {
+                    pendingHashes.push_back({ AZStd::move(key), info.m_filePath, fileInfoItr.value() });
+                }
+            }
+        }
+
+        if (pendingHashes.isEmpty())
+        {
+            return;
+        }
+
+        // The files are hashed on the global thread pool, without holding the lock, so that they are read in parallel.
+        // Stats are captured for the whole set instead of per file, since capturing stats is not thread safe.
+        AssetProcessor::StatsCapture::BeginCaptureStat("PrecomputingFileHashes");
+        QtConcurrent::blockingMap(
+            pendingHashes,
+            [this](const PendingHash& pendingHash)
+            {
+                const QByteArray absolutePath = pendingHash.m_absolutePath.toUtf8();
+                const AZ::u64 fileIdentity = m_fileHashCacheLoaded ? AssetUtilities::GetFileIdentity(absolutePath.constData()) : 0;
+                FileHash hash = InvalidFileHash;
+                bool isRecorded = false;
+                {
+                    LockGuardType scopeLock(m_mapMutex);
+                    if (m_fileHashMap.contains(pendingHash.m_key))
+                    {
+                        return;
+                    }
+                    isRecorded = FindRecordedHash(pendingHash.m_key, pendingHash.m_fileInfo, fileIdentity, hash);
+                }
+
+                if (!isRecorded)
+                {
+                    hash = AssetBuilderSDK::GetFileHash(absolutePath.constData());
+                }
+
+                LockGuardType scopeLock(m_mapMutex);
+                // the file may have changed while it was hashed, in which case its hash is left to be computed on demand
+                auto fileInfoItr = m_fileInfoMap.find(pendingHash.m_key);
+                if (fileInfoItr == m_fileInfoMap.end() || !(fileInfoItr.value() == pendingHash.m_fileInfo) ||
+                    m_fileHashMap.contains(pendingHash.m_key))
+                {
+                    return;
+                }
+
+                if (isRecorded)
+                {
+                    m_fileHashMap[pendingHash.m_key] = hash;
+                }
+                else
+                {
+                    StoreComputedHash(pendingHash.m_key, pendingHash.m_fileInfo, fileIdentity, hash);
+                }
+            });
+        AssetProcessor::StatsCapture::EndCaptureStat("PrecomputingFileHashes");
+    }
+
+    bool FileStateCache::FindRecordedHash(const QString& key, const FileStateInfo& fileInfo, AZ::u64 fileIdentity, FileHash& hash) const
+    {
+        if (!m_fileHashCacheLoaded)
+        {
+            return false;
+        }
+
+        auto recordItr = m_fileHashRecords.find(key);
+        if (recordItr == m_fileHashRecords.end())
+        {
+            return false;
+        }
+
+        const FileHashRecord& record = recordItr.value();
+        if (record.m_fileSize != fileInfo.m_fileSize || record.m_modTime != static_cast<AZ::u64>(fileInfo.m_modTime.toMSecsSinceEpoch()) ||
+            record.m_fileIdentity != fileIdentity)
+        {
+            return false;
+        }
+
+        hash = record.m_hash;
         return true;
     }
 
+    void FileStateCache::StoreComputedHash(const QString& key, const FileStateInfo& fileInfo, AZ::u64 fileIdentity, FileHash hash)
+    {
+        m_fileHashMap[key] = hash;
+
+        if (!m_fileHashCacheLoaded || hash == InvalidFileHash || !fileInfo.m_modTime.isValid())
+        {
+            return;
+        }
+
+        const qint64 modTime = fileInfo.m_modTime.toMSecsSinceEpoch();
+        if (modTime + FileStateCachePrivate::RacyModificationIntervalMs > QDateTime::currentMSecsSinceEpoch())
+        {
+            return;
+        }
+
+        FileHashRecord record{ fileInfo.m_fileSize, static_cast<AZ::u64>(modTime), fileIdentity, hash };
+        m_fileHashRecords[key] = record;
+        m_changedFileHashRecords[key] = record;
+        m_removedFileHashRecords.remove(key);
+    }
+
     void FileStateCache::RegisterForDeleteEvent(AZ::Event<FileStateInfo>::Handler& handler)
     {
         handler.Connect(m_deleteEvent);
@@ -129,6 +365,12 @@ namespace AssetProcessor
 
             bool isDirectory = itr.value().m_isDirectory;
             QString parentPath = itr.value().m_absolutePath;
+
+            if (m_fileHashRecords.remove(itr.key()) > 0)
+            {
+                m_changedFileHashRecords.remove(itr.key());
+                m_removedFileHashRecords.insert(itr.key());
+            }
             m_fileInfoMap.erase(itr);
 
             if (isDirectory)
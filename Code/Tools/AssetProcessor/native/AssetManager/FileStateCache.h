@@ -16,10 +16,12 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AssetProcessor
 {
     struct AssetFileInfo;
+    class AssetDatabaseConnection;
 
     struct FileStateInfo
     {
@@ -63,6 +65,10 @@ namespace AssetProcessor
         virtual void WarmUpCache(const AssetFileInfo& existingInfo, const FileHash hash = InvalidFileHash) = 0;
         virtual void RegisterForDeleteEvent(AZ::Event<FileStateInfo>::Handler& handler) = 0;
 
+        //! Called with files whose hashes are about to be requested, so that the ones which are not known yet can be computed together.
+        //! (optional for implementations)
+        virtual void PrecomputeHashes(const QSet<AssetFileInfo>& /*infoSet*/) {}
+
         AZ_DISABLE_COPY_MOVE(IFileStateRequests);
     };
 
@@ -97,10 +103,24 @@ namespace AssetProcessor
 
     /// Caches file state information retrieved by the file scanner and file watcher
     /// Profiling has shown it is faster (at least on windows) compared to asking the OS for file information every time
+    ///
+    /// Once the file hash cache is loaded, the hashes that are computed are also recorded in the asset database along with the size,
+    /// modification time and identity (inode) of the file, and reused in later sessions for as long as those are unchanged,
+    /// so that files which have not changed since they were last hashed are not read again.
     class FileStateCache final :
         public FileStateBase
     {
     public:
+        FileStateCache();
+        ~FileStateCache() override;
+
+        /// Loads the hashes recorded in the asset database, and records the hashes that are computed from now on.
+        bool LoadFileHashCache();
+
+        /// Writes the hashes computed since the last save to the asset database.
+        /// pruneMissingFiles - also forgets the hashes of files that the cache has no information about, which is only correct
+        /// once the initial scan has been completed.
+        void SaveFileHashCache(bool pruneMissingFiles);
 
         // FileStateRequestBus implementation
         bool GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const override;
@@ -114,8 +134,24 @@ namespace AssetProcessor
         void RemoveFile(const QString& absolutePath) override;
 
         void WarmUpCache(const AssetFileInfo& existingInfo, const FileHash hash = IFileStateRequests::InvalidFileHash) override;
+        void PrecomputeHashes(const QSet<AssetFileInfo>& infoSet) override;
 
     private:
+        struct FileHashRecord
+        {
+            AZ::u64 m_fileSize = 0;
+            AZ::u64 m_modTime = 0;
+            AZ::u64 m_fileIdentity = 0;
+            FileHash m_hash = InvalidFileHash;
+        };
+
+        /// Looks up the recorded hash of a file, which is only returned if the file is unchanged since it was recorded.
+        /// Must be called with m_mapMutex locked.
+        bool FindRecordedHash(const QString& key, const FileStateInfo& fileInfo, AZ::u64 fileIdentity, FileHash& hash) const;
+
+        /// Caches a newly computed hash, and records it to be saved if the file hash cache is loaded.
+        /// Must be called with m_mapMutex locked.
+        void StoreComputedHash(const QString& key, const FileStateInfo& fileInfo, AZ::u64 fileIdentity, FileHash hash);
 
         /// Invalidates the hash for a file so it will be re-computed next time it's requested
         void InvalidateHash(const QString& absolutePath);
@@ -140,6 +176,14 @@ namespace AssetProcessor
         /// Profiling has shown path normalization to be a hotspot.
         mutable QHash<QString, QString> m_keyCache;
 
+        /// The hashes recorded in the asset database, keyed the same way as m_fileInfoMap, and the changes that are not saved yet.
+        bool m_fileHashCacheLoaded = false;
+        bool m_fileHashCachePruned = false;
+        QHash<QString, FileHashRecord> m_fileHashRecords;
+        QHash<QString, FileHashRecord> m_changedFileHashRecords;
+        QSet<QString> m_removedFileHashRecords;
+        AZStd::unique_ptr<AssetDatabaseConnection> m_databaseConnection;
+
         using LockGuardType = AZStd::lock_guard<decltype(m_mapMutex)>;
     };
 
@@ -47,6 +47,9 @@ namespace AssetProcessor
 
     constexpr AZStd::size_t s_lengthOfUuid = 38;
 
+    constexpr const char* ProcessedBatchIntervalKey = "/Amazon/AssetProcessor/Settings/Database/WriteBatchIntervalMs";
+    constexpr const char* ProcessedBatchMaxJobsKey = "/Amazon/AssetProcessor/Settings/Database/WriteBatchMaxJobs";
+
     using namespace AzToolsFramework::AssetSystem;
     using namespace AzFramework::AssetSystem;
 
@@ -79,6 +82,26 @@ namespace AssetProcessor
 
         m_excludedFolderCache = AZStd::make_unique<ExcludedFolderCache>(m_platformConfig);
 
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            AZ::s64 batchIntervalMs = 0;
+            if (settingsRegistry->Get(batchIntervalMs, ProcessedBatchIntervalKey))
+            {
+                m_processedBatchIntervalMs = static_cast<int>(AZStd::max<AZ::s64>(batchIntervalMs, 0));
+            }
+
+            AZ::s64 batchMaxJobs = 0;
+            if (settingsRegistry->Get(batchMaxJobs, ProcessedBatchMaxJobsKey) && batchMaxJobs > 0)
+            {
+                m_processedBatchMaxJobs = static_cast<size_t>(batchMaxJobs);
+            }
+        }
+
+        // a full batch is recorded straight away, which stops this timer, so that it doesn't go off later for the next batch.
+        m_processedBatchTimer = new QTimer(this);
+        m_processedBatchTimer->setSingleShot(true);
+        QObject::connect(m_processedBatchTimer, &QTimer::timeout, this, &AssetProcessorManager::AssetProcessed_Impl);
+
         PopulateJobStateCache();
 
         AssetProcessor::ProcessingJobInfoBus::Handler::BusConnect();
@@ -193,11 +216,20 @@ namespace AssetProcessor
             });
 
             m_isCurrentlyScanning = true;
+            m_scannerFiles = {};
+            m_scannerFilesRecorded = false;
+            m_scannerCompleted = false;
         }
         else if ((status == AssetProcessor::AssetScanningStatus::Completed) ||
                  (status == AssetProcessor::AssetScanningStatus::Stopped))
         {
             AssetProcessor::StatsCapture::EndCaptureStat("AssetScanning");
+
+            m_scannerCompleted = true;
+            CheckReadyToAssessScanFiles();
+
+            // the remaining batches are assessed, so it is now possible to become idle
+            QueueIdleCheck();
         }
     }
 
@@ -593,6 +625,12 @@ namespace AssetProcessor
 
     void AssetProcessorManager::QuitRequested()
     {
+        // record the results still waiting for their batch to be written, so those jobs don't have to run again next time.
+        if (m_processedQueued)
+        {
+            AssetProcessed_Impl();
+        }
+
         m_quitRequested = true;
         m_filesToExamine.clear();
         Q_EMIT ReadyToQuit(this);
@@ -989,6 +1027,7 @@ namespace AssetProcessor
         using AssetBuilderSDK::ProductOutputFlags;
 
         m_processedQueued = false;
+        m_processedBatchTimer->stop();
         if (m_quitRequested || m_assetProcessedList.empty())
         {
             return;
@@ -998,10 +1037,16 @@ namespace AssetProcessor
         // because we no longer start any jobs until it has finished.  So there is no reason
         // to delay notification or processing.
 
+        // Everything this batch writes to the database goes into a single transaction.  The notifications which let other
+        // threads (and connected tools) go and read those rows are held back until the transaction has been committed.
+        AZStd::vector<AssetNotificationMessage> productMessages;
+        AssetDatabaseConnection::ScopedWriteBatch writeBatch(*m_stateData);
+
         // before we accept this outcome, do one final check to make sure its not about to double-address things by stomping on the same subID across many products.
         // let's also make sure that the same product was not emitted by some other job.  we detect this by finding other jobs
         // with the same product, but with different sources.
-
+        // Each entry is checked and then written before the next one is checked, so that the checks also catch conflicts with
+        // the entries ahead of it in this batch, whose rows are not committed yet but are visible to this connection.
         for (auto itProcessedAsset = m_assetProcessedList.begin(); itProcessedAsset != m_assetProcessedList.end(); )
         {
             AZStd::unordered_set<AZ::u32> existingSubIDs;
@@ -1214,16 +1259,11 @@ namespace AssetProcessor
             {
                 //we found a dupe remove this entry from the processed list so it does not get into the db
                 itProcessedAsset = m_assetProcessedList.erase(itProcessedAsset);
+                continue;
             }
-            else
-            {
-                ++itProcessedAsset;
-            }
-        }
 
-        //process the asset list
-        for (AssetProcessedEntry& processedAsset : m_assetProcessedList)
-        {
+            AssetProcessedEntry& processedAsset = *itProcessedAsset;
+
             // update products / delete no longer relevant products
             // note that the cache stores products WITH the name of the platform in it so you don't have to do anything
             // to those strings to process them.
@@ -1654,7 +1694,7 @@ namespace AssetProcessor
                     }
                 }
 
-                Q_EMIT AssetMessage(message);
+                productMessages.push_back(AZStd::move(message));
 
                 AddKnownFoldersRecursivelyForFile(fullProductPath, m_cacheRootDir.absolutePath());
 
@@ -1672,9 +1712,6 @@ namespace AssetProcessor
 
             QString fullSourcePath = processedAsset.m_entry.GetAbsoluteSourcePath();
 
-            // notify the system about inputs:
-            Q_EMIT InputAssetProcessed(fullSourcePath, QString(processedAsset.m_entry.m_platformInfo.m_identifier.c_str()));
-            Q_EMIT AddedToCatalog(processedAsset.m_entry);
             OnJobStatusChanged(processedAsset.m_entry, JobStatus::Completed);
 
             // notify the analysis tracking system of our success (each processed entry is one job)
@@ -1687,6 +1724,22 @@ namespace AssetProcessor
                     fullSourcePath.toUtf8().constData());
                 AssessFileInternal(fullSourcePath, true);
             }
+
+            ++itProcessedAsset;
+        }
+
+        writeBatch.Commit();
+
+        for (const AssetNotificationMessage& message : productMessages)
+        {
+            Q_EMIT AssetMessage(message);
+        }
+
+        for (const AssetProcessedEntry& processedAsset : m_assetProcessedList)
+        {
+            // notify the system about inputs:
+            Q_EMIT InputAssetProcessed(processedAsset.m_entry.GetAbsoluteSourcePath(), QString(processedAsset.m_entry.m_platformInfo.m_identifier.c_str()));
+            Q_EMIT AddedToCatalog(processedAsset.m_entry);
         }
 
         m_assetProcessedList.clear();
@@ -1777,11 +1830,19 @@ namespace AssetProcessor
 
         m_assetProcessedList.push_back(AssetProcessedEntry(jobEntry, response));
 
-        if (!m_processedQueued)
+        // when a batch interval is configured, results which arrive within it are recorded together in one database
+        // transaction, unless enough of them arrive to fill a batch before it elapses.
+        if (m_processedBatchIntervalMs > 0 && m_assetProcessedList.size() < m_processedBatchMaxJobs)
         {
-            m_processedQueued = true;
-            AssetProcessed_Impl();
+            if (!m_processedQueued)
+            {
+                m_processedQueued = true;
+                m_processedBatchTimer->start(m_processedBatchIntervalMs);
+            }
+            return;
         }
+
+        AssetProcessed_Impl();
     }
 
     void AssetProcessorManager::CheckSource(const FileEntry& source)
@@ -3421,12 +3482,43 @@ namespace AssetProcessor
         }
     }
 
+    void AssetProcessorManager::AssessFileChanges(FileChangeList changes)
+    {
+        for (const FileChange& change : changes)
+        {
+            switch (change.m_type)
+            {
+            case FileChange::Type::Added:
+                AssessAddedFile(change.m_filePath);
+                break;
+            case FileChange::Type::Removed:
+                AssessDeletedFile(change.m_filePath);
+                break;
+            case FileChange::Type::Modified:
+                AssessModifiedFile(change.m_filePath);
+                break;
+            }
+        }
+    }
+
     void AssetProcessorManager::CheckReadyToAssessScanFiles()
     {
-        if (m_catalogReady && m_buildersReady && m_scannerFiles.size() > 0)
+        if (!m_catalogReady || !m_buildersReady)
         {
-            AssessFilesFromScanner(m_scannerFiles);
-            m_scannerFiles = {};
+            return;
+        }
+
+        if (m_scannerFiles.size() > 0)
+        {
+            QSet<AssetFileInfo> scannerFiles;
+            scannerFiles.swap(m_scannerFiles);
+            AssessBatchFromScanner(scannerFiles);
+        }
+
+        if (m_scannerCompleted && m_scannerFilesRecorded)
+        {
+            m_scannerFilesRecorded = false;
+            FinishAssessingFilesFromScanner();
         }
     }
 
@@ -3506,6 +3598,12 @@ namespace AssetProcessor
     // the file scanner does not scan the cache.
     // the scanner should be omitting directory changes.
     void AssetProcessorManager::AssessFilesFromScanner(QSet<AssetFileInfo> filePaths)
+    {
+        AssessBatchFromScanner(filePaths);
+        FinishAssessingFilesFromScanner();
+    }
+
+    void AssetProcessorManager::AssessBatchFromScanner(const QSet<AssetFileInfo>& filePaths)
     {
         if (m_initialScanSkippingFeature)
         {
@@ -3513,16 +3611,6 @@ namespace AssetProcessor
             {
                 AddKnownFoldersRecursivelyForFile(fileInfo.m_filePath, fileInfo.m_scanFolder->ScanPath());
             }
-
-            m_sourceFilesInDatabase.clear();
-            m_fileModTimes.clear();
-            m_fileHashes.clear();
-
-            // place a message in the queue that will cause us to transition
-            // into a "no longer scanning" state and then continue with the next phase
-            QMetaObject::invokeMethod(this, "FinishAssetScan", Qt::QueuedConnection);
-
-            m_initialScanSkippingFeature = false;
             return;
         }
 
@@ -3531,6 +3619,12 @@ namespace AssetProcessor
         WarmUpFileCache(filePaths);
         AssetProcessor::StatsCapture::EndCaptureStat("WarmingFileCache");
 
+        // the files are fingerprinted as they are assessed, hash the ones whose hashes are not known yet all at once.
+        if (IFileStateRequests* fileStateCache = AZ::Interface<IFileStateRequests>::Get())
+        {
+            fileStateCache->PrecomputeHashes(filePaths);
+        }
+
         int processedFileCount = 0;
 
         AssetProcessor::StatsCapture::BeginCaptureStat("InitialFileAssessment");
@@ -3572,6 +3666,18 @@ namespace AssetProcessor
         }
 
         AssetProcessor::StatsCapture::EndCaptureStat("InitialFileAssessment");
+    }
+
+    void AssetProcessorManager::FinishAssessingFilesFromScanner()
+    {
+        if (m_initialScanSkippingFeature)
+        {
+            m_sourceFilesInDatabase.clear();
+            m_fileModTimes.clear();
+            m_fileHashes.clear();
+
+            m_initialScanSkippingFeature = false;
+        }
 
         // place a message in the queue that will cause us to transition
         // into a "no longer scanning" state and then continue with the next phase
@@ -3582,7 +3688,12 @@ namespace AssetProcessor
 
     void AssetProcessorManager::RecordFilesFromScanner(QSet<AssetFileInfo> filePaths)
     {
-        m_scannerFiles = filePaths;
+        // the scanner reports what it finds in batches while it is still scanning
+        if (!filePaths.isEmpty())
+        {
+            m_scannerFiles.unite(filePaths);
+            m_scannerFilesRecorded = true;
+        }
 
         CheckReadyToAssessScanFiles();
     }
@@ -3804,8 +3915,11 @@ namespace AssetProcessor
 
     bool AssetProcessorManager::IsIdle()
     {
+        // while the scanner is running, more batches of files are still to come
+        const bool waitingForScanner = m_isCurrentlyScanning && !m_scannerCompleted;
+
         if ((!m_queuedExamination) && (m_filesToExamine.isEmpty()) && (m_activeFiles.isEmpty()) &&
-            !m_processedQueued && m_assetProcessedList.empty() && !m_numOfJobsToAnalyze)
+            !m_processedQueued && m_assetProcessedList.empty() && !m_numOfJobsToAnalyze && !waitingForScanner)
         {
             return true;
         }
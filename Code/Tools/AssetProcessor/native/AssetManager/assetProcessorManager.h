@@ -19,6 +19,7 @@
 #include <QMap>
 #include <QPair>
 #include <QMutex>
+#include <QTimer>
 
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/containers/unordered_map.h>
@@ -43,6 +44,7 @@
 
 #include <AssetManager/ExcludedFolderCache.h>
 #include <AssetManager/ProductAsset.h>
+#include <native/FileWatcher/FileWatcherBase.h>
 #include <native/utilities/IMetadataUpdates.h>
 #endif
 
@@ -325,6 +327,8 @@ namespace AssetProcessor
         virtual void AssessModifiedFile(QString filePath);
         virtual void AssessAddedFile(QString filePath);
         virtual void AssessDeletedFile(QString filePath);
+        //! Assesses a batch of changes from the file watcher, in the order they happened.
+        void AssessFileChanges(FileChangeList changes);
         void OnAssetScannerStatusChange(AssetProcessor::AssetScanningStatus status);
         void FinishAssetScan();
         void OnJobStatusChanged(JobEntry jobEntry, JobStatus status);
@@ -452,6 +456,10 @@ namespace AssetProcessor
         bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
 
         void CheckReadyToAssessScanFiles();
+        // The scanner reports the files that it finds in batches, each batch is assessed as it arrives
+        // and the scan is only finished once the scanner has completed and every batch has been assessed.
+        void AssessBatchFromScanner(const QSet<AssetFileInfo>& filePaths);
+        void FinishAssessingFilesFromScanner();
 
         AZ::s64 GenerateNewJobRunKey();
         // Attempt to erase a log file.  Failing to erase it is not a critical problem, but should be logged.
@@ -569,6 +577,9 @@ namespace AssetProcessor
         bool m_isCurrentlyScanning = false;
         bool m_quitRequested = false;
         bool m_processedQueued = false;
+        int m_processedBatchIntervalMs = 0; // 0 records each job result as soon as it arrives
+        size_t m_processedBatchMaxJobs = 256;
+        QTimer* m_processedBatchTimer = nullptr; // pending while m_processedQueued is set
         bool m_AssetProcessorIsBusy = true;
         bool m_catalogReady = false;
         bool m_buildersReady = false;
@@ -599,6 +610,9 @@ namespace AssetProcessor
 
         // Files from the scanner, waiting for initial analysis
         QSet<AssetFileInfo> m_scannerFiles;
+        // Whether the scanner reported any files since it started, and whether it has since completed
+        bool m_scannerFilesRecorded = false;
+        bool m_scannerCompleted = false;
 
         //////////////////// Analysis Early-Out feature ///////////////////
         // ComputeBuilderDirty builds the maps of which builders are dirty and how they have changed.
@@ -40,7 +40,7 @@ namespace AssetProcessor
         m_assetWorkerScannerThread.wait();
     }
 
-    void AssetScanner::StartScan()
+    void AssetScanner::StartScan(bool allowDirectorySkipping)
     {
         if (!m_workerCreated)
         {
@@ -49,7 +49,7 @@ namespace AssetProcessor
             m_assetWorkerScannerThread.start();
         }
 
-        QMetaObject::invokeMethod(&m_assetScannerWorker, "StartScan", Qt::QueuedConnection);
+        QMetaObject::invokeMethod(&m_assetScannerWorker, "StartScan", Qt::QueuedConnection, Q_ARG(bool, allowDirectorySkipping));
     }
 
     void AssetScanner::StopScan()
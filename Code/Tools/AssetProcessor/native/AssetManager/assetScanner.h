@@ -33,7 +33,8 @@ namespace AssetProcessor
         explicit AssetScanner(PlatformConfiguration* config, QObject* parent = nullptr);
         virtual ~AssetScanner();
 
-        void StartScan();//Should be called to start a scan
+        //Should be called to start a scan, allowDirectorySkipping - false forces every directory to be listed again
+        void StartScan(bool allowDirectorySkipping = true);
         void StopScan();//Should be called to stop a scan
 
         Q_INVOKABLE AssetScanningStatus status() const;
@@ -7,19 +7,197 @@
  */
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
+#include "native/AssetDatabase/AssetDatabase.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <QDir>
+#include <QHash>
+#include <QThreadPool>
+#include <QVector>
 #include <QtConcurrent/QtConcurrentFilter>
+#include <QtConcurrent/QtConcurrentRun>
 
 using namespace AssetProcessor;
 
+namespace AssetScannerWorkerPrivate
+{
+    constexpr const char* MaxThreadCountKey = "/Amazon/AssetProcessor/Settings/Scanner/MaxThreadCount";
+    constexpr const char* BatchSizeKey = "/Amazon/AssetProcessor/Settings/Scanner/BatchSize";
+    constexpr const char* SkipUnchangedDirectoriesKey = "/Amazon/AssetProcessor/Settings/Scanner/SkipUnchangedDirectories";
+
+    constexpr int DefaultBatchSize = 10000;
+
+    // A directory that was modified this close to the start of the scan may be modified again without its modification time
+    // changing, on file systems with a coarse timestamp resolution, so its listing is not recorded.
+    constexpr qint64 RacyModificationIntervalMs = 2000;
+
+    struct DirectoryEntry
+    {
+        QString m_name;
+        QDateTime m_modTime;
+        AZ::u64 m_fileSize = 0;
+        bool m_isDirectory = false;
+    };
+
+    QString GenerateScanDirectoryKey(AZ::s64 scanFolderId, const QString& directoryName)
+    {
+        return QString("%1:%2").arg(scanFolderId).arg(directoryName);
+    }
+
+    QVector<DirectoryEntry> ListDirectory(const QString& path)
+    {
+        QDir dir(path);
+        dir.setSorting(QDir::Unsorted);
+
+        QVector<DirectoryEntry> entries;
+        for (const QFileInfo& entry : dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files))
+        {
+            const bool isDirectory = entry.isDir();
+            entries.push_back({ entry.fileName(), entry.lastModified(), isDirectory ? 0 : static_cast<AZ::u64>(entry.size()), isDirectory });
+        }
+        return entries;
+    }
+
+    // The recorded listing of a directory has a line per entry, of the form "<d|f>\t<modtime>\t<size>\t<name>".
+    // Returns false if the listing can't be recorded, because a name contains a line break.
+    bool SerializeEntries(const QVector<DirectoryEntry>& entries, AZStd::string& serialized)
+    {
+        QString result;
+        for (const DirectoryEntry& entry : entries)
+        {
+            if (entry.m_name.contains('\n'))
+            {
+                return false;
+            }
+            result += QString("%1\t%2\t%3\t%4\n")
+                          .arg(entry.m_isDirectory ? 'd' : 'f')
+                          .arg(entry.m_modTime.toMSecsSinceEpoch())
+                          .arg(entry.m_fileSize)
+                          .arg(entry.m_name);
+        }
+        serialized = result.toUtf8().constData();
+        return true;
+    }
+
+    bool DeserializeEntries(const AZStd::string& serialized, QVector<DirectoryEntry>& entries)
+    {
+        const QStringList lines = QString::fromUtf8(serialized.c_str(), aznumeric_cast<int>(serialized.size())).split('\n', Qt::SkipEmptyParts);
+        entries.reserve(lines.size());
+        for (const QString& line : lines)
+        {
+            // the name is the last field, since it may contain tabs
+            const int modTimeStart = line.indexOf('\t') + 1;
+            const int sizeStart = modTimeStart > 0 ? line.indexOf('\t', modTimeStart) + 1 : 0;
+            const int nameStart = sizeStart > 0 ? line.indexOf('\t', sizeStart) + 1 : 0;
+            if (modTimeStart != 2 || nameStart == 0)
+            {
+                return false;
+            }
+
+            bool modTimeValid = false;
+            bool sizeValid = false;
+            DirectoryEntry entry;
+            entry.m_isDirectory = line[0] == 'd';
+            entry.m_modTime = QDateTime::fromMSecsSinceEpoch(line.mid(modTimeStart, sizeStart - modTimeStart - 1).toLongLong(&modTimeValid));
+            entry.m_fileSize = line.mid(sizeStart, nameStart - sizeStart - 1).toULongLong(&sizeValid);
+            entry.m_name = line.mid(nameStart);
+            if (!modTimeValid || !sizeValid)
+            {
+                return false;
+            }
+            entries.push_back(AZStd::move(entry));
+        }
+        return true;
+    }
+}
+
+struct AssetScannerWorker::PendingDirectory
+{
+    QString m_path;
+    const ScanFolderInfo* m_rootScanFolder = nullptr;
+};
+
+struct AssetScannerWorker::DirectoryResult
+{
+    QVector<AssetFileInfo> m_files;
+    QVector<AssetFileInfo> m_folders;
+    QVector<AssetFileInfo> m_excluded;
+    QVector<PendingDirectory> m_subDirectories;
+
+    QString m_scanDirectoryKey;
+    bool m_scanDirectoryChanged = false;
+    AzToolsFramework::AssetDatabase::ScanDirectoryDatabaseEntry m_scanDirectory;
+};
+
+struct AssetScannerWorker::ScanState
+{
+    bool IsFinished() const
+    {
+        return m_pendingDirectories.empty() && m_activeCount == 0;
+    }
+
+    // constant while the directories are scanned
+    QString m_normalizedCachePath;
+    AZ::IO::Path m_cachePath;
+    QString m_normalizedIntermediateAssetsFolder;
+    qint64 m_startTimeMs = 0;
+    bool m_recordDirectories = false;
+    bool m_skipUnchangedDirectories = false;
+    QHash<QString, AzToolsFramework::AssetDatabase::ScanDirectoryDatabaseEntry> m_recordedDirectories;
+
+    // guarded by m_mutex
+    AZStd::mutex m_mutex;
+    AZStd::condition_variable m_condition;
+    QVector<PendingDirectory> m_pendingDirectories;
+    int m_activeCount = 0;
+    QSet<AssetFileInfo> m_files;
+    QSet<AssetFileInfo> m_folders;
+    QSet<AssetFileInfo> m_excluded;
+    QSet<QString> m_visitedDirectories;
+    AzToolsFramework::AssetDatabase::ScanDirectoryDatabaseEntryContainer m_changedDirectories;
+};
+
 AssetScannerWorker::AssetScannerWorker(PlatformConfiguration* config, QObject* parent)
     : QObject(parent)
     , m_platformConfiguration(config)
+    , m_batchSize(AssetScannerWorkerPrivate::DefaultBatchSize)
 {
+    if (auto* settingsRegistry = AZ::SettingsRegistry::Get())
+    {
+        AZ::s64 maxThreadCount = 0;
+        if (settingsRegistry->Get(maxThreadCount, AssetScannerWorkerPrivate::MaxThreadCountKey))
+        {
+            SetMaxThreadCount(aznumeric_cast<int>(maxThreadCount));
+        }
+        AZ::s64 batchSize = 0;
+        if (settingsRegistry->Get(batchSize, AssetScannerWorkerPrivate::BatchSizeKey))
+        {
+            SetBatchSize(aznumeric_cast<int>(batchSize));
+        }
+        settingsRegistry->Get(m_skipUnchangedDirectories, AssetScannerWorkerPrivate::SkipUnchangedDirectoriesKey);
+    }
+}
+
+AssetScannerWorker::~AssetScannerWorker() = default;
+
+void AssetScannerWorker::SetMaxThreadCount(int maxThreadCount)
+{
+    m_maxThreadCount = AZStd::max(0, maxThreadCount);
+}
+
+void AssetScannerWorker::SetBatchSize(int batchSize)
+{
+    m_batchSize = AZStd::max(1, batchSize);
 }
 
-void AssetScannerWorker::StartScan()
+void AssetScannerWorker::SetSkipUnchangedDirectories(bool skipUnchangedDirectories)
+{
+    m_skipUnchangedDirectories = skipUnchangedDirectories;
+}
+
+void AssetScannerWorker::StartScan(bool allowDirectorySkipping)
 {
     // this must be called from the thread operating it and not the main thread.
     Q_ASSERT(QThread::currentThread() == this->thread());
@@ -27,7 +205,7 @@ void AssetScannerWorker::StartScan()
     m_fileList.clear();
     m_folderList.clear();
     m_excludedList.clear();
-    
+
     m_doScan = true;
 
     AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Scanning file system for changes...\n");
@@ -35,28 +213,105 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
+    ScanState state;
+    state.m_startTimeMs = QDateTime::currentMSecsSinceEpoch();
+
+    QDir cacheDir;
+    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
+    state.m_normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
+    state.m_cachePath = state.m_normalizedCachePath.toUtf8().constData();
+
+    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(state.m_cachePath).c_str());
+    state.m_normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+
+    if (m_skipUnchangedDirectories)
+    {
+        state.m_skipUnchangedDirectories = allowDirectorySkipping;
+        LoadScanDirectories(state);
+    }
+
     for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
     {
         const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        state.m_pendingDirectories.push_back({ scanFolderInfo.ScanPath(), &scanFolderInfo });
+    }
+
+    if (!m_threadPool)
+    {
+        m_threadPool = AZStd::make_unique<QThreadPool>();
+        m_threadPool->setMaxThreadCount(m_maxThreadCount > 0 ? m_maxThreadCount : QThread::idealThreadCount());
+    }
+
+    const int threadCount = m_threadPool->maxThreadCount();
+    for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        QtConcurrent::run(m_threadPool.get(), [this, &state]()
+        {
+            ScanDirectories(state);
+        });
+    }
+
+    // Emit what has been found in batches while the directories are scanned, so that it can be assessed in the meantime.
+    // The excluded files and folders are only emitted once the scan is complete, since the excluded folder cache
+    // is initialized from the complete set.
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(state.m_mutex);
+        bool isFinished = false;
+        while (!isFinished)
+        {
+            state.m_condition.wait(lock, [this, &state]()
+            {
+                return state.IsFinished() || (state.m_files.size() + state.m_folders.size() >= m_batchSize);
+            });
+
+            isFinished = state.IsFinished();
+            m_fileList.swap(state.m_files);
+            m_folderList.swap(state.m_folders);
+            if (isFinished)
+            {
+                m_excludedList.swap(state.m_excluded);
+            }
+            // the batch was taken, the scanning threads can carry on
+            state.m_condition.notify_all();
+
+            lock.unlock();
+            if (m_doScan && isFinished)
+            {
+                EmitFiles();
+            }
+            else if (m_doScan)
+            {
+                // only the final batch is emitted when it's empty, so that the scan results are always reported
+                if (!m_fileList.isEmpty())
+                {
+                    Q_EMIT FilesFound(m_fileList);
+                }
+                if (!m_folderList.isEmpty())
+                {
+                    Q_EMIT FoldersFound(m_folderList);
+                }
+            }
+            m_fileList.clear();
+            m_folderList.clear();
+            lock.lock();
+        }
     }
 
-    // we want not to emit any signals until we're finished scanning
-    // so that we don't interleave directory tree walking (IO access to the file table)
-    // with file access (IO access to file data) caused by sending signals to other classes.
+    m_threadPool->waitForDone();
 
     if (!m_doScan)
     {
         m_fileList.clear();
         m_folderList.clear();
         m_excludedList.clear();
-        
+
         Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Stopped);
         return;
     }
-    else
+
+    if (state.m_recordDirectories)
     {
-        EmitFiles();
+        SaveScanDirectories(state);
     }
 
     AZ_TracePrintf(AssetProcessor::ConsoleChannel, "File system scan done.\n");
@@ -72,113 +327,226 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::LoadScanDirectories(ScanState& state)
 {
-    if (!m_doScan)
+    if (!m_databaseConnection)
     {
-        return;
+        m_databaseConnection = AZStd::make_unique<AssetDatabaseConnection>();
+        if (!m_databaseConnection->OpenDatabase())
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to open the asset database, all directories will be scanned.\n");
+            m_databaseConnection.reset();
+            return;
+        }
     }
 
-    QFileInfoList entries;
+    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    {
+        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+        m_databaseConnection->QueryScanDirectoriesByScanFolderID(scanFolderInfo.ScanFolderID(),
+            [&state](AzToolsFramework::AssetDatabase::ScanDirectoryDatabaseEntry& entry)
+            {
+                QString key = AssetScannerWorkerPrivate::GenerateScanDirectoryKey(entry.m_scanFolderPK, QString::fromUtf8(entry.m_directoryName.c_str()));
+                state.m_recordedDirectories.insert(key, AZStd::move(entry));
+                return true;
+            });
+    }
 
-    QDir cacheDir;
-    AssetUtilities::ComputeProjectCacheRoot(cacheDir);
-    QString normalizedCachePath = AssetUtilities::NormalizeDirectoryPath(cacheDir.absolutePath());
-    AZ::IO::Path cachePath(normalizedCachePath.toUtf8().constData());
+    state.m_recordDirectories = true;
+}
 
-    QString intermediateAssetsFolder = QString::fromUtf8(AssetUtilities::GetIntermediateAssetsFolder(cachePath).c_str());
-    QString normalizedIntermediateAssetsFolder = AssetUtilities::NormalizeDirectoryPath(intermediateAssetsFolder);
+void AssetScannerWorker::SaveScanDirectories(ScanState& state)
+{
+    // the directories that were not visited by this scan no longer exist, or are no longer scanned.
+    AZStd::vector<AZ::s64> removedScanDirectoryIds;
+    for (auto itr = state.m_recordedDirectories.begin(); itr != state.m_recordedDirectories.end(); ++itr)
+    {
+        if (!state.m_visitedDirectories.contains(itr.key()))
+        {
+            removedScanDirectoryIds.push_back(itr.value().m_scanDirectoryID);
+        }
+    }
 
-    // Implemented non-recursively so that the above functions only have to be called once per scan,
-    // and so that the performance is easy to analyze in a profiler:
-    QList<ScanFolderInfo> pathsToScanQueue;
-    pathsToScanQueue.push_back(scanFolderInfo);
+    if (!m_databaseConnection->UpdateScanDirectories(state.m_changedDirectories, removedScanDirectoryIds))
+    {
+        AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to record the scanned directories in the asset database.\n");
+    }
+}
 
-    while (!pathsToScanQueue.empty())
+void AssetScannerWorker::ScanDirectories(ScanState& state)
+{
+    AZStd::unique_lock<AZStd::mutex> lock(state.m_mutex);
+    while (true)
     {
-        ScanFolderInfo pathToScan = pathsToScanQueue.back();
-        pathsToScanQueue.pop_back();
-        QDir dir(pathToScan.ScanPath());
-        dir.setSorting(QDir::Unsorted);
-        // Only scan sub folders if recurseSubFolders flag is set
-        if (!scanFolderInfo.RecurseSubFolders())
+        // a full batch must be taken before scanning any further, which bounds the memory used by the results that are waiting.
+        state.m_condition.wait(lock, [this, &state]()
+        {
+            return state.IsFinished() ||
+                (!state.m_pendingDirectories.empty() && state.m_files.size() + state.m_folders.size() < m_batchSize);
+        });
+
+        if (state.m_pendingDirectories.empty())
+        {
+            return;
+        }
+
+        PendingDirectory directory = AZStd::move(state.m_pendingDirectories.back());
+        state.m_pendingDirectories.pop_back();
+        ++state.m_activeCount;
+        lock.unlock();
+
+        DirectoryResult result;
+        ScanDirectory(state, directory, result);
+
+        lock.lock();
+        --state.m_activeCount;
+        if (!m_doScan) // scan was cancelled!
         {
-            entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+            state.m_pendingDirectories.clear();
         }
         else
         {
-            entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+            for (AssetFileInfo& file : result.m_files)
+            {
+                state.m_files.insert(AZStd::move(file));
+            }
+            for (AssetFileInfo& folder : result.m_folders)
+            {
+                state.m_folders.insert(AZStd::move(folder));
+            }
+            for (AssetFileInfo& excluded : result.m_excluded)
+            {
+                state.m_excluded.insert(AZStd::move(excluded));
+            }
+            state.m_pendingDirectories.append(result.m_subDirectories);
+
+            if (!result.m_scanDirectoryKey.isEmpty())
+            {
+                state.m_visitedDirectories.insert(result.m_scanDirectoryKey);
+            }
+            if (result.m_scanDirectoryChanged)
+            {
+                state.m_changedDirectories.push_back(AZStd::move(result.m_scanDirectory));
+            }
         }
+        state.m_condition.notify_all();
+    }
+}
+
+void AssetScannerWorker::ScanDirectory(const ScanState& state, const PendingDirectory& directory, DirectoryResult& result)
+{
+    using namespace AssetScannerWorkerPrivate;
+
+    if (!m_doScan)
+    {
+        return;
+    }
+
+    const ScanFolderInfo& rootScanFolder = *directory.m_rootScanFolder;
+
+    const QDir dir(directory.m_path);
+    QVector<DirectoryEntry> entries;
+    if (state.m_recordDirectories)
+    {
+        QString directoryName = directory.m_path.mid(rootScanFolder.ScanPath().length() + 1);
+        result.m_scanDirectoryKey = GenerateScanDirectoryKey(rootScanFolder.ScanFolderID(), directoryName);
 
-        for (const QFileInfo& entry : entries)
+        // the modification time must be read before the directory is listed, so that any change made while it is listed
+        // is detected by the next scan.
+        const qint64 modTime = QFileInfo(directory.m_path).lastModified().toMSecsSinceEpoch();
+
+        auto recordItr = state.m_recordedDirectories.find(result.m_scanDirectoryKey);
+        const bool isRecorded = recordItr != state.m_recordedDirectories.end() && recordItr.value().m_modTime == static_cast<AZ::u64>(modTime);
+        if (!isRecorded || !state.m_skipUnchangedDirectories || !DeserializeEntries(recordItr.value().m_entries, entries))
         {
-            if (!m_doScan) // scan was cancelled!
+            entries = ListDirectory(directory.m_path);
+
+            if (modTime + RacyModificationIntervalMs < state.m_startTimeMs)
             {
-                return;
+                AzToolsFramework::AssetDatabase::ScanDirectoryDatabaseEntry& scanDirectory = result.m_scanDirectory;
+                scanDirectory.m_scanFolderPK = rootScanFolder.ScanFolderID();
+                scanDirectory.m_directoryName = directoryName.toUtf8().constData();
+                scanDirectory.m_modTime = static_cast<AZ::u64>(modTime);
+                result.m_scanDirectoryChanged = SerializeEntries(entries, scanDirectory.m_entries) &&
+                    (recordItr == state.m_recordedDirectories.end() || !(recordItr.value() == scanDirectory));
             }
+        }
+    }
+    else
+    {
+        entries = ListDirectory(directory.m_path);
+    }
 
-            QString absPath = entry.absoluteFilePath();
-            const bool isDirectory = entry.isDir();
-            QDateTime modTime = entry.lastModified();
-            AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-            AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
-            QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
+    for (const DirectoryEntry& entry : entries)
+    {
+        if (!m_doScan) // scan was cancelled!
+        {
+            return;
+        }
 
-            if (isDirectory)
-            {
-                // in debug, assert that the paths coming from qt directory info iteration is already normalized
-                // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
-                Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
-                // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
+        // Only scan sub folders if recurseSubFolders flag is set
+        if (entry.m_isDirectory && !rootScanFolder.RecurseSubFolders())
+        {
+            continue;
+        }
 
-                // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
+        QString absPath = dir.absoluteFilePath(entry.m_name);
+        AssetFileInfo assetFileInfo(absPath, entry.m_modTime, entry.m_fileSize, &rootScanFolder, entry.m_isDirectory);
+        QString relPath = absPath.mid(rootScanFolder.ScanPath().length() + 1);
 
-                if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
-                    continue;
-                }
+        if (entry.m_isDirectory)
+        {
+            // in debug, assert that the paths coming from qt directory info iteration is already normalized
+            // allowing us to skip normalization and know that comparisons like "IsInCacheFolder" will actually succed.
+            Q_ASSERT(absPath == AssetUtilities::NormalizeDirectoryPath(absPath));
+            // Filtering out excluded directories immediately (not in a thread pool) since that prevents us from recursing.
+
+            // we already know the root scan folder, and can thus chop that part off and call the cheaper IsFileExcludedRelPath:
+
+            if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
+            {
+                result.m_excluded.push_back(AZStd::move(assetFileInfo));
+                continue;
+            }
 
-                // Entry is a directory
-                // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+            // Entry is a directory
+            // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
+            result.m_folders.push_back(AZStd::move(assetFileInfo));
 
-                // recurse into this folder.
-                // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
+            // recurse into this folder.
+            // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
 
-                if (absPath.startsWith(normalizedCachePath))
+            if (absPath.startsWith(state.m_normalizedCachePath))
+            {
+                // its in the cache.  Is it the cache itself?
+                if (absPath.length() != state.m_normalizedCachePath.length())
                 {
-                    // its in the cache.  Is it the cache itself?
-                    if (absPath.length() != normalizedCachePath.length())
+                    // no.  Is it in the intermediateassets?
+                    if (!absPath.startsWith(state.m_normalizedIntermediateAssetsFolder))
                     {
-                        // no.  Is it in the intermediateassets?
-                        if (!absPath.startsWith(normalizedIntermediateAssetsFolder))
-                        {
-                            // Its not something in the intermediate assets folder, nor is it the cache itself,
-                            // so it is just a file somewhere in the cache.
-                            continue; // do not recurse.
-                        }
+                        // Its not something in the intermediate assets folder, nor is it the cache itself,
+                        // so it is just a file somewhere in the cache.
+                        continue; // do not recurse.
                     }
                 }
-                // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
-                ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-                pathsToScanQueue.push_back(tempScanFolderInfo);
             }
-            else
-            {
-                // Entry is a file
-                Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
+            // then we can recurse.  Otherwise, its a non-intermediate-assets-folder
+            result.m_subDirectories.push_back({ AZStd::move(absPath), &rootScanFolder });
+        }
+        else
+        {
+            // Entry is a file
+            Q_ASSERT(absPath == AssetUtilities::NormalizeFilePath(absPath));
 
-                if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), cachePath)) // Ignore files in the cache
+            if (!AssetUtilities::IsInCacheFolder(absPath.toUtf8().constData(), state.m_cachePath)) // Ignore files in the cache
+            {
+                if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
-                    {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
-                    }
-                    else
-                    {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
-                    }
+                    result.m_files.push_back(AZStd::move(assetFileInfo));
+                }
+                else
+                {
+                    result.m_excluded.push_back(AZStd::move(assetFileInfo));
                 }
             }
         }
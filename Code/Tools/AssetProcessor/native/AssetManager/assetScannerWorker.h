@@ -11,19 +11,31 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <QString>
 #include <QSet>
 #include <QObject>
 #endif
 
+class QThreadPool;
+
 namespace AssetProcessor
 {
+    class AssetDatabaseConnection;
     class PlatformConfiguration;
 
     /** This Class is actually responsible for scanning the game folder
      * and finding file of interest files.
      * Its created on the main thread and then moved to the worker thread
      * so it should contain no QObject-based classes at construction time (it can make them later)
+     *
+     * The directories of all scan folders are listed in parallel by a bounded pool of threads, and the files and folders
+     * that are found are emitted in batches while the scan is still running.
+     * When SkipUnchangedDirectories is enabled, the listing of every directory is recorded in the asset database along with
+     * the modification time of the directory, and directories whose modification time has not changed since the last scan
+     * reuse their recorded listing instead of being listed again.  Note that editing a file in place does not change the
+     * modification time of its directory, so such edits made while the Asset Processor was not running are not detected.
      */
     class AssetScannerWorker
         : public QObject
@@ -31,6 +43,13 @@ namespace AssetProcessor
         Q_OBJECT
     public:
         explicit AssetScannerWorker(PlatformConfiguration* config, QObject* parent = 0);
+        ~AssetScannerWorker() override;
+
+        // 0 uses one thread per core.
+        void SetMaxThreadCount(int maxThreadCount);
+        // the number of files and folders found before they are emitted.
+        void SetBatchSize(int batchSize);
+        void SetSkipUnchangedDirectories(bool skipUnchangedDirectories);
 
 Q_SIGNALS:
         void ScanningStateChanged(AssetProcessor::AssetScanningStatus status);
@@ -39,22 +58,37 @@ Q_SIGNALS:
         void ExcludedFound(QSet<AssetFileInfo> excluded); // QSet<QString> is a refcounted copy-on-write object, do not pass by ref.
 
     public Q_SLOTS:
-        void StartScan();
+        // allowDirectorySkipping - false forces every directory to be listed, even when SkipUnchangedDirectories is enabled
+        void StartScan(bool allowDirectorySkipping = true);
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        struct ScanState;
+        struct PendingDirectory;
+        struct DirectoryResult;
+
+        // Runs on the threads of the scan pool until there are no directories left to scan.
+        void ScanDirectories(ScanState& state);
+        void ScanDirectory(const ScanState& state, const PendingDirectory& directory, DirectoryResult& result);
+        void LoadScanDirectories(ScanState& state);
+        void SaveScanDirectories(ScanState& state);
         void EmitFiles();
 
     private:
-        volatile bool m_doScan = true;
+        AZStd::atomic_bool m_doScan{ true };
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
 
         PlatformConfiguration* m_platformConfiguration;
+
+        int m_maxThreadCount = 0;
+        int m_batchSize;
+        bool m_skipUnchangedDirectories = false;
+
+        // created on the scanning thread, the first time that they are needed.
+        AZStd::unique_ptr<QThreadPool> m_threadPool;
+        AZStd::unique_ptr<AssetDatabaseConnection> m_databaseConnection;
     };
 } // end namespace AssetProcessor
 
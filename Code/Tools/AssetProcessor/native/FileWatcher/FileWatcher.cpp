@@ -69,34 +69,50 @@ static bool IsSubfolder(const QString& folderA, const QString& folderB)
 FileWatcher::FileWatcher()
     : m_platformImpl(AZStd::make_unique<PlatformImplementation>())
 {
-    auto makeFilter = [this](auto signal)
+    qRegisterMetaType<FileChangeList>("FileChangeList");
+
+    auto makeFilter = [this](auto signal, FileChange::Type type)
     {
-        return [this, signal](QString path)
+        return [this, signal, type](QString path)
         {
-            const auto foundWatchRoot = AZStd::find_if(begin(m_folderWatchRoots), end(m_folderWatchRoots), [path](const WatchRoot& watchRoot)
-            {
-                return Filter(path, watchRoot);
-            });
-            if (foundWatchRoot == end(m_folderWatchRoots))
-            {
-                return;
-            }
-
-            if (IsExcluded(path))
+            if (!ShouldReport(path))
             {
                 return;
             }
 
             AZStd::invoke(signal, this, path);
+            Q_EMIT filesChanged({ FileChange{ type, path } });
         };
     };
 
     // The rawFileAdded signals are emitted by the watcher thread. Use a queued
     // connection so that the consumers of the notification process the
     // notification on the main thread.
-    connect(this, &FileWatcherBase::rawFileAdded, this, makeFilter(&FileWatcherBase::fileAdded), Qt::QueuedConnection);
-    connect(this, &FileWatcherBase::rawFileRemoved, this, makeFilter(&FileWatcherBase::fileRemoved), Qt::QueuedConnection);
-    connect(this, &FileWatcherBase::rawFileModified, this, makeFilter(&FileWatcherBase::fileModified), Qt::QueuedConnection);
+    connect(this, &FileWatcherBase::rawFileAdded, this, makeFilter(&FileWatcherBase::fileAdded, FileChange::Type::Added), Qt::QueuedConnection);
+    connect(this, &FileWatcherBase::rawFileRemoved, this, makeFilter(&FileWatcherBase::fileRemoved, FileChange::Type::Removed), Qt::QueuedConnection);
+    connect(this, &FileWatcherBase::rawFileModified, this, makeFilter(&FileWatcherBase::fileModified, FileChange::Type::Modified), Qt::QueuedConnection);
+
+    // Batches were already filtered on the watcher thread, so they only need to be forwarded.
+    connect(this, &FileWatcherBase::rawFilesChanged, this, [this](FileChangeList changes)
+    {
+        for (const FileChange& change : changes)
+        {
+            switch (change.m_type)
+            {
+            case FileChange::Type::Added:
+                Q_EMIT fileAdded(change.m_filePath);
+                break;
+            case FileChange::Type::Removed:
+                Q_EMIT fileRemoved(change.m_filePath);
+                break;
+            case FileChange::Type::Modified:
+                Q_EMIT fileModified(change.m_filePath);
+                break;
+            }
+        }
+
+        Q_EMIT filesChanged(changes);
+    }, Qt::QueuedConnection);
 }
 
 FileWatcher::~FileWatcher()
@@ -216,6 +232,20 @@ bool FileWatcher::Filter(QString path, const WatchRoot& watchRoot)
     return true;
 }
 
+bool FileWatcher::ShouldReport(const QString& path) const
+{
+    const auto foundWatchRoot = AZStd::find_if(begin(m_folderWatchRoots), end(m_folderWatchRoots), [&path](const WatchRoot& watchRoot)
+    {
+        return Filter(path, watchRoot);
+    });
+    if (foundWatchRoot == end(m_folderWatchRoots))
+    {
+        return false;
+    }
+
+    return !IsExcluded(path);
+}
+
 bool FileWatcher::IsExcluded(QString filepath) const
 {
     for (const AssetBuilderSDK::FilePatternMatcher& matcher : m_excludes)
@@ -63,6 +63,8 @@ private:
         bool m_recursive;
     };
     static bool Filter(QString path, const WatchRoot& watchRoot);
+    //! Returns whether a change to the given path is in a watched folder and not excluded, so should be reported.
+    bool ShouldReport(const QString& path) const;
 
     AZStd::unique_ptr<PlatformImplementation> m_platformImpl;
     AZStd::vector<WatchRoot> m_folderWatchRoots;
@@ -9,8 +9,10 @@
 #pragma once
 
 #if !defined(Q_MOC_RUN)
+#include <QMetaType>
 #include <QObject>
 #include <QString>
+#include <QVector>
 #endif
 
 namespace AssetBuilderSDK
@@ -18,6 +20,22 @@ namespace AssetBuilderSDK
     class FilePatternMatcher;
 }
 
+//! A single file or folder change reported by a FileWatcherBase, see FileWatcherBase::filesChanged.
+struct FileChange
+{
+    enum class Type
+    {
+        Added,
+        Removed,
+        Modified
+    };
+
+    Type m_type = Type::Modified;
+    QString m_filePath;
+};
+using FileChangeList = QVector<FileChange>;
+Q_DECLARE_METATYPE(FileChangeList)
+
 //////////////////////////////////////////////////////////////////////////
 //! FileWatcherBase
 /*! Base class that handles creation and deletion of FolderRootWatches.
@@ -73,6 +91,10 @@ Q_SIGNALS:
     void fileRemoved(QString filePath);
     void fileModified(QString filePath);
 
+    // Emitted after the signals above for each batch of changes, with the same changes in the order they occurred.
+    // Platforms which do not batch their notifications emit a batch for every change.
+    void filesChanged(FileChangeList changes);
+
     // These signals are emitted by the platform implementations when files
     // change. Some platforms' file watch APIs do not support non-recursive
     // watches, so the signals are filtered before being forwarded to the
@@ -80,4 +102,8 @@ Q_SIGNALS:
     void rawFileAdded(QString filePath, QPrivateSignal);
     void rawFileRemoved(QString filePath, QPrivateSignal);
     void rawFileModified(QString filePath, QPrivateSignal);
+
+    // Emitted by platform implementations which coalesce changes into batches.  Unlike the signals
+    // above, the batch has already been filtered by the time it is emitted.
+    void rawFilesChanged(FileChangeList changes, QPrivateSignal);
 };
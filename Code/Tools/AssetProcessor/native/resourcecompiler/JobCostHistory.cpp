@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/resourcecompiler/JobCostHistory.h>
+#include <native/assetprocessor.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
+
+namespace AssetProcessor
+{
+    void JobCostHistory::LoadFromDatabase(AzToolsFramework::AssetDatabase::AssetDatabaseConnection& databaseConnection)
+    {
+        databaseConnection.QueryStatLikeStatName(
+            "ProcessJob,%",
+            [this](AzToolsFramework::AssetDatabase::StatDatabaseEntry entry)
+            {
+                // ProcessJob,scanFolder,relativePath,jobKey,platform,builderGuid
+                static constexpr int numTokensExpected = 6;
+                AZStd::vector<AZStd::string> tokens;
+                AZ::StringFunc::Tokenize(entry.m_statName, tokens, ',');
+
+                if (tokens.size() == numTokensExpected)
+                {
+                    QueueElementID elementId(SourceAssetReference(tokens[1].c_str(), tokens[2].c_str()), tokens[4].c_str(), tokens[3].c_str());
+                    RecordDuration(elementId, GetBuilderJobKey(tokens[5], tokens[3].c_str(), tokens[4].c_str()), entry.m_statValue);
+                }
+                return true;
+            });
+    }
+
+    void JobCostHistory::RecordDuration(const JobEntry& jobEntry, AZ::s64 durationMs)
+    {
+        QueueElementID elementId(jobEntry.m_sourceAssetReference, jobEntry.m_platformInfo.m_identifier.c_str(), jobEntry.m_jobKey);
+        RecordDuration(elementId,
+            GetBuilderJobKey(jobEntry.m_builderGuid.ToString<AZStd::string>(), jobEntry.m_jobKey, jobEntry.m_platformInfo.m_identifier.c_str()),
+            durationMs);
+    }
+
+    void JobCostHistory::RecordDuration(const QueueElementID& elementId, const AZStd::string& builderJobKey, AZ::s64 durationMs)
+    {
+        TotalDuration& builderJobDuration = m_builderJobDurations[builderJobKey];
+        auto [jobDuration, inserted] = m_jobDurations.try_emplace(elementId, durationMs);
+        if (inserted)
+        {
+            builderJobDuration.m_totalMs += durationMs;
+            ++builderJobDuration.m_count;
+        }
+        else
+        {
+            // only the latest run of each job counts towards the average, same as in the stats table.
+            builderJobDuration.m_totalMs += durationMs - jobDuration->second;
+            jobDuration->second = durationMs;
+        }
+    }
+
+    AZ::s64 JobCostHistory::EstimateDuration(const JobEntry& jobEntry) const
+    {
+        QueueElementID elementId(jobEntry.m_sourceAssetReference, jobEntry.m_platformInfo.m_identifier.c_str(), jobEntry.m_jobKey);
+        if (auto jobDuration = m_jobDurations.find(elementId); jobDuration != m_jobDurations.end())
+        {
+            return jobDuration->second;
+        }
+
+        auto builderJobDuration = m_builderJobDurations.find(
+            GetBuilderJobKey(jobEntry.m_builderGuid.ToString<AZStd::string>(), jobEntry.m_jobKey, jobEntry.m_platformInfo.m_identifier.c_str()));
+        if (builderJobDuration != m_builderJobDurations.end() && builderJobDuration->second.m_count > 0)
+        {
+            return builderJobDuration->second.m_totalMs / builderJobDuration->second.m_count;
+        }
+        return 0;
+    }
+
+    AZStd::string JobCostHistory::GetBuilderJobKey(const AZStd::string& builderGuid, const QString& jobKey, const QString& platform)
+    {
+        return AZStd::string::format("%s,%s,%s", builderGuid.c_str(), jobKey.toUtf8().constData(), platform.toUtf8().constData());
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+#include <native/resourcecompiler/RCCommon.h>
+
+namespace AzToolsFramework
+{
+    namespace AssetDatabase
+    {
+        class AssetDatabaseConnection;
+    }
+}
+
+namespace AssetProcessor
+{
+    struct JobEntry;
+
+    //! JobCostHistory remembers how long jobs took to process, so that the cost of a job can be estimated before it runs.
+    //! The history comes from the ProcessJob stats in the asset database, and is kept up to date as jobs finish.
+    class JobCostHistory
+    {
+    public:
+        //! Reads the duration of every job recorded by the ProcessJob stats.
+        void LoadFromDatabase(AzToolsFramework::AssetDatabase::AssetDatabaseConnection& databaseConnection);
+
+        void RecordDuration(const JobEntry& jobEntry, AZ::s64 durationMs);
+
+        //! Returns the last duration of the same job if it has run before, otherwise the average duration of the
+        //! jobs with the same builder, job key and platform.  Returns 0 if there is no history to go by.
+        AZ::s64 EstimateDuration(const JobEntry& jobEntry) const;
+
+    private:
+        struct TotalDuration
+        {
+            AZ::s64 m_totalMs = 0;
+            AZ::s64 m_count = 0;
+        };
+
+        void RecordDuration(const QueueElementID& elementId, const AZStd::string& builderJobKey, AZ::s64 durationMs);
+
+        static AZStd::string GetBuilderJobKey(const AZStd::string& builderGuid, const QString& jobKey, const QString& platform);
+
+        AZStd::unordered_map<QueueElementID, AZ::s64> m_jobDurations;
+        AZStd::unordered_map<AZStd::string, TotalDuration> m_builderJobDurations;
+    };
+} // namespace AssetProcessor
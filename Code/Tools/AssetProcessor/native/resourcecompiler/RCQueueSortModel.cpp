@@ -279,6 +279,13 @@ namespace AssetProcessor
             return leftJob->GetJobEntry().m_jobRunKey < rightJob->GetJobEntry().m_jobRunKey;
         }
 
+        // within the same priority, start the jobs expected to take longest first, so that they are not
+        // left running on their own at the end of the build while the other workers sit idle.
+        if (leftJob->GetEstimatedDuration() != rightJob->GetEstimatedDuration())
+        {
+            return leftJob->GetEstimatedDuration() > rightJob->GetEstimatedDuration();
+        }
+
         // if we get all the way down here it means we're dealing with two assets which are not
         // in any compile groups, not a priority platform, not a priority type, priority platform, etc.
         // we can arrange these any way we want, but must pick at least a stable order.
@@ -8,6 +8,8 @@
 
 #include "rccontroller.h"
 #include <native/resourcecompiler/RCCommon.h>
+#include <native/AssetDatabase/AssetDatabase.h>
+#include <native/utilities/assetUtils.h>
 #include <QTimer>
 #include <QThreadPool>
 
@@ -35,6 +37,7 @@ namespace AssetProcessor
         // regardless of whether they have chosen something bad or not - they would have had to explicitly
         // pick this value (we ship with default 0 meaning auto), so if they've changed it, they intend it that way
         m_maxJobs = cfg_maxJobs ? qMax(cfg_minJobs, cfg_maxJobs) :  maxJobs;
+        m_minJobs = qMin<unsigned int>(qMax(cfg_minJobs, 1), m_maxJobs);
 
         m_RCQueueSortModel.AttachToModel(&m_RCJobListModel);
 
@@ -59,9 +62,38 @@ namespace AssetProcessor
         return &m_RCJobListModel;
     }
 
+    unsigned int RCController::GetMaxJobs() const
+    {
+        return m_maxJobs;
+    }
+
+    void RCController::LoadJobCostHistory()
+    {
+        AssetProcessor::AssetDatabaseConnection assetDatabaseConnection;
+        if (assetDatabaseConnection.OpenDatabase())
+        {
+            m_jobCostHistory.LoadFromDatabase(assetDatabaseConnection);
+        }
+    }
+
+    void RCController::SetMemoryPerJob(AZ::u64 memoryPerJobBytes)
+    {
+        m_memoryPerJob = memoryPerJobBytes;
+    }
+
+    void RCController::SetAvailableMemoryQuery(AZStd::function<AZ::u64()> availableMemoryQuery)
+    {
+        m_availableMemoryQuery = AZStd::move(availableMemoryQuery);
+    }
+
     void RCController::StartJob(RCJob* rcJob)
     {
         Q_ASSERT(rcJob);
+        if (!m_buildTimes.m_wallClock.isValid())
+        {
+            m_buildTimes.m_wallClock.start();
+        }
+
         // request to be notified when job is done
         QObject::connect(rcJob, &RCJob::Finished, this, [this, rcJob]()
         {
@@ -139,6 +171,12 @@ namespace AssetProcessor
             Q_EMIT JobStatusChanged(rcJob->GetJobEntry(), AzToolsFramework::AssetSystem::JobStatus::Completed);
         }
 
+        // a job that never launched was cancelled before it started, and has no time to record.
+        if (rcJob->GetTimeLaunched().isValid())
+        {
+            RecordJobTime(rcJob, rcJob->GetTimeLaunched().msecsTo(QDateTime::currentDateTime()));
+        }
+
         // Move to Completed list which will mark as "completed"
         // unless a different state has been set.
         m_RCJobListModel.markAsCompleted(rcJob);
@@ -156,11 +194,84 @@ namespace AssetProcessor
             // if there is no next job, and nothing is in flight, we are done.
             if (IsIdle())
             {
+                ReportBuildTimes();
                 Q_EMIT BecameIdle();
             }
         }
     }
 
+    void RCController::RecordJobTime(RCJob* rcJob, AZ::s64 durationMs)
+    {
+        if (rcJob->GetState() == RCJob::completed)
+        {
+            m_jobCostHistory.RecordDuration(rcJob->GetJobEntry(), durationMs);
+        }
+
+        // the critical path to this job runs through whichever of the jobs it had to wait for has the longest one.
+        AZ::s64 longestDependencyPathMs = 0;
+        for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+        {
+            const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+            if (jobDependency.m_type == AssetBuilderSDK::JobDependencyType::Order ||
+                jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce ||
+                jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnly)
+            {
+                QueueElementID elementId(
+                    SourceAssetReference(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str()),
+                    jobDependency.m_platformIdentifier.c_str(),
+                    jobDependency.m_jobKey.c_str());
+                if (auto dependencyPath = m_buildTimes.m_criticalPathMs.find(elementId); dependencyPath != m_buildTimes.m_criticalPathMs.end())
+                {
+                    longestDependencyPathMs = AZStd::max(longestDependencyPathMs, dependencyPath->second);
+                }
+            }
+        }
+
+        const AZ::s64 criticalPathMs = longestDependencyPathMs + durationMs;
+        m_buildTimes.m_criticalPathMs[rcJob->GetElementID()] = criticalPathMs;
+        if (criticalPathMs > m_buildTimes.m_longestCriticalPathMs)
+        {
+            m_buildTimes.m_longestCriticalPathMs = criticalPathMs;
+            m_buildTimes.m_criticalPathEnd = rcJob->GetElementID();
+        }
+
+        if (durationMs > m_buildTimes.m_longestJobMs)
+        {
+            m_buildTimes.m_longestJobMs = durationMs;
+            m_buildTimes.m_longestJob = rcJob->GetElementID();
+        }
+
+        ++m_buildTimes.m_jobCount;
+        m_buildTimes.m_totalJobMs += durationMs;
+    }
+
+    void RCController::ReportBuildTimes()
+    {
+        if (m_buildTimes.m_jobCount > 0)
+        {
+            // with enough workers, a build can't finish any sooner than its critical path, no matter how the jobs are scheduled.
+            const AZ::s64 wallClockMs = AZStd::max<AZ::s64>(m_buildTimes.m_wallClock.elapsed(), 1);
+            AZ_TracePrintf(
+                AssetProcessor::ConsoleChannel,
+                "Processed %d jobs in %.2f seconds, %.2f seconds of job time at an average of %.1f jobs at once.\n"
+                "Critical path: %.2f seconds, ending with %s (%s, %s).\n"
+                "Longest job: %.2f seconds, %s (%s, %s).\n",
+                m_buildTimes.m_jobCount,
+                wallClockMs / 1000.0,
+                m_buildTimes.m_totalJobMs / 1000.0,
+                static_cast<double>(m_buildTimes.m_totalJobMs) / wallClockMs,
+                m_buildTimes.m_longestCriticalPathMs / 1000.0,
+                m_buildTimes.m_criticalPathEnd.GetSourceAssetReference().AbsolutePath().c_str(),
+                m_buildTimes.m_criticalPathEnd.GetPlatform().toUtf8().constData(),
+                m_buildTimes.m_criticalPathEnd.GetJobDescriptor().toUtf8().constData(),
+                m_buildTimes.m_longestJobMs / 1000.0,
+                m_buildTimes.m_longestJob.GetSourceAssetReference().AbsolutePath().c_str(),
+                m_buildTimes.m_longestJob.GetPlatform().toUtf8().constData(),
+                m_buildTimes.m_longestJob.GetJobDescriptor().toUtf8().constData());
+        }
+        m_buildTimes = BuildTimes();
+    }
+
     bool RCController::IsIdle()
     {
         return ((!m_RCQueueSortModel.GetNextPendingJob()) && (m_RCJobListModel.jobsInFlight() == 0));
@@ -279,6 +390,7 @@ namespace AssetProcessor
 
         RCJob* rcJob = new RCJob(&m_RCJobListModel);
         rcJob->Init(details); // note - move operation.  From this point on you must use the job details to refer to it.
+        rcJob->SetEstimatedDuration(m_jobCostHistory.EstimateDuration(rcJob->GetJobEntry()));
         m_RCQueueSortModel.AddJobIdEntry(rcJob);
         m_RCJobListModel.addNewJob(rcJob);
         QString platformName = rcJob->GetPlatformInfo().m_identifier.c_str();// we need to get the actual platform from the rcJob
@@ -336,6 +448,14 @@ namespace AssetProcessor
             m_dispatchingJobs = true;
             RCJob* rcJob = m_RCQueueSortModel.GetNextPendingJob();
 
+            // memory is only queried once per dispatch, since the jobs started below won't have taken up theirs yet.
+            AZ::u64 availableMemory = 0;
+            if (m_memoryPerJob > 0)
+            {
+                availableMemory = m_availableMemoryQuery ? m_availableMemoryQuery() : AssetUtilities::GetAvailablePhysicalMemory();
+            }
+            const bool limitByMemory = availableMemory > 0;
+
             while (m_RCJobListModel.jobsInFlight() < m_maxJobs && rcJob && !m_shuttingDown)
             {
                 if (m_dispatchingPaused)
@@ -346,6 +466,16 @@ namespace AssetProcessor
                         break;
                     }
                 }
+
+                if (limitByMemory && !rcJob->IsAutoFail())
+                {
+                    if (availableMemory < m_memoryPerJob && m_RCJobListModel.jobsInFlight() >= m_minJobs)
+                    {
+                        // the rest are started as the running jobs finish and give their memory back.
+                        break;
+                    }
+                    availableMemory -= AZStd::min(availableMemory, m_memoryPerJob);
+                }
                 StartJob(rcJob);
                 rcJob = m_RCQueueSortModel.GetNextPendingJob();
             }
@@ -15,11 +15,14 @@
 #include <QProcess>
 #include <QDir>
 #include <QList>
+#include <QElapsedTimer>
 #include "native/utilities/AssetUtilEBusHelper.h"
 
 #include "rcjoblistmodel.h"
 #include "RCQueueSortModel.h"
+#include "JobCostHistory.h"
 
+#include <AzCore/std/function/function_template.h>
 #include <AzFramework/Asset/AssetProcessorMessages.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 #endif
@@ -57,6 +60,19 @@ namespace AssetProcessor
         int NumberOfPendingJobsPerPlatform(QString platform);
         bool IsIdle();
 
+        unsigned int GetMaxJobs() const;
+
+        //! Reads how long jobs took the last time they ran from the asset database, so that the longest ones can be started first.
+        void LoadJobCostHistory();
+
+        //! Sets how much physical memory each job is expected to need.  Jobs beyond the minimum are only started while there is
+        //! that much memory available for each of them.  0 turns the check off.
+        void SetMemoryPerJob(AZ::u64 memoryPerJobBytes);
+
+        //! Replaces how the available physical memory is queried when jobs are dispatched.  An empty function restores the default,
+        //! AssetUtilities::GetAvailablePhysicalMemory.
+        void SetAvailableMemoryQuery(AZStd::function<AZ::u64()> availableMemoryQuery);
+
     Q_SIGNALS:
         void FileCompiled(JobEntry entry, AssetBuilderSDK::ProcessJobResponse response);
         void FileFailed(JobEntry entry);
@@ -111,7 +127,32 @@ namespace AssetProcessor
     private:
         void FinishJob(AssetProcessor::RCJob* rcJob);
 
+        //! Adds a job that just finished to the job cost history and to the times of the current build.
+        void RecordJobTime(AssetProcessor::RCJob* rcJob, AZ::s64 durationMs);
+        //! Logs how long the jobs that ran since the controller was last idle took, then starts over.
+        void ReportBuildTimes();
+
         unsigned int m_maxJobs;
+        unsigned int m_minJobs = 1;
+        AZ::u64 m_memoryPerJob = 0;
+        AZStd::function<AZ::u64()> m_availableMemoryQuery;
+
+        JobCostHistory m_jobCostHistory;
+
+        //! The times of the jobs that ran since the controller was last idle.
+        struct BuildTimes
+        {
+            QElapsedTimer m_wallClock;
+            int m_jobCount = 0;
+            AZ::s64 m_totalJobMs = 0;
+            //! For each finished job, the longest chain of order dependencies that ends with it, including its own duration.
+            AZStd::unordered_map<QueueElementID, AZ::s64> m_criticalPathMs;
+            AZ::s64 m_longestCriticalPathMs = 0;
+            QueueElementID m_criticalPathEnd;
+            AZ::s64 m_longestJobMs = 0;
+            QueueElementID m_longestJob;
+        };
+        BuildTimes m_buildTimes;
 
         bool m_dispatchingJobs = false;
         bool m_shuttingDown = false;
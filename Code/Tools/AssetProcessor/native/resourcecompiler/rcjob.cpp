@@ -141,6 +141,16 @@ namespace AssetProcessor
         m_timeCompleted = timeCompleted;
     }
 
+    AZ::s64 RCJob::GetEstimatedDuration() const
+    {
+        return m_estimatedDurationMs;
+    }
+
+    void RCJob::SetEstimatedDuration(AZ::s64 estimatedDurationMs)
+    {
+        m_estimatedDurationMs = estimatedDurationMs;
+    }
+
     AZ::u32 RCJob::GetOriginalFingerprint() const
     {
         return m_jobDetails.m_jobEntry.m_computedFingerprint;
@@ -179,6 +179,10 @@ namespace AssetProcessor
         QDateTime GetTimeCompleted() const;
         void SetTimeCompleted(const QDateTime& timeCompleted);
 
+        //! The number of milliseconds the job is expected to take, based on previous runs.  0 if unknown.
+        AZ::s64 GetEstimatedDuration() const;
+        void SetEstimatedDuration(AZ::s64 estimatedDurationMs);
+
         void SetOriginalFingerprint(AZ::u32 originalFingerprint);
         AZ::u32 GetOriginalFingerprint() const;
 
@@ -269,6 +273,8 @@ namespace AssetProcessor
         QDateTime m_timeLaunched;
         QDateTime m_timeCompleted;
 
+        AZ::s64 m_estimatedDurationMs = 0;
+
         unsigned int m_exitCode = 0;
 
         AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer m_products;
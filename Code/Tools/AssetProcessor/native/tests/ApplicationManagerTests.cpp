@@ -90,6 +90,10 @@ namespace UnitTests
         Q_EMIT m_fileWatcher->fileAdded((assetRootDir / "test").c_str());
         Q_EMIT m_fileWatcher->fileModified((assetRootDir / "test2").c_str());
         Q_EMIT m_fileWatcher->fileRemoved((assetRootDir / "test3").c_str());
+        // the file watcher follows the individual signals with the same changes as a batch, which is what the APM listens to.
+        Q_EMIT m_fileWatcher->filesChanged({ FileChange{ FileChange::Type::Added, (assetRootDir / "test").c_str() },
+                                             FileChange{ FileChange::Type::Modified, (assetRootDir / "test2").c_str() },
+                                             FileChange{ FileChange::Type::Removed, (assetRootDir / "test3").c_str() } });
 
         EXPECT_TRUE(m_mockAPM->m_events[Added].WaitAndCheck()) << "APM Added event failed";
         EXPECT_TRUE(m_mockAPM->m_events[Modified].WaitAndCheck()) << "APM Modified event failed";
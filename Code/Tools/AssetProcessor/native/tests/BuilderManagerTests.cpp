@@ -56,6 +56,34 @@ namespace UnitTests
         ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
     }
 
+    TEST_F(BuilderManagerTest, PrestartBuilders_BuildersAreReusedForJobs)
+    {
+        ConnectionManager cm{nullptr};
+        TestBuilderManager bm(&cm);
+
+        constexpr int NumberOfBuilders = 4;
+        bm.PrestartBuilders(NumberOfBuilders);
+        bm.WaitForPrestartedBuilders();
+
+        // The CreateJobs builder is not counted towards the prestarted ones
+        ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
+
+        AZStd::vector<AssetProcessor::BuilderRef> builders;
+        for (int i = 0; i < NumberOfBuilders; ++i)
+        {
+            builders.push_back(bm.GetBuilder(AssetProcessor::BuilderPurpose::ProcessJob));
+            ASSERT_TRUE(builders.back());
+        }
+
+        // Jobs should have been given the prestarted builders rather than new ones
+        ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
+
+        // Asking again for the same number of builders doesn't start any more
+        bm.PrestartBuilders(NumberOfBuilders);
+        bm.WaitForPrestartedBuilders();
+        ASSERT_EQ(bm.GetBuilderCreationCount(), NumberOfBuilders + 1);
+    }
+
     AZ::Outcome<void, AZStd::string> TestBuilder::Start(AssetProcessor::BuilderPurpose /*purpose*/)
     {
         return AZ::Success();
@@ -71,6 +99,17 @@ namespace UnitTests
         return m_connectionCounter;
     }
 
+    void TestBuilderManager::WaitForPrestartedBuilders()
+    {
+        for (AZStd::thread& prestartThread : m_prestartThreads)
+        {
+            if (prestartThread.joinable())
+            {
+                prestartThread.join();
+            }
+        }
+    }
+
     AZStd::shared_ptr<AssetProcessor::Builder> TestBuilderManager::AddNewBuilder(AssetProcessor::BuilderPurpose purpose)
     {
         auto uuid = AZ::Uuid::CreateRandom();
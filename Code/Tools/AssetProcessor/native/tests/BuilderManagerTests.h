@@ -32,6 +32,7 @@ namespace UnitTests
         TestBuilderManager(ConnectionManager* connectionManager);
 
         int GetBuilderCreationCount() const;
+        void WaitForPrestartedBuilders();
 
     protected:
         AZStd::shared_ptr<AssetProcessor::Builder> AddNewBuilder(AssetProcessor::BuilderPurpose purpose) override;
@@ -7,6 +7,7 @@
  */
 
 #include <native/tests/FileStateCache/FileStateCacheTests.h>
+#include <native/tests/MockAssetDatabaseRequestsHandler.h>
 #include <native/utilities/assetUtils.h>
 #include <native/unittests/UnitTestUtils.h>
 
@@ -166,4 +167,62 @@ namespace UnitTests
         CheckForFile(R"(c:\some\test\file.txt)", true);
         CheckForFile(R"(c:/some/test/file.txt)", true);
     }
+
+    namespace
+    {
+        void SetModificationTime(const QString& path, const QDateTime& modTime)
+        {
+            QFile file(path);
+            ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+            ASSERT_TRUE(file.setFileTime(modTime, QFileDevice::FileModificationTime));
+        }
+    }
+
+    TEST_F(FileStateCacheTests, LoadedFileHashCache_UnchangedFile_ReusesRecordedHash)
+    {
+        using FileHash = AssetProcessor::IFileStateRequests::FileHash;
+
+        AssetProcessor::MockAssetDatabaseRequestsHandler databaseLocationListener;
+        AssetUtilities::SetUseFileHashOverride(true, true);
+
+        QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
+        // the file is backdated, a file that was modified too recently doesn't have its hash recorded
+        const QDateTime modTime = QDateTime::currentDateTime().addSecs(-60);
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "first"));
+        SetModificationTime(testPath, modTime);
+
+        m_fileStateCache = nullptr; // Need to release the existing one first since only one handler can exist for the ebus
+        auto fileStateCache = AZStd::make_unique<AssetProcessor::FileStateCache>();
+        ASSERT_TRUE(fileStateCache->LoadFileHashCache());
+        fileStateCache->AddFile(testPath);
+
+        FileHash firstHash = AssetProcessor::IFileStateRequests::InvalidFileHash;
+        ASSERT_TRUE(fileStateCache->GetHash(testPath, &firstHash));
+        fileStateCache->SaveFileHashCache(false);
+        fileStateCache = nullptr;
+
+        // rewrite the file in place with contents of the same size, and restore its modification time.
+        // the recorded hash is reused, which shows that the file was not read again.
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "other"));
+        SetModificationTime(testPath, modTime);
+
+        fileStateCache = AZStd::make_unique<AssetProcessor::FileStateCache>();
+        ASSERT_TRUE(fileStateCache->LoadFileHashCache());
+        fileStateCache->AddFile(testPath);
+
+        FileHash recordedHash = AssetProcessor::IFileStateRequests::InvalidFileHash;
+        ASSERT_TRUE(fileStateCache->GetHash(testPath, &recordedHash));
+        EXPECT_EQ(recordedHash, firstHash);
+
+        // a different modification time invalidates the recorded hash
+        SetModificationTime(testPath, modTime.addSecs(30));
+        fileStateCache->UpdateFile(testPath);
+
+        FileHash updatedHash = AssetProcessor::IFileStateRequests::InvalidFileHash;
+        ASSERT_TRUE(fileStateCache->GetHash(testPath, &updatedHash));
+        EXPECT_NE(updatedHash, firstHash);
+
+        fileStateCache = nullptr;
+        AssetUtilities::SetUseFileHashOverride(false, false);
+    }
 }
@@ -2664,4 +2664,144 @@ namespace UnitTests
 
     }
 
+    TEST_F(AssetDatabaseTest, ScopedWriteBatch_Committed_KeepsAllWrites)
+    {
+        CreateCoverageTestData();
+
+        SourceDatabaseEntry newSource{ m_data->m_scanFolder.m_scanFolderID, "batched.tif", AZ::Uuid::CreateRandom(), "AnalysisFingerprint3" };
+        {
+            AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch writeBatch(m_data->m_connection);
+            ASSERT_TRUE(m_data->m_connection.SetSource(newSource));
+
+            // a write which fails inside of the batch is rolled back on its own, without discarding the rest of the batch.
+            ProductDatabaseEntry invalidProduct{ 9999, 1, "invalid.dds", AZ::Data::AssetType::CreateRandom() };
+            m_errorAbsorber->Clear();
+            EXPECT_FALSE(m_data->m_connection.SetProduct(invalidProduct));
+            EXPECT_GT(m_errorAbsorber->m_numErrorsAbsorbed, 0);
+
+            writeBatch.Commit();
+        }
+
+        SourceDatabaseEntry foundSource;
+        EXPECT_TRUE(m_data->m_connection.GetSourceBySourceID(newSource.m_sourceID, foundSource));
+        EXPECT_EQ(foundSource, newSource);
+    }
+
+    TEST_F(AssetDatabaseTest, ScopedWriteBatch_NotCommitted_DiscardsAllWrites)
+    {
+        CreateCoverageTestData();
+
+        SourceDatabaseEntry newSource{ m_data->m_scanFolder.m_scanFolderID, "batched.tif", AZ::Uuid::CreateRandom(), "AnalysisFingerprint3" };
+        {
+            AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch writeBatch(m_data->m_connection);
+            ASSERT_TRUE(m_data->m_connection.SetSource(newSource));
+
+            // writes made inside of the batch are visible to the connection which made them.
+            SourceDatabaseEntry foundSource;
+            EXPECT_TRUE(m_data->m_connection.GetSourceBySourceID(newSource.m_sourceID, foundSource));
+        }
+
+        SourceDatabaseEntry foundSource;
+        EXPECT_FALSE(m_data->m_connection.GetSourceBySourceID(newSource.m_sourceID, foundSource));
+    }
+
+    // Records completed jobs (a source, a job, two products and their dependencies each) in a database on disk.
+    // The first argument is the number of jobs recorded per iteration, the second is 1 to record them in a single
+    // ScopedWriteBatch and 0 to record each write in its own transaction.
+    struct AssetDatabaseBenchmarks : public ::benchmark::Fixture
+    {
+        void SetUp([[maybe_unused]] const benchmark::State& st) override
+        {
+            SetupTestData();
+        }
+        void SetUp([[maybe_unused]] benchmark::State& st) override
+        {
+            SetupTestData();
+        }
+
+        void TearDown([[maybe_unused]] benchmark::State& st) override
+        {
+            m_data.reset();
+        }
+        void TearDown([[maybe_unused]] const benchmark::State& st) override
+        {
+            m_data.reset();
+        }
+
+        void SetupTestData()
+        {
+            m_data = AZStd::make_unique<StaticData>();
+            m_data->m_connection.OpenDatabase();
+
+            m_data->m_scanFolder = { "c:/O3DE/dev", "dev", "rootportkey" };
+            m_data->m_connection.SetScanFolder(m_data->m_scanFolder);
+        }
+
+        void RecordCompletedJob(int jobIndex)
+        {
+            SourceDatabaseEntry source{ m_data->m_scanFolder.m_scanFolderID,
+                                        AZStd::string::format("source%d.tif", jobIndex).c_str(),
+                                        AZ::Uuid::CreateRandom(),
+                                        "AnalysisFingerprint" };
+            m_data->m_connection.SetSource(source);
+
+            JobDatabaseEntry job{ source.m_sourceID, "some job key", 123, "pc", AZ::Uuid::CreateRandom(),
+                                  AzToolsFramework::AssetSystem::JobStatus::Completed, static_cast<AZ::u64>(jobIndex) + 1 };
+            m_data->m_connection.SetJob(job);
+
+            ProductDependencyDatabaseEntryContainer dependencies;
+            for (AZ::u32 subId = 0; subId < 2; ++subId)
+            {
+                ProductDatabaseEntry product{ job.m_jobID, subId,
+                                              AZStd::string::format("pc/source%d_%u.dds", jobIndex, subId).c_str(),
+                                              AZ::Data::AssetType::CreateRandom() };
+                m_data->m_connection.SetProduct(product);
+                dependencies.emplace_back(product.m_productID, AZ::Uuid::CreateRandom(), 0, 0, "pc", 0);
+            }
+            m_data->m_connection.SetProductDependencies(dependencies);
+        }
+
+        struct StaticData
+        {
+            AssetProcessor::MockAssetDatabaseRequestsHandler m_databaseLocationListener;
+            AssetProcessor::AssetDatabaseConnection m_connection;
+            ScanFolderDatabaseEntry m_scanFolder;
+        };
+
+        AZStd::unique_ptr<StaticData> m_data;
+        int m_nextJobIndex = 0;
+    };
+
+    BENCHMARK_DEFINE_F(AssetDatabaseBenchmarks, BM_RecordCompletedJobs)(benchmark::State& state)
+    {
+        const int jobCount = static_cast<int>(state.range(0));
+        const bool batched = state.range(1) != 0;
+
+        for ([[maybe_unused]] auto unused : state)
+        {
+            AZStd::unique_ptr<AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch> writeBatch;
+            if (batched)
+            {
+                writeBatch = AZStd::make_unique<AssetProcessor::AssetDatabaseConnection::ScopedWriteBatch>(m_data->m_connection);
+            }
+
+            for (int jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                RecordCompletedJob(m_nextJobIndex++);
+            }
+
+            if (writeBatch)
+            {
+                writeBatch->Commit();
+            }
+        }
+
+        state.counters["JobsPerSecond"] = benchmark::Counter(static_cast<double>(state.iterations() * jobCount), benchmark::Counter::kIsRate);
+    }
+
+    BENCHMARK_REGISTER_F(AssetDatabaseBenchmarks, BM_RecordCompletedJobs)
+        ->Args({ 256, 0 })
+        ->Args({ 256, 1 })
+        ->Unit(benchmark::kMillisecond);
+
 } // end namespace UnitTests
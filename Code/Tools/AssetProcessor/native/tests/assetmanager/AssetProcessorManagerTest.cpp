@@ -5367,6 +5367,17 @@ void DuplicateProductsTest::SetupDuplicateProductsTest(QString& sourceFile, QDir
     ASSERT_TRUE(BlockUntilIdle(5000));
 }
 
+void DuplicateProductsTest::SetProcessedBatching(int batchIntervalMs, size_t batchMaxJobs)
+{
+    m_assetProcessorManager->m_processedBatchIntervalMs = batchIntervalMs;
+    m_assetProcessorManager->m_processedBatchMaxJobs = batchMaxJobs;
+}
+
+bool DuplicateProductsTest::IsProcessedBatchPending() const
+{
+    return m_assetProcessorManager->m_processedQueued || m_assetProcessorManager->m_processedBatchTimer->isActive();
+}
+
 TEST_F(DuplicateProductsTest, SameSource_MultipleBuilder_DuplicateProductJobs_EmitAutoFailJob)
 {
     using namespace AssetProcessor;
@@ -5415,6 +5426,47 @@ TEST_F(DuplicateProductsTest, SameSource_SameBuilder_DuplicateProductJobs_EmitAu
     EXPECT_TRUE(jobDetails.back().m_jobParam.find(AZ_CRC(AutoFailReasonKey)) != jobDetails.back().m_jobParam.end());
 }
 
+TEST_F(DuplicateProductsTest, SameSource_MultipleBuilder_DuplicateProductJobsInOneBatch_EmitAutoFailJob)
+{
+    using namespace AssetProcessor;
+    using namespace AssetBuilderSDK;
+
+    QString productFile;
+    QString sourceFile;
+    AZStd::vector<JobDetails> jobDetails;
+
+    ProcessJobResponse response;
+    SetupDuplicateProductsTest(sourceFile, m_assetRootDir, productFile, jobDetails, response, false, "txt");
+
+    // ----------------------------- TEST BEGINS HERE -----------------------------
+    // Both jobs of the source output a product which isn't in the database yet, and their results are recorded in the same
+    // batch, so the second one can only be caught by checking it against the first one.
+    auto filename = "product_batched.txt";
+    productFile = (jobDetails[0].m_cachePath / filename).AsPosix().c_str();
+    UnitTestUtils::CreateDummyFile(productFile, "product");
+
+    JobProduct batchedJobProduct((jobDetails[0].m_relativePath / filename).c_str(), AZ::Uuid::CreateRandom(), static_cast<AZ::u32>(0));
+    response.m_outputProducts.clear();
+    response.m_outputProducts.push_back(batchedJobProduct);
+
+    // the second result fills the batch, which records it right away rather than waiting for the interval.
+    SetProcessedBatching(60 * 1000, 2);
+
+    JobDetails firstJobDetail = jobDetails[0];
+    JobDetails secondJobDetail = jobDetails[1];
+    jobDetails.clear();
+    m_isIdling = false;
+    m_assetProcessorManager->AssetProcessed(firstJobDetail.m_jobEntry, response);
+    EXPECT_TRUE(IsProcessedBatchPending());
+    m_assetProcessorManager->AssetProcessed(secondJobDetail.m_jobEntry, response);
+    EXPECT_FALSE(IsProcessedBatchPending());
+    ASSERT_TRUE(BlockUntilIdle(5000));
+
+    ASSERT_EQ(jobDetails.size(), 1);
+    EXPECT_EQ(jobDetails.back().m_jobEntry.m_jobKey, secondJobDetail.m_jobEntry.m_jobKey);
+    EXPECT_TRUE(jobDetails.back().m_jobParam.find(AZ_CRC(AutoFailReasonKey)) != jobDetails.back().m_jobParam.end());
+}
+
 TEST_F(DuplicateProductsTest, SameSource_MultipleBuilder_NoDuplicateProductJob_NoWarning)
 {
     using namespace AssetProcessor;
@@ -367,4 +367,6 @@ struct DuplicateProductsTest
     : public AssetProcessorManagerTest
 {
     void SetupDuplicateProductsTest(QString& sourceFile, QDir& tempPath, QString& productFile, AZStd::vector<AssetProcessor::JobDetails>& jobDetails, AssetBuilderSDK::ProcessJobResponse& response, bool multipleOutputs, QString extension);
+    void SetProcessedBatching(int batchIntervalMs, size_t batchMaxJobs);
+    bool IsProcessedBatchPending() const;
 };
@@ -8,6 +8,7 @@
 
 #include <native/tests/assetscanner/AssetScannerTests.h>
 #include <native/AssetManager/assetScanner.h>
+#include <native/AssetManager/assetScannerWorker.h>
 
 namespace AssetProcessor
 {
@@ -154,4 +155,111 @@ namespace AssetProcessor
         EXPECT_FALSE(m_files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
         EXPECT_EQ(m_folders.size(), 0);
     }
+
+    TEST_F(AssetScannerTest, AssetScannerWorker_SmallBatchSize_EmitsFilesInBatches)
+    {
+        QDir tempDir(m_tempDir.path());
+
+        // the worker is scanned on this thread, so that its signals are delivered directly
+        AssetScannerWorker worker(m_platformConfig.get());
+        worker.SetBatchSize(1);
+        worker.SetMaxThreadCount(2);
+
+        int batchCount = 0;
+        QSet<QString> files;
+        QObject::connect(&worker, &AssetScannerWorker::FilesFound, [&](QSet<AssetFileInfo> fileList)
+        {
+            ++batchCount;
+            for (const AssetFileInfo& foundFile : fileList)
+            {
+                EXPECT_FALSE(files.contains(foundFile.m_filePath));
+                files.insert(foundFile.m_filePath);
+            }
+        });
+
+        worker.StartScan();
+
+        EXPECT_GT(batchCount, 1);
+        EXPECT_EQ(files.size(), 4);
+        EXPECT_TRUE(files.contains(tempDir.filePath("rootfile.txt")));
+        EXPECT_TRUE(files.contains(tempDir.filePath("subfolder1/basefile.txt")));
+        EXPECT_TRUE(files.contains(tempDir.filePath("subfolder2/basefile.txt")));
+        EXPECT_TRUE(files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
+    }
+
+    // Scans a synthetic tree of empty files, 100 files to a directory and 100 directories to a parent directory.
+    // The first argument is the number of files, the second is the number of scanning threads (0 uses one per core).
+    struct AssetScannerBenchmarks : public ::benchmark::Fixture
+    {
+        void SetUp(const benchmark::State& st) override
+        {
+            SetupTestData(static_cast<int>(st.range(0)));
+        }
+        void SetUp(benchmark::State& st) override
+        {
+            SetupTestData(static_cast<int>(st.range(0)));
+        }
+
+        void TearDown([[maybe_unused]] benchmark::State& st) override
+        {
+            m_platformConfig.reset();
+            m_tempDir.reset();
+        }
+        void TearDown([[maybe_unused]] const benchmark::State& st) override
+        {
+            m_platformConfig.reset();
+            m_tempDir.reset();
+        }
+
+        void SetupTestData(int fileCount)
+        {
+            m_tempDir = AZStd::make_unique<QTemporaryDir>();
+            QDir tempPath(m_tempDir->path());
+
+            for (int fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+            {
+                QString directory = QString("%1/%2").arg(fileIndex / 10000).arg((fileIndex / 100) % 100);
+                if (fileIndex % 100 == 0)
+                {
+                    tempPath.mkpath(directory);
+                }
+                QFile file(tempPath.filePath(QString("%1/%2.txt").arg(directory).arg(fileIndex)));
+                file.open(QIODevice::WriteOnly);
+            }
+
+            m_platformConfig = AZStd::make_unique<PlatformConfiguration>();
+            AZStd::vector<AssetBuilderSDK::PlatformInfo> platforms;
+            m_platformConfig->PopulatePlatformsForScanFolder(platforms);
+            m_platformConfig->AddScanFolder(ScanFolderInfo(tempPath.absolutePath(), "", "ap1", true, true, platforms));
+        }
+
+        AZStd::unique_ptr<QTemporaryDir> m_tempDir;
+        AZStd::unique_ptr<PlatformConfiguration> m_platformConfig;
+    };
+
+    BENCHMARK_DEFINE_F(AssetScannerBenchmarks, BM_ScanSourceFiles)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto unused : state)
+        {
+            AssetScannerWorker worker(m_platformConfig.get());
+            worker.SetMaxThreadCount(static_cast<int>(state.range(1)));
+
+            int fileCount = 0;
+            QObject::connect(&worker, &AssetScannerWorker::FilesFound, [&fileCount](QSet<AssetFileInfo> fileList)
+            {
+                fileCount += fileList.size();
+            });
+
+            worker.StartScan();
+            benchmark::DoNotOptimize(fileCount);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(AssetScannerBenchmarks, BM_ScanSourceFiles)
+        ->Args({ 10000, 1 })
+        ->Args({ 10000, 0 })
+        ->Args({ 1000000, 1 })
+        ->Args({ 1000000, 0 })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(1);
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/tests/AssetProcessorTest.h>
+#include <native/tests/MockAssetDatabaseRequestsHandler.h>
+#include <native/AssetDatabase/AssetDatabase.h>
+#include <native/resourcecompiler/JobCostHistory.h>
+#include <native/assetprocessor.h>
+
+namespace AssetProcessor
+{
+    class JobCostHistoryTest
+        : public AssetProcessorTest
+    {
+    public:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            m_dbConnection.OpenDatabase();
+        }
+
+        void TearDown() override
+        {
+            m_dbConnection.CloseDatabase();
+            AssetProcessorTest::TearDown();
+        }
+
+        static JobEntry MakeJobEntry(const char* relativePath, const char* jobKey = "Text files", const char* platform = "pc")
+        {
+            JobEntry jobEntry;
+            jobEntry.m_sourceAssetReference = SourceAssetReference(ScanFolderPath, relativePath);
+            jobEntry.m_platformInfo = { platform, { "desktop", "renderer" } };
+            jobEntry.m_jobKey = jobKey;
+            jobEntry.m_builderGuid = BuilderGuid;
+            return jobEntry;
+        }
+
+        // the same key the asset processor manager records the duration of a job under.
+        static AZStd::string MakeStatName(const char* relativePath, const char* jobKey = "Text files", const char* platform = "pc")
+        {
+            return AZStd::string::format("ProcessJob,%s,%s,%s,%s,%s",
+                ScanFolderPath, relativePath, jobKey, platform, BuilderGuid.ToString<AZStd::string>().c_str());
+        }
+
+        void AddStat(const AZStd::string& statName, AZ::s64 durationMs)
+        {
+            AzToolsFramework::AssetDatabase::StatDatabaseEntry statEntry{ statName, durationMs, 0 };
+            ASSERT_TRUE(m_dbConnection.ReplaceStat(statEntry));
+        }
+
+        static constexpr const char* ScanFolderPath = "c:/somepath";
+        static inline const AZ::Uuid BuilderGuid = AZ::Uuid::CreateName("JobCostHistoryTest");
+
+        MockAssetDatabaseRequestsHandler m_databaseLocationListener;
+        AssetDatabaseConnection m_dbConnection;
+    };
+
+    TEST_F(JobCostHistoryTest, LoadFromDatabase_ProcessJobStats_EstimatesRecordedDuration)
+    {
+        AddStat(MakeStatName("fileA.txt"), 1500);
+        AddStat(MakeStatName("fileA.txt", "Text files", "android"), 700);
+
+        JobCostHistory jobCostHistory;
+        jobCostHistory.LoadFromDatabase(m_dbConnection);
+
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileA.txt")), 1500);
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileA.txt", "Text files", "android")), 700);
+    }
+
+    TEST_F(JobCostHistoryTest, LoadFromDatabase_OtherStats_AreIgnored)
+    {
+        AddStat(AZStd::string::format("CreateJobs,%s,fileA.txt,%s", ScanFolderPath, BuilderGuid.ToString<AZStd::string>().c_str()), 1500);
+        // one token too many, as in a job key that contains a comma.
+        AddStat(AZStd::string::format("ProcessJob,%s,fileA.txt,Text,files,pc,%s", ScanFolderPath, BuilderGuid.ToString<AZStd::string>().c_str()), 1500);
+
+        JobCostHistory jobCostHistory;
+        jobCostHistory.LoadFromDatabase(m_dbConnection);
+
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileA.txt")), 0);
+    }
+
+    TEST_F(JobCostHistoryTest, EstimateDuration_JobWithoutHistory_UsesAverageOfSameBuilderJobKeyAndPlatform)
+    {
+        AddStat(MakeStatName("fileA.txt"), 1000);
+        AddStat(MakeStatName("fileB.txt"), 3000);
+        AddStat(MakeStatName("fileC.txt", "Other files"), 9000);
+        AddStat(MakeStatName("fileD.txt", "Text files", "android"), 9000);
+
+        JobCostHistory jobCostHistory;
+        jobCostHistory.LoadFromDatabase(m_dbConnection);
+
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileNew.txt")), 2000);
+
+        JobEntry otherBuilderJobEntry = MakeJobEntry("fileNew.txt");
+        otherBuilderJobEntry.m_builderGuid = AZ::Uuid::CreateName("OtherBuilder");
+        EXPECT_EQ(jobCostHistory.EstimateDuration(otherBuilderJobEntry), 0);
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileNew.txt", "Unknown files")), 0);
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileNew.txt", "Text files", "mac")), 0);
+    }
+
+    TEST_F(JobCostHistoryTest, RecordDuration_JobRunsAgain_ReplacesItsDurationInTheAverage)
+    {
+        JobCostHistory jobCostHistory;
+        jobCostHistory.RecordDuration(MakeJobEntry("fileA.txt"), 1000);
+        jobCostHistory.RecordDuration(MakeJobEntry("fileB.txt"), 3000);
+        jobCostHistory.RecordDuration(MakeJobEntry("fileA.txt"), 5000);
+
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileA.txt")), 5000);
+        EXPECT_EQ(jobCostHistory.EstimateDuration(MakeJobEntry("fileNew.txt")), 4000);
+    }
+} // namespace AssetProcessor
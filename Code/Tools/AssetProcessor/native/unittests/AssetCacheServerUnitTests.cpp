@@ -16,10 +16,12 @@
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <native/resourcecompiler/rcjob.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/ContentAddressedJobCache.h>
 #include <native/utilities/assetUtils.h>
 #include <native/unittests/UnitTestUtils.h>
 #include <QStandardPaths>
 #include <QDir>
+#include <QDirIterator>
 
 namespace UnitTest
 {
@@ -122,7 +124,7 @@ namespace UnitTest
     TEST_F(AssetServerHandlerUnitTest, AssetCacheServer_UnConfiguredToRunAsServer_SetsFalse)
     {
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
 
         AssetProcessor::AssetServerHandler assetServerHandler;
         EXPECT_FALSE(assetServerHandler.IsServerAddressValid());
@@ -134,7 +136,7 @@ namespace UnitTest
         MockSettingsRegistry();
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
 
         AssetProcessor::AssetServerHandler assetServerHandler;
         EXPECT_TRUE(assetServerHandler.IsServerAddressValid());
@@ -147,7 +149,7 @@ namespace UnitTest
         MockSettingsRegistry();
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
 
         AssetProcessor::AssetServerHandler assetServerHandler;
         EXPECT_TRUE(assetServerHandler.IsServerAddressValid());
@@ -169,7 +171,7 @@ namespace UnitTest
         ON_CALL(m_mockArchiveCommandsBusHandler, CreateArchive(::testing::_, ::testing::_)).WillByDefault(createArchive);
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
         EXPECT_CALL(m_mockArchiveCommandsBusHandler, CreateArchive(::testing::_, ::testing::_)).Times(1);
 
         QObject parent{};
@@ -209,7 +211,7 @@ namespace UnitTest
         ON_CALL(m_mockArchiveCommandsBusHandler, ExtractArchive(::testing::_, ::testing::_)).WillByDefault(extractArchive);
 
         EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<AZStd::string&>(), ::testing::_)).Times(2);
-        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(1);
+        EXPECT_CALL(m_mockSettingsRegistry, Get(::testing::An<bool&>(), ::testing::_)).Times(2);
         EXPECT_CALL(m_mockArchiveCommandsBusHandler, ExtractArchive(::testing::_, ::testing::_)).Times(1);
 
         QObject parent{};
@@ -231,4 +233,185 @@ namespace UnitTest
         EXPECT_EQ(mode, AssetServerMode::Client);
         EXPECT_TRUE(assetServerHandler.RetrieveJobResult(builderParams));
     }
+
+    class ContentAddressedJobCacheTest
+        : public LeakDetectionFixture
+    {
+    public:
+        QString CacheFolder() const
+        {
+            return QDir(m_tempDir.GetDirectory()).filePath("cache");
+        }
+
+        QString JobFolder(const char* name) const
+        {
+            return QDir(m_tempDir.GetDirectory()).filePath(name);
+        }
+
+        static QByteArray ReadFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+        }
+
+        static bool WriteFile(const QString& filePath, const QByteArray& contents)
+        {
+            QFile file(filePath);
+            return file.open(QIODevice::WriteOnly | QIODevice::Truncate) && file.write(contents) == contents.size();
+        }
+
+        //! Returns the paths of all the files under a folder of the cache.
+        QStringList CacheFiles(const char* folderName) const
+        {
+            QStringList filePaths;
+            QDirIterator fileIter(QDir(CacheFolder()).filePath(folderName), QDir::Files, QDirIterator::Subdirectories);
+            while (fileIter.hasNext())
+            {
+                filePaths.append(fileIter.next());
+            }
+            return filePaths;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDir;
+    };
+
+    TEST_F(ContentAddressedJobCacheTest, StoreJob_RetrieveJob_RestoresAllFiles)
+    {
+        QDir jobDir(JobFolder("job"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("product.txt"), "product"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("subfolder/other.txt"), "other product"));
+
+        AssetProcessor::ContentAddressedJobCache cache(CacheFolder());
+        EXPECT_FALSE(cache.HasJob("job key"));
+        EXPECT_TRUE(cache.StoreJob("job key", jobDir.absolutePath()));
+        EXPECT_TRUE(cache.HasJob("job key"));
+
+        QDir retrievedDir(JobFolder("retrieved"));
+        EXPECT_TRUE(cache.RetrieveJob("job key", retrievedDir.absolutePath()));
+        EXPECT_EQ(ReadFile(retrievedDir.filePath("product.txt")), "product");
+        EXPECT_EQ(ReadFile(retrievedDir.filePath("subfolder/other.txt")), "other product");
+    }
+
+    TEST_F(ContentAddressedJobCacheTest, StoreJob_SourceFiles_RetrievedRelativeToJobFolder)
+    {
+        QDir jobDir(JobFolder("job"));
+        QDir sourceDir(JobFolder("source"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("product.txt"), "product"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(sourceDir.filePath("copied.txt"), "copied"));
+
+        AssetProcessor::ContentAddressedJobCache cache(CacheFolder());
+        EXPECT_TRUE(cache.StoreJob("job key", jobDir.absolutePath(), sourceDir.absolutePath(), { "copied.txt" }));
+
+        QDir retrievedDir(JobFolder("retrieved"));
+        EXPECT_TRUE(cache.RetrieveJob("job key", retrievedDir.absolutePath()));
+        EXPECT_EQ(ReadFile(retrievedDir.filePath("product.txt")), "product");
+        EXPECT_EQ(ReadFile(retrievedDir.filePath("copied.txt")), "copied");
+    }
+
+    TEST_F(ContentAddressedJobCacheTest, StoreJob_IdenticalFiles_StoredOnce)
+    {
+        QDir firstJobDir(JobFolder("job1"));
+        QDir secondJobDir(JobFolder("job2"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(firstJobDir.filePath("product.txt"), "shared"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(secondJobDir.filePath("renamed_product.txt"), "shared"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(secondJobDir.filePath("unique_product.txt"), "unique"));
+
+        AssetProcessor::ContentAddressedJobCache cache(CacheFolder());
+        EXPECT_TRUE(cache.StoreJob("first job", firstJobDir.absolutePath()));
+        EXPECT_TRUE(cache.StoreJob("second job", secondJobDir.absolutePath()));
+
+        int blobCount = 0;
+        QDirIterator blobIter(QDir(CacheFolder()).filePath("blobs"), QDir::Files, QDirIterator::Subdirectories);
+        while (blobIter.hasNext())
+        {
+            blobIter.next();
+            ++blobCount;
+        }
+        EXPECT_EQ(blobCount, 2);
+
+        QDir retrievedDir(JobFolder("retrieved"));
+        EXPECT_TRUE(cache.RetrieveJob("second job", retrievedDir.absolutePath()));
+        EXPECT_EQ(ReadFile(retrievedDir.filePath("renamed_product.txt")), "shared");
+        EXPECT_EQ(ReadFile(retrievedDir.filePath("unique_product.txt")), "unique");
+    }
+
+    TEST_F(ContentAddressedJobCacheTest, RetrieveJob_UnknownJob_Fails)
+    {
+        QDir jobDir(JobFolder("job"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("product.txt"), "product"));
+
+        AssetProcessor::ContentAddressedJobCache cache(CacheFolder());
+        EXPECT_TRUE(cache.StoreJob("job key", jobDir.absolutePath()));
+        EXPECT_FALSE(cache.RetrieveJob("other job key", JobFolder("retrieved")));
+    }
+
+    TEST_F(ContentAddressedJobCacheTest, RetrieveJob_IndexEntryOutsideJobFolder_FailsWithoutWritingIt)
+    {
+        QDir jobDir(JobFolder("job"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("product.txt"), "product"));
+
+        AssetProcessor::ContentAddressedJobCache cache(CacheFolder());
+        EXPECT_TRUE(cache.StoreJob("job key", jobDir.absolutePath()));
+
+        const QStringList indexFiles = CacheFiles("index");
+        ASSERT_EQ(indexFiles.size(), 1);
+        const QByteArray indexContents = ReadFile(indexFiles[0]);
+        ASSERT_TRUE(indexContents.contains("\"product.txt\""));
+
+        QDir retrievedDir(JobFolder("retrieved"));
+        const QString absolutePath = QDir(m_tempDir.GetDirectory()).filePath("absolute.txt");
+        for (const QString& escapingPath : { QString("../escaped.txt"), QString("subfolder/../../escaped.txt"), absolutePath })
+        {
+            QByteArray tamperedContents = indexContents;
+            tamperedContents.replace("\"product.txt\"", QString("\"%1\"").arg(escapingPath).toUtf8());
+            ASSERT_TRUE(WriteFile(indexFiles[0], tamperedContents));
+
+            EXPECT_FALSE(cache.RetrieveJob("job key", retrievedDir.absolutePath())) << escapingPath.toUtf8().constData();
+        }
+
+        EXPECT_FALSE(QFile::exists(QDir(m_tempDir.GetDirectory()).filePath("escaped.txt")));
+        EXPECT_FALSE(QFile::exists(absolutePath));
+    }
+
+    TEST_F(ContentAddressedJobCacheTest, RetrieveJob_MissingBlob_FailsWithoutWritingAnyFile)
+    {
+        QDir jobDir(JobFolder("job"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("product.txt"), "product"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("subfolder/other.txt"), "other product"));
+
+        AssetProcessor::ContentAddressedJobCache cache(CacheFolder());
+        EXPECT_TRUE(cache.StoreJob("job key", jobDir.absolutePath()));
+
+        for (const QString& blobFilePath : CacheFiles("blobs"))
+        {
+            if (ReadFile(blobFilePath) == "other product")
+            {
+                ASSERT_TRUE(QFile::remove(blobFilePath));
+            }
+        }
+
+        QDir retrievedDir(JobFolder("retrieved"));
+        EXPECT_FALSE(cache.RetrieveJob("job key", retrievedDir.absolutePath()));
+        EXPECT_FALSE(QFile::exists(retrievedDir.filePath("product.txt")));
+        EXPECT_FALSE(QFile::exists(retrievedDir.filePath("subfolder/other.txt")));
+    }
+
+    TEST_F(ContentAddressedJobCacheTest, RetrieveJob_FileCannotBeWritten_RemovesFilesAlreadyRetrieved)
+    {
+        QDir jobDir(JobFolder("job"));
+        QDir sourceDir(JobFolder("source"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.filePath("product.txt"), "product"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(sourceDir.filePath("copied.txt"), "copied"));
+
+        AssetProcessor::ContentAddressedJobCache cache(CacheFolder());
+        EXPECT_TRUE(cache.StoreJob("job key", jobDir.absolutePath(), sourceDir.absolutePath(), { "copied.txt" }));
+
+        // source files are retrieved after the job's own files, so a folder in the way of the source file
+        // makes retrieval fail after product.txt was already written.
+        QDir retrievedDir(JobFolder("retrieved"));
+        ASSERT_TRUE(retrievedDir.mkpath("copied.txt"));
+
+        EXPECT_FALSE(cache.RetrieveJob("job key", retrievedDir.absolutePath()));
+        EXPECT_FALSE(QFile::exists(retrievedDir.filePath("product.txt")));
+    }
 }
@@ -40,6 +40,11 @@ namespace FileWatcherTests
     // and may wear SSD
     const unsigned long c_FilesInFloodTest = 1000;
 
+    // the stress test spreads this many files over c_FoldersInStressTest folders, which is enough to overflow the
+    // inotify queue on a default configured system, so it also exercises the overflow recovery.
+    const unsigned long c_FilesInStressTest = 100000;
+    const unsigned long c_FoldersInStressTest = 100;
+
     class FileWatcherUnitTest : public ::testing::Test
     {
     public:
@@ -620,6 +625,65 @@ namespace FileWatcherTests
         EXPECT_TRUE(m_filesAdded.contains(QDir::toNativeSeparators(tempDirPath.absoluteFilePath("dir4"))));
     }
 
+    TEST_F(FileWatcherUnitTest, WatchFolderRelocation_RenamedFolder_StillWatched)
+    {
+        QDir tempDirPath(m_assetRootPath);
+        tempDirPath.mkpath("dir1");
+        WatchUntilNoMoreEvents(1, 0, 0);
+        Flush();
+        tempDirPath.mkpath("dir1/subdir");
+        WatchUntilNoMoreEvents(1, 0, 0);
+
+        Flush();
+        QDir renamer;
+        EXPECT_TRUE(renamer.rename(tempDirPath.absoluteFilePath("dir1"), tempDirPath.absoluteFilePath("dir2")));
+        WatchUntilNoMoreEvents(1, 0, 1);
+
+        // the watches of the renamed folder and its children must follow it to its new location.
+        Flush();
+        QString fileInRenamedFolder = QDir::toNativeSeparators(tempDirPath.absoluteFilePath("dir2/test.tif"));
+        QString fileInRenamedSubfolder = QDir::toNativeSeparators(tempDirPath.absoluteFilePath("dir2/subdir/test.tif"));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(fileInRenamedFolder));
+        EXPECT_TRUE(UnitTestUtils::CreateDummyFile(fileInRenamedSubfolder));
+        WatchUntilNoMoreEvents(2, 0, 0);
+        EXPECT_TRUE(m_filesAdded.contains(fileInRenamedFolder));
+        EXPECT_TRUE(m_filesAdded.contains(fileInRenamedSubfolder));
+    }
+
+    TEST_F(FileWatcherUnitTest, WatchFileCreation_StressTest_AllFilesFound_SUITE_periodic)
+    {
+        QDir tempDirPath(m_assetRootPath);
+        QSet<QString> expectedFiles;
+        for (unsigned long folderIndex = 0; folderIndex < c_FoldersInStressTest; ++folderIndex)
+        {
+            QString folderName = QString("folder_%1").arg(folderIndex);
+            tempDirPath.mkpath(folderName);
+            expectedFiles.insert(QDir::toNativeSeparators(tempDirPath.absoluteFilePath(folderName)));
+            for (unsigned long fileIndex = 0; fileIndex < c_FilesInStressTest / c_FoldersInStressTest; ++fileIndex)
+            {
+                QString filename = QDir::toNativeSeparators(tempDirPath.absoluteFilePath(QString("%1/file_%2.txt").arg(folderName).arg(fileIndex)));
+                EXPECT_TRUE(UnitTestUtils::CreateDummyFile(filename));
+                expectedFiles.insert(filename);
+            }
+        }
+
+        m_fenceFileFound = false;
+        CreateFenceFile();
+        QElapsedTimer timer;
+        timer.start();
+        while ((timer.elapsed() < c_MaxWaitForFileChangesMS) && (!m_fenceFileFound))
+        {
+            QCoreApplication::processEvents(QEventLoop::AllEvents);
+        }
+        ASSERT_TRUE(m_fenceFileFound);
+
+        // recovering from a queue overflow rescans the affected folders, which may report some files more than once,
+        // so only make sure that nothing was missed.
+        QSet<QString> foundFiles(m_filesAdded.begin(), m_filesAdded.end());
+        EXPECT_TRUE(foundFiles.contains(expectedFiles));
+        EXPECT_TRUE(m_filesRemoved.isEmpty());
+    }
+
     TEST_F(FileWatcherUnitTest, WatchFolder_ValidFoldersWatched)
     {
         // reset watched folders
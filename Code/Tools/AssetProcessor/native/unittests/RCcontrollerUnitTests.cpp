@@ -850,3 +850,139 @@ TEST_F(RCcontrollerUnitTests, TestRCController_FeedJobsWithCyclicDependencies_Al
         EXPECT_EQ(m_rcJobListModel->itemCount(), prevJobCount);
     }
 }
+
+TEST_F(RCcontrollerUnitTests, TestRCQueueSortModel_JobsWithSamePriority_LongestEstimatedJobFirst)
+{
+    Reset();
+    m_rcController->SetDispatchPaused(true);
+
+    auto addJob = [this](const char* sourceFile, AZ::s64 estimatedDurationMs)
+    {
+        JobDetails jobDetails;
+        jobDetails.m_scanFolder = &TestScanFolderInfo;
+        jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), sourceFile);
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = "Text files";
+        jobDetails.m_jobEntry.m_builderGuid = BuilderUuid;
+
+        MockRCJob* job = new MockRCJob(m_rcJobListModel);
+        job->Init(jobDetails);
+        job->SetEstimatedDuration(estimatedDurationMs);
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        m_rcJobListModel->addNewJob(job);
+        return job;
+    };
+
+    // without any estimate, jobs are ordered by path, so the longer job is added with the later path
+    addJob("fileA.txt", 10);
+    RCJob* longJob = addJob("fileB.txt", 5000);
+    addJob("fileC.txt", 0);
+
+    EXPECT_EQ(m_rcQueueSortModel->GetNextPendingJob(), longJob);
+}
+
+TEST_F(RCcontrollerUnitTests, TestRCController_NotEnoughMemoryForMoreJobs_DispatchStopsAtMinJobs)
+{
+    Reset();
+    m_assetBuilderDesc.m_name = "Memory Per Job UnitTest";
+    m_assetBuilderDesc.m_busId = BuilderUuid;
+    m_assetBuilderDesc.m_processJobFunction = []
+    ([[maybe_unused]] const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+    {
+        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+    };
+
+    constexpr AZ::u64 MemoryPerJob = 1024 * 1024 * 1024;
+    AZ::u64 availableMemory = MemoryPerJob / 2;
+    m_rcController->SetMemoryPerJob(MemoryPerJob);
+    m_rcController->SetAvailableMemoryQuery([&availableMemory]()
+    {
+        return availableMemory;
+    });
+    m_rcController->SetDispatchPaused(true);
+
+    for (const char* sourceFile : { "fileA.txt", "fileB.txt", "fileC.txt" })
+    {
+        JobDetails jobDetails;
+        jobDetails.m_scanFolder = &TestScanFolderInfo;
+        jobDetails.m_assetBuilderDesc = m_assetBuilderDesc;
+        jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), sourceFile);
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = "Text files";
+        jobDetails.m_jobEntry.m_builderGuid = BuilderUuid;
+
+        MockRCJob* job = new MockRCJob(m_rcJobListModel);
+        job->Init(jobDetails);
+        m_rcQueueSortModel->AddJobIdEntry(job);
+        m_rcJobListModel->addNewJob(job);
+    }
+
+    JobEntry completedJob;
+    bool allJobsCompleted = false;
+    ConnectJobSignalsAndSlots(allJobsCompleted, completedJob);
+
+    // MaxRCJobs would allow all three to run at once, but there isn't memory for more than the MinRCJobs that always run.
+    m_rcController->m_dispatchingPaused = false;
+    m_rcController->DispatchJobsImpl();
+    EXPECT_EQ(m_rcJobListModel->jobsInFlight(), MinRCJobs);
+
+    // the rest are started as the running ones finish.
+    availableMemory = MemoryPerJob * MaxRCJobs;
+    EXPECT_TRUE(UnitTestUtils::BlockUntil(allJobsCompleted, MaxProcessingWaitTimeMs));
+}
+
+TEST_F(RCcontrollerUnitTests, TestRCController_RecordJobTime_AccumulatesCriticalPathThroughOrderDependencies)
+{
+    Reset();
+
+    auto addJob = [this](const char* sourceFile, const char* jobKey, AZStd::vector<JobDependencyInternal> jobDependencies)
+    {
+        JobDetails jobDetails;
+        jobDetails.m_scanFolder = &TestScanFolderInfo;
+        jobDetails.m_jobEntry.m_sourceAssetReference = AssetProcessor::SourceAssetReference(TestScanFolderInfo.ScanPath(), sourceFile);
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = jobKey;
+        jobDetails.m_jobEntry.m_builderGuid = BuilderUuid;
+        jobDetails.m_jobDependencyList = AZStd::move(jobDependencies);
+
+        MockRCJob* job = new MockRCJob(m_rcJobListModel);
+        job->Init(jobDetails);
+        job->SetState(RCJob::completed);
+        m_rcJobListModel->addNewJob(job);
+        return job;
+    };
+
+    auto dependencyOn = [](const char* sourceFile, const char* jobKey, AssetBuilderSDK::JobDependencyType type)
+    {
+        AssetBuilderSDK::SourceFileDependency sourceFileDependency;
+        sourceFileDependency.m_sourceFileDependencyPath = (AZ::IO::Path(TestScanFolderInfo.ScanPath().toUtf8().constData()) / sourceFile).Native();
+        return JobDependencyInternal(AssetBuilderSDK::JobDependency(jobKey, "pc", type, sourceFileDependency));
+    };
+
+    // B waits for A, so the path through both is longer than the longest job, C.
+    // D only takes its fingerprint from C, so it doesn't have to wait for C.
+    RCJob* jobA = addJob("fileA.txt", "TestJobA", {});
+    RCJob* jobB = addJob("fileB.txt", "TestJobB", { dependencyOn("fileA.txt", "TestJobA", AssetBuilderSDK::JobDependencyType::Order) });
+    RCJob* jobC = addJob("fileC.txt", "TestJobC", {});
+    RCJob* jobD = addJob("fileD.txt", "TestJobD", { dependencyOn("fileC.txt", "TestJobC", AssetBuilderSDK::JobDependencyType::Fingerprint) });
+
+    m_rcController->RecordJobTime(jobA, 1000);
+    m_rcController->RecordJobTime(jobB, 500);
+    m_rcController->RecordJobTime(jobC, 1200);
+    m_rcController->RecordJobTime(jobD, 100);
+
+    const auto& buildTimes = m_rcController->m_buildTimes;
+    EXPECT_EQ(buildTimes.m_criticalPathMs.at(jobA->GetElementID()), 1000);
+    EXPECT_EQ(buildTimes.m_criticalPathMs.at(jobB->GetElementID()), 1500);
+    EXPECT_EQ(buildTimes.m_criticalPathMs.at(jobC->GetElementID()), 1200);
+    EXPECT_EQ(buildTimes.m_criticalPathMs.at(jobD->GetElementID()), 100);
+    EXPECT_EQ(buildTimes.m_longestCriticalPathMs, 1500);
+    EXPECT_EQ(buildTimes.m_criticalPathEnd, jobB->GetElementID());
+    EXPECT_EQ(buildTimes.m_longestJobMs, 1200);
+    EXPECT_EQ(buildTimes.m_longestJob, jobC->GetElementID());
+    EXPECT_EQ(buildTimes.m_jobCount, 4);
+    EXPECT_EQ(buildTimes.m_totalJobMs, 2800);
+
+    // completed jobs also go into the job cost history.
+    EXPECT_EQ(m_rcController->m_jobCostHistory.EstimateDuration(jobB->GetJobEntry()), 500);
+}
@@ -304,7 +304,7 @@ void ApplicationManagerBase::HandleCommandLineHelp(AZStd::vector<ApplicationMana
 void ApplicationManagerBase::Rescan()
 {
     m_assetProcessorManager->SetEnableModtimeSkippingFeature(false);
-    GetAssetScanner()->StartScan();
+    GetAssetScanner()->StartScan(false);
 }
 
 void ApplicationManagerBase::FastScan()
@@ -371,6 +371,8 @@ void ApplicationManagerBase::ConnectAssetCatalog()
 void ApplicationManagerBase::InitRCController()
 {
     m_rcController = new AssetProcessor::RCController(m_platformConfiguration->GetMinJobs(), m_platformConfiguration->GetMaxJobs());
+    m_rcController->SetMemoryPerJob(aznumeric_cast<AZ::u64>(AZStd::max(m_platformConfiguration->GetMemoryPerJobMB(), 0)) * 1024 * 1024);
+    m_rcController->LoadJobCostHistory();
 
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetToProcess, m_rcController, &AssetProcessor::RCController::JobSubmitted);
     QObject::connect(m_rcController, &AssetProcessor::RCController::FileCompiled, m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetProcessed, Qt::UniqueConnection);
@@ -541,9 +543,8 @@ void ApplicationManagerBase::InitFileMonitor(AZStd::unique_ptr<FileWatcherBase>
         connect(m_fileWatcher.get(), &FileWatcher::fileRemoved, m_fileProcessor.get(), &FileProcessor::AssessDeletedFile, Qt::QueuedConnection);
     }
 
-    connect(m_fileWatcher.get(), &FileWatcher::fileAdded, m_assetProcessorManager, &AssetProcessorManager::AssessAddedFile, Qt::QueuedConnection);
-    connect(m_fileWatcher.get(), &FileWatcher::fileModified, m_assetProcessorManager, &AssetProcessorManager::AssessModifiedFile, Qt::QueuedConnection);
-    connect(m_fileWatcher.get(), &FileWatcher::fileRemoved, m_assetProcessorManager, &AssetProcessorManager::AssessDeletedFile, Qt::QueuedConnection);
+    // the asset processor manager receives whole batches of changes, rather than one queued call per file.
+    connect(m_fileWatcher.get(), &FileWatcher::filesChanged, m_assetProcessorManager, &AssetProcessorManager::AssessFileChanges, Qt::QueuedConnection);
 }
 
 void ApplicationManagerBase::DestroyFileMonitor()
@@ -854,7 +855,29 @@ void ApplicationManagerBase::InitFileStateCache()
         return;
     }
 
-    m_fileStateCache = AZStd::make_unique<AssetProcessor::FileStateCache>();
+    auto fileStateCache = AZStd::make_unique<AssetProcessor::FileStateCache>();
+
+    bool cacheFileHashes = true;
+    if (auto* settingsRegistry = AZ::SettingsRegistry::Get())
+    {
+        settingsRegistry->Get(cacheFileHashes, "/Amazon/AssetProcessor/Settings/FileStateCache/CacheFileHashes");
+    }
+
+    if (cacheFileHashes && fileStateCache->LoadFileHashCache())
+    {
+        // the hashes are saved whenever processing settles, once the initial scan is done and all the scanned files are known
+        QObject::connect(
+            m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetProcessorManagerIdleState, this,
+            [fileStateCache = fileStateCache.get()](bool isIdle)
+            {
+                if (isIdle)
+                {
+                    fileStateCache->SaveFileHashCache(true);
+                }
+            });
+    }
+
+    m_fileStateCache = AZStd::move(fileStateCache);
 }
 
 void ApplicationManagerBase::InitUuidManager()
@@ -1646,6 +1669,12 @@ bool ApplicationManagerBase::PostActivate()
 
     Q_EMIT OnBuildersRegistered();
 
+    const int prestartBuilders = AZStd::min(m_platformConfiguration->GetPrestartBuilders(), aznumeric_cast<int>(m_rcController->GetMaxJobs()));
+    if (prestartBuilders > 0)
+    {
+        m_builderManager->PrestartBuilders(prestartBuilders);
+    }
+
     // 25 milliseconds is above the 'while loop' thing that QT does on windows (where small time ticks will spin loop instead of sleep)
     m_ticker = new AzToolsFramework::Ticker(nullptr, 25.0f);
     m_ticker->Start();
@@ -7,6 +7,7 @@
  */
 
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/ContentAddressedJobCache.h>
 #include <native/resourcecompiler/rcjob.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
@@ -85,6 +86,20 @@ namespace AssetProcessor
         return {};
     }
 
+    bool CheckContentAddressed()
+    {
+        bool contentAddressed = false;
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry)
+        {
+            settingsRegistry->Get(contentAddressed,
+                AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorServerKey)
+                + "/"
+                + CacheServerContentAddressedKey);
+        }
+        return contentAddressed;
+    }
+
     QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
     {
         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
@@ -117,6 +132,24 @@ namespace AssetProcessor
         return QString();
     }
 
+    AZStd::string AssetServerHandler::ComputeContentAddressedJobKey(const AssetProcessor::BuilderParams& builderParams) const
+    {
+        // the fingerprint of the job covers the source file, its dependencies and the builder version already.
+        // The builder is named as well, so that the jobs of two builders never share an entry.
+        return AZStd::string::format("%s|%s|%s|%s|%i|%u",
+            builderParams.m_processJobRequest.m_sourceFile.c_str(),
+            builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(),
+            builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str(),
+            builderParams.m_assetBuilderDesc.m_busId.ToString<AZStd::string>().c_str(),
+            builderParams.m_assetBuilderDesc.m_version,
+            builderParams.m_rcJob->GetOriginalFingerprint());
+    }
+
+    QString AssetServerHandler::GetContentAddressedCacheFolder() const
+    {
+        return QDir(QString::fromUtf8(m_serverAddress.c_str())).filePath("ContentAddressedCache");
+    }
+
     const char* AssetServerHandler::GetAssetServerModeText(AssetServerMode mode)
     {
         switch (mode)
@@ -134,6 +167,7 @@ namespace AssetProcessor
     {
         SetRemoteCachingMode(CheckServerMode());
         SetServerAddress(CheckServerAddress());
+        m_contentAddressed = CheckContentAddressed();
         AssetServerBus::Handler::BusConnect();
     }
 
@@ -255,6 +289,26 @@ namespace AssetProcessor
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
 
+        if (m_contentAddressed)
+        {
+            if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+            {
+                return false;
+            }
+
+            // this runs on the job's own thread before any builder is involved, so all the jobs being processed fetch in parallel.
+            ContentAddressedJobCache cache(GetContentAddressedCacheFolder());
+            if (!cache.RetrieveJob(ComputeContentAddressedJobKey(builderParams), builderParams.GetTempJobDirectory().c_str()))
+            {
+                AZ_TracePrintf(AssetProcessor::DebugChannel, "Job is not in the content addressed cache. \n");
+                return false;
+            }
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieved job (%s, %s, %s) with fingerprint (%u) from the content addressed cache.\n",
+                builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+            return true;
+        }
+
         QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
         if (archiveAbsFilePath.isEmpty())
         {
@@ -291,6 +345,22 @@ namespace AssetProcessor
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
         AssetUtilities::QuitListener listener;
         listener.BusConnect();
+
+        if (m_contentAddressed)
+        {
+            if (listener.WasQuitRequested() || jobCancelListener.IsCancelled())
+            {
+                return false;
+            }
+
+            // products copied straight from the source folder are stored relative to it, the same as in an archive.
+            QString sourceFolder = QFileInfo(builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath()).absolutePath();
+            ContentAddressedJobCache cache(GetContentAddressedCacheFolder());
+            bool success = cache.StoreJob(ComputeContentAddressedJobKey(builderParams), builderParams.GetTempJobDirectory().c_str(), sourceFolder, sourceFileList);
+            AZ_Error(AssetProcessor::DebugChannel, success, "Storing job in the content addressed cache failed. \n");
+            return success;
+        }
+
         QString archiveAbsFilePath = ComputeArchiveFilePath(builderParams);
 
         if (archiveAbsFilePath.isEmpty())
@@ -15,6 +15,7 @@ namespace AssetProcessor
 {
     inline constexpr const char* AssetCacheServerModeKey{ "assetCacheServerMode" };
     inline constexpr const char* CacheServerAddressKey{ "cacheServerAddress" };
+    inline constexpr const char* CacheServerContentAddressedKey{ "cacheServerContentAddressed" };
 
     //! AssetServerHandler is implementing asset server using network share.
     class AssetServerHandler
@@ -30,9 +31,10 @@ namespace AssetProcessor
         // AssetServerBus::Handler overrides
         bool IsServerAddressValid() override;
         //! StoreJobResult will store all the files in the the temp folder provided by AP to a zip file on the network drive 
-        //! whose file name will be based on the server key
+        //! whose file name will be based on the server key, or to the content addressed cache if it is enabled
         bool StoreJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList)  override;
         //! RetrieveJobResult will retrieve the zip file from the network share associated with the server key and unzip it to the temporary directory provided by AP.
+        //! If the content addressed cache is enabled, the files of the job are copied from it instead.
         bool RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams) override;
         //! HandleRemoteConfiguration will attempt to set or get the remote configuration for the cache server
         void HandleRemoteConfiguration();
@@ -49,9 +51,14 @@ namespace AssetProcessor
         //! to be added to the Archive in an additional step
         bool AddSourceFilesToArchive(const AssetProcessor::BuilderParams& builderParams, const QString& archivePath, AZStd::vector<AZStd::string>& sourceFileList);
         QString ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams);
+        //! The key of a job in the content addressed cache, made of the builder version and the fingerprint of the job's inputs
+        AZStd::string ComputeContentAddressedJobKey(const AssetProcessor::BuilderParams& builderParams) const;
+        QString GetContentAddressedCacheFolder() const;
         
     private:
         AssetServerMode m_assetCachingMode = AssetServerMode::Inactive;
         AZStd::string m_serverAddress;
+        //! Store job results in a content addressed cache (deduplicated files plus an index of jobs) instead of one archive per job
+        bool m_contentAddressed = false;
     };
 } //namespace AssetProcessor
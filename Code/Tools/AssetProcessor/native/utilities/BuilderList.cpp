@@ -162,4 +162,9 @@ namespace AssetProcessor
             }
         }
     }
+
+    size_t BuilderList::GetBuilderCount() const
+    {
+        return m_builders.size();
+    }
 }
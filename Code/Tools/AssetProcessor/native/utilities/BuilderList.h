@@ -26,6 +26,9 @@ namespace AssetProcessor
         void RemoveByUuid(AZ::Uuid uuid);
         void PumpIdleBuilders();
 
+        //! Returns the number of builders in the pool, not counting the CreateJobs builder
+        size_t GetBuilderCount() const;
+
         AZ_DISABLE_COPY_MOVE(BuilderList);
 
     protected:
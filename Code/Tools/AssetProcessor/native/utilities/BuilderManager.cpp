@@ -53,6 +53,43 @@ namespace AssetProcessor
         {
             m_pollingThread.join();
         }
+
+        for (AZStd::thread& prestartThread : m_prestartThreads)
+        {
+            if (prestartThread.joinable())
+            {
+                prestartThread.join();
+            }
+        }
+    }
+
+    void BuilderManager::PrestartBuilders(int count)
+    {
+        int buildersToStart = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_buildersMutex);
+            buildersToStart = count - aznumeric_cast<int>(m_builderList.GetBuilderCount());
+        }
+
+        if (buildersToStart > 0)
+        {
+            AZ_TracePrintf("BuilderManager", "Starting %d builders ahead of time\n", buildersToStart);
+        }
+
+        // builders start in parallel, since each one spends most of its start up loading gems.
+        for (int builderIndex = 0; builderIndex < buildersToStart; ++builderIndex)
+        {
+            AZStd::thread_desc desc;
+            desc.m_name = "BuilderManager Prestart";
+            m_prestartThreads.emplace_back(desc, [this]()
+                {
+                    if (!m_quitListener.WasQuitRequested())
+                    {
+                        // the reference is released as soon as the builder has started, which leaves it idle in the pool.
+                        StartNewBuilder(BuilderPurpose::ProcessJob);
+                    }
+                });
+        }
     }
 
     void BuilderManager::ConnectionLost(AZ::u32 connId)
@@ -155,12 +192,10 @@ namespace AssetProcessor
 
     BuilderRef BuilderManager::GetBuilder(BuilderPurpose purpose)
     {
-        AZStd::shared_ptr<Builder> newBuilder;
-        BuilderRef builderRef;
         if (m_quitListener.WasQuitRequested())
         {
             // don't hand out new builders if we're quitting.
-            return builderRef;
+            return {};
         }
 
         // the below scope is intentional, to contain the scoped lock.
@@ -176,10 +211,23 @@ namespace AssetProcessor
                     return builder;
                 }
             }
+        }
+
+        AZ_TracePrintf("BuilderManager", "Starting new builder for job request\n");
+
+        // None found, start up a new one
+        return StartNewBuilder(purpose);
+    }
+
+    BuilderRef BuilderManager::StartNewBuilder(BuilderPurpose purpose)
+    {
+        AZStd::shared_ptr<Builder> newBuilder;
+        BuilderRef builderRef;
 
-            AZ_TracePrintf("BuilderManager", "Starting new builder for job request\n");
+        // the below scope is intentional, to contain the scoped lock.
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_buildersMutex);
 
-            // None found, start up a new one
             newBuilder = AddNewBuilder(purpose);
 
             // Grab a reference so no one else can take it while we're outside the lock
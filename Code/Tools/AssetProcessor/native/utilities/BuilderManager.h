@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <native/utilities/assetUtils.h>
@@ -64,6 +65,10 @@ namespace AssetProcessor
 
         void ConnectionLost(AZ::u32 connId);
 
+        //! Starts ProcessJob builders in the background until there are count of them, so that jobs find a builder
+        //! that has already loaded its gems instead of waiting for a new one to start up.
+        void PrestartBuilders(int count);
+
         //BuilderManagerBus
         BuilderRef GetBuilder(BuilderPurpose purpose) override;
         void AddAssetToBuilderProcessedList(const AZ::Uuid& builderId, const AZStd::string& sourceAsset) override;
@@ -73,6 +78,9 @@ namespace AssetProcessor
         //! Makes a new builder, adds it to the pool, and returns a shared pointer to it
         virtual AZStd::shared_ptr<Builder> AddNewBuilder(BuilderPurpose purpose);
 
+        //! Makes a new builder and starts it up.  Returns an empty reference if it fails to start
+        BuilderRef StartNewBuilder(BuilderPurpose purpose);
+
         //! Handles incoming builder connections
         void IncomingBuilderPing(AZ::u32 connId, AZ::u32 type, AZ::u32 serial, QByteArray payload, QString platform);
 
@@ -95,6 +103,9 @@ namespace AssetProcessor
         //! Responsible for going through all the idle builders and pumping their communicators so they don't stall
         AZStd::thread m_pollingThread;
 
+        //! Threads starting the builders requested by PrestartBuilders
+        AZStd::vector<AZStd::thread> m_prestartThreads;
+
         AssetUtilities::QuitListener m_quitListener;
     };
 } // namespace AssetProcessor
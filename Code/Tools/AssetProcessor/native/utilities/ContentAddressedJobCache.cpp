@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/ContentAddressedJobCache.h>
+#include <native/assetprocessor.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        constexpr const char* BlobsFolderName = "blobs";
+        constexpr const char* IndexFolderName = "index";
+        constexpr const char* IndexKeyMember = "key";
+        constexpr const char* IndexFilesMember = "files";
+        constexpr const char* IndexPathMember = "path";
+        constexpr const char* IndexBlobMember = "blob";
+
+        // Returns a name next to filePath that no other writer will use, to write to before renaming it into place.
+        QString GetTemporaryFilePath(const QString& filePath)
+        {
+            return QString("%1.%2.tmp").arg(filePath, AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+        }
+
+        // Moves the temporary file into place.  If another writer already put the same file there, ours is discarded.
+        bool CommitTemporaryFile(const QString& temporaryFilePath, const QString& filePath)
+        {
+            if (QFile::rename(temporaryFilePath, filePath))
+            {
+                return true;
+            }
+            QFile::remove(temporaryFilePath);
+            return QFile::exists(filePath);
+        }
+    }
+
+    ContentAddressedJobCache::ContentAddressedJobCache(const QString& rootFolder)
+        : m_rootFolder(rootFolder)
+    {
+    }
+
+    QString ContentAddressedJobCache::GetIndexFilePath(const AZStd::string& jobKey) const
+    {
+        // job keys can be any string, so the index entry is named after a hash of it instead.
+        AZ::Sha1 sha;
+        sha.ProcessBytes(AZStd::as_bytes(AZStd::span(jobKey)));
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        QString indexName;
+        for (AZ::u32 part : digest)
+        {
+            indexName.append(QString("%1").arg(part, 8, 16, QChar('0')));
+        }
+        return QDir(m_rootFolder).filePath(QString("%1/%2/%3.json").arg(IndexFolderName, indexName.left(2), indexName));
+    }
+
+    QString ContentAddressedJobCache::GetBlobFilePath(const QString& blobName) const
+    {
+        // spread the blobs over subfolders, so that no single folder grows too large.
+        return QDir(m_rootFolder).filePath(QString("%1/%2/%3").arg(BlobsFolderName, blobName.left(2), blobName));
+    }
+
+    QString ContentAddressedJobCache::StoreBlob(const QString& filePath) const
+    {
+        QFileInfo fileInfo(filePath);
+        if (!fileInfo.isFile())
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Cannot store %s in the cache - the file does not exist.", filePath.toUtf8().constData());
+            return QString();
+        }
+
+        // the size is part of the name, so that two different files would have to collide on both to be confused.
+        const AZ::u64 hash = AssetBuilderSDK::GetFileHash(filePath.toUtf8().constData());
+        const QString blobName = QString("%1-%2").arg(hash, 16, 16, QChar('0')).arg(fileInfo.size());
+        const QString blobFilePath = GetBlobFilePath(blobName);
+        if (QFile::exists(blobFilePath))
+        {
+            return blobName;
+        }
+
+        if (!QDir().mkpath(QFileInfo(blobFilePath).absolutePath()))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not make cache folder for %s.", blobFilePath.toUtf8().constData());
+            return QString();
+        }
+
+        const QString temporaryFilePath = GetTemporaryFilePath(blobFilePath);
+        if (!QFile::copy(filePath, temporaryFilePath) || !CommitTemporaryFile(temporaryFilePath, blobFilePath))
+        {
+            QFile::remove(temporaryFilePath);
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not store %s in the cache as %s.", filePath.toUtf8().constData(), blobFilePath.toUtf8().constData());
+            return QString();
+        }
+        return blobName;
+    }
+
+    bool ContentAddressedJobCache::HasJob(const AZStd::string& jobKey) const
+    {
+        return QFile::exists(GetIndexFilePath(jobKey));
+    }
+
+    bool ContentAddressedJobCache::StoreJob(const AZStd::string& jobKey, const QString& jobFolder,
+        const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFiles)
+    {
+        const QString indexFilePath = GetIndexFilePath(jobKey);
+        if (QFile::exists(indexFilePath))
+        {
+            return true;
+        }
+
+        rapidjson::Document indexDocument(rapidjson::kObjectType);
+        auto& allocator = indexDocument.GetAllocator();
+        rapidjson::Value files(rapidjson::kArrayType);
+
+        auto addFile = [this, &files, &allocator](const QString& filePath, const QString& relativePath)
+        {
+            const QString blobName = StoreBlob(filePath);
+            if (blobName.isEmpty())
+            {
+                return false;
+            }
+            rapidjson::Value file(rapidjson::kObjectType);
+            file.AddMember(rapidjson::StringRef(IndexPathMember), rapidjson::Value(relativePath.toUtf8().constData(), allocator), allocator);
+            file.AddMember(rapidjson::StringRef(IndexBlobMember), rapidjson::Value(blobName.toUtf8().constData(), allocator), allocator);
+            files.PushBack(file, allocator);
+            return true;
+        };
+
+        // the blobs all go in before the index entry, so that nobody can find an entry whose blobs are still missing.
+        const QDir jobDir(jobFolder);
+        QDirIterator fileIter(jobFolder, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (fileIter.hasNext())
+        {
+            const QString filePath = fileIter.next();
+            if (!addFile(filePath, jobDir.relativeFilePath(filePath)))
+            {
+                return false;
+            }
+        }
+
+        const QDir sourceDir(sourceFolder);
+        for (const AZStd::string& sourceFile : sourceFiles)
+        {
+            const QString filePath = sourceDir.absoluteFilePath(sourceFile.c_str());
+            if (!addFile(filePath, sourceDir.relativeFilePath(filePath)))
+            {
+                return false;
+            }
+        }
+
+        indexDocument.AddMember(rapidjson::StringRef(IndexKeyMember), rapidjson::Value(jobKey.c_str(), allocator), allocator);
+        indexDocument.AddMember(rapidjson::StringRef(IndexFilesMember), files, allocator);
+
+        if (!QDir().mkpath(QFileInfo(indexFilePath).absolutePath()))
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not make cache folder for %s.", indexFilePath.toUtf8().constData());
+            return false;
+        }
+
+        const QString temporaryFilePath = GetTemporaryFilePath(indexFilePath);
+        auto writeResult = AZ::JsonSerializationUtils::WriteJsonFile(indexDocument, temporaryFilePath.toUtf8().constData());
+        if (!writeResult.IsSuccess() || !CommitTemporaryFile(temporaryFilePath, indexFilePath))
+        {
+            QFile::remove(temporaryFilePath);
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not write cache index entry %s.", indexFilePath.toUtf8().constData());
+            return false;
+        }
+        return true;
+    }
+
+    bool ContentAddressedJobCache::RetrieveJob(const AZStd::string& jobKey, const QString& jobFolder) const
+    {
+        const QString indexFilePath = GetIndexFilePath(jobKey);
+        if (!QFile::exists(indexFilePath))
+        {
+            return false;
+        }
+
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(indexFilePath.toUtf8().constData());
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Could not read cache index entry %s (%s).", indexFilePath.toUtf8().constData(), readResult.GetError().c_str());
+            return false;
+        }
+
+        const rapidjson::Document& indexDocument = readResult.GetValue();
+        if (!indexDocument.IsObject() || !indexDocument.HasMember(IndexKeyMember) || !indexDocument[IndexKeyMember].IsString()
+            || !indexDocument.HasMember(IndexFilesMember) || !indexDocument[IndexFilesMember].IsArray())
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Cache index entry %s is invalid.", indexFilePath.toUtf8().constData());
+            return false;
+        }
+
+        if (jobKey != indexDocument[IndexKeyMember].GetString())
+        {
+            // two job keys hashed to the same index entry
+            return false;
+        }
+
+        // check every entry before writing anything, so that a bad entry can't leave part of a job behind.
+        const QDir jobDir(jobFolder);
+        const QString jobFolderPrefix = QDir::cleanPath(jobDir.absolutePath()) + '/';
+        AZStd::vector<AZStd::pair<QString, QString>> blobAndTargetFilePaths;
+        for (const rapidjson::Value& file : indexDocument[IndexFilesMember].GetArray())
+        {
+            if (!file.IsObject() || !file.HasMember(IndexPathMember) || !file[IndexPathMember].IsString()
+                || !file.HasMember(IndexBlobMember) || !file[IndexBlobMember].IsString())
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Cache index entry %s is invalid.", indexFilePath.toUtf8().constData());
+                return false;
+            }
+
+            // the index is read from a shared folder, so it must not be able to name a file outside of the job folder.
+            const QString relativePath = QString::fromUtf8(file[IndexPathMember].GetString());
+            const QString targetFilePath = QDir::cleanPath(jobDir.absoluteFilePath(relativePath));
+            const QString blobName = QString::fromUtf8(file[IndexBlobMember].GetString());
+            if (relativePath.isEmpty() || QDir::isAbsolutePath(relativePath) || !targetFilePath.startsWith(jobFolderPrefix)
+                || blobName.isEmpty() || blobName.contains('/') || blobName.contains('\\') || blobName.contains(".."))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Cache index entry %s names a file outside of the job folder.", indexFilePath.toUtf8().constData());
+                return false;
+            }
+
+            const QString blobFilePath = GetBlobFilePath(blobName);
+            if (!QFile::exists(blobFilePath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Cache index entry %s refers to the missing blob %s.", indexFilePath.toUtf8().constData(), blobFilePath.toUtf8().constData());
+                return false;
+            }
+            blobAndTargetFilePaths.emplace_back(blobFilePath, targetFilePath);
+        }
+
+        QStringList retrievedFilePaths;
+        auto removeRetrievedFiles = [&retrievedFilePaths]()
+        {
+            for (const QString& retrievedFilePath : retrievedFilePaths)
+            {
+                QFile::remove(retrievedFilePath);
+            }
+        };
+
+        for (const auto& [blobFilePath, targetFilePath] : blobAndTargetFilePaths)
+        {
+            if (!QDir().mkpath(QFileInfo(targetFilePath).absolutePath()))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Could not make folder for %s.", targetFilePath.toUtf8().constData());
+                removeRetrievedFiles();
+                return false;
+            }
+
+            QFile::remove(targetFilePath);
+            if (!QFile::copy(blobFilePath, targetFilePath))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Could not retrieve %s from the cache blob %s.", targetFilePath.toUtf8().constData(), blobFilePath.toUtf8().constData());
+                removeRetrievedFiles();
+                return false;
+            }
+            retrievedFilePaths.append(targetFilePath);
+        }
+        return true;
+    }
+} // namespace AssetProcessor
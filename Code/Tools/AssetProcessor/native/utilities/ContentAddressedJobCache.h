@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! ContentAddressedJobCache stores the outputs of jobs in a shared folder, as a content addressed store.
+    //! Every file is stored once as a blob named after the hash of its contents, no matter how many jobs produced it,
+    //! and an index entry for each job key lists which blob goes to which relative path in the job's temp folder.
+    //! Blobs and index entries are written under a temporary name and renamed into place, so any number of
+    //! Asset Processors can read from and write to the same folder at once.
+    class ContentAddressedJobCache
+    {
+    public:
+        explicit ContentAddressedJobCache(const QString& rootFolder);
+
+        //! Returns true if there is an index entry for the job key.
+        bool HasJob(const AZStd::string& jobKey) const;
+
+        //! Stores all the files in jobFolder, plus the given files relative to sourceFolder, as the outputs of the job.
+        //! Files already in the cache are not copied again.  Returns true if the job is in the cache afterwards.
+        bool StoreJob(const AZStd::string& jobKey, const QString& jobFolder,
+            const QString& sourceFolder = {}, const AZStd::vector<AZStd::string>& sourceFiles = {});
+
+        //! Copies the outputs of the job into jobFolder, at the same relative paths they were stored from.
+        //! Returns false if the job is not in the cache, or if any of its files could not be retrieved, in which case none of them are
+        //! left in jobFolder.  Index entries naming a file outside of jobFolder are rejected.
+        bool RetrieveJob(const AZStd::string& jobKey, const QString& jobFolder) const;
+
+    protected:
+        QString GetIndexFilePath(const AZStd::string& jobKey) const;
+        QString GetBlobFilePath(const QString& blobName) const;
+
+        //! Copies the file into the blob store unless a blob with the same contents is already there.
+        //! Returns the name of the blob, or an empty string on failure.
+        QString StoreBlob(const QString& filePath) const;
+
+    private:
+        QString m_rootFolder;
+    };
+} // namespace AssetProcessor
@@ -1143,6 +1143,18 @@ namespace AssetProcessor
             m_maxJobs = aznumeric_cast<int>(jobCount);
         }
 
+        AZ::s64 memoryPerJobMB = m_memoryPerJobMB;
+        if (settingsRegistry->Get(memoryPerJobMB, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/Jobs/memoryPerJobMB"))
+        {
+            m_memoryPerJobMB = aznumeric_cast<int>(memoryPerJobMB);
+        }
+
+        AZ::s64 prestartBuilders = m_prestartBuilders;
+        if (settingsRegistry->Get(prestartBuilders, AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/Jobs/prestartBuilders"))
+        {
+            m_prestartBuilders = aznumeric_cast<int>(prestartBuilders);
+        }
+
         if (!skipScanFolders)
         {
             AZStd::unordered_map<AZStd::string, AZ::IO::Path> gemNameToPathMap;
@@ -1849,6 +1861,16 @@ namespace AssetProcessor
         return m_maxJobs;
     }
 
+    int PlatformConfiguration::GetMemoryPerJobMB() const
+    {
+        return m_memoryPerJobMB;
+    }
+
+    int PlatformConfiguration::GetPrestartBuilders() const
+    {
+        return m_prestartBuilders;
+    }
+
     void PlatformConfiguration::EnableCommonPlatform()
     {
         EnablePlatform(AssetBuilderSDK::PlatformInfo{ AssetBuilderSDK::CommonPlatformName, AZStd::unordered_set<AZStd::string>{ "common" } });
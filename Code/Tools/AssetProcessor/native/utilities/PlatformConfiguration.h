@@ -181,6 +181,10 @@ namespace AssetProcessor
         //! Gets the minumum jobs specified in the configuration file
         int GetMinJobs() const;
         int GetMaxJobs() const;
+        //! Gets the physical memory, in megabytes, that each job is expected to need.  0 means no limit.
+        int GetMemoryPerJobMB() const;
+        //! Gets the number of builder processes to start ahead of time, so that the first jobs don't wait for them.
+        int GetPrestartBuilders() const;
 
         void EnableCommonPlatform();
         void AddIntermediateScanFolder();
@@ -334,6 +338,8 @@ namespace AssetProcessor
 
         int m_minJobs = 1;
         int m_maxJobs = 3;
+        int m_memoryPerJobMB = 0;
+        int m_prestartBuilders = 0;
 
         // used only during file read, keeps the total running list of all the enabled platforms from all config files and command lines
         AZStd::vector<AZStd::string> m_tempEnabledPlatforms;
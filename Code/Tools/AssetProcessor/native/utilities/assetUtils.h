@@ -240,6 +240,16 @@ namespace AssetUtilities
     // hashMsDelay is not used in non-unit test builds.
     AZ::u64 GetFileHash(const char* filePath, bool force = false, AZ::IO::SizeType* bytesReadOut = nullptr, int hashMsDelay = 0);
 
+    //! Returns an identifier of the specified file on its volume, such as its inode, which changes when the file is replaced.
+    //! Returns 0 if the platform doesn't provide one or the file can't be queried.
+    //! Implemented per platform.
+    AZ::u64 GetFileIdentity(const char* filePath);
+
+    //! Returns the number of bytes of physical memory that new processes could use without the system swapping.
+    //! Returns 0 if the platform can't be queried.
+    //! Implemented per platform.
+    AZ::u64 GetAvailablePhysicalMemory();
+
     //! Adjusts a timestamp to fix timezone settings and account for any precision adjustment needed
     AZ::u64 AdjustTimestamp(QDateTime timestamp);
 
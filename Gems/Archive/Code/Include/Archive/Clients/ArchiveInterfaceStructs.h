@@ -74,6 +74,7 @@ namespace Archive
         //! + TOC File Path Index table
         //! + TOC File Path Blob table
         //! + TOC Block Offset table
+        //! + TOC Compression Dictionary
         AZ::u64 GetUncompressedTocSize() const;
 
         //! If on the Compression algorithm the TOC is using a compression algorithm
@@ -184,11 +185,15 @@ namespace Archive
             return compressionIdInitArray;
         }();
 
-        //! Padding bytes added to ArchiveHeader
-        //! to ensure byte offsets 76-79 contains bytes with a value '\0'
-        //! This allows equivalent ArchiveHeader to be memcmp
+        //! Uncompressed size of the Table of Contents compression dictionary
+        //! The dictionary is trained on the content of the archive and is supplied
+        //! to the compression algorithms that support dictionaries when compressing and
+        //! decompressing the archive file blocks.
+        //! It is stored after the block offset table and is 0 if the archive has no dictionary.
+        //! Archives written before the dictionary section was added stored padding bytes
+        //! with a value of '\0' at this offset, so they are read as having no dictionary
         //! offset = 76
-        const AZ::u32 m_padding{};
+        AZ::u32 m_tocCompressionDictionaryUncompressedSize{};
 
         //! Offset from the beginning of the file block section to the first
         //! deleted block.
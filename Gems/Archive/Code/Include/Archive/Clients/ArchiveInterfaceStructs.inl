@@ -70,6 +70,7 @@ namespace Archive
         , m_tocBlockOffsetTableUncompressedSize(other.m_tocBlockOffsetTableUncompressedSize)
         , m_compressionThreshold(other.m_compressionThreshold)
         , m_compressionAlgorithmsIds(other.m_compressionAlgorithmsIds)
+        , m_tocCompressionDictionaryUncompressedSize(other.m_tocCompressionDictionaryUncompressedSize)
         , m_firstDeletedBlockOffset(other.m_firstDeletedBlockOffset)
     {}
     inline ArchiveHeader& ArchiveHeader::operator=(const ArchiveHeader& other)
@@ -88,6 +89,7 @@ namespace Archive
         m_tocBlockOffsetTableUncompressedSize = other.m_tocBlockOffsetTableUncompressedSize;
         m_compressionThreshold = other.m_compressionThreshold;
         m_compressionAlgorithmsIds = other.m_compressionAlgorithmsIds;
+        m_tocCompressionDictionaryUncompressedSize = other.m_tocCompressionDictionaryUncompressedSize;
         m_firstDeletedBlockOffset = other.m_firstDeletedBlockOffset;
 
         return *this;
@@ -113,13 +115,15 @@ namespace Archive
         // to the next multiple of 8
         uncompressedSize = AZ_SIZE_ALIGN_UP(uncompressedSize, 8);
 
-        // As the block offset table is the last section of the
-        // table of contents, no alignment constraints need to be accounted for
-        // To close out the information loop however, each block offset table
-        // entry stores a 8-byte integer which encodes either 3 2-MiB compressed block sizes
+        // Each block offset table entry stores a 8-byte integer which encodes either 3 2-MiB compressed block sizes
         // or a 16-bit block jump offset entry and 2 2-MiB compressed block sizes(21-bits each)
+        // so the section after it remains 8-byte aligned
         uncompressedSize += m_tocBlockOffsetTableUncompressedSize;
 
+        // As the compression dictionary is the last section of the
+        // table of contents, no alignment constraints need to be accounted for
+        uncompressedSize += m_tocCompressionDictionaryUncompressedSize;
+
         return uncompressedSize;
     }
 
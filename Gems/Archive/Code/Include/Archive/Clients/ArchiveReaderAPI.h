@@ -79,8 +79,15 @@ namespace Archive
         AZ::u32 m_maxDecompressTasks{ AZStd::thread::hardware_concurrency() };
 
         //! Configures the maximum number of read task that can run in parallel
+        //! Each read task uses its own stream to the archive, so this is only honored
+        //! for archives mounted from a path. Archives mounted from a stream are read by one task at a time
         //! For a value of 0 maps to a single read task
-        AZ::u32 m_maxReadTasks{ 1 };
+        AZ::u32 m_maxReadTasks{ 4 };
+
+        //! Configures the number of 2 MiB blocks that are read and decompressed ahead
+        //! of a compressed file that is being read sequentially in multiple extract calls
+        //! If the value is 0, then read ahead is disabled
+        AZ::u32 m_readAheadBlockCount{ 2 };
     };
 
     //! Settings for controlling how an individual file is extracted from an archive.
@@ -12,6 +12,7 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <Archive/Clients/ArchiveBaseAPI.h>
 #include <Archive/Clients/ArchiveInterfaceStructs.h>
@@ -81,6 +82,20 @@ namespace Archive
         //! If the value is 0, then a single compression task that will be run
         //! at a given moment
         AZ::u32 m_maxCompressTasks{ AZStd::thread::hardware_concurrency() };
+
+        //! Compression level used to compress files which are added without custom compression options
+        //! Its range is specific to the compression algorithm of the file and
+        //! a value of 0 selects the default level of the compression algorithm
+        AZ::s32 m_compressionLevel{};
+
+        //! Compression dictionary which is stored in the Archive TOC and is used to compress files
+        //! which are added without custom compression options.
+        //! It is only used by compression algorithms that support dictionaries, such as Zstd,
+        //! and can be trained on samples of the archived content using `ICompressionInterface::TrainDictionary`
+        //!
+        //! If the mounted archive already contains a dictionary, the archive dictionary is kept instead,
+        //! as the content already in the archive may have been compressed with it
+        AZStd::vector<AZStd::byte> m_compressionDictionary;
     };
 
     enum class ArchiveWriterFileMode : bool
@@ -11,6 +11,8 @@
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/OpenMode.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/Task/TaskGraph.h>
 
@@ -217,6 +219,7 @@ namespace Archive
             | AZ::IO::OpenMode::ModeBinary;
 
         m_archiveStream.reset(aznew AZ::IO::SystemFileStream(mountPath.c_str(), openMode));
+        m_archivePath = mountPath;
 
         // Early return if the archive is not open
         if (!m_archiveStream->IsOpen())
@@ -236,6 +239,8 @@ namespace Archive
             UnmountArchive();
             return false;
         }
+
+        ResetReadStreams();
         return true;
     }
 
@@ -258,6 +263,8 @@ namespace Archive
             UnmountArchive();
             return false;
         }
+
+        ResetReadStreams();
         return true;
     }
 
@@ -277,6 +284,18 @@ namespace Archive
 
     void ArchiveReader::UnmountArchive()
     {
+        // Read ahead tasks read from the archive streams, so they must complete
+        // before the streams are closed
+        ClearReadAhead();
+        {
+            AZStd::scoped_lock archiveLock(m_archiveStreamMutex);
+            m_idleReadStreams.clear();
+            m_additionalReadStreams.clear();
+            m_readStreamCount = 0;
+            m_maxReadStreams = 0;
+        }
+        m_archivePath.clear();
+
         if (m_archiveStream != nullptr && m_archiveStream->IsOpen())
         {
             // Clear the path mount on unmount as it has pointers
@@ -296,6 +315,260 @@ namespace Archive
         return m_archiveStream != nullptr && m_archiveStream->IsOpen();
     }
 
+    void ArchiveReader::ResetReadStreams()
+    {
+        AZStd::scoped_lock archiveLock(m_archiveStreamMutex);
+        m_additionalReadStreams.clear();
+        m_idleReadStreams.clear();
+        m_idleReadStreams.push_back(m_archiveStream.get());
+        m_readStreamCount = 1;
+        // A stream supplied by the caller can't be duplicated, so all reads are done using it
+        m_maxReadStreams = m_archivePath.empty() ? 1 : AZStd::max(1U, m_settings.m_maxReadTasks);
+    }
+
+    AZ::IO::GenericStream* ArchiveReader::AcquireReadStream()
+    {
+        AZStd::unique_lock archiveLock(m_archiveStreamMutex);
+        while (m_idleReadStreams.empty())
+        {
+            if (m_readStreamCount < m_maxReadStreams)
+            {
+                // Reserve a slot in the pool before opening the stream outside of the lock,
+                // so that other threads don't open more streams than allowed
+                ++m_readStreamCount;
+                archiveLock.unlock();
+
+                constexpr AZ::IO::OpenMode openMode =
+                    AZ::IO::OpenMode::ModeRead
+                    | AZ::IO::OpenMode::ModeBinary;
+                ArchiveStreamPtr readStream(aznew AZ::IO::SystemFileStream(m_archivePath.c_str(), openMode));
+
+                archiveLock.lock();
+                if (readStream->IsOpen())
+                {
+                    AZ::IO::GenericStream* acquiredStream = readStream.get();
+                    m_additionalReadStreams.push_back(AZStd::move(readStream));
+                    return acquiredStream;
+                }
+
+                // The archive could not be opened again(for example if the process is out of file handles)
+                // so cap the pool at the streams that are already open and wait on them
+                --m_readStreamCount;
+                m_maxReadStreams = m_readStreamCount;
+                continue;
+            }
+
+            m_readStreamReleased.wait(archiveLock);
+        }
+
+        AZ::IO::GenericStream* acquiredStream = m_idleReadStreams.back();
+        m_idleReadStreams.pop_back();
+        return acquiredStream;
+    }
+
+    void ArchiveReader::ReleaseReadStream(AZ::IO::GenericStream* readStream)
+    {
+        {
+            AZStd::scoped_lock archiveLock(m_archiveStreamMutex);
+            m_idleReadStreams.push_back(readStream);
+        }
+        m_readStreamReleased.notify_one();
+    }
+
+    AZ::IO::SizeType ArchiveReader::ReadArchiveAtOffset(AZStd::span<AZStd::byte> readBuffer, AZ::u64 offset)
+    {
+        AZ::IO::GenericStream* readStream = AcquireReadStream();
+        AZ::IO::SizeType bytesRead = readStream->ReadAtOffset(readBuffer.size(), readBuffer.data(),
+            static_cast<AZ::IO::OffsetType>(offset));
+        ReleaseReadStream(readStream);
+        return bytesRead;
+    }
+
+    bool ArchiveReader::RecordSequentialRead(ArchiveFileToken filePathToken, AZ::u64 startOffset, AZ::u64 endOffset)
+    {
+        if (m_settings.m_readAheadBlockCount == 0)
+        {
+            return false;
+        }
+
+        // Bound the number of tracked files, so that reading every file of a large archive
+        // once doesn't grow the map without limit
+        constexpr size_t MaxTrackedFiles = 256;
+        AZStd::scoped_lock readAheadLock(m_readAheadMutex);
+        auto [readOffsetIt, inserted] = m_sequentialReadOffsets.try_emplace(AZStd::to_underlying(filePathToken), endOffset);
+        if (inserted)
+        {
+            if (m_sequentialReadOffsets.size() > MaxTrackedFiles)
+            {
+                m_sequentialReadOffsets.clear();
+                m_sequentialReadOffsets.emplace(AZStd::to_underlying(filePathToken), endOffset);
+            }
+            return false;
+        }
+
+        const bool isSequentialRead = readOffsetIt->second == startOffset;
+        readOffsetIt->second = endOffset;
+        return isSequentialRead;
+    }
+
+    bool ArchiveReader::CopyCachedBlock(AZStd::span<AZStd::byte> decompressionBlockSpan, ArchiveFileToken filePathToken,
+        AZ::u64 blockIndex)
+    {
+        AZStd::scoped_lock readAheadLock(m_readAheadMutex);
+        for (CachedBlock& cachedBlock : m_blockCache)
+        {
+            if (cachedBlock.m_filePathToken == filePathToken && cachedBlock.m_blockIndex == blockIndex
+                && cachedBlock.m_blockData.size() <= decompressionBlockSpan.size())
+            {
+                AZStd::copy(cachedBlock.m_blockData.begin(), cachedBlock.m_blockData.end(), decompressionBlockSpan.begin());
+                cachedBlock.m_lastUse = ++m_blockCacheUseCounter;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ArchiveReader::CacheBlock(ArchiveFileToken filePathToken, AZ::u64 blockIndex, AZStd::span<const AZStd::byte> blockData)
+    {
+        if (m_settings.m_readAheadBlockCount == 0)
+        {
+            return;
+        }
+
+        // Allow each concurrent reader to keep its read ahead blocks in the cache
+        const size_t maxCachedBlocks = static_cast<size_t>(m_settings.m_readAheadBlockCount)
+            * AZStd::max(1U, m_settings.m_maxReadTasks) + 1;
+
+        AZStd::scoped_lock readAheadLock(m_readAheadMutex);
+        CachedBlock* blockToReplace{};
+        for (CachedBlock& cachedBlock : m_blockCache)
+        {
+            if (cachedBlock.m_filePathToken == filePathToken && cachedBlock.m_blockIndex == blockIndex)
+            {
+                // The block is already cached, so only mark it as used
+                cachedBlock.m_lastUse = ++m_blockCacheUseCounter;
+                return;
+            }
+
+            if (blockToReplace == nullptr || cachedBlock.m_lastUse < blockToReplace->m_lastUse)
+            {
+                blockToReplace = &cachedBlock;
+            }
+        }
+
+        if (m_blockCache.size() < maxCachedBlocks)
+        {
+            blockToReplace = &m_blockCache.emplace_back();
+        }
+
+        blockToReplace->m_filePathToken = filePathToken;
+        blockToReplace->m_blockIndex = blockIndex;
+        blockToReplace->m_lastUse = ++m_blockCacheUseCounter;
+        blockToReplace->m_blockData.assign(blockData.begin(), blockData.end());
+    }
+
+    void ArchiveReader::ScheduleReadAhead(const ArchiveExtractFileResult& extractFileResult,
+        Compression::IDecompressionInterface* decompressionInterface,
+        AZ::u64 firstBlockIndex, AZ::u64 fileRelativeSeekOffset)
+    {
+        const auto fileMetadataTableIndex = static_cast<AZ::u64>(extractFileResult.m_filePathToken);
+        auto blockLineSpanOutcome = GetBlockLineSpanForFile(m_archiveToc.m_tocView, fileMetadataTableIndex);
+        if (!blockLineSpanOutcome)
+        {
+            return;
+        }
+
+        const AZ::u32 blockCount = GetBlockCountIfCompressed(extractFileResult.m_uncompressedSize);
+        const AZ::u64 lastBlockIndex = AZStd::min<AZ::u64>(blockCount, firstBlockIndex + m_settings.m_readAheadBlockCount);
+        if (firstBlockIndex >= lastBlockIndex)
+        {
+            return;
+        }
+
+        {
+            AZStd::scoped_lock readAheadLock(m_readAheadMutex);
+            // Remove the events of read ahead tasks which have completed
+            AZStd::erase_if(m_readAheadEvents, [](const AZStd::unique_ptr<AZ::TaskGraphEvent>& readAheadEvent)
+            {
+                return readAheadEvent->IsSignaled();
+            });
+
+            // Don't queue more read ahead than there are concurrent readers, as read ahead
+            // should not take executor threads away from decompressing blocks that were requested
+            if (m_readAheadEvents.size() >= AZStd::max(1U, m_settings.m_maxReadTasks))
+            {
+                return;
+            }
+        }
+
+        // The block line span is a view into the table of contents, which is valid until the archive
+        // is unmounted. UnmountArchive waits on the read ahead tasks before clearing it
+        auto readAheadTask = [this, decompressionInterface, fileBlockLineSpan = blockLineSpanOutcome.value(),
+            filePathToken = extractFileResult.m_filePathToken, fileOffset = extractFileResult.m_offset,
+            uncompressedSize = extractFileResult.m_uncompressedSize,
+            blockCount, firstBlockIndex, lastBlockIndex, fileRelativeSeekOffset]() mutable
+        {
+            AZStd::vector<AZStd::byte> compressedBlock;
+            AZStd::vector<AZStd::byte> decompressedBlock;
+            Compression::DecompressionOptions archiveDecompressionOptions;
+            archiveDecompressionOptions.m_dictionary = m_archiveToc.m_tocView.m_compressionDictionary;
+            for (AZ::u64 blockIndex = firstBlockIndex; blockIndex < lastBlockIndex; ++blockIndex)
+            {
+                const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
+                const AZ::u64 blockUncompressedSize = AZStd::min<AZ::u64>(ArchiveBlockSizeForCompression,
+                    uncompressedSize - blockIndex * ArchiveBlockSizeForCompression);
+
+                compressedBlock.resize_no_construct(blockCompressedSize);
+                decompressedBlock.resize_no_construct(blockUncompressedSize);
+                if (ReadArchiveAtOffset(compressedBlock, fileOffset + fileRelativeSeekOffset) != blockCompressedSize)
+                {
+                    return;
+                }
+                fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
+
+                if (!decompressionInterface->DecompressBlock(decompressedBlock, compressedBlock,
+                    archiveDecompressionOptions))
+                {
+                    return;
+                }
+
+                CacheBlock(filePathToken, blockIndex, decompressedBlock);
+            }
+        };
+
+        AZ::TaskGraph taskGraph{ "Archive Read Ahead Tasks" };
+        AZ::TaskDescriptor readAheadTaskDescriptor{ "Read Ahead Blocks", "Archive Content File Decompression" };
+        taskGraph.AddTask(readAheadTaskDescriptor, AZStd::move(readAheadTask));
+        // The task graph is not waited on by this function, so let it deallocate once complete
+        taskGraph.Detach();
+
+        auto readAheadEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Archive Read Ahead Sync");
+        taskGraph.SubmitOnExecutor(m_taskExecutor, readAheadEvent.get());
+
+        AZStd::scoped_lock readAheadLock(m_readAheadMutex);
+        m_readAheadEvents.push_back(AZStd::move(readAheadEvent));
+    }
+
+    void ArchiveReader::ClearReadAhead()
+    {
+        AZStd::vector<AZStd::unique_ptr<AZ::TaskGraphEvent>> readAheadEvents;
+        {
+            AZStd::scoped_lock readAheadLock(m_readAheadMutex);
+            readAheadEvents.swap(m_readAheadEvents);
+        }
+
+        for (auto& readAheadEvent : readAheadEvents)
+        {
+            readAheadEvent->Wait();
+        }
+
+        AZStd::scoped_lock readAheadLock(m_readAheadMutex);
+        m_blockCache.clear();
+        m_blockCacheUseCounter = 0;
+        m_sequentialReadOffsets.clear();
+    }
+
     ArchiveExtractFileResult ArchiveReader::ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
         const ArchiveReaderFileSettings& fileSettings)
     {
@@ -406,8 +679,7 @@ namespace Archive
                 " Buffer size is %zu, while %llu is required.", readOffset, fileBuffer.size(), bytesToRead));
         }
 
-        AZStd::scoped_lock archiveReadLock(m_archiveStreamMutex);
-        if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(bytesToRead, fileBuffer.data(), readOffset);
+        if (AZ::IO::SizeType bytesRead = ReadArchiveAtOffset(fileBuffer.first(bytesToRead), readOffset);
             bytesRead < bytesToRead)
         {
             return AZStd::unexpected(ResultString::format("Attempted to read %llu bytes from the archive at offset %lld."
@@ -553,116 +825,191 @@ namespace Archive
             }
         }
 
+        // Determine if the read continues from where the previous read of the file ended
+        // Those reads trigger reading ahead of the current read to hide the decompression latency
+        // of the next read
+        const ArchiveFileToken filePathToken = extractFileResult.m_filePathToken;
+        const bool isSequentialRead = RecordSequentialRead(filePathToken, fileSettings.m_startOffset,
+            fileSettings.m_startOffset + maxBytesToReadForFile);
+
         // Stores the list of compressed blocks to decompress
+        const AZ::u64 blocksToRead = blockRange.second - blockRange.first;
         AZStd::vector<AZStd::byte> compressedBlocks;
-        compressedBlocks.resize_no_construct((blockRange.second - blockRange.first) * ArchiveBlockSizeForCompression);
-        AZStd::span<AZStd::byte> compressedBlockRemainingSpan = compressedBlocks;
+        compressedBlocks.resize_no_construct(blocksToRead * ArchiveBlockSizeForCompression);
 
-        AZ::IO::SizeType fileRelativeSeekOffset = alignedFirstSeekOffset;
-        for (AZ::u64 blockIndex = blockRange.first; blockIndex != blockRange.second; ++blockIndex)
+        // Slice the compressed blocks buffer and the decompression result span into 2 MiB windows per block
+        // As the uncompressed size is 2 MiB for all blocks except the last
+        // the entire contiguous file sequence will be available in the decompressedResultSpan after decompression
+        struct BlockReadState
+        {
+            AZStd::span<AZStd::byte> m_compressedData;
+            AZStd::span<AZStd::byte> m_decompressionBlockSpan;
+            Compression::DecompressionResultData m_decompressionResult;
+            // Set when the block was copied from the read ahead cache, so there is nothing to decompress
+            bool m_isCached{};
+        };
+        AZStd::vector<BlockReadState> blockReadStates(blocksToRead);
+        AZStd::span<AZStd::byte> compressedBlockRemainingSpan = compressedBlocks;
+        AZStd::span<AZStd::byte> decompressionRemainingSpan = decompressionResultSpan;
+        for (BlockReadState& blockReadState : blockReadStates)
         {
-            const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
-            // Get the next 2 MiB block (or less if in the final block) of memory to store the compressed block data
             const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
                 ArchiveBlockSizeForCompression);
-            const AZStd::span<AZStd::byte> compressedBlockToReadInto = compressedBlockRemainingSpan.first(
-                availableBytesInCompressedBlock);
-            // Slide the compressed block remaining span view ahead by the 2 MiB that is being used for the read span
+            blockReadState.m_compressedData = compressedBlockRemainingSpan.first(availableBytesInCompressedBlock);
             compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
-            const AZ::u64 absoluteSeekOffset = extractFileResult.m_offset + fileRelativeSeekOffset;
-            if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(blockCompressedSize,
-                compressedBlockToReadInto.data(), absoluteSeekOffset);
-                bytesRead != blockCompressedSize)
-            {
-                return AZStd::unexpected(ResultString::format("Cannot read all of compressed block for"
-                    " block %llu. The compressed block size is %llu, but only %llu was able to be read",
-                    blockIndex, blockCompressedSize, bytesRead));
-            }
 
-            // As the read was successful add the aligned compressed size to the fileRelativeSeekOffset
-            // The value is the read offset where the next block data starts
-            fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
+            const auto remainingBytesInBlockSpan = AZStd::min<size_t>(decompressionRemainingSpan.size(),
+                ArchiveBlockSizeForCompression);
+            blockReadState.m_decompressionBlockSpan = decompressionRemainingSpan.first(remainingBytesInBlockSpan);
+            decompressionRemainingSpan = decompressionRemainingSpan.subspan(remainingBytesInBlockSpan);
         }
 
-        // Reset the compressed block remaining to the start of the compressedBlocks vector
-        compressedBlockRemainingSpan = compressedBlocks;
-        // The span below is used to slide a 2 MiB window for storing decompressed file contents
-        AZStd::span<AZStd::byte> decompressionRemainingSpan = decompressionResultSpan;
-
         // Get a reference to the the caller supplied decompression options if available
-        const auto& decompressionOptions = fileSettings.m_decompressionOptions != nullptr
+        // otherwise the archive compression dictionary is supplied to the decompressor
+        Compression::DecompressionOptions archiveDecompressionOptions;
+        archiveDecompressionOptions.m_dictionary = m_archiveToc.m_tocView.m_compressionDictionary;
+        const Compression::DecompressionOptions& decompressionOptions = fileSettings.m_decompressionOptions != nullptr
             ? *fileSettings.m_decompressionOptions
-            : Compression::DecompressionOptions{};
+            : archiveDecompressionOptions;
 
         // m_maxDecompressTasks has a minimum value of 1
         // This makes sure there is never a scenario where the there are blocks to decompress
         // but the decompress task count is 0
         const AZ::u32 maxDecompressTasks = AZStd::min(
             AZStd::max(1U, m_settings.m_maxDecompressTasks),
-            static_cast<AZ::u32>(blockRange.second - blockRange.first));
-        AZStd::vector<Compression::DecompressionResultData> decompressedBlockResults(maxDecompressTasks);
+            static_cast<AZ::u32>(blocksToRead));
+
+        // Blocks are read and decompressed in batches of maxDecompressTasks
+        // The compressed blocks of the next batch are read while the previous batch is being decompressed
+        // on the task executor
+        AZStd::unique_ptr<AZ::TaskGraphEvent> inFlightDecompressEvent;
+        AZ::u64 inFlightBatchBegin{};
+        AZ::u64 inFlightBatchEnd{};
+        // Waits for the in flight batch to be decompressed and returns the first decompression error, if any
+        auto WaitForInFlightBatch = [&]() -> ReadCompressedFileOutcome
+        {
+            if (inFlightDecompressEvent == nullptr)
+            {
+                return {};
+            }
+
+            inFlightDecompressEvent->Wait();
+            inFlightDecompressEvent.reset();
+
+            // Validate the decompression for all blocks
+            for (AZ::u64 batchIndex = inFlightBatchBegin; batchIndex < inFlightBatchEnd; ++batchIndex)
+            {
+                const BlockReadState& blockReadState = blockReadStates[batchIndex];
+                if (!blockReadState.m_isCached && !blockReadState.m_decompressionResult)
+                {
+                    // If one of the decompression task fails, early return with the error message
+                    return AZStd::unexpected(blockReadState.m_decompressionResult.m_decompressionOutcome.m_resultString);
+                }
+            }
+
+            return {};
+        };
 
-        for (AZ::u64 blockIndex = blockRange.first; blockIndex < blockRange.second;)
+        AZ::IO::SizeType fileRelativeSeekOffset = alignedFirstSeekOffset;
+        for (AZ::u64 batchBegin{}; batchBegin < blocksToRead;)
         {
-            // Determine the number of decompression task that can be run in parallel
-            const AZ::u32 decompressTaskCount = AZStd::min(static_cast<AZ::u32>(blockRange.second - blockIndex),
-                maxDecompressTasks);
+            const AZ::u64 batchEnd = AZStd::min<AZ::u64>(blocksToRead, batchBegin + maxDecompressTasks);
 
-            // Task graph event used to block decompressing blocks in parallel
-            auto taskDecompressGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Content File Decompress Sync");
             AZ::TaskGraph taskGraph{ "Archive Decompress Tasks" };
             AZ::TaskDescriptor decompressTaskDescriptor{ "Decompress Block", "Archive Content File Decompression" };
+            bool batchHasDecompressTasks{};
 
-            // Increment the block index as part of the inner loop that creates the decompression task
-            for (AZ::u32 decompressTaskSlot = 0; decompressTaskSlot < decompressTaskCount; ++decompressTaskSlot,
-                ++blockIndex)
+            for (AZ::u64 batchIndex = batchBegin; batchIndex < batchEnd; ++batchIndex)
             {
+                const AZ::u64 blockIndex = blockRange.first + batchIndex;
+                BlockReadState& blockReadState = blockReadStates[batchIndex];
                 const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(fileBlockLineSpan, blockCount, blockIndex);
+                const AZ::u64 absoluteSeekOffset = extractFileResult.m_offset + fileRelativeSeekOffset;
+                // Add the aligned compressed size to the fileRelativeSeekOffset
+                // The value is the read offset where the next block data starts
+                fileRelativeSeekOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
+
+                // Use the block decompressed by a previous read or read ahead if available
+                if (CopyCachedBlock(blockReadState.m_decompressionBlockSpan, filePathToken, blockIndex))
+                {
+                    blockReadState.m_isCached = true;
+                    continue;
+                }
+
                 // Downsize the 2 MiB span that was used to read the compressed data to the exact compressed size
-                const auto availableBytesInCompressedBlock = AZStd::min<size_t>(compressedBlockRemainingSpan.size(),
-                    ArchiveBlockSizeForCompression);
-                AZStd::span<const AZStd::byte> compressedDataForBlock = compressedBlockRemainingSpan
-                    .first(availableBytesInCompressedBlock)
-                    .first(blockCompressedSize);
-                // Slide the compressed block remaining span by 2 MiB
-                compressedBlockRemainingSpan = compressedBlockRemainingSpan.subspan(availableBytesInCompressedBlock);
-
-                // Get the block span for storing the decompressed block
-                // As the uncompressed size is 2 MiB for all blocks except the last
-                // the entire contiguous file sequence will be available in the decompressedResultSpan after the loop
-                const auto remainingBytesInBlockSpan = AZStd::min<size_t>(decompressionRemainingSpan.size(),
-                    ArchiveBlockSizeForCompression);
-                AZStd::span<AZStd::byte> decompressionBlockSpan = decompressionRemainingSpan
-                    .first(remainingBytesInBlockSpan);
-                // Slide the remaining decompressed span by 2 MiB as well
-                decompressionRemainingSpan = decompressionRemainingSpan.subspan(remainingBytesInBlockSpan);
+                blockReadState.m_compressedData = blockReadState.m_compressedData.first(blockCompressedSize);
+                if (AZ::IO::SizeType bytesRead = ReadArchiveAtOffset(blockReadState.m_compressedData, absoluteSeekOffset);
+                    bytesRead != blockCompressedSize)
+                {
+                    // The in flight decompression tasks reference the compressed blocks buffer,
+                    // so they must complete before returning
+                    WaitForInFlightBatch();
+                    return AZStd::unexpected(ResultString::format("Cannot read all of compressed block for"
+                        " block %llu. The compressed block size is %llu, but only %llu was able to be read",
+                        blockIndex, blockCompressedSize, bytesRead));
+                }
 
                 //! Decompress Task to execute in task executor
-                auto decompressTask = [decompressionInterface, &decompressionOptions, decompressionBlockSpan, compressedDataForBlock,
-                    &decompressedBlockResult = decompressedBlockResults[decompressTaskSlot]]()
+                auto decompressTask = [decompressionInterface, &decompressionOptions, &blockReadState]()
                 {
                     // Decompressed the compressed block
-                    decompressedBlockResult = decompressionInterface->DecompressBlock(
-                        decompressionBlockSpan, compressedDataForBlock, decompressionOptions);
+                    blockReadState.m_decompressionResult = decompressionInterface->DecompressBlock(
+                        blockReadState.m_decompressionBlockSpan, blockReadState.m_compressedData, decompressionOptions);
                 };
 
                 taskGraph.AddTask(decompressTaskDescriptor, AZStd::move(decompressTask));
+                batchHasDecompressTasks = true;
+            }
+
+            // Wait for the previous batch, which was decompressing while this batch was read
+            if (ReadCompressedFileOutcome batchOutcome = WaitForInFlightBatch(); !batchOutcome)
+            {
+                return batchOutcome;
             }
 
-            taskGraph.SubmitOnExecutor(m_taskExecutor, taskDecompressGraphEvent.get());
-            // Sync on the task completion
-            taskDecompressGraphEvent->Wait();
+            if (batchHasDecompressTasks)
+            {
+                // Task graph event used to block on the blocks decompressing in parallel
+                inFlightDecompressEvent = AZStd::make_unique<AZ::TaskGraphEvent>("Content File Decompress Sync");
+                inFlightBatchBegin = batchBegin;
+                inFlightBatchEnd = batchEnd;
+                // The task graph goes out of scope before the batch is waited on, so let it deallocate once complete
+                taskGraph.Detach();
+                taskGraph.SubmitOnExecutor(m_taskExecutor, inFlightDecompressEvent.get());
+            }
 
-            // Validate the decompression for all blocks
-            for (AZ::u32 decompressTaskSlot = 0; decompressTaskSlot < decompressTaskCount; ++decompressTaskSlot)
+            batchBegin = batchEnd;
+        }
+
+        if (ReadCompressedFileOutcome batchOutcome = WaitForInFlightBatch(); !batchOutcome)
+        {
+            return batchOutcome;
+        }
+
+        if (m_settings.m_readAheadBlockCount > 0 && blocksToRead > 0)
+        {
+            // If the read ended within its last block, keep that block decompressed,
+            // as the next sequential read of the file starts in it
+            const AZ::u64 readEndOffset = fileSettings.m_startOffset + maxBytesToReadForFile;
+            const AZ::u64 lastBlockIndex = blockRange.second - 1;
+            if (readEndOffset % ArchiveBlockSizeForCompression != 0 && readEndOffset < extractFileResult.m_uncompressedSize)
             {
-                const auto& decompressedBlockResult = decompressedBlockResults[decompressTaskSlot];
-                if (!decompressedBlockResult)
+                const AZ::u64 lastBlockUncompressedSize = AZStd::min<AZ::u64>(ArchiveBlockSizeForCompression,
+                    extractFileResult.m_uncompressedSize - lastBlockIndex * ArchiveBlockSizeForCompression);
+                const BlockReadState& lastBlockReadState = blockReadStates.back();
+                if (!lastBlockReadState.m_isCached
+                    && lastBlockReadState.m_decompressionBlockSpan.size() >= lastBlockUncompressedSize)
                 {
-                    // If one of the decompression task fails, early return with the error message
-                    return AZStd::unexpected(AZStd::move(decompressedBlockResult.m_decompressionOutcome.m_resultString));
+                    CacheBlock(filePathToken, lastBlockIndex,
+                        lastBlockReadState.m_decompressionBlockSpan.first(lastBlockUncompressedSize));
                 }
             }
+
+            // Start decompressing the blocks after this read if the file is being read sequentially
+            if (isSequentialRead && blockRange.second < blockCount)
+            {
+                ScheduleReadAhead(extractFileResult, decompressionInterface, blockRange.second, fileRelativeSeekOffset);
+            }
         }
 
         // Return a subspan that accounts for the start offset within the compressed file to start
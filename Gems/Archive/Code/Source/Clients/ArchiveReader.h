@@ -13,8 +13,12 @@
 
 #include <Clients/ArchiveTOCView.h>
 
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/RTTI/RTTIMacros.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/utility/to_underlying.h>
@@ -30,6 +34,11 @@ namespace AZ::IO
     class GenericStream;
 }
 
+namespace Compression
+{
+    struct IDecompressionInterface;
+}
+
 namespace Archive
 {
     //! Implements the Archive Reader Interface
@@ -166,6 +175,37 @@ namespace Archive
             const ArchiveReaderFileSettings& fileSettings,
             const ArchiveExtractFileResult& extractFileResult);
 
+        //! Populates the read stream pool with the mounted archive stream
+        //! Additional streams are opened on demand if the archive was mounted from a path
+        void ResetReadStreams();
+        //! Returns a stream that no other thread is reading from
+        //! Blocks until a stream is released if all streams are in use and no more can be opened
+        AZ::IO::GenericStream* AcquireReadStream();
+        //! Returns a stream acquired with AcquireReadStream to the pool
+        void ReleaseReadStream(AZ::IO::GenericStream* readStream);
+        //! Reads data at an absolute offset within the mounted archive
+        //! Safe to call from multiple threads, as each read uses its own stream seek position
+        //! @return the number of bytes read
+        AZ::IO::SizeType ReadArchiveAtOffset(AZStd::span<AZStd::byte> readBuffer, AZ::u64 offset);
+
+        //! Records the range of a decompressed read of a file
+        //! @return true if the read starts where the previous read of the file ended
+        bool RecordSequentialRead(ArchiveFileToken filePathToken, AZ::u64 startOffset, AZ::u64 endOffset);
+        //! Copies a decompressed block of a file from the read ahead cache into the block span
+        //! @return true if the block was cached and copied
+        bool CopyCachedBlock(AZStd::span<AZStd::byte> decompressionBlockSpan, ArchiveFileToken filePathToken,
+            AZ::u64 blockIndex);
+        //! Stores a decompressed block of a file in the read ahead cache, evicting the least recently used block
+        void CacheBlock(ArchiveFileToken filePathToken, AZ::u64 blockIndex, AZStd::span<const AZStd::byte> blockData);
+        //! Queues reading and decompressing of blocks starting at firstBlockIndex into the read ahead cache
+        //! on the task executor
+        //! @param fileRelativeSeekOffset offset of firstBlockIndex's compressed data relative to the file offset
+        void ScheduleReadAhead(const ArchiveExtractFileResult& extractFileResult,
+            Compression::IDecompressionInterface* decompressionInterface,
+            AZ::u64 firstBlockIndex, AZ::u64 fileRelativeSeekOffset);
+        //! Blocks until all read ahead tasks have completed and clears the read ahead cache
+        void ClearReadAhead();
+
 
         // Private Member variables section
 
@@ -205,12 +245,46 @@ namespace Archive
         //! GenericStream pointer which stores the open archive
         ArchiveStreamPtr m_archiveStream;
 
-        //! Protects reads within the archive stream
-        //! NOTE: This does restrict read jobs to be done on one thread at a time
-        //! if done using the AZ::IO::GenericStream API as it maintains a single seek position
+        //! Path of the mounted archive which is used to open additional read streams
+        //! It is empty when the archive was mounted from a stream, in which case reads
+        //! are done one at a time using that stream
+        AZ::IO::Path m_archivePath;
+
+        //! Protects the read stream pool
+        //! The AZ::IO::GenericStream API maintains a single seek position, so concurrent
+        //! reads are done using separate streams to the archive rather than a shared one
         AZStd::mutex m_archiveStreamMutex;
+        //! Signaled when a read stream is returned to the pool
+        AZStd::condition_variable m_readStreamReleased;
+        //! Additional streams opened to the archive path, up to ArchiveReaderSettings::m_maxReadTasks
+        AZStd::vector<ArchiveStreamPtr> m_additionalReadStreams;
+        //! Streams which are not being read from
+        AZStd::vector<AZ::IO::GenericStream*> m_idleReadStreams;
+        //! Number of streams in the pool, including the mounted archive stream
+        AZ::u32 m_readStreamCount{};
+        //! Maximum number of streams in the pool
+        AZ::u32 m_maxReadStreams{};
+
+        //! Decompressed block kept in memory for a file that is being read sequentially
+        struct CachedBlock
+        {
+            ArchiveFileToken m_filePathToken{ InvalidArchiveFileToken };
+            AZ::u64 m_blockIndex{};
+            AZ::u64 m_lastUse{};
+            AZStd::vector<AZStd::byte> m_blockData;
+        };
+        //! Protects the read ahead cache and the sequential read offsets
+        AZStd::mutex m_readAheadMutex;
+        AZStd::vector<CachedBlock> m_blockCache;
+        AZ::u64 m_blockCacheUseCounter{};
+        //! Stores the offset after the last decompressed read of a file, keyed by its ArchiveFileToken
+        //! A read which starts at that offset is considered sequential and triggers read ahead
+        AZStd::unordered_map<AZ::u64, AZ::u64> m_sequentialReadOffsets;
+        //! Events for read ahead task graphs which are still running
+        AZStd::vector<AZStd::unique_ptr<AZ::TaskGraphEvent>> m_readAheadEvents;
 
         //! Task Executor used to decompress blocks of a file in parallel
+        //! Decompression tasks of reads on different threads are interleaved on the executor
         AZ::TaskExecutor m_taskExecutor;
     };
 } // namespace Archive
@@ -88,6 +88,10 @@ namespace Archive
 
         //! vector storing the block offset table for each file
         AZStd::vector<ArchiveBlockLineUnion> m_blockOffsetTable{};
+
+        //! vector storing the compression dictionary of the archive
+        //! It is empty if the archive has no dictionary
+        AZStd::vector<AZStd::byte> m_compressionDictionary{};
     };
 } // namespace Archive
 
@@ -98,6 +98,7 @@ namespace Archive
         ArchiveTableOfContents tableOfContents;
         tableOfContents.m_fileMetadataTable = { tocView.m_fileMetadataTable.begin(), tocView.m_fileMetadataTable.end() };
         tableOfContents.m_blockOffsetTable = { tocView.m_blockOffsetTable.begin(), tocView.m_blockOffsetTable.end() };
+        tableOfContents.m_compressionDictionary = { tocView.m_compressionDictionary.begin(), tocView.m_compressionDictionary.end() };
         size_t fileCount = tocView.m_filePathIndexTable.size();
 
         // Populate the file path table using the file path index offset entries from the raw TOC view
@@ -65,6 +65,10 @@ namespace Archive
 
         //! pointer to block offset table which stores the compressed size of all blocks within the archive
         AZStd::span<ArchiveBlockLineUnion const> m_blockOffsetTable{};
+
+        //! pointer to the compression dictionary which is supplied to the compression algorithms
+        //! that support dictionaries. It is empty if the archive has no dictionary
+        AZStd::span<AZStd::byte const> m_compressionDictionary{};
     };
 
     //! Options which allows configuring which sections of the table of contents
@@ -80,6 +80,11 @@ namespace Archive
             blockOffsetTableBegin,
             blockOffsetTableEnd);
 
+        // create a span to the compression dictionary which follows the block offset table
+        tocView.m_compressionDictionary = AZStd::span(
+            reinterpret_cast<const AZStd::byte*>(blockOffsetTableEnd),
+            archiveHeader.m_tocCompressionDictionaryUncompressedSize);
+
         ArchiveTocValidationOptions validationSettings;
         // Skip over validating the block Offset table has that is a potentially slow operation
         validationSettings.m_validateBlockOffsetTable = false;
@@ -434,6 +434,7 @@ namespace Archive
         // An empty file is valid to use for writing a new archive therefore return true
         if (m_archiveStream->GetLength() == 0)
         {
+            m_archiveToc.m_compressionDictionary = m_settings.m_compressionDictionary;
             return true;
         }
         const bool mountResult = ReadArchiveHeader(m_archiveHeader, *m_archiveStream)
@@ -441,6 +442,13 @@ namespace Archive
             && BuildDeletedFileBlocksMap(m_archiveHeader, *m_archiveStream)
             && BuildFilePathMap(m_archiveToc);
 
+        // The dictionary of an existing archive is kept, as the content already in the archive
+        // may have been compressed with it
+        if (mountResult && m_archiveToc.m_compressionDictionary.empty())
+        {
+            m_archiveToc.m_compressionDictionary = m_settings.m_compressionDictionary;
+        }
+
         return mountResult;
     }
 
@@ -581,6 +589,10 @@ namespace Archive
         m_archiveHeader.m_tocBlockOffsetTableUncompressedSize = static_cast<AZ::u32>(
             AZStd::span(m_archiveToc.m_blockOffsetTable).size_bytes());
 
+        // Update the Archive uncompressed TOC compression dictionary size
+        m_archiveHeader.m_tocCompressionDictionaryUncompressedSize = static_cast<AZ::u32>(
+            m_archiveToc.m_compressionDictionary.size());
+
         // 2. Write the Archive Table of Contents
         // Both buffers lifetime must be encompass the tocWriteSpan below
         // to make sure the span points to a valid buffer
@@ -740,6 +752,12 @@ namespace Archive
         AZStd::span<ArchiveBlockLineUnion> blockOffsetTableView = m_archiveToc.m_blockOffsetTable;
         tocOutputStream.Write(blockOffsetTableView.size_bytes(), blockOffsetTableView.data());
 
+        // Write out the compression dictionary as the last section of the table of contents
+        if (!m_archiveToc.m_compressionDictionary.empty())
+        {
+            tocOutputStream.Write(m_archiveToc.m_compressionDictionary.size(), m_archiveToc.m_compressionDictionary.data());
+        }
+
         WriteTocRawResult result;
         result.m_tocSpan = tocOutputBuffer;
         return result;
@@ -941,9 +959,13 @@ namespace Archive
             return contentFileBlocks;
         }
 
+        // When no compression options are supplied for the file, the archive compression level and dictionary are used
+        Compression::CompressionOptions archiveCompressionOptions;
+        archiveCompressionOptions.m_compressionLevel = m_settings.m_compressionLevel;
+        archiveCompressionOptions.m_dictionary = m_archiveToc.m_compressionDictionary;
         const Compression::CompressionOptions& compressionOptions = fileSettings.m_compressionOptions != nullptr
             ? *fileSettings.m_compressionOptions
-            : Compression::CompressionOptions{};
+            : archiveCompressionOptions;
 
         // Due to check earlier validating that the inputDataSpan is not empty,
         // the compressedBlockCount will be at least 1 due to rounding up to the nearest block
@@ -25,4 +25,26 @@ public:
     }
 };
 
+#if defined(HAVE_BENCHMARK)
+//! The benchmark environment loads the Compression gem as well,
+//! so that the benchmarks can decompress the content of archives
+class ArchiveEditorBenchmarkEnvironment
+    : public AZ::Test::BenchmarkEnvironmentBase
+    , public ArchiveEditorTestEnvironment
+{
+protected:
+    void SetUpBenchmark() override
+    {
+        SetupEnvironment();
+    }
+
+    void TearDownBenchmark() override
+    {
+        TeardownEnvironment();
+    }
+};
+
+AZ_UNIT_TEST_HOOK(new ArchiveEditorTestEnvironment, ArchiveEditorBenchmarkEnvironment);
+#else
 AZ_UNIT_TEST_HOOK(new ArchiveEditorTestEnvironment);
+#endif
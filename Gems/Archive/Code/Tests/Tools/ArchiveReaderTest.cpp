@@ -9,12 +9,15 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 
 #include <Archive/Clients/ArchiveReaderAPI.h>
 #include <Archive/Tools/ArchiveWriterAPI.h>
 
 #include <Compression/CompressionLZ4API.h>
+#include <Compression/CompressionZstdAPI.h>
 
 // Archive Gem private implementation includes
 #include <Clients/ArchiveReaderFactory.h>
@@ -970,4 +973,338 @@ namespace Archive::Test
             EXPECT_TRUE(AZStd::ranges::equal(requestedFileData, expectedResultData));
         }
     }
+
+    namespace ArchiveReaderTestInternal
+    {
+        constexpr AZStd::string_view MultiblockFilePath = "multiblockcompressed.bin";
+
+        // Generates data for a file which spans several 2 MiB blocks
+        // The pattern repeats every 251 bytes, so that each block has different content
+        AZStd::vector<AZStd::byte> GenerateMultiblockFileData(size_t fileSize)
+        {
+            AZStd::vector<AZStd::byte> fileData;
+            fileData.resize_no_construct(fileSize);
+            for (size_t index = 0; index < fileSize; ++index)
+            {
+                fileData[index] = static_cast<AZStd::byte>(index % 251);
+            }
+            return fileData;
+        }
+
+        // Writes an archive containing the file data compressed with LZ4 to the archive stream
+        bool WriteMultiblockArchive(AZ::IO::GenericStream& archiveStream, AZStd::span<const AZStd::byte> fileData)
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            if (!createArchiveWriterResult)
+            {
+                return false;
+            }
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            fileSettings.m_relativeFilePath = MultiblockFilePath;
+            return archiveWriter->AddFileToArchive(fileData, fileSettings) && archiveWriter->Commit();
+        }
+    }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_FromMultipleThreads_Succeeds)
+    {
+        // 5 full blocks and a partial final block
+        constexpr size_t FileSize = ArchiveBlockSizeForCompression * 5 + 100;
+        const AZStd::vector<AZStd::byte> fileData = ArchiveReaderTestInternal::GenerateMultiblockFileData(FileSize);
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        ASSERT_TRUE(ArchiveReaderTestInternal::WriteMultiblockArchive(archiveStream, fileData));
+
+        // Set the ArchiveStreamDeleter to not delete the stack ByteContainerStream
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        ArchiveReaderSettings readerSettings;
+        readerSettings.m_maxDecompressTasks = 2;
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr), readerSettings);
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        // Each thread extracts the entire file several times while the other threads do the same
+        constexpr size_t ThreadCount = 8;
+        constexpr size_t ExtractionsPerThread = 4;
+        AZStd::atomic_int matchingExtractions{};
+        AZStd::vector<AZStd::thread> readerThreads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            readerThreads.emplace_back([&archiveReader, &fileData, &matchingExtractions]()
+            {
+                AZStd::vector<AZStd::byte> fileBuffer;
+                fileBuffer.resize_no_construct(FileSize);
+                ArchiveReaderFileSettings fileSettings;
+                fileSettings.m_filePathIdentifier = AZ::IO::PathView(ArchiveReaderTestInternal::MultiblockFilePath);
+                for (size_t extraction = 0; extraction < ExtractionsPerThread; ++extraction)
+                {
+                    const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                        fileBuffer, fileSettings);
+                    if (archiveExtractFileResult && AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan, fileData))
+                    {
+                        ++matchingExtractions;
+                    }
+                }
+            });
+        }
+
+        for (AZStd::thread& readerThread : readerThreads)
+        {
+            readerThread.join();
+        }
+
+        EXPECT_EQ(ThreadCount * ExtractionsPerThread, static_cast<size_t>(matchingExtractions));
+    }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_SequentialPartialReadsOfCompressedFile_Succeeds)
+    {
+        // Reading a compressed file in chunks smaller than a block exercises the read ahead
+        // of the next blocks and the reuse of the partially read block
+        constexpr size_t FileSize = ArchiveBlockSizeForCompression * 4 + 100;
+        constexpr size_t ChunkSize = ArchiveBlockSizeForCompression / 4;
+        const AZStd::vector<AZStd::byte> fileData = ArchiveReaderTestInternal::GenerateMultiblockFileData(FileSize);
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        ASSERT_TRUE(ArchiveReaderTestInternal::WriteMultiblockArchive(archiveStream, fileData));
+
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        // The output buffer must be large enough to decompress whole blocks
+        AZStd::vector<AZStd::byte> fileBuffer;
+        fileBuffer.resize_no_construct(FileSize);
+        AZStd::vector<AZStd::byte> sequentiallyReadData;
+        sequentiallyReadData.reserve(FileSize);
+
+        ArchiveReaderFileSettings fileSettings;
+        fileSettings.m_filePathIdentifier = AZ::IO::PathView(ArchiveReaderTestInternal::MultiblockFilePath);
+        fileSettings.m_bytesToRead = ChunkSize;
+        for (fileSettings.m_startOffset = 0; fileSettings.m_startOffset < FileSize; fileSettings.m_startOffset += ChunkSize)
+        {
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            sequentiallyReadData.insert(sequentiallyReadData.end(), archiveExtractFileResult.m_fileSpan.begin(),
+                archiveExtractFileResult.m_fileSpan.end());
+        }
+
+        EXPECT_TRUE(AZStd::ranges::equal(sequentiallyReadData, fileData));
+    }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_CompressedWithZstdDictionary_Succeeds)
+    {
+        auto compressionRegistrar = Compression::CompressionRegistrar::Get();
+        ASSERT_NE(nullptr, compressionRegistrar);
+        auto zstdCompressor = compressionRegistrar->FindCompressionInterface(CompressionZstd::GetZstdCompressionAlgorithmId());
+        ASSERT_NE(nullptr, zstdCompressor);
+
+        // Generate small files with similar content that a trained dictionary compresses well
+        AZStd::vector<AZStd::string> fileContents;
+        for (AZ::u32 index = 0; index < 512; ++index)
+        {
+            fileContents.emplace_back(AZStd::string::format(
+                R"({"$type": "AZ::Entity", "Id": %u, "Name": "Entity_%u", "Components": [{"$type": "AZ::TransformComponent"}]})",
+                index, index % 37));
+        }
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        for (const AZStd::string& fileContent : fileContents)
+        {
+            samples.emplace_back(AZStd::as_bytes(AZStd::span(fileContent)));
+        }
+
+        ArchiveWriterSettings writerSettings;
+        writerSettings.m_compressionLevel = 19;
+        writerSettings.m_compressionDictionary = zstdCompressor->TrainDictionary(samples, 8 * 1024);
+        ASSERT_FALSE(writerSettings.m_compressionDictionary.empty());
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        constexpr size_t FilesPerWrite = 8;
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr), writerSettings);
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_compressionAlgorithm = CompressionZstd::GetZstdCompressionAlgorithmId();
+            for (size_t fileIndex = 0; fileIndex < FilesPerWrite; ++fileIndex)
+            {
+                const AZ::IO::Path filePath = AZ::IO::Path(AZStd::string::format("entities/%zu.json", fileIndex));
+                fileSettings.m_relativeFilePath = filePath;
+                EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fileContents[fileIndex])), fileSettings));
+            }
+
+            ASSERT_TRUE(archiveWriter->Commit());
+        }
+
+        {
+            // Remount the archive with a writer that doesn't supply the dictionary
+            // The dictionary stored in the archive should continue to be used
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_compressionAlgorithm = CompressionZstd::GetZstdCompressionAlgorithmId();
+            for (size_t fileIndex = FilesPerWrite; fileIndex < FilesPerWrite * 2; ++fileIndex)
+            {
+                const AZ::IO::Path filePath = AZ::IO::Path(AZStd::string::format("entities/%zu.json", fileIndex));
+                fileSettings.m_relativeFilePath = filePath;
+                EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fileContents[fileIndex])), fileSettings));
+            }
+
+            ASSERT_TRUE(archiveWriter->Commit());
+        }
+
+        auto archiveHeader = reinterpret_cast<const ArchiveHeader*>(archiveBuffer.data());
+        EXPECT_EQ(writerSettings.m_compressionDictionary.size(), archiveHeader->m_tocCompressionDictionaryUncompressedSize);
+
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        for (size_t fileIndex = 0; fileIndex < FilesPerWrite * 2; ++fileIndex)
+        {
+            const AZ::IO::Path filePath = AZ::IO::Path(AZStd::string::format("entities/%zu.json", fileIndex));
+            const ArchiveListFileResult archiveListFileResult = archiveReader->ListFileInArchive(filePath);
+            ASSERT_TRUE(archiveListFileResult);
+            EXPECT_EQ(CompressionZstd::GetZstdCompressionAlgorithmId(), archiveListFileResult.m_compressionAlgorithm);
+
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(archiveListFileResult.m_uncompressedSize);
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = archiveListFileResult.m_filePathToken;
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+
+            AZStd::string_view textFileSpan(reinterpret_cast<const char*>(archiveExtractFileResult.m_fileSpan.data()),
+                archiveExtractFileResult.m_fileSpan.size());
+            EXPECT_EQ(fileContents[fileIndex], textFileSpan);
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Measures the extraction throughput of a compressed file by several threads reading at the same time
+    class ArchiveReaderBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            SetUpArchive(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUpArchive(state);
+        }
+
+        void TearDown(const ::benchmark::State&) override
+        {
+            TearDownArchive();
+        }
+        void TearDown(::benchmark::State&) override
+        {
+            TearDownArchive();
+        }
+
+    protected:
+        static constexpr size_t FileSize = ArchiveBlockSizeForCompression * 8;
+
+        void SetUpArchive(const ::benchmark::State& state)
+        {
+            m_archiveReaderFactory = AZStd::make_unique<ArchiveReaderFactory>();
+            AZ::Interface<IArchiveReaderFactory>::Register(m_archiveReaderFactory.get());
+            m_archiveWriterFactory = AZStd::make_unique<ArchiveWriterFactory>();
+            AZ::Interface<IArchiveWriterFactory>::Register(m_archiveWriterFactory.get());
+
+            m_archiveStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::vector<AZStd::byte>>>(&m_archiveBuffer);
+            ArchiveReaderTestInternal::WriteMultiblockArchive(*m_archiveStream,
+                ArchiveReaderTestInternal::GenerateMultiblockFileData(FileSize));
+
+            ArchiveReaderSettings readerSettings;
+            readerSettings.m_maxReadTasks = static_cast<AZ::u32>(state.range(0));
+            if (auto createArchiveReaderResult = CreateArchiveReader(
+                IArchiveReader::ArchiveStreamPtr(m_archiveStream.get(), { false }), readerSettings);
+                createArchiveReaderResult)
+            {
+                m_archiveReader = AZStd::move(createArchiveReaderResult.value());
+            }
+        }
+
+        void TearDownArchive()
+        {
+            m_archiveReader.reset();
+            m_archiveStream.reset();
+            m_archiveBuffer = {};
+            AZ::Interface<IArchiveWriterFactory>::Unregister(m_archiveWriterFactory.get());
+            AZ::Interface<IArchiveReaderFactory>::Unregister(m_archiveReaderFactory.get());
+            m_archiveWriterFactory.reset();
+            m_archiveReaderFactory.reset();
+        }
+
+        AZStd::unique_ptr<IArchiveReaderFactory> m_archiveReaderFactory;
+        AZStd::unique_ptr<IArchiveWriterFactory> m_archiveWriterFactory;
+        AZStd::vector<AZStd::byte> m_archiveBuffer;
+        AZStd::unique_ptr<AZ::IO::ByteContainerStream<AZStd::vector<AZStd::byte>>> m_archiveStream;
+        AZStd::unique_ptr<IArchiveReader> m_archiveReader;
+    };
+
+    BENCHMARK_DEFINE_F(ArchiveReaderBenchmarkFixture, BM_ExtractCompressedFile_ConcurrentReaders)(benchmark::State& state)
+    {
+        if (m_archiveReader == nullptr)
+        {
+            state.SkipWithError("Archive could not be created");
+            return;
+        }
+
+        const size_t readerCount = static_cast<size_t>(state.range(0));
+        AZStd::vector<AZStd::vector<AZStd::byte>> fileBuffers(readerCount);
+        for (AZStd::vector<AZStd::byte>& fileBuffer : fileBuffers)
+        {
+            fileBuffer.resize_no_construct(FileSize);
+        }
+
+        ArchiveReaderFileSettings fileSettings;
+        fileSettings.m_filePathIdentifier = AZ::IO::PathView(ArchiveReaderTestInternal::MultiblockFilePath);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<AZStd::thread> readerThreads;
+            readerThreads.reserve(readerCount);
+            for (AZStd::vector<AZStd::byte>& fileBuffer : fileBuffers)
+            {
+                readerThreads.emplace_back([this, &fileBuffer, &fileSettings]()
+                {
+                    benchmark::DoNotOptimize(m_archiveReader->ExtractFileFromArchive(fileBuffer, fileSettings));
+                });
+            }
+
+            for (AZStd::thread& readerThread : readerThreads)
+            {
+                readerThread.join();
+            }
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * readerCount * FileSize));
+    }
+
+    BENCHMARK_REGISTER_F(ArchiveReaderBenchmarkFixture, BM_ExtractCompressedFile_ConcurrentReaders)
+        ->Arg(1)->Arg(4)->Arg(8)
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
 }
@@ -94,6 +94,13 @@ namespace AZ
             //! other, these additional constants will be added to the end of the returned list.
             AZStd::vector<ShaderInputConstantIndex> GetIndicesOfDifferingConstants(const ConstantsData& other) const;
 
+            //! Returns the byte range of the constant data written since construction or the last call to ResetDirtyInterval().
+            //! The interval is empty (m_min == m_max) if nothing was written.
+            Interval GetDirtyInterval() const;
+
+            //! Clears the tracked range of written constant data.
+            void ResetDirtyInterval();
+
         private:
             enum class ValidateConstantAccessExpect : uint32_t
             {
@@ -111,6 +118,9 @@ namespace AZ
             bool ValidateConstantAccess(ShaderInputConstantIndex inputIndex, ValidateConstantAccessExpect expect, size_t offsetInBytes, size_t sizeInBytes) const;
             bool ValidateConstantBufferAccess(size_t offsetInBytes, size_t sizeInBytes) const;
 
+            //! Extends the dirty interval to include the byte range [min, max).
+            void MarkDirty(uint32_t min, uint32_t max);
+
             //! Assigns a specified number of rows from a Matrix of type Matrix3x4 and Matrix4x4
             //! the function expects type T and matrixSize (number of floats, which is 12 for Matrix3x4 and 16 for Matrix4x4)
             template <typename T, uint32_t matrixSize>
@@ -118,6 +128,9 @@ namespace AZ
 
             ConstPtr<ConstantsLayout> m_layout;
             AZStd::vector<uint8_t> m_constantData;
+
+            //! Byte range of m_constantData written since the last ResetDirtyInterval() call.
+            Interval m_dirtyInterval;
         };
 
         template <typename T>
@@ -194,6 +207,7 @@ namespace AZ
                 {
                     value.GetRow(i).StoreToFloat4(row + i * 4);
                 }
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
             }
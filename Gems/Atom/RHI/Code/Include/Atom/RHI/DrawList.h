@@ -44,6 +44,17 @@ namespace AZ
         /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
+        /// Sorts the draw list by sort key and depth. Uses a radix sort for large lists and a comparison sort for small ones.
         void SortDrawList(DrawList& drawList, DrawListSortType sortType);
+
+        /// Sorts the draw list with a stable LSD radix sort over the sort key and depth. Byte passes in which every
+        /// item has the same digit are skipped, so lists where only the depth varies take just a few passes.
+        void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType);
+
+        /// Sorts the draw list with a comparison sort.
+        void ComparisonSortDrawList(DrawList& drawList, DrawListSortType sortType);
+
+        /// Draw lists with at least this many items are sorted with RadixSortDrawList by SortDrawList.
+        constexpr size_t DrawListRadixSortMinItemCount = 256;
     }
 }
@@ -53,8 +53,13 @@ namespace AZ
 
             /// Coalesces the draw lists in preparation for access via GetList. This should
             /// be called from a single thread as a sync point between the append / consume phases.
+            /// The draw lists are merged on the calling thread, so this is safe to call from within a task.
             void FinalizeLists();
 
+            /// Same as FinalizeLists, but large sets of draw lists are merged in parallel, one task per draw list tag.
+            /// This blocks until the merge tasks complete, so it must not be called from within a task.
+            void FinalizeListsParallel();
+
             /// Returns the draw list associated with the provided tag.
             DrawListView GetList(DrawListTag drawListTag) const;
 
@@ -62,7 +67,12 @@ namespace AZ
             /// merged draw lists and isn't intended for use outside that case.
             DrawListsByTag& GetMergedDrawListsByTag();
 
+            /// Total number of draw items from which FinalizeLists merges the draw lists of different tags in parallel.
+            static constexpr size_t ParallelMergeMinItemCount = 4096;
+
         private:
+            void MergeLists(bool mergeInParallel);
+
             ThreadLocalContext<DrawListsByTag> m_threadListsByTag;
             DrawListsByTag m_mergedListsByTag;
             DrawListMask m_drawListMask = 0;
@@ -8,10 +8,12 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
 #include <Atom/RHI/BufferView.h>
+#include <AzCore/std/optional.h>
 
 //! Struct used as a key for m_imageReverseLookupHash map below. The reason for using a struct instead of a hash directly is
 //! so that the map can handle hash collision correctly by using the == operator. This struct contains
@@ -162,6 +164,15 @@ namespace AZ
          * kept inside the compiler. The cache is big enough to avoid having to re-create views every frame, but
          * bounded in order to release entries old views.
          *
+         *      == Compile Cache ==
+         *
+         * The frame graph is rebuilt every frame, but its structure (scopes, queues, attachment usages and transient
+         * attachment descriptors) rarely changes between frames. The compiler calculates a structural hash of each graph,
+         * and when it matches the previous one, the transient attachment lifetimes, the sorted allocation commands and the
+         * memory hint of the previous frame are reused. The transient attachments are still activated against the pool and
+         * the views are still bound each frame, since resources and scope objects are re-created per frame. The cache can be
+         * disabled with the r_frameGraphCompileCache cvar.
+         *
          *      == Platform-Specific Compilation ==
          *
          * Finally, the compiler calls into the platform-specific compile method, which hands control over to the
@@ -188,6 +199,9 @@ namespace AZ
              */
             MessageOutcome Compile(const FrameGraphCompileRequest& request);
 
+            /// Returns whether the last call to Compile reused the cached transient attachment compilation.
+            bool WasLastCompileCached() const;
+
         protected:
             FrameGraphCompiler() = default;
 
@@ -225,6 +239,13 @@ namespace AZ
 
             void CompileResourceViews(const FrameGraphAttachmentDatabase& attachmentDatabase);
 
+            /// Calculates a hash of the frame graph topology and transient attachment descriptors, which is everything
+            /// the transient attachment compilation depends on.
+            static HashValue64 CalculateStructureHash(const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags);
+
+            /// Assigns the first / last scopes of the transient attachments from the compile cache.
+            void ApplyCachedTransientAttachmentLifetimes(FrameGraph& frameGraph) const;
+
             //! Remove the entry related to the provided ReverseLookupObjectType from the appropriate cache as it is probably stale now
             template<typename ReverseLookupObjectType, typename ObjectCacheType>
             void RemoveFromCache(ReverseLookupObjectType objectToRemove,
@@ -244,6 +265,26 @@ namespace AZ
             // once they have been replaced with a new view instance. 
             AZStd::unordered_map<ImageResourceViewData, HashValue64> m_imageReverseLookupHash;
             AZStd::unordered_map<BufferResourceViewData, HashValue64> m_bufferReverseLookupHash;
+
+            /// Results of the last transient attachment compilation, reused while the frame graph structure is unchanged.
+            struct CompileCache
+            {
+                bool m_isValid = false;
+                HashValue64 m_structureHash = HashValue64{ 0 };
+                const TransientAttachmentPool* m_transientAttachmentPool = nullptr;
+
+                /// First / last scope index of each transient buffer followed by each transient image.
+                AZStd::vector<AZStd::pair<uint32_t, uint32_t>> m_transientAttachmentLifetimes;
+
+                /// Sorted activation / deactivation commands.
+                AZStd::vector<uint32_t> m_transientAttachmentCommands;
+
+                /// Memory usage calculated by the first pass of a memory hint transient attachment pool.
+                AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_memoryUsage;
+            };
+
+            CompileCache m_compileCache;
+            bool m_lastCompileCached = false;
         };
     }
 }
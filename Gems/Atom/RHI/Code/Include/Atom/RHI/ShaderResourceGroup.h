@@ -10,6 +10,8 @@
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
 
+#include <AzCore/std/containers/array.h>
+
 namespace AZ
 {
     namespace RHI
@@ -74,6 +76,11 @@ namespace AZ
 
             //! Update the view hash within m_viewHash
             void UpdateViewHash(const AZ::Name& viewName, const HashValue64 viewHash);
+
+            //! Returns the byte range of the constant data that needs to be uploaded by the current compile. Platforms
+            //! keep one copy of the constants per frame in flight, so this is the union of the ranges written during
+            //! the last FrameCountMax compiles. Only valid while the group is being compiled.
+            Interval GetConstantDataUpdateInterval() const;
             
         protected:
             ShaderResourceGroup() = default;
@@ -81,6 +88,16 @@ namespace AZ
         private:
             void SetData(const ShaderResourceGroupData& data);
 
+            //! Accumulates the constant data written in the provided data into the range to upload on the next compile.
+            void MergeConstantDataDirtyInterval(const ShaderResourceGroupData& data);
+
+            //! Moves the pending constant data range into the per-compile history and computes the range to upload.
+            //! Called once for every compile that reaches the platform.
+            void UpdateConstantDataUpdateInterval(bool isConstantDataCompiled, bool forceFullUpdate);
+
+            //! Clears the constant data tracking and flags the full constant data for upload.
+            void ResetConstantDataUpdateTracking();
+
             ShaderResourceGroupData m_data;
 
             // The binding slot cached from the layout.
@@ -98,6 +115,16 @@ namespace AZ
 
             // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
             AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
+
+            // Range of constant data written since the last compile.
+            Interval m_pendingConstantDataInterval;
+
+            // Range of constant data written by each of the last FrameCountMax compiles, used as a ring buffer.
+            AZStd::array<Interval, RHI::Limits::Device::FrameCountMax> m_constantDataIntervalHistory;
+            uint32_t m_constantDataIntervalHistoryIndex = 0;
+
+            // Range of constant data to upload for the current compile.
+            Interval m_constantDataUpdateInterval;
         };
     }
 }
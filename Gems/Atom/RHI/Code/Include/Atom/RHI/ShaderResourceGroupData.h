@@ -225,7 +225,7 @@ namespace AZ
                 AZStd::vector<ConstPtr<ResourceView>> m_bindlessResources;
             };
             
-            //! Reset the update mask
+            //! Reset the update mask and the dirty range of the constant data.
             void ResetUpdateMask();
 
             //! Enable compilation for a resourceType specified by resourceTypeMask
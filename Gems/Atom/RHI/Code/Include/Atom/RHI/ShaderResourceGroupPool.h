@@ -66,6 +66,10 @@ namespace AZ
 
             //////////////////////////////////////////////////////////////////////////
 
+            //! Returns the number of constant data bytes uploaded by compiles since the previous call, and resets the count.
+            //! Used to report the constant upload volume per frame.
+            uint64_t GetAndResetConstantDataBytesUpdated();
+
             //! Returns whether layout in this pool has constants.
             bool HasConstants() const;
 
@@ -107,6 +111,12 @@ namespace AZ
             // Compiles an SRG synchronously. 
             void Compile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData);
 
+            // Compiles the group and returns the number of constant data bytes the platform has to upload.
+            ResultCode CompileGroup(
+                ShaderResourceGroup& shaderResourceGroup,
+                const ShaderResourceGroupData& shaderResourceGroupData,
+                uint32_t& constantDataBytesUpdated);
+
             // Calculate diffs for updating the resource registry.
             void CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData);
 
@@ -142,6 +152,12 @@ namespace AZ
                 ShaderResourceGroup& shaderResourceGroup,
                 const ShaderResourceGroupData& shaderResourceGroupData) = 0;
 
+            // Returns the number of constant data bytes the platform uploads when compiling the group. The default is the
+            // size of GetConstantDataUpdateInterval(). Platforms that upload more than that range override it.
+            virtual uint32_t GetConstantDataBytesUpdatedInternal(
+                const ShaderResourceGroup& shaderResourceGroup,
+                const ShaderResourceGroupData& shaderResourceGroupData) const;
+
             //////////////////////////////////////////////////////////////////////////
 
             ShaderResourceGroupPoolDescriptor m_descriptor;
@@ -156,6 +172,9 @@ namespace AZ
 
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
+
+            // Constant data bytes uploaded by compiles since the last GetAndResetConstantDataBytesUpdated() call.
+            AZStd::atomic<uint64_t> m_constantDataBytesUpdated{ 0 };
         };
     }
 }
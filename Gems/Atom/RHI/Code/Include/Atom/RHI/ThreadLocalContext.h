@@ -11,6 +11,7 @@
 
 #include <AzCore/std/parallel/threadbus.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZ
@@ -69,6 +70,12 @@ namespace AZ
             void ForEach(AZStd::function<void(Storage&)> visitor);
             void ForEach(AZStd::function<void(const Storage&)> visitor) const;
 
+            /**
+             * Takes a shared lock on the container and passes all thread storages to the visitor at once.
+             * The storages stay valid for the duration of the call, which allows processing them in parallel.
+             */
+            void ForAll(AZStd::function<void(AZStd::span<const AZStd::unique_ptr<Storage>>)> visitor);
+
             /**
              * Clears all thread storage from the container.
              */
@@ -187,6 +194,13 @@ namespace AZ
             }
         }
 
+        template <typename Storage>
+        void ThreadLocalContext<Storage>::ForAll(AZStd::function<void(AZStd::span<const AZStd::unique_ptr<Storage>>)> visitor)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            visitor(m_storageList);
+        }
+
         template <typename Storage>
         void ThreadLocalContext<Storage>::Clear()
         {
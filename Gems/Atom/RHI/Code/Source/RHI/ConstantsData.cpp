@@ -19,6 +19,7 @@ namespace AZ
             if (m_layout->GetDataSize() > 0)
             {
                 m_constantData.resize(m_layout->GetDataSize());
+                m_dirtyInterval = Interval(0, m_layout->GetDataSize());
             }
         }
 
@@ -105,6 +106,7 @@ namespace AZ
             {
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 memcpy(&m_constantData[interval.m_min + byteOffset], bytes, byteCount);
+                MarkDirty(interval.m_min + aznumeric_cast<uint32_t>(byteOffset), interval.m_min + aznumeric_cast<uint32_t>(byteOffset + byteCount));
                 return true;
             }
             return false;
@@ -115,6 +117,7 @@ namespace AZ
             if (ValidateConstantBufferAccess(0, byteCount))
             {
                 memcpy(m_constantData.data(), bytes, byteCount);
+                MarkDirty(0, aznumeric_cast<uint32_t>(byteCount));
                 return true;
             }
             return false;
@@ -125,6 +128,7 @@ namespace AZ
             if (ValidateConstantBufferAccess(byteOffset, byteCount))
             {
                 memcpy(&m_constantData[byteOffset], bytes, byteCount);
+                MarkDirty(aznumeric_cast<uint32_t>(byteOffset), aznumeric_cast<uint32_t>(byteOffset + byteCount));
                 return true;
             }
             return false;
@@ -189,6 +193,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 transform.StoreToRowMajorFloat12(matrixValue);
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
             }
@@ -205,6 +210,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToRowMajorFloat12(matrixValue);
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
             }
@@ -221,6 +227,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToRowMajorFloat16(matrixValue);
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
 
@@ -237,6 +244,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat2(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
             }
@@ -253,6 +261,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat3(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
             }
@@ -268,6 +277,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat4(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
             }
@@ -283,6 +293,7 @@ namespace AZ
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
                 float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
                 value.StoreToFloat4(vectorValue);
+                MarkDirty(interval.m_min, interval.m_max);
 
                 return true;
             }
@@ -428,6 +439,29 @@ namespace AZ
             return m_constantData;
         }
 
+        Interval ConstantsData::GetDirtyInterval() const
+        {
+            return m_dirtyInterval;
+        }
+
+        void ConstantsData::ResetDirtyInterval()
+        {
+            m_dirtyInterval = Interval();
+        }
+
+        void ConstantsData::MarkDirty(uint32_t min, uint32_t max)
+        {
+            if (m_dirtyInterval.m_min == m_dirtyInterval.m_max)
+            {
+                m_dirtyInterval = Interval(min, max);
+            }
+            else
+            {
+                m_dirtyInterval.m_min = AZStd::min(m_dirtyInterval.m_min, min);
+                m_dirtyInterval.m_max = AZStd::max(m_dirtyInterval.m_max, max);
+            }
+        }
+
         const ConstantsLayout* ConstantsData::GetLayout() const
         {
             AZ_Assert(m_layout, "Constants layout is null");
@@ -7,6 +7,8 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -26,7 +28,129 @@ namespace AZ
             return DrawListView(&drawList[itemOffset], itemCount);
         }
 
+        namespace
+        {
+            struct RadixSortEntry
+            {
+                uint64_t m_sortKey;
+                uint32_t m_depthKey;
+                uint32_t m_index;
+            };
+
+            // Digits 0-3 are the bytes of the depth key and digits 4-11 the bytes of the sort key, least significant first.
+            constexpr uint32_t RadixDepthDigitCount = 4;
+            constexpr uint32_t RadixDigitCount = RadixDepthDigitCount + 8;
+            constexpr uint32_t RadixBucketCount = 256;
+
+            // Maps a float to an unsigned integer with the same ordering, so it can be sorted bytewise.
+            uint32_t GetOrderedDepthKey(float depth, bool reverseDepth)
+            {
+                uint32_t bits;
+                memcpy(&bits, &depth, sizeof(bits));
+                const uint32_t orderedBits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+                return reverseDepth ? ~orderedBits : orderedBits;
+            }
+
+            // The sort key is signed, so flip the sign bit to get the unsigned ordering.
+            uint64_t GetOrderedSortKey(DrawItemSortKey sortKey)
+            {
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t{ 1 } << 63);
+            }
+
+            uint32_t GetRadixDigit(const RadixSortEntry& entry, uint32_t digit)
+            {
+                if (digit < RadixDepthDigitCount)
+                {
+                    return (entry.m_depthKey >> (digit * 8)) & 0xFF;
+                }
+                return static_cast<uint32_t>(entry.m_sortKey >> ((digit - RadixDepthDigitCount) * 8)) & 0xFF;
+            }
+        }
+
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+        {
+            if (drawList.size() >= DrawListRadixSortMinItemCount)
+            {
+                RadixSortDrawList(drawList, sortType);
+            }
+            else
+            {
+                ComparisonSortDrawList(drawList, sortType);
+            }
+        }
+
+        void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+        {
+            const size_t itemCount = drawList.size();
+            if (itemCount < 2)
+            {
+                return;
+            }
+
+            AZ_Assert(itemCount <= AZStd::numeric_limits<uint32_t>::max(), "Draw list is too large to be radix sorted.");
+
+            const bool reverseDepth = sortType == DrawListSortType::KeyThenReverseDepth || sortType == DrawListSortType::ReverseDepthThenKey;
+            const bool keyFirst = sortType == DrawListSortType::KeyThenDepth || sortType == DrawListSortType::KeyThenReverseDepth;
+
+            // Build the keys and the histograms for all digits in a single pass over the draw items.
+            AZStd::vector<RadixSortEntry> entries(itemCount);
+            AZStd::array<AZStd::array<uint32_t, RadixBucketCount>, RadixDigitCount> histograms = {};
+            for (size_t i = 0; i < itemCount; ++i)
+            {
+                RadixSortEntry& entry = entries[i];
+                entry.m_sortKey = GetOrderedSortKey(drawList[i].m_sortKey);
+                entry.m_depthKey = GetOrderedDepthKey(drawList[i].m_depth, reverseDepth);
+                entry.m_index = static_cast<uint32_t>(i);
+
+                for (uint32_t digit = 0; digit < RadixDigitCount; ++digit)
+                {
+                    ++histograms[digit][GetRadixDigit(entry, digit)];
+                }
+            }
+
+            // LSD radix sort: the secondary key is sorted first, then the primary key. Each pass is stable.
+            AZStd::array<uint32_t, RadixDigitCount> digitOrder;
+            for (uint32_t pass = 0; pass < RadixDigitCount; ++pass)
+            {
+                digitOrder[pass] = keyFirst ? pass : (pass + RadixDepthDigitCount) % RadixDigitCount;
+            }
+
+            AZStd::vector<RadixSortEntry> scratch(itemCount);
+            for (const uint32_t digit : digitOrder)
+            {
+                AZStd::array<uint32_t, RadixBucketCount>& histogram = histograms[digit];
+
+                // Skip passes where all items share the same digit, they would not change the order.
+                if (histogram[GetRadixDigit(entries[0], digit)] == itemCount)
+                {
+                    continue;
+                }
+
+                uint32_t offset = 0;
+                for (uint32_t& bucket : histogram)
+                {
+                    const uint32_t count = bucket;
+                    bucket = offset;
+                    offset += count;
+                }
+
+                for (const RadixSortEntry& entry : entries)
+                {
+                    scratch[histogram[GetRadixDigit(entry, digit)]++] = entry;
+                }
+                entries.swap(scratch);
+            }
+
+            DrawList sortedDrawList;
+            sortedDrawList.reserve(itemCount);
+            for (const RadixSortEntry& entry : entries)
+            {
+                sortedDrawList.push_back(drawList[entry.m_index]);
+            }
+            drawList = AZStd::move(sortedDrawList);
+        }
+
+        void ComparisonSortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
             switch (sortType)
             {
@@ -8,6 +8,9 @@
 #include <Atom/RHI/DrawListContext.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -89,26 +92,79 @@ namespace AZ
         void DrawListContext::FinalizeLists()
         {
             AZ_PROFILE_SCOPE(RHI, "DrawListContext: FinalizeLists");
-            for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
-            {
-                if (m_drawListMask[i])
-                {
-                    m_mergedListsByTag[i].clear();
-                }
-            }
+            MergeLists(false);
+        }
 
-            m_threadListsByTag.ForEach([this](DrawListsByTag& drawListsByTag)
+        void DrawListContext::FinalizeListsParallel()
+        {
+            AZ_PROFILE_SCOPE(RHI, "DrawListContext: FinalizeListsParallel");
+            MergeLists(true);
+        }
+
+        void DrawListContext::MergeLists(bool mergeInParallel)
+        {
+            // Visit all thread lists at once. Knowing all of them up front allows reserving the exact size of
+            // each merged list, and merging each tag independently without any shared state between tags.
+            m_threadListsByTag.ForAll([this, mergeInParallel](AZStd::span<const AZStd::unique_ptr<DrawListsByTag>> threadListsByTag)
             {
-                for (size_t i = 0; i < drawListsByTag.size(); ++i)
+                size_t totalItemCount = 0;
+                AZStd::fixed_vector<size_t, Limits::Pipeline::DrawListTagCountMax> tagsToMerge;
+                for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
                 {
                     if (m_drawListMask[i])
                     {
-                        auto& sourceList = drawListsByTag[i];
-                        auto& resultList = m_mergedListsByTag[i];
+                        size_t itemCount = 0;
+                        for (const AZStd::unique_ptr<DrawListsByTag>& threadLists : threadListsByTag)
+                        {
+                            itemCount += (*threadLists)[i].size();
+                        }
+
+                        m_mergedListsByTag[i].clear();
+                        if (itemCount > 0)
+                        {
+                            m_mergedListsByTag[i].reserve(itemCount);
+                            tagsToMerge.push_back(i);
+                            totalItemCount += itemCount;
+                        }
+                    }
+                }
 
+                const auto mergeTag = [this, threadListsByTag](size_t tagIndex)
+                {
+                    DrawList& resultList = m_mergedListsByTag[tagIndex];
+                    for (const AZStd::unique_ptr<DrawListsByTag>& threadLists : threadListsByTag)
+                    {
+                        DrawList& sourceList = (*threadLists)[tagIndex];
                         resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
                         sourceList.clear();
                     }
+                };
+
+                AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+                if (mergeInParallel && tagsToMerge.size() > 1 && totalItemCount >= ParallelMergeMinItemCount &&
+                    taskGraphActive && taskGraphActive->IsTaskGraphActive())
+                {
+                    AZ::TaskGraph taskGraph{ "DrawList Merge" };
+                    AZ::TaskDescriptor mergeDescriptor{ "RHI_DrawListContext_MergeDrawList", "Graphics" };
+                    for (const size_t tagIndex : tagsToMerge)
+                    {
+                        taskGraph.AddTask(mergeDescriptor, [&mergeTag, tagIndex]()
+                        {
+                            AZ_PROFILE_SCOPE(RHI, "DrawListContext: MergeDrawList");
+                            mergeTag(tagIndex);
+                        });
+                    }
+
+                    AZ::TaskGraphEvent finishedEvent{ "DrawList Merge Wait" };
+                    taskGraph.Submit(&finishedEvent);
+                    finishedEvent.Wait();
+                }
+                else
+                {
+                    for (const size_t tagIndex : tagsToMerge)
+                    {
+                        mergeTag(tagIndex);
+                    }
                 }
             });
         }
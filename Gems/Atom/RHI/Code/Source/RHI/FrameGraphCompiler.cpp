@@ -17,14 +17,19 @@
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/Utils/TypeHash.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(bool, r_frameGraphCompileCache, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Reuse the transient attachment compilation of the previous frame when the frame graph structure is unchanged.");
+
         ResultCode FrameGraphCompiler::Init(Device& device)
         {
             if (Validation::IsEnabled())
@@ -62,6 +67,7 @@ namespace AZ
                 m_bufferViewCache.Clear();
                 m_imageReverseLookupHash.clear();
                 m_bufferReverseLookupHash.clear();
+                m_compileCache = {};
                
                 ShutdownInternal();
                 DeviceObject::Shutdown();
@@ -94,6 +100,11 @@ namespace AZ
             return AZ::Success();
         }
 
+        bool FrameGraphCompiler::WasLastCompileCached() const
+        {
+            return m_lastCompileCached;
+        }
+
         /**
          * The entry point for FrameGraph compilation. Frame Graph compilation is broken into several phases:
          * 
@@ -107,7 +118,8 @@ namespace AZ
          *      2) Transient Attachment Compilation:
          *
          *          This phase takes the transient attachment set and acquires physical resources from the Transient
-         *          Attachment Pool. The resources are assigned to the attachments.
+         *          Attachment Pool. The resources are assigned to the attachments. If the structure of the graph matches
+         *          the previous compile, the attachment lifetimes and allocation commands are taken from the compile cache.
          *
          *      3) Resource View Compilation:
          *
@@ -130,6 +142,7 @@ namespace AZ
             }
 
             FrameGraph& frameGraph = *request.m_frameGraph;
+            m_lastCompileCached = false;
 
             /// [Phase 1] Compiles the cross-queue scope graph.
             CompileQueueCentricScopeGraph(frameGraph, request.m_compileFlags);
@@ -482,7 +495,34 @@ namespace AZ
 
             AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: CompileTransientAttachments");
 
-            ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+            bool isCacheHit = false;
+            if (r_frameGraphCompileCache)
+            {
+                const HashValue64 structureHash = CalculateStructureHash(frameGraph, compileFlags);
+                isCacheHit = m_compileCache.m_isValid &&
+                    m_compileCache.m_structureHash == structureHash &&
+                    m_compileCache.m_transientAttachmentPool == &transientAttachmentPool;
+
+                if (!isCacheHit)
+                {
+                    m_compileCache = {};
+                    m_compileCache.m_structureHash = structureHash;
+                    m_compileCache.m_transientAttachmentPool = &transientAttachmentPool;
+                }
+            }
+            else
+            {
+                m_compileCache.m_isValid = false;
+            }
+
+            if (isCacheHit)
+            {
+                ApplyCachedTransientAttachmentLifetimes(frameGraph);
+            }
+            else
+            {
+                ExtendTransientAttachmentAsyncQueueLifetimes(frameGraph, compileFlags);
+            }
 
             /**
              * Builds a sortable key. It iterates each scope and performs deactivations
@@ -508,6 +548,11 @@ namespace AZ
                     m_bits.m_attachmentIndex = attachmentIndex;
                 }
 
+                explicit Command(uint32_t command)
+                {
+                    m_command = command;
+                }
+
                 bool operator < (Command rhs) const
                 {
                     return m_command < rhs.m_command;
@@ -548,7 +593,14 @@ namespace AZ
             AZStd::vector<Command> commands;
             commands.reserve((transientBufferGraphAttachments.size() + transientImageGraphAttachments.size()) * 2);
 
-            if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
+            if (isCacheHit)
+            {
+                for (uint32_t command : m_compileCache.m_transientAttachmentCommands)
+                {
+                    commands.emplace_back(command);
+                }
+            }
+            else if (CheckBitsAny(compileFlags, FrameSchedulerCompileFlags::DisableAttachmentAliasing))
             {
                 const uint32_t ScopeIndexFirst = 0;
                 const uint32_t ScopeIndexLast = static_cast<uint32_t>(scopes.size() - 1);
@@ -590,7 +642,10 @@ namespace AZ
                 }
             }
 
-            AZStd::sort(commands.begin(), commands.end());
+            if (!isCacheHit)
+            {
+                AZStd::sort(commands.begin(), commands.end());
+            }
 
             auto processCommands = [&](TransientAttachmentPoolCompileFlags compileFlags, TransientAttachmentStatistics::MemoryUsage* memoryHint = nullptr)
             {
@@ -701,9 +756,17 @@ namespace AZ
             // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
             if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
             {
-                // First pass to calculate size needed.
-                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                if (isCacheHit && m_compileCache.m_memoryUsage)
+                {
+                    // The size needed only depends on the graph structure, so the first pass can be skipped.
+                    memoryUsage = m_compileCache.m_memoryUsage;
+                }
+                else
+                {
+                    // First pass to calculate size needed.
+                    processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                    memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+                }
             }
 
             // Second pass uses the information about memory usage
@@ -713,6 +776,110 @@ namespace AZ
                 poolCompileFlags |= TransientAttachmentPoolCompileFlags::GatherStatistics;
             }
             processCommands(poolCompileFlags, memoryUsage ? &memoryUsage.value() : nullptr);
+
+            if (isCacheHit)
+            {
+                m_lastCompileCached = true;
+            }
+            else if (r_frameGraphCompileCache)
+            {
+                m_compileCache.m_transientAttachmentLifetimes.reserve(transientBufferGraphAttachments.size() + transientImageGraphAttachments.size());
+                for (const BufferFrameAttachment* transientBuffer : transientBufferGraphAttachments)
+                {
+                    m_compileCache.m_transientAttachmentLifetimes.emplace_back(transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex());
+                }
+                for (const ImageFrameAttachment* transientImage : transientImageGraphAttachments)
+                {
+                    m_compileCache.m_transientAttachmentLifetimes.emplace_back(transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex());
+                }
+
+                m_compileCache.m_transientAttachmentCommands.reserve(commands.size());
+                for (Command command : commands)
+                {
+                    m_compileCache.m_transientAttachmentCommands.push_back(command.m_command);
+                }
+
+                m_compileCache.m_memoryUsage = memoryUsage;
+                m_compileCache.m_isValid = true;
+            }
+        }
+
+        HashValue64 FrameGraphCompiler::CalculateStructureHash(const FrameGraph& frameGraph, FrameSchedulerCompileFlags compileFlags)
+        {
+            AZ_PROFILE_FUNCTION(RHI);
+
+            HashValue64 hash = TypeHash64(compileFlags);
+
+            const auto& scopes = frameGraph.GetScopes();
+            hash = TypeHash64(scopes.size(), hash);
+            for (const Scope* scope : scopes)
+            {
+                hash = TypeHash64(scope->GetId().GetHash(), hash);
+                hash = TypeHash64(scope->GetHardwareQueueClass(), hash);
+
+                // Explicit scope dependencies are not visible through the attachments, so the edges are hashed as well.
+                const auto& consumers = frameGraph.GetConsumers(*scope);
+                hash = TypeHash64(consumers.size(), hash);
+                for (const Scope* consumer : consumers)
+                {
+                    hash = TypeHash64(consumer->GetIndex(), hash);
+                }
+
+                const auto& scopeAttachments = scope->GetAttachments();
+                hash = TypeHash64(scopeAttachments.size(), hash);
+                for (const ScopeAttachment* scopeAttachment : scopeAttachments)
+                {
+                    hash = TypeHash64(scopeAttachment->GetFrameAttachment().GetId().GetHash(), hash);
+                    for (const ScopeAttachmentUsageAndAccess& usageAndAccess : scopeAttachment->GetUsageAndAccess())
+                    {
+                        hash = TypeHash64(usageAndAccess.m_usage, hash);
+                        hash = TypeHash64(usageAndAccess.m_access, hash);
+                    }
+                }
+            }
+
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+
+            const auto& transientBuffers = attachmentDatabase.GetTransientBufferAttachments();
+            hash = TypeHash64(transientBuffers.size(), hash);
+            for (const BufferFrameAttachment* transientBuffer : transientBuffers)
+            {
+                hash = TypeHash64(transientBuffer->GetId().GetHash(), hash);
+                hash = transientBuffer->GetBufferDescriptor().GetHash(hash);
+            }
+
+            const auto& transientImages = attachmentDatabase.GetTransientImageAttachments();
+            hash = TypeHash64(transientImages.size(), hash);
+            for (const ImageFrameAttachment* transientImage : transientImages)
+            {
+                hash = TypeHash64(transientImage->GetId().GetHash(), hash);
+                hash = TypeHash64(transientImage->GetSupportedQueueMask(), hash);
+                hash = transientImage->GetImageDescriptor().GetHash(hash);
+            }
+
+            return hash;
+        }
+
+        void FrameGraphCompiler::ApplyCachedTransientAttachmentLifetimes(FrameGraph& frameGraph) const
+        {
+            const auto& scopes = frameGraph.GetScopes();
+            const FrameGraphAttachmentDatabase& attachmentDatabase = frameGraph.GetAttachmentDatabase();
+            const auto& lifetimes = m_compileCache.m_transientAttachmentLifetimes;
+
+            size_t lifetimeIndex = 0;
+            for (FrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                transientBuffer->m_firstScope = scopes[lifetimes[lifetimeIndex].first];
+                transientBuffer->m_lastScope = scopes[lifetimes[lifetimeIndex].second];
+                ++lifetimeIndex;
+            }
+
+            for (FrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                transientImage->m_firstScope = scopes[lifetimes[lifetimeIndex].first];
+                transientImage->m_lastScope = scopes[lifetimes[lifetimeIndex].second];
+                ++lifetimeIndex;
+            }
         }
                     
         ImageView* FrameGraphCompiler::GetImageViewFromLocalCache(Image* image, const ImageViewDescriptor& imageViewDescriptor)
@@ -377,6 +377,15 @@ namespace AZ
                 resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(compileAllLambda)>(compileAllLambda);
             }
 
+            // Report the amount of constant data uploaded by this frame's compiles.
+            uint64_t constantDataBytesUpdated = 0;
+            const auto gatherStatisticsFunction = [&constantDataBytesUpdated](ShaderResourceGroupPool* srgPool)
+            {
+                constantDataBytesUpdated += srgPool->GetAndResetConstantDataBytesUpdated();
+            };
+            resourcePoolDatabase.ForEachShaderResourceGroupPool<decltype(gatherStatisticsFunction)>(gatherStatisticsFunction);
+            AZ_PROFILE_DATAPOINT(RHI, aznumeric_cast<double>(constantDataBytesUpdated), L"RHI/SrgConstantDataBytesUpdated");
+
             //It is possible for certain back ends to run out of SRG memory (due to fragmentation) in which case
             //we try to compact and re-compile SRGs.
             [[maybe_unused]] RHI::ResultCode resultCode = m_device->CompactSRGMemory();
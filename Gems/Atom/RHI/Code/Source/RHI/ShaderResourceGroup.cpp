@@ -14,6 +14,27 @@ namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            bool IsConstantDataIntervalEmpty(const Interval& interval)
+            {
+                return interval.m_min == interval.m_max;
+            }
+
+            Interval MergeConstantDataIntervals(const Interval& lhs, const Interval& rhs)
+            {
+                if (IsConstantDataIntervalEmpty(lhs))
+                {
+                    return rhs;
+                }
+                if (IsConstantDataIntervalEmpty(rhs))
+                {
+                    return lhs;
+                }
+                return Interval(AZStd::min(lhs.m_min, rhs.m_min), AZStd::max(lhs.m_max, rhs.m_max));
+            }
+        }
+
         void ShaderResourceGroup::Compile(const ShaderResourceGroupData& groupData, CompileMode compileMode /*= CompileMode::Async*/)
         {
             switch (compileMode)
@@ -58,6 +79,7 @@ namespace AZ
         void ShaderResourceGroup::SetData(const ShaderResourceGroupData& data)
         {
             m_data = data;
+            MergeConstantDataDirtyInterval(data);
             uint32_t sourceUpdateMask = data.GetUpdateMask();
             
             //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
@@ -118,6 +140,57 @@ namespace AZ
             m_viewHash[viewName] = viewHash;
         }
     
+        Interval ShaderResourceGroup::GetConstantDataUpdateInterval() const
+        {
+            return m_constantDataUpdateInterval;
+        }
+
+        void ShaderResourceGroup::MergeConstantDataDirtyInterval(const ShaderResourceGroupData& data)
+        {
+            m_pendingConstantDataInterval = MergeConstantDataIntervals(m_pendingConstantDataInterval, data.GetConstantsData().GetDirtyInterval());
+        }
+
+        void ShaderResourceGroup::UpdateConstantDataUpdateInterval(bool isConstantDataCompiled, bool forceFullUpdate)
+        {
+            const uint32_t historyIndex = m_constantDataIntervalHistoryIndex;
+            m_constantDataIntervalHistoryIndex = (m_constantDataIntervalHistoryIndex + 1) % RHI::Limits::Device::FrameCountMax;
+
+            // When the constants are not compiled, every platform copy already holds the current data
+            // (see m_updateMaskResetLatency), so the pending range is kept for the next compile that uploads constants.
+            if (!isConstantDataCompiled)
+            {
+                m_constantDataIntervalHistory[historyIndex] = Interval();
+                m_constantDataUpdateInterval = Interval();
+                return;
+            }
+
+            m_constantDataIntervalHistory[historyIndex] = m_pendingConstantDataInterval;
+            m_pendingConstantDataInterval = Interval();
+
+            if (forceFullUpdate)
+            {
+                m_constantDataUpdateInterval = Interval(0, aznumeric_cast<uint32_t>(m_data.GetConstantData().size()));
+                return;
+            }
+
+            // The platform copy written by this compile was last written FrameCountMax compiles ago,
+            // so it is missing every range written since then.
+            Interval updateInterval;
+            for (const Interval& interval : m_constantDataIntervalHistory)
+            {
+                updateInterval = MergeConstantDataIntervals(updateInterval, interval);
+            }
+            m_constantDataUpdateInterval = updateInterval;
+        }
+
+        void ShaderResourceGroup::ResetConstantDataUpdateTracking()
+        {
+            m_constantDataIntervalHistory.fill(Interval());
+            m_constantDataIntervalHistoryIndex = 0;
+            m_constantDataUpdateInterval = Interval();
+            m_pendingConstantDataInterval = Interval(0, aznumeric_cast<uint32_t>(m_data.GetConstantData().size()));
+        }
+
         void ShaderResourceGroup::ReportMemoryUsage(MemoryStatisticsBuilder& builder) const
         {
             AZ_UNUSED(builder);
@@ -392,6 +392,7 @@ namespace AZ
         void ShaderResourceGroupData::ResetUpdateMask()
         {
             m_updateMask = 0;
+            m_constantsData.ResetDirtyInterval();
         }
     
         void ShaderResourceGroupData::SetBindlessViews(
@@ -72,6 +72,7 @@ namespace AZ
 
                 // Pre-initialize the data so that we can build view diffs later.
                 group.m_data = ShaderResourceGroupData(layout);
+                group.ResetConstantDataUpdateTracking();
 
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
@@ -128,6 +129,14 @@ namespace AZ
 
                 QueueForCompileNoLock(shaderResourceGroup);
             }
+            else if (groupData.GetConstantsData().GetDirtyInterval().m_max > groupData.GetConstantsData().GetDirtyInterval().m_min)
+            {
+                // The data is dropped, but the caller resets its dirty range. Remember which constants were written
+                // so they are uploaded once the data is provided again.
+                shaderResourceGroup.MergeConstantDataDirtyInterval(groupData);
+                shaderResourceGroup.EnableRhiResourceTypeCompilation(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask);
+                shaderResourceGroup.ResetResourceTypeIteration(ShaderResourceGroupData::ResourceType::ConstantData);
+            }
         }
 
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
@@ -335,6 +344,19 @@ namespace AZ
         ResultCode ShaderResourceGroupPool::CompileGroup(ShaderResourceGroup& shaderResourceGroup,
                                                          const ShaderResourceGroupData& shaderResourceGroupData)
         {
+            uint32_t constantDataBytesUpdated = 0;
+            const ResultCode resultCode = CompileGroup(shaderResourceGroup, shaderResourceGroupData, constantDataBytesUpdated);
+            m_constantDataBytesUpdated += constantDataBytesUpdated;
+            return resultCode;
+        }
+
+        ResultCode ShaderResourceGroupPool::CompileGroup(
+            ShaderResourceGroup& shaderResourceGroup,
+            const ShaderResourceGroupData& shaderResourceGroupData,
+            uint32_t& constantDataBytesUpdated)
+        {
+            constantDataBytesUpdated = 0;
+
             if (r_DisablePartialSrgCompilation)
             {
                 //Reset m_rhiUpdateMask for all resource types which will disable partial SRG compilation
@@ -350,6 +372,13 @@ namespace AZ
             // Check if any part of the Srg was updated before trying to compile it
             if (shaderResourceGroup.IsAnyResourceTypeUpdated())
             {
+                const bool isConstantDataCompiled = HasConstants() &&
+                    shaderResourceGroup.IsResourceTypeEnabledForCompilation(
+                        static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask));
+                shaderResourceGroup.UpdateConstantDataUpdateInterval(isConstantDataCompiled, r_DisablePartialSrgCompilation);
+
+                constantDataBytesUpdated = GetConstantDataBytesUpdatedInternal(shaderResourceGroup, shaderResourceGroupData);
+
                 ResultCode resultCode = CompileGroupInternal(shaderResourceGroup, shaderResourceGroupData);
                 
                 //Reset update mask if the latency check has been fulfilled
@@ -367,14 +396,32 @@ namespace AZ
                 interval.m_max <= static_cast<uint32_t>(m_groupsToCompile.size()),
                 "You must specify a valid interval for compilation");
 
+            uint64_t constantDataBytesUpdated = 0;
             for (uint32_t i = interval.m_min; i < interval.m_max; ++i)
             {
                 ShaderResourceGroup* group = m_groupsToCompile[i];
                 RHI_PROFILE_SCOPE_VERBOSE("CompileGroupsForInterval %s", group->GetName().GetCStr());
 
-                CompileGroup(*group, group->GetData());
+                uint32_t groupConstantDataBytesUpdated = 0;
+                CompileGroup(*group, group->GetData(), groupConstantDataBytesUpdated);
                 group->m_isQueuedForCompile = false;
+                constantDataBytesUpdated += groupConstantDataBytesUpdated;
             }
+
+            // Intervals are compiled in parallel, so the counter is only touched once per interval.
+            m_constantDataBytesUpdated += constantDataBytesUpdated;
+        }
+
+        uint64_t ShaderResourceGroupPool::GetAndResetConstantDataBytesUpdated()
+        {
+            return m_constantDataBytesUpdated.exchange(0);
+        }
+
+        uint32_t ShaderResourceGroupPool::GetConstantDataBytesUpdatedInternal(
+            const ShaderResourceGroup& shaderResourceGroup, [[maybe_unused]] const ShaderResourceGroupData& shaderResourceGroupData) const
+        {
+            const Interval updateInterval = shaderResourceGroup.GetConstantDataUpdateInterval();
+            return updateInterval.m_max - updateInterval.m_min;
         }
 
         ResultCode ShaderResourceGroupPool::InitInternal(Device&, const ShaderResourceGroupPoolDescriptor&)
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+
+#include <Atom/RHI/DrawList.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/limits.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    namespace
+    {
+        constexpr RHI::DrawListSortType s_drawListSortTypes[] = {
+            RHI::DrawListSortType::KeyThenDepth,
+            RHI::DrawListSortType::KeyThenReverseDepth,
+            RHI::DrawListSortType::DepthThenKey,
+            RHI::DrawListSortType::ReverseDepthThenKey
+        };
+
+        // Builds a draw list with a small set of sort keys and depths, so that there are plenty of ties,
+        // including negative sort keys and negative depths.
+        RHI::DrawList BuildDrawList(const AZStd::vector<RHI::DrawItem>& drawItems, uint64_t seed, size_t keyCount, size_t depthCount)
+        {
+            SimpleLcgRandom random(seed);
+
+            RHI::DrawList drawList;
+            drawList.reserve(drawItems.size());
+            for (const RHI::DrawItem& drawItem : drawItems)
+            {
+                const RHI::DrawItemSortKey sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % keyCount) - static_cast<RHI::DrawItemSortKey>(keyCount / 2);
+
+                RHI::DrawItemProperties properties(&drawItem, sortKey);
+                properties.m_depth = static_cast<float>(random.GetRandom() % depthCount) * 0.25f - static_cast<float>(depthCount / 8) + 0.125f;
+                drawList.push_back(properties);
+            }
+            return drawList;
+        }
+    }
+
+    class DrawListSortTest
+        : public RHITestFixture
+    {
+    protected:
+        void ExpectSameOrder(const RHI::DrawList& drawList, const RHI::DrawList& expectedDrawList)
+        {
+            ASSERT_EQ(drawList.size(), expectedDrawList.size());
+            for (size_t i = 0; i < drawList.size(); ++i)
+            {
+                // The comparison sort is not stable, so only the sort criteria are compared.
+                EXPECT_EQ(drawList[i].m_sortKey, expectedDrawList[i].m_sortKey);
+                EXPECT_EQ(drawList[i].m_depth, expectedDrawList[i].m_depth);
+            }
+        }
+
+        void TestMatchesComparisonSort(size_t itemCount, size_t keyCount, size_t depthCount)
+        {
+            AZStd::vector<RHI::DrawItem> drawItems(itemCount);
+
+            for (RHI::DrawListSortType sortType : s_drawListSortTypes)
+            {
+                RHI::DrawList radixSorted = BuildDrawList(drawItems, 1234, keyCount, depthCount);
+                RHI::DrawList comparisonSorted = radixSorted;
+
+                RHI::RadixSortDrawList(radixSorted, sortType);
+                RHI::ComparisonSortDrawList(comparisonSorted, sortType);
+
+                ExpectSameOrder(radixSorted, comparisonSorted);
+            }
+        }
+    };
+
+    TEST_F(DrawListSortTest, RadixSort_EmptyAndSingleItem_Unchanged)
+    {
+        RHI::DrawList drawList;
+        RHI::RadixSortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+        EXPECT_TRUE(drawList.empty());
+
+        RHI::DrawItem drawItem;
+        drawList.emplace_back(&drawItem, -5);
+        RHI::RadixSortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+        ASSERT_EQ(drawList.size(), 1);
+        EXPECT_EQ(drawList[0].m_item, &drawItem);
+    }
+
+    TEST_F(DrawListSortTest, RadixSort_ManyTies_MatchesComparisonSort)
+    {
+        TestMatchesComparisonSort(1000, 8, 16);
+    }
+
+    TEST_F(DrawListSortTest, RadixSort_WideKeyRange_MatchesComparisonSort)
+    {
+        TestMatchesComparisonSort(5000, 100000, 4096);
+    }
+
+    TEST_F(DrawListSortTest, RadixSort_UniformKeys_MatchesComparisonSort)
+    {
+        TestMatchesComparisonSort(500, 1, 64);
+    }
+
+    TEST_F(DrawListSortTest, RadixSort_ExtremeKeys_MatchesComparisonSort)
+    {
+        AZStd::vector<RHI::DrawItem> drawItems(6);
+        const RHI::DrawItemSortKey sortKeys[] = {
+            AZStd::numeric_limits<RHI::DrawItemSortKey>::max(), 0, -1, AZStd::numeric_limits<RHI::DrawItemSortKey>::min(), 1, -1
+        };
+        const float depths[] = { 1.0f, -1000.0f, 0.5f, 3.0f, -0.5f, -2.0f };
+
+        for (RHI::DrawListSortType sortType : s_drawListSortTypes)
+        {
+            RHI::DrawList radixSorted;
+            for (size_t i = 0; i < drawItems.size(); ++i)
+            {
+                RHI::DrawItemProperties properties(&drawItems[i], sortKeys[i]);
+                properties.m_depth = depths[i];
+                radixSorted.push_back(properties);
+            }
+            RHI::DrawList comparisonSorted = radixSorted;
+
+            RHI::RadixSortDrawList(radixSorted, sortType);
+            RHI::ComparisonSortDrawList(comparisonSorted, sortType);
+
+            ExpectSameOrder(radixSorted, comparisonSorted);
+        }
+    }
+
+    TEST_F(DrawListSortTest, RadixSort_EqualItems_IsStable)
+    {
+        AZStd::vector<RHI::DrawItem> drawItems(300);
+
+        RHI::DrawList drawList;
+        for (const RHI::DrawItem& drawItem : drawItems)
+        {
+            RHI::DrawItemProperties properties(&drawItem, 7);
+            properties.m_depth = 2.0f;
+            drawList.push_back(properties);
+        }
+
+        RHI::RadixSortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+
+        for (size_t i = 0; i < drawList.size(); ++i)
+        {
+            EXPECT_EQ(drawList[i].m_item, &drawItems[i]);
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class DrawListSortBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            const size_t itemCount = static_cast<size_t>(state.range(0));
+            m_drawItems.resize(itemCount);
+            m_drawList = BuildDrawList(m_drawItems, 1234, 1024, 65536);
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_drawList = {};
+            m_drawItems = {};
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        template<typename SortFunction>
+        void RunSort(benchmark::State& state, SortFunction sortFunction)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                RHI::DrawList drawList = m_drawList;
+                state.ResumeTiming();
+
+                sortFunction(drawList, RHI::DrawListSortType::KeyThenDepth);
+                benchmark::DoNotOptimize(drawList.data());
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        AZStd::vector<RHI::DrawItem> m_drawItems;
+        RHI::DrawList m_drawList;
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, RadixSort)(benchmark::State& state)
+    {
+        RunSort(state, &RHI::RadixSortDrawList);
+    }
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, ComparisonSort)(benchmark::State& state)
+    {
+        RunSort(state, &RHI::ComparisonSortDrawList);
+    }
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, RadixSort)->Arg(1000)->Arg(10000)->Arg(100000)->Arg(500000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, ComparisonSort)->Arg(1000)->Arg(10000)->Arg(100000)->Arg(500000)->Unit(benchmark::kMicrosecond);
+#endif
+}
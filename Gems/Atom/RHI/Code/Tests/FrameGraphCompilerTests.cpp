@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <Tests/Factory.h>
+#include <Tests/Device.h>
+#include <Atom/RHI/BufferFrameAttachment.h>
+#include <Atom/RHI/FrameGraph.h>
+#include <Atom/RHI/FrameGraphCompiler.h>
+#include <Atom/RHI/ImageFrameAttachment.h>
+#include <Atom/RHI/TransientAttachmentPool.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    //! Builds a frame graph of scopes which each create a transient buffer and a transient image,
+    //! and read them again a couple of scopes later. Shared by the compile cache tests and benchmarks.
+    class FrameGraphCompilerTestGraph
+    {
+    public:
+        static const uint32_t ScopeCount = 64;
+        static const uint32_t ScopeReadDistance = 2;
+        static const uint32_t BufferSize = 64;
+        static const uint32_t ImageSize = 16;
+
+        void Init()
+        {
+            m_device = MakeTestDevice();
+
+            m_transientAttachmentPool = RHI::Factory::Get().CreateTransientAttachmentPool();
+            RHI::TransientAttachmentPoolDescriptor poolDescriptor;
+            poolDescriptor.m_bufferBudgetInBytes = 16 * 1024 * 1024;
+            poolDescriptor.m_imageBudgetInBytes = 16 * 1024 * 1024;
+            m_transientAttachmentPool->Init(*m_device, poolDescriptor);
+
+            m_frameGraphCompiler = RHI::Factory::Get().CreateFrameGraphCompiler();
+            m_frameGraphCompiler->Init(*m_device);
+
+            for (uint32_t i = 0; i < ScopeCount; ++i)
+            {
+                m_scopes[i] = RHI::Factory::Get().CreateScope();
+                m_scopes[i]->Init(RHI::ScopeId{ AZStd::string::format("S%d", i) });
+                m_bufferIds[i] = RHI::AttachmentId{ AZStd::string::format("TB%d", i) };
+                m_imageIds[i] = RHI::AttachmentId{ AZStd::string::format("TI%d", i) };
+            }
+        }
+
+        void Shutdown()
+        {
+            m_frameGraph.Clear();
+            for (uint32_t i = 0; i < ScopeCount; ++i)
+            {
+                m_scopes[i] = nullptr;
+            }
+            m_frameGraphCompiler = nullptr;
+            m_transientAttachmentPool = nullptr;
+            m_device = nullptr;
+        }
+
+        //! Builds and compiles a frame. When extendFirstBuffer is set, the first transient buffer is read
+        //! one scope later than usual, which changes the structure of the graph.
+        void CompileFrame(bool extendFirstBuffer)
+        {
+            m_frameGraph.Begin();
+
+            RHI::BufferScopeAttachmentDescriptor bufferDescriptor;
+            bufferDescriptor.m_bufferViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, BufferSize);
+            bufferDescriptor.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::DontCare;
+
+            RHI::ImageScopeAttachmentDescriptor imageDescriptor;
+            imageDescriptor.m_imageViewDescriptor = RHI::ImageViewDescriptor();
+            imageDescriptor.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::DontCare;
+
+            for (uint32_t scopeIdx = 0; scopeIdx < ScopeCount; ++scopeIdx)
+            {
+                m_frameGraph.BeginScope(*m_scopes[scopeIdx]);
+
+                // Read the attachments created a few scopes earlier.
+                if (scopeIdx >= ScopeReadDistance)
+                {
+                    const uint32_t producerIdx = scopeIdx - ScopeReadDistance;
+                    if (producerIdx != 0 || !extendFirstBuffer)
+                    {
+                        bufferDescriptor.m_attachmentId = m_bufferIds[producerIdx];
+                        m_frameGraph.UseShaderAttachment(bufferDescriptor, RHI::ScopeAttachmentAccess::Read);
+                    }
+
+                    imageDescriptor.m_attachmentId = m_imageIds[producerIdx];
+                    m_frameGraph.UseShaderAttachment(imageDescriptor, RHI::ScopeAttachmentAccess::Read);
+                }
+
+                if (extendFirstBuffer && scopeIdx == ScopeReadDistance + 1)
+                {
+                    bufferDescriptor.m_attachmentId = m_bufferIds[0];
+                    m_frameGraph.UseShaderAttachment(bufferDescriptor, RHI::ScopeAttachmentAccess::Read);
+                }
+
+                // Create and write the attachments of this scope.
+                m_frameGraph.GetAttachmentDatabase().CreateTransientBuffer(RHI::TransientBufferDescriptor{
+                    m_bufferIds[scopeIdx], RHI::BufferDescriptor(RHI::BufferBindFlags::ShaderReadWrite, BufferSize) });
+                bufferDescriptor.m_attachmentId = m_bufferIds[scopeIdx];
+                m_frameGraph.UseShaderAttachment(bufferDescriptor, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                m_frameGraph.GetAttachmentDatabase().CreateTransientImage(RHI::TransientImageDescriptor{
+                    m_imageIds[scopeIdx],
+                    RHI::ImageDescriptor::Create2D(RHI::ImageBindFlags::ShaderReadWrite, ImageSize, ImageSize, RHI::Format::R8G8B8A8_UNORM) });
+                imageDescriptor.m_attachmentId = m_imageIds[scopeIdx];
+                m_frameGraph.UseShaderAttachment(imageDescriptor, RHI::ScopeAttachmentAccess::ReadWrite);
+
+                m_frameGraph.EndScope();
+            }
+
+            m_frameGraph.End();
+
+            RHI::FrameGraphCompileRequest request;
+            request.m_frameGraph = &m_frameGraph;
+            request.m_transientAttachmentPool = m_transientAttachmentPool.get();
+            m_frameGraphCompiler->Compile(request);
+        }
+
+        //! Returns the first / last scope index of every transient attachment of the last compiled frame.
+        AZStd::vector<AZStd::pair<uint32_t, uint32_t>> GetTransientAttachmentLifetimes() const
+        {
+            AZStd::vector<AZStd::pair<uint32_t, uint32_t>> lifetimes;
+            const RHI::FrameGraphAttachmentDatabase& attachmentDatabase = m_frameGraph.GetAttachmentDatabase();
+            for (const RHI::BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                lifetimes.emplace_back(transientBuffer->GetFirstScope()->GetIndex(), transientBuffer->GetLastScope()->GetIndex());
+            }
+            for (const RHI::ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                lifetimes.emplace_back(transientImage->GetFirstScope()->GetIndex(), transientImage->GetLastScope()->GetIndex());
+            }
+            return lifetimes;
+        }
+
+        //! Returns the id of the last scope using the first transient buffer.
+        RHI::ScopeId GetFirstBufferLastScopeId() const
+        {
+            return m_frameGraph.GetAttachmentDatabase().GetTransientBufferAttachments()[0]->GetLastScope()->GetId();
+        }
+
+        bool AreTransientResourcesAssigned() const
+        {
+            const RHI::FrameGraphAttachmentDatabase& attachmentDatabase = m_frameGraph.GetAttachmentDatabase();
+            for (const RHI::BufferFrameAttachment* transientBuffer : attachmentDatabase.GetTransientBufferAttachments())
+            {
+                if (!transientBuffer->GetBuffer())
+                {
+                    return false;
+                }
+            }
+            for (const RHI::ImageFrameAttachment* transientImage : attachmentDatabase.GetTransientImageAttachments())
+            {
+                if (!transientImage->GetImage())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool WasLastCompileCached() const
+        {
+            return m_frameGraphCompiler->WasLastCompileCached();
+        }
+
+    private:
+        RHI::Ptr<RHI::Device> m_device;
+        RHI::Ptr<RHI::TransientAttachmentPool> m_transientAttachmentPool;
+        RHI::Ptr<RHI::FrameGraphCompiler> m_frameGraphCompiler;
+        RHI::FrameGraph m_frameGraph;
+        RHI::Ptr<RHI::Scope> m_scopes[ScopeCount];
+        RHI::AttachmentId m_bufferIds[ScopeCount];
+        RHI::AttachmentId m_imageIds[ScopeCount];
+    };
+
+    class FrameGraphCompilerTests
+        : public RHITestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            RHITestFixture::SetUp();
+
+            m_rootFactory.reset(aznew Factory());
+            m_graph = AZStd::make_unique<FrameGraphCompilerTestGraph>();
+            m_graph->Init();
+        }
+
+        void TearDown() override
+        {
+            m_graph->Shutdown();
+            m_graph.reset();
+            m_rootFactory.reset();
+
+            RHITestFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<Factory> m_rootFactory;
+        AZStd::unique_ptr<FrameGraphCompilerTestGraph> m_graph;
+    };
+
+    TEST_F(FrameGraphCompilerTests, CompileCache_SameStructure_ReusesTransientAttachmentLifetimes)
+    {
+        m_graph->CompileFrame(false);
+        EXPECT_FALSE(m_graph->WasLastCompileCached());
+        const auto expectedLifetimes = m_graph->GetTransientAttachmentLifetimes();
+
+        for (uint32_t frameIdx = 0; frameIdx < 4; ++frameIdx)
+        {
+            m_graph->CompileFrame(false);
+            EXPECT_TRUE(m_graph->WasLastCompileCached());
+            EXPECT_EQ(m_graph->GetTransientAttachmentLifetimes(), expectedLifetimes);
+            EXPECT_TRUE(m_graph->AreTransientResourcesAssigned());
+        }
+    }
+
+    TEST_F(FrameGraphCompilerTests, CompileCache_StructureChanged_RecompilesTransientAttachments)
+    {
+        m_graph->CompileFrame(false);
+        const auto lifetimes = m_graph->GetTransientAttachmentLifetimes();
+        EXPECT_EQ(m_graph->GetFirstBufferLastScopeId(), RHI::ScopeId{ "S2" });
+
+        // The first transient buffer is now read one scope later.
+        m_graph->CompileFrame(true);
+        EXPECT_FALSE(m_graph->WasLastCompileCached());
+        EXPECT_EQ(m_graph->GetFirstBufferLastScopeId(), RHI::ScopeId{ "S3" });
+        const auto extendedLifetimes = m_graph->GetTransientAttachmentLifetimes();
+
+        m_graph->CompileFrame(true);
+        EXPECT_TRUE(m_graph->WasLastCompileCached());
+        EXPECT_EQ(m_graph->GetTransientAttachmentLifetimes(), extendedLifetimes);
+        EXPECT_EQ(m_graph->GetFirstBufferLastScopeId(), RHI::ScopeId{ "S3" });
+
+        m_graph->CompileFrame(false);
+        EXPECT_FALSE(m_graph->WasLastCompileCached());
+        EXPECT_EQ(m_graph->GetTransientAttachmentLifetimes(), lifetimes);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    class FrameGraphCompilerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::NameDictionary::Create();
+
+            m_rootFactory.reset(aznew Factory());
+            m_graph = AZStd::make_unique<FrameGraphCompilerTestGraph>();
+            m_graph->Init();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_graph->Shutdown();
+            m_graph.reset();
+            m_rootFactory.reset();
+
+            AZ::SystemTickBus::ClearQueuedEvents();
+            AZ::NameDictionary::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZStd::unique_ptr<Factory> m_rootFactory;
+        AZStd::unique_ptr<FrameGraphCompilerTestGraph> m_graph;
+    };
+
+    BENCHMARK_F(FrameGraphCompilerBenchmark, CompileStableGraph)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_graph->CompileFrame(false);
+        }
+    }
+
+    // Alternates the graph structure every frame, so each compile misses the cache.
+    BENCHMARK_F(FrameGraphCompilerBenchmark, CompileChangingGraph)(benchmark::State& state)
+    {
+        bool extendFirstBuffer = false;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_graph->CompileFrame(extendFirstBuffer);
+            extendFirstBuffer = !extendFirstBuffer;
+        }
+    }
+#endif
+}
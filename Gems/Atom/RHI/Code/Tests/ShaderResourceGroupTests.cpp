@@ -697,6 +697,69 @@ namespace UnitTest
         TestGetConstantVectorsInvalidCase(srgLayout);
     }
 
+    TEST_F(ShaderResourceGroupTests, SRGDataSetConstant_DirtyInterval_CoversWrittenConstants)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ShaderInputConstantIndex vector2index = srgLayout->FindShaderInputConstantIndex(Name("m_vector2"));
+        const RHI::ShaderInputConstantIndex vector4index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+        const RHI::Interval vector2interval = srgLayout->GetConstantsLayout()->GetInterval(vector2index);
+        const RHI::Interval vector4interval = srgLayout->GetConstantsLayout()->GetInterval(vector4index);
+
+        // New data has never been uploaded, so all of it is dirty.
+        RHI::ShaderResourceGroupData srgData(srgLayout.get());
+        EXPECT_EQ(srgData.GetConstantsData().GetDirtyInterval(), RHI::Interval(0, srgLayout->GetConstantDataSize()));
+
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(srgData.GetConstantsData().GetDirtyInterval(), RHI::Interval());
+
+        EXPECT_TRUE(srgData.SetConstant(vector4index, Vector4::CreateOne()));
+        EXPECT_EQ(srgData.GetConstantsData().GetDirtyInterval(), vector4interval);
+
+        EXPECT_TRUE(srgData.SetConstant(vector2index, Vector2::CreateOne()));
+        EXPECT_EQ(srgData.GetConstantsData().GetDirtyInterval(), RHI::Interval(vector2interval.m_min, vector4interval.m_max));
+    }
+
+    TEST_F(ShaderResourceGroupTests, SRGCompile_ConstantDataUpdateInterval_CoversFramesInFlight)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        const RHI::ShaderInputConstantIndex vector4index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+        const RHI::Interval vector4interval = srgLayout->GetConstantsLayout()->GetInterval(vector4index);
+        const RHI::Interval fullInterval(0, srgLayout->GetConstantDataSize());
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        // The first compile uploads all of the constants.
+        RHI::ShaderResourceGroupData srgData(srgLayout.get());
+        EXPECT_TRUE(srgData.SetConstant(vector4index, Vector4::CreateZero()));
+        srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+        srgData.ResetUpdateMask();
+        EXPECT_EQ(srg->GetConstantDataUpdateInterval(), fullInterval);
+        EXPECT_EQ(srgPool->GetAndResetConstantDataBytesUpdated(), fullInterval.m_max);
+        EXPECT_EQ(srgPool->GetAndResetConstantDataBytesUpdated(), 0);
+
+        // The full upload has to reach every copy of the constants before only the modified range is uploaded.
+        for (uint32_t i = 0; i < RHI::Limits::Device::FrameCountMax + 1; ++i)
+        {
+            EXPECT_TRUE(srgData.SetConstant(vector4index, Vector4(static_cast<float>(i))));
+            srg->Compile(srgData, RHI::ShaderResourceGroup::CompileMode::Sync);
+            srgData.ResetUpdateMask();
+
+            const RHI::Interval expectedInterval = (i + 1 < RHI::Limits::Device::FrameCountMax) ? fullInterval : vector4interval;
+            EXPECT_EQ(srg->GetConstantDataUpdateInterval(), expectedInterval);
+            EXPECT_EQ(srgPool->GetAndResetConstantDataBytesUpdated(), expectedInterval.m_max - expectedInterval.m_min);
+        }
+
+        srg = nullptr;
+        srgPool = nullptr;
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayoutHash)
     {
         const Name imageName("m_image");
@@ -10,7 +10,9 @@ set(FILES
     Tests/RHITestFixture.h
     Tests/AllocatorTests.cpp
     Tests/BufferTests.cpp
+    Tests/DrawListSortTests.cpp
     Tests/DrawPacketTests.cpp
+    Tests/FrameGraphCompilerTests.cpp
     Tests/FrameGraphTests.cpp
     Tests/FrameSchedulerTests.cpp
     Tests/HashingTests.cpp
@@ -207,7 +207,15 @@ namespace AZ
             
             if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                // Only the range written since this copy of the constants was last compiled needs to be uploaded.
+                const RHI::Interval updateInterval = groupBase.GetConstantDataUpdateInterval();
+                if (updateInterval.m_max > updateInterval.m_min)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + updateInterval.m_min,
+                        groupData.GetConstantData().data() + updateInterval.m_min,
+                        updateInterval.m_max - updateInterval.m_min);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
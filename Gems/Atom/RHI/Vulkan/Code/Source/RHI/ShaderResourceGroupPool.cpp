@@ -177,6 +177,13 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        uint32_t ShaderResourceGroupPool::GetConstantDataBytesUpdatedInternal(
+            [[maybe_unused]] const RHI::ShaderResourceGroup& groupBase, const RHI::ShaderResourceGroupData& groupData) const
+        {
+            // CompileGroupInternal writes the whole constant buffer on every compile.
+            return aznumeric_cast<uint32_t>(groupData.GetConstantData().size());
+        }
+
         void ShaderResourceGroupPool::ShutdownResourceInternal(RHI::Resource& resourceBase)
         {
             ShaderResourceGroup& group = static_cast<ShaderResourceGroup&>(resourceBase);
@@ -37,6 +37,8 @@ namespace AZ
             RHI::ResultCode InitGroupInternal(RHI::ShaderResourceGroup& groupBase) override;
             void ShutdownInternal() override;
             RHI::ResultCode CompileGroupInternal(RHI::ShaderResourceGroup& groupBase, const RHI::ShaderResourceGroupData& groupData) override;
+            uint32_t GetConstantDataBytesUpdatedInternal(
+                const RHI::ShaderResourceGroup& groupBase, const RHI::ShaderResourceGroupData& groupData) const override;
             void ShutdownResourceInternal(RHI::Resource& resourceBase) override;
             //////////////////////////////////////////////////////////////////////////
 
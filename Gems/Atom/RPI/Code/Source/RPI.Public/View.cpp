@@ -422,7 +422,15 @@ namespace AZ
         void View::FinalizeDrawListsJob(AZ::Job* parentJob)
         {
             AZ_PROFILE_SCOPE(RPI, "View: FinalizeDrawLists");
-            m_drawListContext.FinalizeLists();
+            if (parentJob)
+            {
+                m_drawListContext.FinalizeLists();
+            }
+            else
+            {
+                // Not running in a job or task, so the draw list tags can be merged in parallel
+                m_drawListContext.FinalizeListsParallel();
+            }
             SortFinalizedDrawListsJob(parentJob);
         }
 
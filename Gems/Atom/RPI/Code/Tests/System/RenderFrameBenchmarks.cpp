@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+
+#include <Atom/RHI/DrawListContext.h>
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <Common/RPITestFixture.h>
+#include <Common/ShaderAssetTestUtils.h>
+
+#include <benchmark/benchmark.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace RPI;
+
+    //! Brings up the RPISystem on the stub RHI device that the RPI unit tests use, which doesn't talk to a GPU.
+    //! This lets the benchmarks below measure the CPU side of a frame on headless build machines.
+    class RenderFrameBenchmarkEnvironment final
+        : public RPITestFixture
+    {
+    public:
+        void SetUpEnvironment()
+        {
+            RPITestFixture::SetUp();
+        }
+
+        void TearDownEnvironment()
+        {
+            RPITestFixture::TearDown();
+        }
+
+        void CompileQueuedSrgs(Data::Asset<ShaderAsset> shaderAsset, const Name& srgName)
+        {
+            ProcessQueuedSrgCompilations(shaderAsset, srgName);
+        }
+
+    private:
+        // The environment is never run as a test.
+        void TestBody() override {}
+    };
+
+    //! Runs synthetic frames for a scene of N meshes observed by V views and reports the average CPU time per frame
+    //! for each stage as benchmark counters. Run with --benchmark_format=json to get machine-readable results.
+    //! The scene layout is generated from a fixed seed, so every run processes the same visible sets.
+    //! Arguments: number of meshes, number of views.
+    class RenderFrameBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            m_environment = AZStd::make_unique<RenderFrameBenchmarkEnvironment>();
+            m_environment->SetUpEnvironment();
+
+            m_executor = aznew TaskExecutor{};
+            TaskExecutor::SetInstance(m_executor);
+
+            m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
+            m_scene = Scene::CreateScene(SceneDescriptor{});
+            m_cullingScene = m_scene->GetCullingScene();
+            m_cullingScene->Activate(m_scene.get());
+
+            CreateViews(aznumeric_cast<size_t>(state.range(1)));
+            CreateMeshes(aznumeric_cast<size_t>(state.range(0)));
+        }
+
+        void TearDown(::benchmark::State&) override
+        {
+            for (auto& cullable : m_cullables)
+            {
+                m_cullingScene->UnregisterCullable(*cullable);
+            }
+            m_cullables = {};
+            m_objectSrgs = {};
+            m_objectTransforms = {};
+            m_drawListContexts = {};
+            m_views = {};
+
+            m_cullingScene->Deactivate();
+            m_scene = nullptr;
+            delete m_octreeSystemComponent;
+
+            m_srgShaderAsset.Release();
+
+            if (&TaskExecutor::Instance() == m_executor)
+            {
+                TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+
+            m_environment->TearDownEnvironment();
+            m_environment.reset();
+        }
+
+    protected:
+        static constexpr size_t DrawItemsPerMesh = 2;
+        static constexpr float SceneExtent = 500.0f;
+
+        void CreateViews(size_t viewCount)
+        {
+            // Use the first DrawItemsPerMesh draw list tags, e.g. a depth and a forward pass.
+            m_drawListMask.reset();
+            for (size_t tag = 0; tag < DrawItemsPerMesh; ++tag)
+            {
+                m_drawListMask.set(tag);
+            }
+
+            Matrix4x4 viewToClip = Matrix4x4::CreateIdentity();
+            MakePerspectiveFovMatrixRH(viewToClip, DegToRad(90.0f), 1.0f, 0.1f, SceneExtent, true);
+
+            for (size_t viewIndex = 0; viewIndex < viewCount; ++viewIndex)
+            {
+                ViewPtr view = View::CreateView(Name(AZStd::string::format("BenchmarkView%zu", viewIndex)), RPI::View::UsageCamera);
+                view->SetDrawListMask(m_drawListMask);
+
+                // Spread the views around the scene origin, looking outwards.
+                const float angle = Constants::TwoPi * static_cast<float>(viewIndex) / static_cast<float>(viewCount);
+                view->SetCameraTransform(Matrix3x4::CreateRotationZ(angle));
+                view->SetViewToClipMatrix(viewToClip);
+                m_views.push_back(view);
+
+                auto drawListContext = AZStd::make_unique<RHI::DrawListContext>();
+                drawListContext->Init(m_drawListMask);
+                m_drawListContexts.push_back(AZStd::move(drawListContext));
+            }
+        }
+
+        void CreateMeshes(size_t meshCount)
+        {
+            RHI::Ptr<RHI::ShaderResourceGroupLayout> srgLayout = RHI::ShaderResourceGroupLayout::Create();
+            srgLayout->SetName(m_srgName);
+            srgLayout->SetBindingSlot(0);
+            srgLayout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ Name("m_objectToWorld"), 0, sizeof(float) * 12, 0, 0 });
+            srgLayout->Finalize();
+            m_srgShaderAsset = CreateTestShaderAsset(Uuid::CreateRandom(), srgLayout);
+
+            SimpleLcgRandom random(1234);
+            m_cullables.reserve(meshCount);
+            m_objectSrgs.reserve(meshCount);
+            m_objectTransforms.reserve(meshCount);
+            for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
+            {
+                const Vector3 position(
+                    (random.GetRandomFloat() * 2.0f - 1.0f) * SceneExtent,
+                    (random.GetRandomFloat() * 2.0f - 1.0f) * SceneExtent,
+                    (random.GetRandomFloat() * 2.0f - 1.0f) * SceneExtent * 0.1f);
+                const Aabb aabb = Aabb::CreateCenterRadius(position, 1.0f + random.GetRandomFloat());
+
+                auto cullable = AZStd::make_unique<Cullable>();
+                cullable->m_cullData.m_boundingObb = Obb::CreateFromAabb(aabb);
+                cullable->m_cullData.m_boundingSphere = Sphere::CreateFromAabb(aabb);
+                cullable->m_cullData.m_visibilityEntry.m_boundingVolume = aabb;
+                cullable->m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_VisibleObjectList;
+                cullable->m_cullData.m_visibilityEntry.m_userData = cullable.get();
+                cullable->m_cullData.m_drawListMask = m_drawListMask;
+                cullable->m_lodData.m_lodSelectionRadius = 0.5f * aabb.GetExtents().GetMaxElement();
+
+                Cullable::LodData::Lod lod;
+                lod.m_screenCoverageMin = 0.0f;
+                lod.m_screenCoverageMax = 1.0f;
+                // The visible object user data is used to find the object index again when building the draw lists.
+                // It must not be null, so the index is offset by one.
+                lod.m_visibleObjectUserData = reinterpret_cast<void*>(meshIndex + 1);
+                cullable->m_lodData.m_lods.push_back(lod);
+
+                m_cullingScene->RegisterOrUpdateCullable(*cullable);
+                m_cullables.push_back(AZStd::move(cullable));
+
+                m_objectSrgs.push_back(ShaderResourceGroup::Create(m_srgShaderAsset, DefaultSupervariantIndex, m_srgName));
+                m_objectTransforms.push_back(Matrix3x4::CreateTranslation(position));
+            }
+        }
+
+        void Cull()
+        {
+            m_cullingScene->BeginCulling(m_views);
+
+            // Submit the culling work the same way as RPI::Scene::PrepareRender.
+            static const TaskDescriptor processCullablesDescriptor{ "RPI::Scene::ProcessCullables", "Graphics" };
+            TaskGraphEvent processCullablesTGEvent{ "ProcessCullables Wait" };
+            TaskGraph processCullablesTG{ "ProcessCullables" };
+            for (ViewPtr& viewPtr : m_views)
+            {
+                processCullablesTG.AddTask(
+                    processCullablesDescriptor,
+                    [this, &viewPtr, &processCullablesTGEvent]()
+                    {
+                        TaskGraph subTaskGraph{ "ProcessCullables Subgraph" };
+                        m_cullingScene->ProcessCullablesTG(*m_scene, *viewPtr, subTaskGraph, processCullablesTGEvent);
+                        if (!subTaskGraph.IsEmpty())
+                        {
+                            subTaskGraph.Detach();
+                            subTaskGraph.Submit(&processCullablesTGEvent);
+                        }
+                    });
+            }
+
+            processCullablesTG.Submit(&processCullablesTGEvent);
+            processCullablesTGEvent.Wait();
+            m_cullingScene->EndCulling();
+
+            for (ViewPtr& viewPtr : m_views)
+            {
+                viewPtr->FinalizeVisibleObjectList();
+            }
+        }
+
+        void BuildDrawLists()
+        {
+            static const TaskDescriptor buildDrawListsDescriptor{ "RPI::Benchmark::BuildDrawLists", "Graphics" };
+            TaskGraphEvent buildDrawListsTGEvent{ "BuildDrawLists Wait" };
+            TaskGraph buildDrawListsTG{ "BuildDrawLists" };
+            for (size_t viewIndex = 0; viewIndex < m_views.size(); ++viewIndex)
+            {
+                buildDrawListsTG.AddTask(
+                    buildDrawListsDescriptor,
+                    [this, viewIndex]()
+                    {
+                        View& view = *m_views[viewIndex];
+                        RHI::DrawListContext& drawListContext = *m_drawListContexts[viewIndex];
+                        for (const VisibleObjectProperties& visibleObject : view.GetVisibleObjectList())
+                        {
+                            const size_t meshIndex = reinterpret_cast<size_t>(visibleObject.m_userData) - 1;
+                            const RHI::DrawItemSortKey sortKey = view.GetSortKeyForPosition(m_objectTransforms[meshIndex].GetTranslation());
+                            for (size_t tag = 0; tag < DrawItemsPerMesh; ++tag)
+                            {
+                                RHI::DrawItemProperties drawItemProperties(nullptr, sortKey);
+                                drawItemProperties.m_depth = visibleObject.m_depth;
+                                drawListContext.AddDrawItem(RHI::DrawListTag(tag), drawItemProperties);
+                            }
+                        }
+
+                        // This runs in a task, so the draw list tags are merged on this thread, as View::FinalizeDrawListsTG does.
+                        // FinalizeListsParallel would block on its merge tasks from within a task.
+                        drawListContext.FinalizeLists();
+                        for (size_t tag = 0; tag < DrawItemsPerMesh; ++tag)
+                        {
+                            RHI::SortDrawList(drawListContext.GetMergedDrawListsByTag()[tag], RHI::DrawListSortType::KeyThenDepth);
+                        }
+                    });
+            }
+
+            buildDrawListsTG.Submit(&buildDrawListsTGEvent);
+            buildDrawListsTGEvent.Wait();
+        }
+
+        void CompileSrgs()
+        {
+            // Every mesh moves a bit every frame, which is the common case for dynamic objects.
+            const Matrix3x4 delta = Matrix3x4::CreateRotationZ(0.01f);
+            for (size_t meshIndex = 0; meshIndex < m_objectSrgs.size(); ++meshIndex)
+            {
+                m_objectTransforms[meshIndex] = delta * m_objectTransforms[meshIndex];
+                m_objectSrgs[meshIndex]->SetConstant(m_objectToWorldIndex, m_objectTransforms[meshIndex]);
+                m_objectSrgs[meshIndex]->Compile();
+            }
+
+            m_environment->CompileQueuedSrgs(m_srgShaderAsset, m_srgName);
+        }
+
+        AZStd::unique_ptr<RenderFrameBenchmarkEnvironment> m_environment;
+        TaskExecutor* m_executor = nullptr;
+        AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        ScenePtr m_scene;
+        CullingScene* m_cullingScene = nullptr;
+
+        RHI::DrawListMask m_drawListMask;
+        AZStd::vector<ViewPtr> m_views;
+        AZStd::vector<AZStd::unique_ptr<RHI::DrawListContext>> m_drawListContexts;
+
+        const Name m_srgName{ "BenchmarkObjectSrg" };
+        RHI::ShaderInputNameIndex m_objectToWorldIndex = "m_objectToWorld";
+        Data::Asset<ShaderAsset> m_srgShaderAsset;
+        AZStd::vector<AZStd::unique_ptr<Cullable>> m_cullables;
+        AZStd::vector<Data::Instance<ShaderResourceGroup>> m_objectSrgs;
+        AZStd::vector<Matrix3x4> m_objectTransforms;
+    };
+
+    BENCHMARK_DEFINE_F(RenderFrameBenchmarkFixture, BM_RenderFrame)(benchmark::State& state)
+    {
+        using Clock = AZStd::chrono::steady_clock;
+        using Milliseconds = AZStd::chrono::duration<double, AZStd::milli>;
+
+        double cullingMs = 0.0;
+        double drawListMs = 0.0;
+        double srgCompileMs = 0.0;
+        size_t drawItemCount = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const auto frameStart = Clock::now();
+            Cull();
+            const auto cullingEnd = Clock::now();
+            BuildDrawLists();
+            const auto drawListEnd = Clock::now();
+            CompileSrgs();
+            const auto srgCompileEnd = Clock::now();
+
+            cullingMs += Milliseconds(cullingEnd - frameStart).count();
+            drawListMs += Milliseconds(drawListEnd - cullingEnd).count();
+            srgCompileMs += Milliseconds(srgCompileEnd - drawListEnd).count();
+
+            for (auto& drawListContext : m_drawListContexts)
+            {
+                for (size_t tag = 0; tag < DrawItemsPerMesh; ++tag)
+                {
+                    drawItemCount += drawListContext->GetList(RHI::DrawListTag(tag)).size();
+                }
+            }
+        }
+
+        // Per-stage CPU time, averaged over all frames.
+        state.counters["CullingMs"] = benchmark::Counter(cullingMs, benchmark::Counter::kAvgIterations);
+        state.counters["DrawListMs"] = benchmark::Counter(drawListMs, benchmark::Counter::kAvgIterations);
+        state.counters["SrgCompileMs"] = benchmark::Counter(srgCompileMs, benchmark::Counter::kAvgIterations);
+        state.counters["DrawItems"] = benchmark::Counter(aznumeric_cast<double>(drawItemCount), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(RenderFrameBenchmarkFixture, BM_RenderFrame)
+        ->Args({ 1000, 1 })
+        ->Args({ 10000, 1 })
+        ->Args({ 10000, 4 })
+        ->Args({ 50000, 4 })
+        ->Unit(::benchmark::kMillisecond);
+} // namespace UnitTest
+
+#endif // HAVE_BENCHMARK
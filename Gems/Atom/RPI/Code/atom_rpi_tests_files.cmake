@@ -48,6 +48,7 @@ set(FILES
     Tests/System/CullingTests.cpp
     Tests/System/FeatureProcessorFactoryTests.cpp
     Tests/System/GpuQueryTests.cpp
+    Tests/System/RenderFrameBenchmarks.cpp
     Tests/System/RenderPipelineTests.cpp
     Tests/System/SceneTests.cpp
     Tests/System/ViewTests.cpp
@@ -162,8 +162,15 @@ namespace SurfaceData
             return;
         }
 
-        for (auto& inPosition : inPositions)
+        // Collect the hits so that they can be added to the surface point list as one batch by input position index.
+        AZStd::vector<size_t> hitIndices;
+        AZStd::vector<AZ::Vector3> hitPositions;
+        AZStd::vector<AZ::Vector3> hitNormals;
+
+        for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
         {
+            const AZ::Vector3& inPosition = inPositions[inPositionIndex];
+
             // test AABB as first pass to claim the point
             if (SurfaceData::AabbContains2D(m_meshBounds, inPosition))
             {
@@ -176,10 +183,14 @@ namespace SurfaceData
 
                 if (rayHit)
                 {
-                    surfacePointList.AddSurfacePoint(GetEntityId(), inPosition, hitPosition, hitNormal, m_newPointWeights);
+                    hitIndices.emplace_back(inPositionIndex);
+                    hitPositions.emplace_back(hitPosition);
+                    hitNormals.emplace_back(hitNormal);
                 }
             }
         }
+
+        surfacePointList.AddSurfacePoints(GetEntityId(), hitIndices, hitPositions, hitNormals, m_newPointWeights);
     }
 
 
@@ -11,6 +11,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <Compression/CompressionInterfaceStructs.h>
 
@@ -38,6 +39,16 @@ namespace Compression
         AZ_TYPE_INFO_WITH_NAME_DECL(CompressionOptions);
         AZ_RTTI_NO_TYPE_INFO_DECL();
         virtual ~CompressionOptions();
+
+        //! Compression level to use, whose range is specific to the compression algorithm
+        //! A value of 0 selects the default level of the compression algorithm
+        //! Compressors which do not support levels ignore this value
+        AZ::s32 m_compressionLevel{};
+
+        //! Optional dictionary that compressed content is primed with
+        //! The same dictionary must be supplied to the DecompressionOptions to decompress the content
+        //! Compressors which do not support dictionaries ignore this value
+        AZStd::span<const AZStd::byte> m_dictionary;
     };
 
     struct CompressionOutcome
@@ -92,6 +103,20 @@ namespace Compression
         //! @param uncompressedBufferSize size of uncompressed data
         //! @return worst case(upper bound) size that is needed to store compressed data for a given uncompressed size
         [[nodiscard]] virtual size_t CompressBound(size_t uncompressedBufferSize) const = 0;
+
+        //! Trains a dictionary from samples of the content that will be compressed
+        //! The dictionary can be supplied to the CompressionOptions and DecompressionOptions
+        //! to improve the compression ratio of small blocks with similar content
+        //! @param samples spans of sample content to train the dictionary on
+        //! @param maxDictionarySize upper bound on the size of the trained dictionary
+        //! @return trained dictionary, or an empty vector if the compression algorithm doesn't support dictionaries
+        //! or training has failed
+        [[nodiscard]] virtual AZStd::vector<AZStd::byte> TrainDictionary(
+            [[maybe_unused]] AZStd::span<const AZStd::span<const AZStd::byte>> samples,
+            [[maybe_unused]] size_t maxDictionarySize) const
+        {
+            return {};
+        }
     };
 
     class CompressionRegistrarInterface
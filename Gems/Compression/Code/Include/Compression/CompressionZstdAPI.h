@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/string/string_view.h>
+
+
+namespace Compression
+{
+    enum class CompressionAlgorithmId : AZ::u32;
+}
+
+namespace CompressionZstd
+{
+    //! Returns the CompressionAlgorithmId associated with the Zstandard Compressor
+    //! @return Zstd Compression AlgorithmId
+    constexpr Compression::CompressionAlgorithmId GetZstdCompressionAlgorithmId();
+
+    //! Human readable name associated with the compression algorithm
+    constexpr AZStd::string_view GetZstdCompressionAlgorithmName()
+    {
+        return "Zstd";
+    }
+
+    constexpr Compression::CompressionAlgorithmId GetZstdCompressionAlgorithmId()
+    {
+        constexpr Compression::CompressionAlgorithmId AlgorithmId{ AZ::u32(AZStd::hash<AZStd::string_view>{}(GetZstdCompressionAlgorithmName())) };
+        return AlgorithmId;
+    }
+} // namespace CompressionZstd
@@ -38,6 +38,10 @@ namespace Compression
         AZ_TYPE_INFO_WITH_NAME_DECL(DecompressionOptions);
         AZ_RTTI_NO_TYPE_INFO_DECL();
         virtual ~DecompressionOptions();
+
+        //! Optional dictionary that the compressed content was primed with
+        //! Decompressors which do not support dictionaries ignore this value
+        AZStd::span<const AZStd::byte> m_dictionary;
     };
 
     struct DecompressionOutcome
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "DecompressorZstdImpl.h"
+
+#include <Compression/CompressionZstdAPI.h>
+
+namespace CompressionZstd
+{
+    namespace Internal
+    {
+        //! Maximum number of digested dictionaries kept alive by the decompressor
+        //! Each mounted archive supplies at most one dictionary
+        constexpr size_t MaxCachedDictionaries = 8;
+    }
+
+    // Definitions for Zstd Decompressor
+    DecompressorZstd::DecompressorZstd() = default;
+
+    DecompressorZstd::~DecompressorZstd()
+    {
+        for (ZSTD_DCtx* context : m_idleContexts)
+        {
+            ZSTD_freeDCtx(context);
+        }
+    }
+
+    Compression::CompressionAlgorithmId DecompressorZstd::GetCompressionAlgorithmId() const
+    {
+        return GetZstdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view DecompressorZstd::GetCompressionAlgorithmName() const
+    {
+        return GetZstdCompressionAlgorithmName();
+    }
+
+    ZSTD_DCtx* DecompressorZstd::AcquireContext() const
+    {
+        {
+            AZStd::scoped_lock lock(m_contextMutex);
+            if (!m_idleContexts.empty())
+            {
+                ZSTD_DCtx* context = m_idleContexts.back();
+                m_idleContexts.pop_back();
+                return context;
+            }
+        }
+
+        return ZSTD_createDCtx();
+    }
+
+    void DecompressorZstd::ReleaseContext(ZSTD_DCtx* context) const
+    {
+        AZStd::scoped_lock lock(m_contextMutex);
+        m_idleContexts.push_back(context);
+    }
+
+    AZStd::shared_ptr<ZSTD_DDict> DecompressorZstd::FindOrCreateDictionary(AZStd::span<const AZStd::byte> dictionary) const
+    {
+        // The dictionary id is compared in addition to the address, in case the memory of an unmounted
+        // archive dictionary has been reused for a different dictionary
+        const unsigned dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+
+        AZStd::scoped_lock lock(m_dictionaryMutex);
+        for (const CachedDictionary& cachedDictionary : m_dictionaries)
+        {
+            if (cachedDictionary.m_data == dictionary.data() && cachedDictionary.m_size == dictionary.size()
+                && cachedDictionary.m_dictionaryId == dictionaryId)
+            {
+                return cachedDictionary.m_digestedDictionary;
+            }
+        }
+
+        ZSTD_DDict* digestedDictionary = ZSTD_createDDict(dictionary.data(), dictionary.size());
+        if (digestedDictionary == nullptr)
+        {
+            return {};
+        }
+
+        if (m_dictionaries.size() >= Internal::MaxCachedDictionaries)
+        {
+            m_dictionaries.erase(m_dictionaries.begin());
+        }
+
+        CachedDictionary& cachedDictionary = m_dictionaries.emplace_back();
+        cachedDictionary.m_data = dictionary.data();
+        cachedDictionary.m_size = dictionary.size();
+        cachedDictionary.m_dictionaryId = dictionaryId;
+        cachedDictionary.m_digestedDictionary = AZStd::shared_ptr<ZSTD_DDict>(digestedDictionary, &ZSTD_freeDDict);
+        return cachedDictionary.m_digestedDictionary;
+    }
+
+    Compression::DecompressionResultData DecompressorZstd::DecompressBlock(
+        AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+        const Compression::DecompressionOptions& decompressionOptions) const
+    {
+        Compression::DecompressionResultData resultData;
+
+        if (decompressionBuffer.empty())
+        {
+            resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString(
+                "Decompression buffer is empty, uncompressed content cannot be stored in it\n");
+            // Do not return, but hold on to result string in case an error occurs in decompression
+        }
+
+        // The dictionary is only used for frames that were compressed with it.
+        // Frames compressed with a raw content dictionary do not store a dictionary id, so a supplied
+        // dictionary without an id is always used
+        AZStd::shared_ptr<ZSTD_DDict> digestedDictionary;
+        if (!decompressionOptions.m_dictionary.empty())
+        {
+            const unsigned frameDictionaryId = ZSTD_getDictID_fromFrame(compressedData.data(), compressedData.size());
+            const unsigned dictionaryId = ZSTD_getDictID_fromDict(
+                decompressionOptions.m_dictionary.data(), decompressionOptions.m_dictionary.size());
+            if (frameDictionaryId == dictionaryId)
+            {
+                digestedDictionary = FindOrCreateDictionary(decompressionOptions.m_dictionary);
+                if (digestedDictionary == nullptr)
+                {
+                    resultData.m_decompressionOutcome.m_resultString += Compression::DecompressionResultString::format(
+                        "The Zstd dictionary of size %zu could not be loaded", decompressionOptions.m_dictionary.size());
+                    resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+                    return resultData;
+                }
+            }
+        }
+
+        ZSTD_DCtx* context = AcquireContext();
+        if (context == nullptr)
+        {
+            resultData.m_decompressionOutcome.m_resultString += "Failed to create a Zstd decompression context";
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        const size_t decompressedSize = digestedDictionary != nullptr
+            ? ZSTD_decompress_usingDDict(context,
+                decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size(),
+                digestedDictionary.get())
+            : ZSTD_decompressDCtx(context,
+                decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size());
+
+        ReleaseContext(context);
+
+        if (ZSTD_isError(decompressedSize))
+        {
+            resultData.m_decompressionOutcome.m_resultString += Compression::DecompressionResultString::format(
+                "ZSTD_decompressDCtx call has failed with error \"%s\". Dest buffer capacity: %zu, source stream size: %zu",
+                ZSTD_getErrorName(decompressedSize), decompressionBuffer.size(), compressedData.size());
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the decompressed data and
+        // the correct decompressed size
+        resultData.m_uncompressedBuffer = decompressionBuffer.subspan(0, decompressedSize);
+        resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Complete;
+        return resultData;
+    }
+
+} // namespace CompressionZstd
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+#include <zstd.h>
+
+namespace CompressionZstd
+{
+    //! Zstandard decompressor
+    //! Decompression contexts are pooled and reused across DecompressBlock calls,
+    //! so that decompressing a block does not allocate the context working memory.
+    //! Dictionaries supplied through the DecompressionOptions are digested once and cached
+    class DecompressorZstd
+        : public Compression::IDecompressionInterface
+    {
+    public:
+        DecompressorZstd();
+        ~DecompressorZstd();
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the Zstd decompressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Decompresses the compressed data into the decompressed buffer
+        //! @return a DecompressionResultData instance to indicate if decompression operation has succeeded
+        [[nodiscard]] Compression::DecompressionResultData DecompressBlock(
+            AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+            const Compression::DecompressionOptions& decompressionOptions = {}) const override;
+
+    private:
+        ZSTD_DCtx* AcquireContext() const;
+        void ReleaseContext(ZSTD_DCtx* context) const;
+
+        //! Returns the digested dictionary for the dictionary content
+        //! The returned pointer keeps the dictionary alive if it is evicted from the cache while in use
+        AZStd::shared_ptr<ZSTD_DDict> FindOrCreateDictionary(AZStd::span<const AZStd::byte> dictionary) const;
+
+        struct CachedDictionary
+        {
+            const AZStd::byte* m_data{};
+            size_t m_size{};
+            unsigned m_dictionaryId{};
+            AZStd::shared_ptr<ZSTD_DDict> m_digestedDictionary;
+        };
+
+        mutable AZStd::mutex m_contextMutex;
+        mutable AZStd::vector<ZSTD_DCtx*> m_idleContexts;
+
+        mutable AZStd::mutex m_dictionaryMutex;
+        mutable AZStd::vector<CachedDictionary> m_dictionaries;
+    };
+} // namespace CompressionZstd
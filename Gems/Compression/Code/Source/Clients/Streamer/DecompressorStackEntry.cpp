@@ -45,6 +45,9 @@ namespace Compression
         }
     }
 
+    //! Largest partial decompression scratch buffer that a decompression job slot holds on to between requests
+    static constexpr size_t MaxRetainedPartialDecompressionBufferSize = 4 * 1024 * 1024;
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr const char* DecompBoundName = "Decompression bound";
     static constexpr const char* ReadBoundName = "Read bound";
@@ -772,12 +775,19 @@ namespace Compression
         AZ::IO::CompressionInfo& compressionInfo = request->m_compressionInfo;
         AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-        auto decompressionBuffer = AZStd::make_unique<AZStd::byte[]>(compressionInfo.m_uncompressedSize);
+        AZStd::vector<AZStd::byte>& decompressionBuffer = info.m_partialDecompressionBuffer;
+        decompressionBuffer.resize_no_construct(compressionInfo.m_uncompressedSize);
         bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-            compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+            compressionInfo.m_compressedSize, decompressionBuffer.data(), compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? AZ::IO::IStreamerTypes::RequestStatus::Completed : AZ::IO::IStreamerTypes::RequestStatus::Failed);
 
-        memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+        memcpy(request->m_output, decompressionBuffer.data() + request->m_readOffset, request->m_readSize);
+
+        // Only retain scratch buffers up to the size of a compressed block, as uncompressed files can be arbitrarily large
+        if (decompressionBuffer.capacity() > MaxRetainedPartialDecompressionBufferSize)
+        {
+            decompressionBuffer = {};
+        }
 
         context->MarkRequestAsCompleted(info.m_waitRequest);
         context->WakeUpSchedulingThread();
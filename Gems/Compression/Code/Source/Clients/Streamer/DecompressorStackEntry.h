@@ -14,6 +14,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/Task/TaskExecutor.h>
@@ -102,6 +103,9 @@ namespace Compression
             Buffer m_compressedData{ nullptr };
             AZ::IO::FileRequest* m_waitRequest{ nullptr };
             AZ::u32 m_alignmentOffset{ 0 };
+            //! Scratch buffer for partial decompression, which is reused by the jobs of this slot
+            //! instead of allocating the uncompressed size for every request
+            AZStd::vector<AZStd::byte> m_partialDecompressionBuffer;
         };
 
         bool IsIdle() const;
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressorZstdImpl.h"
+
+#include <AzCore/std/algorithm.h>
+#include <Compression/CompressionZstdAPI.h>
+
+#include <zdict.h>
+
+namespace CompressionZstd
+{
+    namespace Internal
+    {
+        //! Maximum number of digested dictionaries kept alive by the compressor
+        constexpr size_t MaxCachedDictionaries = 8;
+
+        //! Maps the CompressionOptions level to a valid Zstd compression level
+        //! A level of 0 selects the Zstd default level
+        int GetCompressionLevel(AZ::s32 compressionLevel)
+        {
+            if (compressionLevel == 0)
+            {
+                return ZSTD_CLEVEL_DEFAULT;
+            }
+
+            return AZStd::clamp(static_cast<int>(compressionLevel), ZSTD_minCLevel(), ZSTD_maxCLevel());
+        }
+    }
+
+    // Definitions for Zstd Compressor
+    CompressorZstd::CompressorZstd() = default;
+
+    CompressorZstd::~CompressorZstd()
+    {
+        for (ZSTD_CCtx* context : m_idleContexts)
+        {
+            ZSTD_freeCCtx(context);
+        }
+    }
+
+    Compression::CompressionAlgorithmId CompressorZstd::GetCompressionAlgorithmId() const
+    {
+        return GetZstdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view CompressorZstd::GetCompressionAlgorithmName() const
+    {
+        return GetZstdCompressionAlgorithmName();
+    }
+
+    [[nodiscard]] size_t CompressorZstd::CompressBound(size_t uncompressedBufferSize) const
+    {
+        return ZSTD_compressBound(uncompressedBufferSize);
+    }
+
+    ZSTD_CCtx* CompressorZstd::AcquireContext() const
+    {
+        {
+            AZStd::scoped_lock lock(m_contextMutex);
+            if (!m_idleContexts.empty())
+            {
+                ZSTD_CCtx* context = m_idleContexts.back();
+                m_idleContexts.pop_back();
+                return context;
+            }
+        }
+
+        return ZSTD_createCCtx();
+    }
+
+    void CompressorZstd::ReleaseContext(ZSTD_CCtx* context) const
+    {
+        AZStd::scoped_lock lock(m_contextMutex);
+        m_idleContexts.push_back(context);
+    }
+
+    AZStd::shared_ptr<ZSTD_CDict> CompressorZstd::FindOrCreateDictionary(
+        AZStd::span<const AZStd::byte> dictionary, int compressionLevel) const
+    {
+        const unsigned dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+
+        AZStd::scoped_lock lock(m_dictionaryMutex);
+        for (const CachedDictionary& cachedDictionary : m_dictionaries)
+        {
+            if (cachedDictionary.m_data == dictionary.data() && cachedDictionary.m_size == dictionary.size()
+                && cachedDictionary.m_dictionaryId == dictionaryId && cachedDictionary.m_compressionLevel == compressionLevel)
+            {
+                return cachedDictionary.m_digestedDictionary;
+            }
+        }
+
+        ZSTD_CDict* digestedDictionary = ZSTD_createCDict(dictionary.data(), dictionary.size(), compressionLevel);
+        if (digestedDictionary == nullptr)
+        {
+            return {};
+        }
+
+        if (m_dictionaries.size() >= Internal::MaxCachedDictionaries)
+        {
+            m_dictionaries.erase(m_dictionaries.begin());
+        }
+
+        CachedDictionary& cachedDictionary = m_dictionaries.emplace_back();
+        cachedDictionary.m_data = dictionary.data();
+        cachedDictionary.m_size = dictionary.size();
+        cachedDictionary.m_dictionaryId = dictionaryId;
+        cachedDictionary.m_compressionLevel = compressionLevel;
+        cachedDictionary.m_digestedDictionary = AZStd::shared_ptr<ZSTD_CDict>(digestedDictionary, &ZSTD_freeCDict);
+        return cachedDictionary.m_digestedDictionary;
+    }
+
+    Compression::CompressionResultData CompressorZstd::CompressBlock(
+        AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+        const Compression::CompressionOptions& compressionOptions) const
+    {
+        Compression::CompressionResultData resultData;
+
+        if (const size_t worstCaseCompressedSize = ZSTD_compressBound(uncompressedData.size());
+            worstCaseCompressedSize == 0 || ZSTD_isError(worstCaseCompressedSize))
+        {
+            resultData.m_compressionOutcome.m_resultString = Compression::CompressionResultString::format(
+                "Input buffer of size %zu is too large to compress in a single call", uncompressedData.size());
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+        else if (compressionBuffer.size() < worstCaseCompressedSize)
+        {
+            resultData.m_compressionOutcome.m_resultString = Compression::CompressionResultString::format(
+                "Output buffer capacity is less than the upper bound for worst case."
+                " Worst case size is %zu; output buffer capacity is %zu\n",
+                worstCaseCompressedSize, compressionBuffer.size());
+        }
+
+        const int compressionLevel = Internal::GetCompressionLevel(compressionOptions.m_compressionLevel);
+
+        AZStd::shared_ptr<ZSTD_CDict> digestedDictionary;
+        if (!compressionOptions.m_dictionary.empty())
+        {
+            digestedDictionary = FindOrCreateDictionary(compressionOptions.m_dictionary, compressionLevel);
+            if (digestedDictionary == nullptr)
+            {
+                resultData.m_compressionOutcome.m_resultString += Compression::CompressionResultString::format(
+                    "The Zstd dictionary of size %zu could not be loaded", compressionOptions.m_dictionary.size());
+                resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+                return resultData;
+            }
+        }
+
+        ZSTD_CCtx* context = AcquireContext();
+        if (context == nullptr)
+        {
+            resultData.m_compressionOutcome.m_resultString += "Failed to create a Zstd compression context";
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        const size_t compressedSize = digestedDictionary != nullptr
+            ? ZSTD_compress_usingCDict(context,
+                compressionBuffer.data(), compressionBuffer.size(),
+                uncompressedData.data(), uncompressedData.size(),
+                digestedDictionary.get())
+            : ZSTD_compressCCtx(context,
+                compressionBuffer.data(), compressionBuffer.size(),
+                uncompressedData.data(), uncompressedData.size(),
+                compressionLevel);
+
+        ReleaseContext(context);
+
+        if (ZSTD_isError(compressedSize))
+        {
+            resultData.m_compressionOutcome.m_resultString += Compression::CompressionResultString::format(
+                "ZSTD_compressCCtx call has failed with error \"%s\". The source buffer size is %zu and the output buffer"
+                " has capacity of %zu", ZSTD_getErrorName(compressedSize), uncompressedData.size(), compressionBuffer.size());
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the compressed data and
+        // the correct compressed size
+        resultData.m_compressedBuffer = compressionBuffer.subspan(0, compressedSize);
+        resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Complete;
+        return resultData;
+    }
+
+    AZStd::vector<AZStd::byte> CompressorZstd::TrainDictionary(
+        AZStd::span<const AZStd::span<const AZStd::byte>> samples, size_t maxDictionarySize) const
+    {
+        // ZDICT_trainFromBuffer expects the samples to be concatenated into a single buffer
+        AZStd::vector<AZStd::byte> sampleBuffer;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (const AZStd::span<const AZStd::byte>& sample : samples)
+        {
+            if (!sample.empty())
+            {
+                sampleBuffer.insert(sampleBuffer.end(), sample.begin(), sample.end());
+                sampleSizes.push_back(sample.size());
+            }
+        }
+
+        if (sampleSizes.empty() || maxDictionarySize == 0)
+        {
+            return {};
+        }
+
+        AZStd::vector<AZStd::byte> dictionary(maxDictionarySize);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+            sampleBuffer.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(dictionarySize))
+        {
+            AZ_Warning("Compression Zstd", false, "Zstd dictionary training on %zu samples has failed with error \"%s\"",
+                sampleSizes.size(), ZDICT_getErrorName(dictionarySize));
+            return {};
+        }
+
+        dictionary.resize(dictionarySize);
+        return dictionary;
+    }
+
+} // namespace CompressionZstd
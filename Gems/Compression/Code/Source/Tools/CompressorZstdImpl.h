@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <Compression/CompressionInterfaceAPI.h>
+
+#include <zstd.h>
+
+namespace CompressionZstd
+{
+    //! Zstandard compressor
+    //! Supports the compression level and dictionary of the CompressionOptions
+    //! and training dictionaries from sample content.
+    //! Compression contexts are pooled and reused across CompressBlock calls
+    //! and dictionaries are digested once per compression level
+    class CompressorZstd
+        : public Compression::ICompressionInterface
+    {
+    public:
+        CompressorZstd();
+        ~CompressorZstd();
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the Zstd compressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Compresses the uncompressed data into the compressed buffer
+        //! @return a CompressionResultData instance to indicate if compression operation has succeeded
+        [[nodiscard]] Compression::CompressionResultData CompressBlock(
+            AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+            const Compression::CompressionOptions& compressionOptions = {}) const override;
+
+        [[nodiscard]] size_t CompressBound(size_t uncompressedBufferSize) const override;
+
+        [[nodiscard]] AZStd::vector<AZStd::byte> TrainDictionary(
+            AZStd::span<const AZStd::span<const AZStd::byte>> samples, size_t maxDictionarySize) const override;
+
+    private:
+        ZSTD_CCtx* AcquireContext() const;
+        void ReleaseContext(ZSTD_CCtx* context) const;
+
+        //! Returns the digested dictionary for the dictionary content and compression level
+        //! The returned pointer keeps the dictionary alive if it is evicted from the cache while in use
+        AZStd::shared_ptr<ZSTD_CDict> FindOrCreateDictionary(AZStd::span<const AZStd::byte> dictionary, int compressionLevel) const;
+
+        struct CachedDictionary
+        {
+            const AZStd::byte* m_data{};
+            size_t m_size{};
+            unsigned m_dictionaryId{};
+            int m_compressionLevel{};
+            AZStd::shared_ptr<ZSTD_CDict> m_digestedDictionary;
+        };
+
+        mutable AZStd::mutex m_contextMutex;
+        mutable AZStd::vector<ZSTD_CCtx*> m_idleContexts;
+
+        mutable AZStd::mutex m_dictionaryMutex;
+        mutable AZStd::vector<CachedDictionary> m_dictionaries;
+    };
+} // namespace CompressionZstd
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Compression/CompressionZstdAPI.h>
+#include <Clients/DecompressorZstdImpl.h>
+
+namespace CompressionZstdTest
+{
+    class DecompressionZstdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        DecompressionZstdFixture() = default;
+
+        ~DecompressionZstdFixture() = default;
+
+    protected:
+        //! Compresses the text with the zstd library directly, as the Zstd compressor is only available in tools
+        AZStd::vector<AZStd::byte> CompressText(AZStd::string_view text)
+        {
+            AZStd::vector<AZStd::byte> compressedData;
+            compressedData.resize_no_construct(ZSTD_compressBound(text.size()));
+            const size_t compressedSize = ZSTD_compress(compressedData.data(), compressedData.size(),
+                text.data(), text.size(), ZSTD_CLEVEL_DEFAULT);
+            EXPECT_FALSE(ZSTD_isError(compressedSize));
+            compressedData.resize_no_construct(compressedSize);
+            return compressedData;
+        }
+    };
+
+    TEST_F(DecompressionZstdFixture, ZstdDecompressor_DecompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZstd::GetZstdCompressionAlgorithmId();
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        EXPECT_EQ(compressionAlgorithmId, decompressorZstd->GetCompressionAlgorithmId());
+
+        AZStd::vector<AZStd::byte> compressedData = CompressText("Hello World");
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(64);
+
+        // Decompress twice to make sure that the pooled decompression context is reusable
+        for (int iteration = 0; iteration < 2; ++iteration)
+        {
+            Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+                decompressionBuffer, compressedData);
+
+            EXPECT_TRUE(static_cast<bool>(decompressionResultData));
+            EXPECT_TRUE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+            ASSERT_NE(nullptr, decompressionResultData.GetUncompressedByteData());
+
+            AZStd::string_view uncompressedString(reinterpret_cast<char*>(decompressionResultData.GetUncompressedByteData()),
+                decompressionResultData.GetUncompressedByteCount());
+            EXPECT_EQ("Hello World", uncompressedString);
+        }
+    }
+
+    TEST_F(DecompressionZstdFixture, ZstdDecompressor_DecompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        AZStd::vector<AZStd::byte> compressedData = CompressText("Hello World");
+
+        // The decompression output buffer has a size of zero, so decompression should fail
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+        EXPECT_EQ(0, decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(nullptr, decompressionResultData.GetUncompressedByteData());
+    }
+
+    TEST_F(DecompressionZstdFixture, ZstdDecompressor_DecompressBlock_WithMalformedData_Fails)
+    {
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        constexpr AZStd::string_view malformedData = "Hello World";
+        AZStd::span compressedData(reinterpret_cast<const AZStd::byte*>(malformedData.data()), malformedData.size());
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(64);
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+        EXPECT_FALSE(decompressionResultData.m_decompressionOutcome.m_resultString.empty());
+    }
+}
@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/string/string.h>
+
+#include <Clients/DecompressorLZ4Impl.h>
+#include <Clients/DecompressorZstdImpl.h>
+#include <Compression/CompressionZstdAPI.h>
+#include <Tools/CompressorLZ4Impl.h>
+#include <Tools/CompressorZstdImpl.h>
+
+namespace CompressionZstdTest
+{
+    namespace Internal
+    {
+        //! Generates a small json document that shares its keys with the other documents of the same seed
+        //! Used as the content of small files that benefit from a trained dictionary
+        AZStd::string GenerateJsonDocument(AZ::u32 index)
+        {
+            return AZStd::string::format(
+                R"({"$type": "AZ::Entity", "Id": %u, "Name": "Entity_%u", "Components": [)"
+                R"({"$type": "AZ::TransformComponent", "Translate": [%u.0, %u.5, 0.0], "Rotate": [0.0, 0.0, 0.0, 1.0]},)"
+                R"({"$type": "AZ::MeshComponent", "Model": "objects/model_%u.azmodel", "Visible": %s}]})",
+                index, index, index % 97, index % 13, index % 31, index % 2 == 0 ? "true" : "false");
+        }
+
+        //! Generates binary content shaped like vertex data, a mix of repeated and varying floats
+        AZStd::vector<AZStd::byte> GenerateVertexData(size_t vertexCount)
+        {
+            AZStd::vector<AZStd::byte> vertexData;
+            vertexData.reserve(vertexCount * 8 * sizeof(float));
+            for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                const float vertex[8]{ float(vertexIndex % 64), float(vertexIndex / 64), 0.0f, 0.0f, 0.0f, 1.0f,
+                    float(vertexIndex % 64) / 64.0f, float(vertexIndex / 64) / 64.0f };
+                const auto vertexBytes = reinterpret_cast<const AZStd::byte*>(vertex);
+                vertexData.insert(vertexData.end(), vertexBytes, vertexBytes + sizeof(vertex));
+            }
+            return vertexData;
+        }
+
+        AZStd::span<const AZStd::byte> AsBytes(AZStd::string_view text)
+        {
+            return { reinterpret_cast<const AZStd::byte*>(text.data()), text.size() };
+        }
+    }
+
+    class CompressionZstdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        CompressionZstdFixture() = default;
+
+        ~CompressionZstdFixture() = default;
+
+    protected:
+        AZStd::vector<AZStd::byte> TrainJsonDictionary(size_t maxDictionarySize)
+        {
+            AZStd::vector<AZStd::string> documents;
+            AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+            for (AZ::u32 index = 0; index < 1024; ++index)
+            {
+                documents.emplace_back(Internal::GenerateJsonDocument(index));
+            }
+            for (const AZStd::string& document : documents)
+            {
+                samples.emplace_back(Internal::AsBytes(document));
+            }
+
+            return m_compressorZstd.TrainDictionary(samples, maxDictionarySize);
+        }
+
+        CompressionZstd::CompressorZstd m_compressorZstd;
+        CompressionZstd::DecompressorZstd m_decompressorZstd;
+    };
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlock_Succeeds)
+    {
+        EXPECT_EQ(CompressionZstd::GetZstdCompressionAlgorithmId(), m_compressorZstd.GetCompressionAlgorithmId());
+        EXPECT_EQ(m_compressorZstd.GetCompressionAlgorithmId(), m_decompressorZstd.GetCompressionAlgorithmId());
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        size_t compressBufferUpperBound = m_compressorZstd.CompressBound(dataToCompress.size());
+        EXPECT_GT(compressBufferUpperBound, 0);
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(compressBufferUpperBound);
+
+        Compression::CompressionResultData compressionResultData = m_compressorZstd.CompressBlock(
+            compressionBuffer, Internal::AsBytes(dataToCompress));
+
+        EXPECT_TRUE(static_cast<bool>(compressionResultData));
+        EXPECT_GT(compressionResultData.GetCompressedByteCount(), 0);
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(dataToCompress.size());
+        Compression::DecompressionResultData decompressionResultData = m_decompressorZstd.DecompressBlock(
+            decompressionBuffer, compressionResultData.m_compressedBuffer);
+
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        AZStd::string_view uncompressedString(reinterpret_cast<char*>(decompressionResultData.GetUncompressedByteData()),
+            decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(dataToCompress, uncompressedString);
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlock_WithBufferTooSmall_Fails)
+    {
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+
+        // The compression output buffer has a size of zero, so compression should fail
+        AZStd::vector<AZStd::byte> compressionBuffer;
+
+        Compression::CompressionResultData compressionResultData = m_compressorZstd.CompressBlock(
+            compressionBuffer, Internal::AsBytes(dataToCompress));
+
+        EXPECT_FALSE(static_cast<bool>(compressionResultData));
+        EXPECT_FALSE(static_cast<bool>(compressionResultData.m_compressionOutcome));
+        EXPECT_EQ(0, compressionResultData.GetCompressedByteCount());
+        EXPECT_EQ(nullptr, compressionResultData.GetCompressedByteData());
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlock_WithHigherLevel_DoesNotIncreaseSize)
+    {
+        AZStd::string dataToCompress;
+        for (AZ::u32 index = 0; index < 256; ++index)
+        {
+            dataToCompress += Internal::GenerateJsonDocument(index);
+        }
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(m_compressorZstd.CompressBound(dataToCompress.size()));
+
+        Compression::CompressionOptions fastestOptions;
+        fastestOptions.m_compressionLevel = 1;
+        Compression::CompressionResultData fastestResultData = m_compressorZstd.CompressBlock(
+            compressionBuffer, Internal::AsBytes(dataToCompress), fastestOptions);
+        ASSERT_TRUE(static_cast<bool>(fastestResultData));
+        const size_t fastestCompressedSize = fastestResultData.GetCompressedByteCount();
+
+        // Levels above the maximum Zstd level are clamped to it
+        Compression::CompressionOptions strongestOptions;
+        strongestOptions.m_compressionLevel = 1000;
+        Compression::CompressionResultData strongestResultData = m_compressorZstd.CompressBlock(
+            compressionBuffer, Internal::AsBytes(dataToCompress), strongestOptions);
+        ASSERT_TRUE(static_cast<bool>(strongestResultData));
+
+        EXPECT_LE(strongestResultData.GetCompressedByteCount(), fastestCompressedSize);
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlockWithTrainedDictionary_RoundTripsAndIsSmaller)
+    {
+        AZStd::vector<AZStd::byte> dictionary = TrainJsonDictionary(16 * 1024);
+        ASSERT_FALSE(dictionary.empty());
+
+        // Compress a document which was not part of the training samples
+        const AZStd::string document = Internal::GenerateJsonDocument(5000);
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(m_compressorZstd.CompressBound(document.size()));
+
+        Compression::CompressionResultData resultData = m_compressorZstd.CompressBlock(
+            compressionBuffer, Internal::AsBytes(document));
+        ASSERT_TRUE(static_cast<bool>(resultData));
+        const size_t compressedSizeWithoutDictionary = resultData.GetCompressedByteCount();
+
+        Compression::CompressionOptions compressionOptions;
+        compressionOptions.m_dictionary = dictionary;
+        resultData = m_compressorZstd.CompressBlock(compressionBuffer, Internal::AsBytes(document), compressionOptions);
+        ASSERT_TRUE(static_cast<bool>(resultData));
+        EXPECT_LT(resultData.GetCompressedByteCount(), compressedSizeWithoutDictionary);
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(document.size());
+
+        // The content can't be decompressed without the dictionary
+        Compression::DecompressionResultData decompressionResultData = m_decompressorZstd.DecompressBlock(
+            decompressionBuffer, resultData.m_compressedBuffer);
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+
+        Compression::DecompressionOptions decompressionOptions;
+        decompressionOptions.m_dictionary = dictionary;
+        decompressionResultData = m_decompressorZstd.DecompressBlock(
+            decompressionBuffer, resultData.m_compressedBuffer, decompressionOptions);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        AZStd::string_view uncompressedString(reinterpret_cast<char*>(decompressionResultData.GetUncompressedByteData()),
+            decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(document, uncompressedString);
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdDecompressor_DecompressBlockWithUnusedDictionary_Succeeds)
+    {
+        AZStd::vector<AZStd::byte> dictionary = TrainJsonDictionary(16 * 1024);
+        ASSERT_FALSE(dictionary.empty());
+
+        // Content compressed without a dictionary can be decompressed with the archive dictionary supplied
+        const AZStd::string document = Internal::GenerateJsonDocument(7);
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(m_compressorZstd.CompressBound(document.size()));
+        Compression::CompressionResultData resultData = m_compressorZstd.CompressBlock(
+            compressionBuffer, Internal::AsBytes(document));
+        ASSERT_TRUE(static_cast<bool>(resultData));
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(document.size());
+        Compression::DecompressionOptions decompressionOptions;
+        decompressionOptions.m_dictionary = dictionary;
+        Compression::DecompressionResultData decompressionResultData = m_decompressorZstd.DecompressBlock(
+            decompressionBuffer, resultData.m_compressedBuffer, decompressionOptions);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_EQ(document.size(), decompressionResultData.GetUncompressedByteCount());
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_TrainDictionaryWithoutSamples_ReturnsEmpty)
+    {
+        EXPECT_TRUE(m_compressorZstd.TrainDictionary({}, 16 * 1024).empty());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Compares the compression ratio and throughput of the Zstd and LZ4 codecs
+    //! on a corpus of json text and binary vertex data
+    class CompressionCodecBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    protected:
+        enum class Corpus : int64_t
+        {
+            Json,
+            Binary
+        };
+
+        void SetUpCorpus(const ::benchmark::State& state)
+        {
+            m_corpus.clear();
+            if (static_cast<Corpus>(state.range(0)) == Corpus::Json)
+            {
+                for (AZ::u32 index = 0; m_corpus.size() < CorpusSize; ++index)
+                {
+                    AZStd::string document = Internal::GenerateJsonDocument(index);
+                    const auto documentBytes = Internal::AsBytes(document);
+                    m_corpus.insert(m_corpus.end(), documentBytes.begin(), documentBytes.end());
+                }
+            }
+            else
+            {
+                m_corpus = Internal::GenerateVertexData(CorpusSize / (8 * sizeof(float)));
+            }
+        }
+
+        void TearDownCorpus()
+        {
+            m_corpus = {};
+        }
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpCorpus(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpCorpus(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownCorpus();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownCorpus();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Compresses the corpus once in archive sized blocks and then benchmarks the decompression of the blocks
+        void BenchmarkCodec(::benchmark::State& state, const Compression::ICompressionInterface& compressor,
+            const Compression::IDecompressionInterface& decompressor, const Compression::CompressionOptions& compressionOptions)
+        {
+            AZStd::vector<AZStd::byte> compressionBuffer;
+            compressionBuffer.resize_no_construct(compressor.CompressBound(BlockSize));
+            AZStd::vector<AZStd::vector<AZStd::byte>> compressedBlocks;
+            size_t compressedSize{};
+            for (size_t offset = 0; offset < m_corpus.size(); offset += BlockSize)
+            {
+                AZStd::span<const AZStd::byte> block(m_corpus.data() + offset, AZStd::min(BlockSize, m_corpus.size() - offset));
+                Compression::CompressionResultData resultData = compressor.CompressBlock(compressionBuffer, block, compressionOptions);
+                if (!resultData)
+                {
+                    state.SkipWithError(resultData.m_compressionOutcome.m_resultString.c_str());
+                    return;
+                }
+                compressedBlocks.emplace_back(resultData.m_compressedBuffer.begin(), resultData.m_compressedBuffer.end());
+                compressedSize += resultData.GetCompressedByteCount();
+            }
+
+            AZStd::vector<AZStd::byte> decompressionBuffer;
+            decompressionBuffer.resize_no_construct(BlockSize);
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (const AZStd::vector<AZStd::byte>& compressedBlock : compressedBlocks)
+                {
+                    Compression::DecompressionResultData resultData = decompressor.DecompressBlock(decompressionBuffer, compressedBlock);
+                    benchmark::DoNotOptimize(resultData.GetUncompressedByteCount());
+                }
+            }
+
+            state.SetBytesProcessed(state.iterations() * m_corpus.size());
+            state.counters["Ratio"] = static_cast<double>(m_corpus.size()) / static_cast<double>(compressedSize);
+        }
+
+        //! Matches the block size used by the Archive gem to compress content
+        static constexpr size_t BlockSize = 2 * 1024 * 1024;
+        static constexpr size_t CorpusSize = 4 * BlockSize;
+        AZStd::vector<AZStd::byte> m_corpus;
+    };
+
+    BENCHMARK_DEFINE_F(CompressionCodecBenchmarkFixture, BM_DecompressLZ4)(benchmark::State& state)
+    {
+        CompressionLZ4::CompressorLZ4 compressor;
+        CompressionLZ4::DecompressorLZ4 decompressor;
+        BenchmarkCodec(state, compressor, decompressor, {});
+    }
+
+    BENCHMARK_DEFINE_F(CompressionCodecBenchmarkFixture, BM_DecompressZstd)(benchmark::State& state)
+    {
+        CompressionZstd::CompressorZstd compressor;
+        CompressionZstd::DecompressorZstd decompressor;
+        Compression::CompressionOptions compressionOptions;
+        compressionOptions.m_compressionLevel = static_cast<AZ::s32>(state.range(1));
+        BenchmarkCodec(state, compressor, decompressor, compressionOptions);
+    }
+
+    BENCHMARK_REGISTER_F(CompressionCodecBenchmarkFixture, BM_DecompressLZ4)
+        ->ArgNames({ "Corpus" })->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(CompressionCodecBenchmarkFixture, BM_DecompressZstd)
+        ->ArgNames({ "Corpus", "Level" })
+        ->Args({ 0, 1 })->Args({ 0, 3 })->Args({ 0, 19 })
+        ->Args({ 1, 1 })->Args({ 1, 3 })->Args({ 1, 19 })
+        ->Unit(benchmark::kMillisecond);
+#endif
+}
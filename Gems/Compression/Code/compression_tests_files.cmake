@@ -7,4 +7,5 @@
 set(FILES
     Tests/Clients/CompressionTest.cpp
     Tests/Clients/CompressionLZ4Test.cpp
+    Tests/Clients/CompressionZstdTest.cpp
 )
@@ -234,13 +234,16 @@ namespace GradientSignal
         AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(
             positions, m_configuration.m_surfaceTagsToSample, points);
 
+        // Get the point with the highest Z value for every position and use that for the altitude.
+        AZStd::vector<AZ::Vector3> highestPositions(positions.size());
+        points.GetHighestSurfacePoints(highestPositions, {});
+
         // For each position, turn the height into a 0-1 value based on our min/max altitudes.
         for (size_t index = 0; index < positions.size(); index++)
         {
             if (!points.IsEmpty(index))
             {
-                // Get the point with the highest Z value and use that for the altitude.
-                const float highestAltitude = points.GetHighestSurfacePoint(index).m_position.GetZ();
+                const float highestAltitude = highestPositions[index].GetZ();
 
                 // Turn the absolute altitude value into a 0-1 value by returning the % of the given altitude range that it falls at.
                 outValues[index] = GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, highestAltitude);
@@ -238,6 +238,9 @@ namespace GradientSignal
         const float angleMin = AZ::DegToRad(AZ::GetClamp(m_configuration.m_slopeMin, 0.0f, 90.0f));
         const float angleMax = AZ::DegToRad(AZ::GetClamp(m_configuration.m_slopeMax, 0.0f, 90.0f));
 
+        AZStd::vector<AZ::Vector3> highestNormals(positions.size());
+        points.GetHighestSurfacePoints({}, highestNormals);
+
         for (size_t index = 0; index < positions.size(); index++)
         {
             if (points.IsEmpty(index))
@@ -248,11 +251,9 @@ namespace GradientSignal
             {
                 // Assuming our surface normal vector is actually normalized, we can get the slope
                 // by just grabbing the Z value.  It's the same thing as normal.Dot(AZ::Vector3::CreateAxisZ()).
-                auto highestSurfacePoint = points.GetHighestSurfacePoint(index);
-                AZ_Assert(
-                    highestSurfacePoint.m_normal.GetNormalized().IsClose(highestSurfacePoint.m_normal),
-                    "Surface normals are expected to be normalized");
-                const float slope = highestSurfacePoint.m_normal.GetZ();
+                const AZ::Vector3& highestNormal = highestNormals[index];
+                AZ_Assert(highestNormal.GetNormalized().IsClose(highestNormal), "Surface normals are expected to be normalized");
+                const float slope = highestNormal.GetZ();
                 // Convert slope back to an angle so that we can lerp in "angular space", not "slope value space".
                 // (We want our 0-1 range to be linear across the range of angles)
                 const float slopeAngle = acosf(slope);
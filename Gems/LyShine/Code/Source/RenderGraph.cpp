@@ -149,14 +149,14 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] Combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        // Add all of the primitives to the dynamic draw context with a single draw call. The combined geometry is kept
+        // around between frames, so it only gets rebuilt along with the render graph.
+        BuildBatchedGeometry();
+        if (!m_batchedIndices.empty())
         {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
+            dynamicDraw->DrawIndexed(
+                m_batchedVertices.data(), static_cast<uint32_t>(m_batchedVertices.size()), m_batchedIndices.data(),
+                static_cast<uint32_t>(m_batchedIndices.size()), AZ::RHI::IndexFormat::Uint16, drawSrg);
         }
 
         uiRenderer->SetBaseState(prevBaseState);
@@ -171,6 +171,35 @@ namespace LyShine
 
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
+
+        m_isBatchedGeometryDirty = true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::BuildBatchedGeometry()
+    {
+        if (!m_isBatchedGeometryDirty)
+        {
+            return;
+        }
+
+        m_batchedVertices.clear();
+        m_batchedIndices.clear();
+        m_batchedVertices.reserve(m_totalNumVertices);
+        m_batchedIndices.reserve(m_totalNumIndices);
+
+        // HasSpaceToAddPrimitive guarantees that the total number of vertices fits in 16 bit indices
+        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        {
+            const uint16 baseVertex = static_cast<uint16>(m_batchedVertices.size());
+            m_batchedVertices.insert(m_batchedVertices.end(), primitive.m_vertices, primitive.m_vertices + primitive.m_numVertices);
+            for (int i = 0; i < primitive.m_numIndices; ++i)
+            {
+                m_batchedIndices.push_back(static_cast<uint16>(baseVertex + primitive.m_indices[i]));
+            }
+        }
+
+        m_isBatchedGeometryDirty = false;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +97,13 @@ namespace LyShine
         // Search to see if this texture is already used by this texture unit, returns -1 if not used
         int FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const;
 
+        // Combine the vertices and indices of all the primitives into a single vertex and index buffer so that the
+        // whole node can be drawn with one draw call. This is only redone when primitives are added, since the render
+        // graph is rebuilt whenever any of the primitives change.
+        void BuildBatchedGeometry();
+        const AZStd::vector<LyShine::UiPrimitiveVertex>& GetBatchedVertices() const { return m_batchedVertices; }
+        const AZStd::vector<uint16>& GetBatchedIndices() const { return m_batchedIndices; }
+
 #ifndef _RELEASE
         // A debug-only function useful for debugging
         void ValidateNode() override;
@@ -123,6 +130,10 @@ namespace LyShine
         int             m_totalNumIndices;
 
         LyShine::UiPrimitiveList   m_primitives;
+
+        AZStd::vector<LyShine::UiPrimitiveVertex>   m_batchedVertices;
+        AZStd::vector<uint16>                       m_batchedIndices;
+        bool                                        m_isBatchedGeometryDirty = true;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
@@ -32,6 +32,7 @@
 #include "UiTextComponentOffsetsSelector.h"
 #include "StringUtfUtils.h"
 #include "UiLayoutHelpers.h"
+#include "UiTextLayoutCache.h"
 #include "RenderGraph.h"
 
 #include <AtomLyIntegration/AtomFont/FFont.h>
@@ -1211,7 +1212,7 @@ void UiTextComponent::DrawBatch::CalculateSize(const STextDrawContext& ctx, bool
             }
         }
 
-        Vec2 textSize = font->GetTextSize(displayString.c_str(), true, ctx);
+        Vec2 textSize = UiTextLayoutCache::GetTextSize(font, displayString, ctx);
         size = AZ::Vector2(textSize.x, textSize.y);
     }
     else if (GetType() == UiTextComponent::DrawBatch::Type::Image)
@@ -2970,6 +2971,8 @@ void UiTextComponent::OnFontsReloaded()
     // Clear the font family shared pointers since they should no longer be used (their fonts have been deleted).
     // When the last one is cleared, the font family's custom deleter will be called and the object will be deleted.
     // This is OK because the custom deleter doesn't do anything if the font family is not in the CryFont's list (which it isn't)
+    // Measured text sizes refer to the deleted fonts, so they can no longer be used either.
+    UiTextLayoutCache::Clear();
     m_font = nullptr;
     m_fontFamily = nullptr;
     m_overrideFontFamily = nullptr;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UiTextLayoutCache.h"
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace
+{
+    // All of the font settings that affect the measured size of a string
+    struct TextSizeKey
+    {
+        IFFont* m_font;
+        AZStd::string m_text;
+        unsigned int m_fxIdx;
+        float m_sizeX;
+        float m_sizeY;
+        float m_widthScale;
+        float m_lineSpacing;
+        float m_tracking;
+        bool m_proportional;
+        bool m_sizeIn800x600;
+        bool m_kerningEnabled;
+        bool m_processSpecialChars;
+
+        bool operator==(const TextSizeKey& rhs) const
+        {
+            return m_font == rhs.m_font && m_text == rhs.m_text && m_fxIdx == rhs.m_fxIdx && m_sizeX == rhs.m_sizeX &&
+                m_sizeY == rhs.m_sizeY && m_widthScale == rhs.m_widthScale && m_lineSpacing == rhs.m_lineSpacing &&
+                m_tracking == rhs.m_tracking && m_proportional == rhs.m_proportional && m_sizeIn800x600 == rhs.m_sizeIn800x600 &&
+                m_kerningEnabled == rhs.m_kerningEnabled && m_processSpecialChars == rhs.m_processSpecialChars;
+        }
+    };
+
+    struct TextSizeKeyHash
+    {
+        size_t operator()(const TextSizeKey& key) const
+        {
+            size_t seed = 0;
+            AZStd::hash_combine(seed, key.m_font, key.m_text, key.m_fxIdx, key.m_sizeX, key.m_sizeY, key.m_widthScale, key.m_lineSpacing);
+            AZStd::hash_combine(seed, key.m_tracking, key.m_proportional, key.m_sizeIn800x600, key.m_kerningEnabled, key.m_processSpecialChars);
+            return seed;
+        }
+    };
+
+    using TextSizeMap = AZStd::unordered_map<TextSizeKey, Vec2, TextSizeKeyHash>;
+
+    struct TextSizeCache
+    {
+        AZStd::mutex m_mutex;
+        TextSizeMap m_sizes;
+    };
+
+    TextSizeCache& GetTextSizeCache()
+    {
+        static TextSizeCache cache;
+        return cache;
+    }
+}
+
+namespace UiTextLayoutCache
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    Vec2 GetTextSize(IFFont* font, const AZStd::string& text, const STextDrawContext& ctx)
+    {
+        TextSizeKey key{ font, text, ctx.m_fxIdx, ctx.m_size.x, ctx.m_size.y, ctx.m_widthScale, ctx.m_lineSpacing, ctx.m_tracking,
+            ctx.m_proportional, ctx.m_sizeIn800x600, ctx.m_kerningEnabled, ctx.m_processSpecialChars };
+
+        TextSizeCache& cache = GetTextSizeCache();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(cache.m_mutex);
+            auto iter = cache.m_sizes.find(key);
+            if (iter != cache.m_sizes.end())
+            {
+                return iter->second;
+            }
+        }
+
+        // Measure the text outside of the lock since it can be slow for long strings
+        Vec2 textSize = font->GetTextSize(text.c_str(), true, ctx);
+
+        AZStd::lock_guard<AZStd::mutex> lock(cache.m_mutex);
+        if (cache.m_sizes.size() >= MaxEntries)
+        {
+            cache.m_sizes.clear();
+        }
+        cache.m_sizes.emplace(AZStd::move(key), textSize);
+
+        return textSize;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void Clear()
+    {
+        TextSizeCache& cache = GetTextSizeCache();
+        AZStd::lock_guard<AZStd::mutex> lock(cache.m_mutex);
+        // Swap with an empty map rather than clearing, so that the memory of the buckets is released as well
+        TextSizeMap().swap(cache.m_sizes);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t GetNumEntries()
+    {
+        TextSizeCache& cache = GetTextSizeCache();
+        AZStd::lock_guard<AZStd::mutex> lock(cache.m_mutex);
+        return cache.m_sizes.size();
+    }
+}
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/string/string.h>
+#include <IFont.h>
+
+//! Caches the measured size of text strings so that text components with the same text, font and font settings
+//! don't each need to measure the glyphs again whenever their layout is recalculated.
+namespace UiTextLayoutCache
+{
+    //! The maximum number of measured strings to keep around. The cache is cleared when it's full.
+    constexpr size_t MaxEntries = 4096;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Get the size of a string as returned by IFFont::GetTextSize with multi-line support enabled,
+    //! measuring the string with the font if the same string hasn't been measured with the same font settings yet
+    Vec2 GetTextSize(IFFont* font, const AZStd::string& text, const STextDrawContext& ctx);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Remove all the measured strings and release their memory, this must be called whenever fonts are reloaded
+    void Clear();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Get the number of measured strings currently in the cache
+    size_t GetNumEntries();
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <gmock/gmock.h>
+#include <IFont.h>
+
+class IFFontMock
+    : public IFFont
+{
+public:
+    MOCK_METHOD0(AddRef, int32 ());
+    MOCK_METHOD0(Release, int32 ());
+    MOCK_METHOD7(Load, bool (const char*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, float));
+    MOCK_METHOD1(Load, bool (const char*));
+    MOCK_METHOD0(Free, void ());
+    MOCK_METHOD5(DrawString, void (float, float, const char*, const bool, const STextDrawContext&));
+    MOCK_METHOD6(DrawString, void (float, float, float, const char*, const bool, const STextDrawContext&));
+    MOCK_METHOD3(GetTextSize, Vec2 (const char*, const bool, const STextDrawContext&));
+    MOCK_CONST_METHOD2(GetTextLength, size_t (const char*, const bool));
+    MOCK_METHOD4(WrapText, void (AZStd::string&, float, const char*, const STextDrawContext&));
+    MOCK_CONST_METHOD4(GetGradientTextureCoord, void (float&, float&, float&, float&));
+    MOCK_CONST_METHOD1(GetEffectId, unsigned int (const char*));
+    MOCK_CONST_METHOD0(GetNumEffects, unsigned int ());
+    MOCK_CONST_METHOD1(GetEffectName, const char* (unsigned int));
+    MOCK_CONST_METHOD1(GetMaxEffectOffset, Vec2 (unsigned int));
+    MOCK_CONST_METHOD1(DoesEffectHaveTransparency, bool (unsigned int));
+    MOCK_METHOD3(AddCharsToFontTexture, void (const char*, int, int));
+    MOCK_CONST_METHOD3(GetKerning, Vec2 (uint32_t, uint32_t, const STextDrawContext&));
+    MOCK_CONST_METHOD1(GetAscender, float (const STextDrawContext&));
+    MOCK_CONST_METHOD1(GetBaseline, float (const STextDrawContext&));
+    MOCK_CONST_METHOD0(GetSizeRatio, float ());
+    MOCK_METHOD3(GetNumQuadsForText, uint32 (const char*, const bool, const STextDrawContext&));
+    MOCK_METHOD9(WriteTextQuadsToBuffers, uint32 (SVF_P2F_C4B_T2F_F4B*, uint16*, uint32, float, float, float, const char*, const bool, const STextDrawContext&));
+    MOCK_METHOD0(GetFontTextureId, int ());
+    MOCK_METHOD0(GetFontTextureVersion, uint32 ());
+};
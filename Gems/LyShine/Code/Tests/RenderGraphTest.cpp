@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LyShineTest.h"
+#include <RenderGraph.h>
+
+namespace UnitTest
+{
+    // Exposes the render nodes of the render graph so that the batching can be verified
+    class TestRenderGraph
+        : public LyShine::RenderGraph
+    {
+    public:
+        const AZStd::vector<LyShine::RenderNode*>& GetRenderNodes() const { return m_renderNodes; }
+    };
+
+    // A set of quad primitives that mimics a canvas with many image elements
+    class RenderGraphTestQuads
+    {
+    public:
+        explicit RenderGraphTestQuads(int numQuads)
+            : m_vertices(numQuads * NumVerticesPerQuad)
+            , m_indices(numQuads * NumIndicesPerQuad)
+            , m_primitives(numQuads)
+        {
+            const uint16 quadIndices[NumIndicesPerQuad] = { 0, 1, 2, 2, 3, 0 };
+            for (int quad = 0; quad < numQuads; ++quad)
+            {
+                LyShine::UiPrimitive& primitive = m_primitives[quad];
+                primitive.m_vertices = &m_vertices[quad * NumVerticesPerQuad];
+                primitive.m_numVertices = NumVerticesPerQuad;
+                primitive.m_indices = &m_indices[quad * NumIndicesPerQuad];
+                primitive.m_numIndices = NumIndicesPerQuad;
+
+                for (int vertex = 0; vertex < NumVerticesPerQuad; ++vertex)
+                {
+                    primitive.m_vertices[vertex].xy = Vec2(static_cast<float>(quad), static_cast<float>(vertex));
+                    primitive.m_vertices[vertex].texIndex = 0;
+                }
+                AZStd::copy(AZStd::begin(quadIndices), AZStd::end(quadIndices), primitive.m_indices);
+            }
+        }
+
+        void AddToRenderGraph(LyShine::RenderGraph& renderGraph)
+        {
+            for (LyShine::UiPrimitive& primitive : m_primitives)
+            {
+                renderGraph.AddPrimitive(&primitive, {}, false, false, false, LyShine::BlendMode::Normal);
+            }
+            renderGraph.FinalizeGraph();
+        }
+
+        static constexpr int NumVerticesPerQuad = 4;
+        static constexpr int NumIndicesPerQuad = 6;
+
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_vertices;
+        AZStd::vector<uint16> m_indices;
+        AZStd::vector<LyShine::UiPrimitive> m_primitives;
+    };
+
+    using LyShineRenderGraphTest = LyShineTest;
+
+    TEST_F(LyShineRenderGraphTest, RenderGraph_PrimitivesWithSameRenderState_BatchedIntoSingleBuffer)
+    {
+        const int numQuads = 1000;
+        RenderGraphTestQuads quads(numQuads);
+
+        TestRenderGraph renderGraph;
+        quads.AddToRenderGraph(renderGraph);
+
+        // All the quads share a texture and blend mode so they should be in one render node
+        ASSERT_EQ(renderGraph.GetRenderNodes().size(), 1);
+        ASSERT_EQ(renderGraph.GetRenderNodes()[0]->GetType(), LyShine::RenderNodeType::PrimitiveList);
+        auto primListNode = static_cast<LyShine::PrimitiveListRenderNode*>(renderGraph.GetRenderNodes()[0]);
+
+        primListNode->BuildBatchedGeometry();
+        const auto& vertices = primListNode->GetBatchedVertices();
+        const auto& indices = primListNode->GetBatchedIndices();
+        ASSERT_EQ(vertices.size(), numQuads * RenderGraphTestQuads::NumVerticesPerQuad);
+        ASSERT_EQ(indices.size(), numQuads * RenderGraphTestQuads::NumIndicesPerQuad);
+
+        // The indices of each quad must be offset to reference that quad's vertices in the combined buffer
+        for (int quad = 0; quad < numQuads; ++quad)
+        {
+            for (int index = 0; index < RenderGraphTestQuads::NumIndicesPerQuad; ++index)
+            {
+                const uint16 batchedIndex = indices[quad * RenderGraphTestQuads::NumIndicesPerQuad + index];
+                EXPECT_EQ(vertices[batchedIndex].xy.x, static_cast<float>(quad));
+                EXPECT_EQ(vertices[batchedIndex].xy.y, static_cast<float>(quads.m_indices[quad * RenderGraphTestQuads::NumIndicesPerQuad + index]));
+            }
+        }
+    }
+
+    TEST_F(LyShineRenderGraphTest, RenderGraph_PrimitivesExceeding16BitIndices_SplitIntoMultipleBatches)
+    {
+        // Enough quads that the vertices can't be referenced by 16 bit indices in a single buffer
+        const int numQuads = 20000;
+        RenderGraphTestQuads quads(numQuads);
+
+        TestRenderGraph renderGraph;
+        quads.AddToRenderGraph(renderGraph);
+
+        ASSERT_EQ(renderGraph.GetRenderNodes().size(), 2);
+
+        size_t totalVertices = 0;
+        for (LyShine::RenderNode* renderNode : renderGraph.GetRenderNodes())
+        {
+            auto primListNode = static_cast<LyShine::PrimitiveListRenderNode*>(renderNode);
+            primListNode->BuildBatchedGeometry();
+            EXPECT_LT(primListNode->GetBatchedVertices().size(), std::numeric_limits<uint16>::max());
+            totalVertices += primListNode->GetBatchedVertices().size();
+        }
+        EXPECT_EQ(totalVertices, numQuads * RenderGraphTestQuads::NumVerticesPerQuad);
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Benchmarks building the render graph for a synthetic canvas of 1,000 elements and combining their
+    // primitives into the vertex and index buffers that get handed to the renderer.
+    // Rendering itself needs an RPI scene, so only the CPU side of the work is measured here.
+    class LyShineRenderGraphBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    BENCHMARK_DEFINE_F(LyShineRenderGraphBenchmark, BM_BuildRenderGraph)(benchmark::State& state)
+    {
+        RenderGraphTestQuads quads(static_cast<int>(state.range(0)));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TestRenderGraph renderGraph;
+            quads.AddToRenderGraph(renderGraph);
+            for (LyShine::RenderNode* renderNode : renderGraph.GetRenderNodes())
+            {
+                auto primListNode = static_cast<LyShine::PrimitiveListRenderNode*>(renderNode);
+                primListNode->BuildBatchedGeometry();
+                benchmark::DoNotOptimize(primListNode->GetBatchedVertices().data());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(LyShineRenderGraphBenchmark, BM_BuildRenderGraph)
+        ->Arg(1000)
+        ->Arg(10000)
+        ->Unit(::benchmark::kMicrosecond);
+#endif
+} // namespace UnitTest
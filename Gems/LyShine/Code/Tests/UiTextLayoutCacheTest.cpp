@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LyShineTest.h"
+#include <Mocks/IFFontMock.h>
+#include <UiTextLayoutCache.h>
+
+namespace UnitTest
+{
+    class LyShineTextLayoutCacheTest
+        : public LyShineTest
+    {
+    protected:
+        void SetUp() override
+        {
+            LyShineTest::SetUp();
+            UiTextLayoutCache::Clear();
+
+            // Report a different size for every measurement, so that a cache hit can be told apart from a new measurement
+            ON_CALL(m_font, GetTextSize(testing::_, true, testing::_))
+                .WillByDefault(
+                    [this](const char*, const bool, const STextDrawContext&)
+                    {
+                        ++m_numMeasurements;
+                        return Vec2(static_cast<float>(m_numMeasurements), 1.0f);
+                    });
+        }
+
+        void TearDown() override
+        {
+            // The cache is global, don't leave anything in it for other tests or for the leak detection
+            UiTextLayoutCache::Clear();
+            LyShineTest::TearDown();
+        }
+
+        testing::NiceMock<IFFontMock> m_font;
+        int m_numMeasurements = 0;
+    };
+
+    TEST_F(LyShineTextLayoutCacheTest, TextLayoutCache_SameTextAndSettings_MeasuredOnce)
+    {
+        STextDrawContext ctx;
+        const Vec2 firstSize = UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+        const Vec2 secondSize = UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+
+        EXPECT_EQ(m_numMeasurements, 1);
+        EXPECT_EQ(firstSize, secondSize);
+        EXPECT_EQ(UiTextLayoutCache::GetNumEntries(), 1);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, TextLayoutCache_DifferentText_MeasuredAgain)
+    {
+        STextDrawContext ctx;
+        const Vec2 firstSize = UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+        const Vec2 secondSize = UiTextLayoutCache::GetTextSize(&m_font, "Hello\nWorld", ctx);
+
+        EXPECT_EQ(m_numMeasurements, 2);
+        EXPECT_NE(firstSize, secondSize);
+        EXPECT_EQ(UiTextLayoutCache::GetNumEntries(), 2);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, TextLayoutCache_DifferentLineSpacing_MeasuredAgain)
+    {
+        // The line spacing changes the height of multi-line text, so it must not share a measurement
+        STextDrawContext ctx;
+        const Vec2 firstSize = UiTextLayoutCache::GetTextSize(&m_font, "Hello\nWorld", ctx);
+
+        ctx.SetLineSpacing(10.0f);
+        const Vec2 secondSize = UiTextLayoutCache::GetTextSize(&m_font, "Hello\nWorld", ctx);
+
+        EXPECT_EQ(m_numMeasurements, 2);
+        EXPECT_NE(firstSize, secondSize);
+
+        // Going back to the first line spacing finds the first measurement again
+        ctx.SetLineSpacing(0.0f);
+        EXPECT_EQ(UiTextLayoutCache::GetTextSize(&m_font, "Hello\nWorld", ctx), firstSize);
+        EXPECT_EQ(m_numMeasurements, 2);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, TextLayoutCache_DifferentFontSettings_MeasuredAgain)
+    {
+        STextDrawContext ctx;
+        UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+
+        ctx.SetSize(Vec2(32.0f, 32.0f));
+        UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+
+        ctx.m_tracking = 2.0f;
+        UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+
+        ctx.m_kerningEnabled = false;
+        UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+
+        EXPECT_EQ(m_numMeasurements, 4);
+        EXPECT_EQ(UiTextLayoutCache::GetNumEntries(), 4);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, TextLayoutCache_DifferentFont_MeasuredAgain)
+    {
+        testing::NiceMock<IFFontMock> otherFont;
+        ON_CALL(otherFont, GetTextSize(testing::_, true, testing::_)).WillByDefault(testing::Return(Vec2(100.0f, 1.0f)));
+
+        STextDrawContext ctx;
+        const Vec2 firstSize = UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+        const Vec2 secondSize = UiTextLayoutCache::GetTextSize(&otherFont, "Hello", ctx);
+
+        EXPECT_EQ(m_numMeasurements, 1);
+        EXPECT_NE(firstSize, secondSize);
+        EXPECT_EQ(UiTextLayoutCache::GetNumEntries(), 2);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, TextLayoutCache_Clear_MeasuredAgain)
+    {
+        STextDrawContext ctx;
+        UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+
+        UiTextLayoutCache::Clear();
+        EXPECT_EQ(UiTextLayoutCache::GetNumEntries(), 0);
+
+        UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+        EXPECT_EQ(m_numMeasurements, 2);
+    }
+
+    TEST_F(LyShineTextLayoutCacheTest, TextLayoutCache_Full_ClearedBeforeAddingMore)
+    {
+        STextDrawContext ctx;
+        for (size_t index = 0; index < UiTextLayoutCache::MaxEntries; ++index)
+        {
+            UiTextLayoutCache::GetTextSize(&m_font, AZStd::string::format("%zu", index), ctx);
+        }
+        EXPECT_EQ(UiTextLayoutCache::GetNumEntries(), UiTextLayoutCache::MaxEntries);
+
+        UiTextLayoutCache::GetTextSize(&m_font, "Hello", ctx);
+        EXPECT_EQ(UiTextLayoutCache::GetNumEntries(), 1);
+    }
+} // namespace UnitTest
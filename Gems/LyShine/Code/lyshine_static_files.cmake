@@ -194,6 +194,8 @@ set(FILES
     Source/UiTextComponent.h
     Source/UiTextComponentOffsetsSelector.cpp
     Source/UiTextComponentOffsetsSelector.h
+    Source/UiTextLayoutCache.cpp
+    Source/UiTextLayoutCache.h
     Source/UiTextInputComponent.cpp
     Source/UiTextInputComponent.h
     Source/UiTooltipComponent.cpp
@@ -9,11 +9,14 @@
 set(FILES
     Tests/LyShineTest.h
     Tests/AnimationTest.cpp
+    Tests/RenderGraphTest.cpp
     Tests/SpriteTest.cpp
     Tests/SerializationTest.cpp
     Tests/TextInputComponentTest.cpp
     Tests/UiDynamicScrollBoxComponentTest.cpp
     Tests/UiScrollBarComponentTest.cpp
     Tests/UiTooltipComponentTest.cpp
+    Tests/UiTextLayoutCacheTest.cpp
+    Tests/Mocks/IFFontMock.h
     Tests/Mocks/UiDynamicScrollBoxDataBusHandlerMock.h
 )
@@ -276,6 +276,13 @@ namespace EMotionFX::MotionMatching
                 AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
                 return false;
             }
+
+            // The brute-force broad-phase search works on the same features as the KD-tree, so that both can be swapped at runtime.
+            if (!m_quantizedFeatureMatrix.Init(m_featureMatrix, m_featuresInKdTree))
+            {
+                AZ_Error("EMotionFX", false, "Failed to initialize the quantized feature matrix.");
+                return false;
+            }
         }
 
         const float initTime = initTimer.GetDeltaTimeInSeconds();
@@ -294,5 +301,6 @@ namespace EMotionFX::MotionMatching
         m_featureMatrix.Clear();
         m_kdTree->Clear();
         m_featuresInKdTree.clear();
+        m_quantizedFeatureMatrix.Clear();
     }
 } // namespace EMotionFX::MotionMatching
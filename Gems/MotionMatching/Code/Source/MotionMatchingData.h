@@ -19,6 +19,7 @@
 #include <FrameDatabase.h>
 #include <FeatureMatrixTransformer.h>
 #include <KdTree.h>
+#include <QuantizedFeatureMatrix.h>
 
 namespace AZ
 {
@@ -71,6 +72,7 @@ namespace EMotionFX::MotionMatching
         FeatureMatrixTransformer* GetFeatureTransformer() { return m_featureTransformer.get(); }
         const KdTree& GetKdTree() const { return *m_kdTree.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
+        const QuantizedFeatureMatrix& GetQuantizedFeatureMatrix() const { return m_quantizedFeatureMatrix; }
 
     protected:
         //! Extract features from the motion database (multi-threaded).
@@ -89,5 +91,6 @@ namespace EMotionFX::MotionMatching
 
         AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
         AZStd::vector<Feature*> m_featuresInKdTree;
+        QuantizedFeatureMatrix m_quantizedFeatureMatrix; //< SoA copy of the broad-phase feature columns used by the SIMD brute-force search.
     };
 } // namespace EMotionFX::MotionMatching
@@ -39,6 +39,8 @@ namespace EMotionFX::MotionMatching
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryPose);
     AZ_CVAR_EXTERNED(bool, mm_debugDrawQueryVelocities);
     AZ_CVAR_EXTERNED(bool, mm_useKdTree);
+    AZ_CVAR_EXTERNED(bool, mm_useBruteForceBroadPhase);
+    AZ_CVAR_EXTERNED(AZ::u32, mm_bruteForceBroadPhaseNumFrames);
 
     AZ_CLASS_ALLOCATOR_IMPL(MotionMatchingInstance, MotionMatchAllocator)
 
@@ -525,7 +527,14 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            if (mm_useBruteForceBroadPhase)
+            {
+                m_data->GetQuantizedFeatureMatrix().FindNearestFrames(kdTreeQueryVector.data(), mm_bruteForceBroadPhaseNumFrames, m_nearestFrames);
+            }
+            else
+            {
+                m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            }
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
@@ -45,6 +45,13 @@ namespace EMotionFX::MotionMatching
         "Use Kd-Tree to accelerate the motion matching search for the best next matching frame. "
         "Disabling it will heavily slow down performance and should only be done for debugging purposes");
 
+    AZ_CVAR(bool, mm_useBruteForceBroadPhase, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Use the SIMD brute-force search on the quantized feature matrix instead of the Kd-Tree for the broad-phase search. "
+        "Only used in case mm_useKdTree is enabled.");
+
+    AZ_CVAR(AZ::u32, mm_bruteForceBroadPhaseNumFrames, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of nearest frames the brute-force broad-phase search passes on to the narrow-phase search.");
+
     AZ_CVAR(bool, mm_multiThreadedInitialization, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Use multi-threading to initialize motion matching.");
 
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+
+#include <Allocators.h>
+#include <QuantizedFeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(QuantizedFeatureMatrix, MotionMatchAllocator)
+
+    AZStd::vector<size_t> QuantizedFeatureMatrix::CalcFeatureColumns(const AZStd::vector<Feature*>& features)
+    {
+        AZStd::vector<size_t> columns;
+        for (const Feature* feature : features)
+        {
+            const size_t numDimensions = feature->GetNumDimensions();
+            const size_t featureColumnOffset = feature->GetColumnOffset();
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                columns.push_back(featureColumnOffset + i);
+            }
+        }
+        return columns;
+    }
+
+    bool QuantizedFeatureMatrix::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features)
+    {
+        return Init(featureMatrix, CalcFeatureColumns(features));
+    }
+
+    bool QuantizedFeatureMatrix::Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns)
+    {
+        AZ_PROFILE_SCOPE(Animation, "QuantizedFeatureMatrix::Init");
+
+        Clear();
+
+        const size_t numFrames = static_cast<size_t>(featureMatrix.rows());
+        const size_t numColumns = static_cast<size_t>(featureMatrix.cols());
+        if (numFrames == 0 || columns.empty())
+        {
+            return true;
+        }
+
+        for (const size_t column : columns)
+        {
+            if (column >= numColumns)
+            {
+                AZ_Error("Motion Matching", false, "Cannot quantize feature matrix. Column index (%zu) out of range (%zu columns).", column, numColumns);
+                return false;
+            }
+        }
+
+        m_numFrames = numFrames;
+        m_numPaddedFrames = ((numFrames + s_numFramesPerBlock - 1) / s_numFramesPerBlock) * s_numFramesPerBlock;
+        m_numDimensions = columns.size();
+        m_scales.resize(m_numDimensions);
+        m_offsets.resize(m_numDimensions);
+        m_values.resize(m_numPaddedFrames * m_numDimensions, 0);
+
+        constexpr float numQuantizationSteps = 65535.0f;
+        constexpr float minQuantizedValue = -32768.0f;
+        for (size_t localColumn = 0; localColumn < m_numDimensions; ++localColumn)
+        {
+            const size_t column = columns[localColumn];
+
+            float minValue = AZStd::numeric_limits<float>::max();
+            float maxValue = -AZStd::numeric_limits<float>::max();
+            for (size_t row = 0; row < numFrames; ++row)
+            {
+                const float value = featureMatrix(row, column);
+                minValue = AZ::GetMin(minValue, value);
+                maxValue = AZ::GetMax(maxValue, value);
+            }
+
+            // Map [minValue, maxValue] to the full int16 range. Constant columns all map to zero.
+            const float range = maxValue - minValue;
+            const float scale = (range > AZ::Constants::FloatEpsilon) ? range / numQuantizationSteps : 1.0f;
+            const float offset = (range > AZ::Constants::FloatEpsilon) ? minValue - minQuantizedValue * scale : minValue;
+            m_scales[localColumn] = scale;
+            m_offsets[localColumn] = offset;
+
+            AZ::s16* columnValues = &m_values[localColumn * m_numPaddedFrames];
+            for (size_t row = 0; row < numFrames; ++row)
+            {
+                const float quantized = AZStd::round((featureMatrix(row, column) - offset) / scale);
+                columnValues[row] = static_cast<AZ::s16>(AZ::GetClamp(quantized, -32768.0f, 32767.0f));
+            }
+        }
+
+        return true;
+    }
+
+    void QuantizedFeatureMatrix::Clear()
+    {
+        m_values.clear();
+        m_values.shrink_to_fit();
+        m_scales.clear();
+        m_offsets.clear();
+        m_numFrames = 0;
+        m_numPaddedFrames = 0;
+        m_numDimensions = 0;
+    }
+
+    size_t QuantizedFeatureMatrix::CalcMemoryUsageInBytes() const
+    {
+        return sizeof(QuantizedFeatureMatrix) +
+            m_values.capacity() * sizeof(AZ::s16) +
+            m_scales.capacity() * sizeof(float) +
+            m_offsets.capacity() * sizeof(float);
+    }
+
+    float QuantizedFeatureMatrix::GetValue(size_t frameIndex, size_t localColumn) const
+    {
+        AZ_Assert(frameIndex < m_numFrames && localColumn < m_numDimensions, "Quantized feature matrix index out of range.");
+        return static_cast<float>(m_values[localColumn * m_numPaddedFrames + frameIndex]) * m_scales[localColumn] + m_offsets[localColumn];
+    }
+
+    void QuantizedFeatureMatrix::FindNearestFrames(const float* query, size_t maxNumResults, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "QuantizedFeatureMatrix::FindNearestFrames");
+        FindNearestFramesForBatch(query, 1, maxNumResults, &resultFrameIndices);
+    }
+
+    void QuantizedFeatureMatrix::FindNearestFramesBatched(const float* queries, size_t numQueries, size_t maxNumResults, AZStd::vector<AZStd::vector<size_t>>& resultFrameIndices) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "QuantizedFeatureMatrix::FindNearestFramesBatched");
+
+        resultFrameIndices.resize(numQueries);
+        for (size_t firstQuery = 0; firstQuery < numQueries; firstQuery += s_numQueriesPerBatch)
+        {
+            const size_t numBatchQueries = AZ::GetMin(s_numQueriesPerBatch, numQueries - firstQuery);
+            FindNearestFramesForBatch(&queries[firstQuery * m_numDimensions], numBatchQueries, maxNumResults, &resultFrameIndices[firstQuery]);
+        }
+    }
+
+    void QuantizedFeatureMatrix::FindNearestFramesForBatch(const float* queries, size_t numQueries, size_t maxNumResults, AZStd::vector<size_t>* resultFrameIndices) const
+    {
+        using namespace AZ::Simd;
+        AZ_Assert(numQueries > 0 && numQueries <= s_numQueriesPerBatch, "Invalid number of queries (%zu) for a batch.", numQueries);
+
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            resultFrameIndices[q].clear();
+        }
+
+        if (!IsInitialized() || maxNumResults == 0)
+        {
+            return;
+        }
+
+        // Bring the queries into the quantized space of each column, so that the inner loop only needs a subtraction.
+        // The squared distance in feature space is then scale^2 * (quantizedValue - quantizedQuery)^2.
+        AZStd::vector<float> quantizedQueries(numQueries * m_numDimensions);
+        AZStd::vector<float> weights(m_numDimensions);
+        for (size_t d = 0; d < m_numDimensions; ++d)
+        {
+            weights[d] = m_scales[d] * m_scales[d];
+            for (size_t q = 0; q < numQueries; ++q)
+            {
+                quantizedQueries[q * m_numDimensions + d] = (queries[q * m_numDimensions + d] - m_offsets[d]) / m_scales[d];
+            }
+        }
+
+        // Max-heaps holding the nearest frames found so far, the worst of them on top.
+        AZStd::vector<FrameDistance> heaps[s_numQueriesPerBatch];
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            heaps[q].reserve(maxNumResults);
+        }
+
+        alignas(16) float distances[s_numQueriesPerBatch][s_numFramesPerBlock];
+        alignas(16) AZ::s32 expanded[4];
+        for (size_t blockStart = 0; blockStart < m_numFrames; blockStart += s_numFramesPerBlock)
+        {
+            for (size_t q = 0; q < numQueries; ++q)
+            {
+                memset(distances[q], 0, sizeof(distances[q]));
+            }
+
+            // Accumulate the weighted squared distances column by column. The values of a column are contiguous in memory.
+            for (size_t d = 0; d < m_numDimensions; ++d)
+            {
+                const AZ::s16* columnValues = &m_values[d * m_numPaddedFrames + blockStart];
+                const Vec4::FloatType weight = Vec4::Splat(weights[d]);
+
+                Vec4::FloatType queryValues[s_numQueriesPerBatch];
+                for (size_t q = 0; q < numQueries; ++q)
+                {
+                    queryValues[q] = Vec4::Splat(quantizedQueries[q * m_numDimensions + d]);
+                }
+
+                for (size_t i = 0; i < s_numFramesPerBlock; i += 4)
+                {
+                    expanded[0] = columnValues[i + 0];
+                    expanded[1] = columnValues[i + 1];
+                    expanded[2] = columnValues[i + 2];
+                    expanded[3] = columnValues[i + 3];
+                    const Vec4::FloatType values = Vec4::ConvertToFloat(Vec4::LoadAligned(expanded));
+
+                    for (size_t q = 0; q < numQueries; ++q)
+                    {
+                        const Vec4::FloatType diff = Vec4::Sub(values, queryValues[q]);
+                        const Vec4::FloatType accumulated = Vec4::LoadAligned(&distances[q][i]);
+                        Vec4::StoreAligned(&distances[q][i], Vec4::Madd(Vec4::Mul(diff, weight), diff, accumulated));
+                    }
+                }
+            }
+
+            // Feed the block results into the per-query heaps. The padded frames at the end of the last block are skipped.
+            const size_t numBlockFrames = AZ::GetMin(s_numFramesPerBlock, m_numFrames - blockStart);
+            for (size_t q = 0; q < numQueries; ++q)
+            {
+                AZStd::vector<FrameDistance>& heap = heaps[q];
+                for (size_t i = 0; i < numBlockFrames; ++i)
+                {
+                    const float distance = distances[q][i];
+                    if (heap.size() < maxNumResults)
+                    {
+                        heap.emplace_back(distance, blockStart + i);
+                        AZStd::push_heap(heap.begin(), heap.end());
+                    }
+                    else if (distance < heap.front().first)
+                    {
+                        AZStd::pop_heap(heap.begin(), heap.end());
+                        heap.back() = FrameDistance(distance, blockStart + i);
+                        AZStd::push_heap(heap.begin(), heap.end());
+                    }
+                }
+            }
+        }
+
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            AZStd::vector<FrameDistance>& heap = heaps[q];
+            AZStd::sort_heap(heap.begin(), heap.end());
+
+            AZStd::vector<size_t>& result = resultFrameIndices[q];
+            result.reserve(heap.size());
+            for (const FrameDistance& frameDistance : heap)
+            {
+                result.emplace_back(frameDistance.second);
+            }
+        }
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Quantized, structure-of-arrays copy of the broad-phase columns of the feature matrix.
+    //! The feature matrix stores the values for a frame next to each other (row-major), which is what the narrow-phase cost functions need.
+    //! The broad-phase search on the other hand compares a query vector against every frame in the database, which vectorizes a lot better
+    //! when the values of a single column are stored next to each other. Each column is quantized to 16-bit integers using a per-column
+    //! scale and offset, which halves the memory bandwidth needed compared to the float values in the feature matrix.
+    //! The nearest frames are found with a SIMD brute-force search, which can be used instead of the KD-tree (see mm_useBruteForceBroadPhase).
+    //! Queries for multiple characters can be evaluated in a single pass over the data using FindNearestFramesBatched().
+    class EMFX_API QuantizedFeatureMatrix
+    {
+    public:
+        AZ_RTTI(QuantizedFeatureMatrix, "{5C1F7F4B-2B7D-4C43-8B0A-6E4E5A0F2D31}");
+        AZ_CLASS_ALLOCATOR_DECL
+
+        QuantizedFeatureMatrix() = default;
+        virtual ~QuantizedFeatureMatrix() = default;
+
+        //! Quantize the given feature matrix columns. The order of the columns defines the order of the values expected in the query vectors.
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<size_t>& columns);
+
+        //! Quantize the columns used by the given features, in the same order as the KD-tree expects its query values.
+        bool Init(const FeatureMatrix& featureMatrix, const AZStd::vector<Feature*>& features);
+
+        //! Calculate the feature matrix column indices for the given feature set.
+        static AZStd::vector<size_t> CalcFeatureColumns(const AZStd::vector<Feature*>& features);
+
+        void Clear();
+
+        bool IsInitialized() const { return m_numDimensions != 0; }
+        size_t GetNumFrames() const { return m_numFrames; }
+        size_t GetNumDimensions() const { return m_numDimensions; }
+        size_t CalcMemoryUsageInBytes() const;
+
+        //! Get the dequantized value for the given frame and local column index.
+        float GetValue(size_t frameIndex, size_t localColumn) const;
+
+        //! Find the frames with the smallest squared distance to the query.
+        //! @param[in] query Query values, one for each quantized column.
+        //! @param[in] maxNumResults The maximum number of frames to return.
+        //! @param[out] resultFrameIndices The nearest frames, sorted by distance with the nearest frame first.
+        void FindNearestFrames(const float* query, size_t maxNumResults, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        //! Batched version of FindNearestFrames().
+        //! All queries are evaluated in one pass over the quantized data, so that every loaded column block is compared against several queries.
+        //! @param[in] queries The query values for all queries, stored one query after another with GetNumDimensions() values each.
+        //! @param[in] numQueries The number of queries.
+        //! @param[in] maxNumResults The maximum number of frames to return per query.
+        //! @param[out] resultFrameIndices The nearest frames for each of the queries.
+        void FindNearestFramesBatched(const float* queries, size_t numQueries, size_t maxNumResults, AZStd::vector<AZStd::vector<size_t>>& resultFrameIndices) const;
+
+        //! Number of frames (rows) processed in one block. Must be a multiple of the SIMD width.
+        static constexpr size_t s_numFramesPerBlock = 256;
+
+        //! Number of queries evaluated against a block of frames at the same time.
+        static constexpr size_t s_numQueriesPerBatch = 4;
+
+    private:
+        using FrameDistance = AZStd::pair<float, size_t>;
+
+        void FindNearestFramesForBatch(const float* queries, size_t numQueries, size_t maxNumResults, AZStd::vector<size_t>* resultFrameIndices) const;
+
+        AZStd::vector<AZ::s16> m_values; //!< Column-major quantized values. Each column holds m_numPaddedFrames values.
+        AZStd::vector<float> m_scales; //!< Per-column scale used to dequantize the values.
+        AZStd::vector<float> m_offsets; //!< Per-column offset used to dequantize the values.
+        size_t m_numFrames = 0;
+        size_t m_numPaddedFrames = 0; //!< Number of frames rounded up to the block size.
+        size_t m_numDimensions = 0;
+    };
+} // namespace EMotionFX::MotionMatching
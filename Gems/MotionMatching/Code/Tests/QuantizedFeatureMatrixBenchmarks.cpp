@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <FeatureMatrix.h>
+#include <QuantizedFeatureMatrix.h>
+#include <benchmark/benchmark.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Benchmarks the broad-phase nearest frame search for a synthetic feature database.
+    //! Arguments: number of frames in the database, number of queries (characters) searched per iteration.
+    class QuantizedFeatureMatrixBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            const size_t numFrames = aznumeric_cast<size_t>(state.range(0));
+            const size_t numQueries = aznumeric_cast<size_t>(state.range(1));
+
+            AZ::SimpleLcgRandom random(1234);
+            m_featureMatrix = AZStd::make_unique<FeatureMatrix>();
+            m_featureMatrix->resize(numFrames, s_numDimensions);
+            for (size_t row = 0; row < numFrames; ++row)
+            {
+                for (size_t column = 0; column < s_numDimensions; ++column)
+                {
+                    (*m_featureMatrix)(row, column) = random.GetRandomFloat() * 2.0f - 1.0f;
+                }
+            }
+
+            AZStd::vector<size_t> columns(s_numDimensions);
+            for (size_t column = 0; column < s_numDimensions; ++column)
+            {
+                columns[column] = column;
+            }
+
+            m_quantizedMatrix = AZStd::make_unique<QuantizedFeatureMatrix>();
+            m_quantizedMatrix->Init(*m_featureMatrix, columns);
+
+            m_queries.resize(numQueries * s_numDimensions);
+            for (float& value : m_queries)
+            {
+                value = random.GetRandomFloat() * 2.0f - 1.0f;
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_quantizedMatrix.reset();
+            m_featureMatrix.reset();
+            m_queries = {};
+            m_results = {};
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        static constexpr size_t s_numDimensions = 24;
+        static constexpr size_t s_numResults = 256;
+
+        AZStd::unique_ptr<FeatureMatrix> m_featureMatrix;
+        AZStd::unique_ptr<QuantizedFeatureMatrix> m_quantizedMatrix;
+        AZStd::vector<float> m_queries;
+        AZStd::vector<AZStd::vector<size_t>> m_results;
+    };
+
+    BENCHMARK_DEFINE_F(QuantizedFeatureMatrixBenchmarkFixture, BM_FindNearestFrames)(benchmark::State& state)
+    {
+        const size_t numQueries = aznumeric_cast<size_t>(state.range(1));
+        m_results.resize(numQueries);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t q = 0; q < numQueries; ++q)
+            {
+                m_quantizedMatrix->FindNearestFrames(&m_queries[q * s_numDimensions], s_numResults, m_results[q]);
+            }
+            benchmark::DoNotOptimize(m_results.data());
+        }
+
+        // Reported as items_per_second, which is the number of queries per second.
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+
+    BENCHMARK_DEFINE_F(QuantizedFeatureMatrixBenchmarkFixture, BM_FindNearestFramesBatched)(benchmark::State& state)
+    {
+        const size_t numQueries = aznumeric_cast<size_t>(state.range(1));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_quantizedMatrix->FindNearestFramesBatched(m_queries.data(), numQueries, s_numResults, m_results);
+            benchmark::DoNotOptimize(m_results.data());
+        }
+
+        // Reported as items_per_second, which is the number of queries per second.
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+
+    BENCHMARK_REGISTER_F(QuantizedFeatureMatrixBenchmarkFixture, BM_FindNearestFrames)
+        ->Args({ 10000, 1 })
+        ->Args({ 10000, 16 })
+        ->Args({ 10000, 64 })
+        ->Args({ 50000, 1 })
+        ->Args({ 50000, 16 })
+        ->Args({ 50000, 64 })
+        ->Args({ 200000, 1 })
+        ->Args({ 200000, 16 })
+        ->Args({ 200000, 64 })
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(QuantizedFeatureMatrixBenchmarkFixture, BM_FindNearestFramesBatched)
+        ->Args({ 10000, 1 })
+        ->Args({ 10000, 16 })
+        ->Args({ 10000, 64 })
+        ->Args({ 50000, 1 })
+        ->Args({ 50000, 16 })
+        ->Args({ 50000, 64 })
+        ->Args({ 200000, 1 })
+        ->Args({ 200000, 16 })
+        ->Args({ 200000, 64 })
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif // HAVE_BENCHMARK
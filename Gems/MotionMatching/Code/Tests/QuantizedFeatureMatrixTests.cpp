@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <Fixture.h>
+#include <FeatureMatrix.h>
+#include <QuantizedFeatureMatrix.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class QuantizedFeatureMatrixFixture
+        : public Fixture
+    {
+    public:
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            AZ::SimpleLcgRandom random(1234);
+            m_featureMatrix.resize(s_numFrames, s_numColumns);
+            for (size_t row = 0; row < s_numFrames; ++row)
+            {
+                for (size_t column = 0; column < s_numColumns; ++column)
+                {
+                    m_featureMatrix(row, column) = random.GetRandomFloat() * 10.0f - 5.0f;
+                }
+            }
+
+            // Use all but the first column, in reversed order, to make sure the local to feature matrix column mapping is respected.
+            for (size_t column = s_numColumns - 1; column > 0; --column)
+            {
+                m_columns.push_back(column);
+            }
+        }
+
+        void TearDown() override
+        {
+            m_featureMatrix.Clear();
+            m_columns = {};
+            Fixture::TearDown();
+        }
+
+        size_t FindNearestFrameExact(const float* query) const
+        {
+            float minDistance = FLT_MAX;
+            size_t minFrameIndex = 0;
+            for (size_t row = 0; row < s_numFrames; ++row)
+            {
+                float distance = 0.0f;
+                for (size_t i = 0; i < m_columns.size(); ++i)
+                {
+                    const float diff = m_featureMatrix(row, m_columns[i]) - query[i];
+                    distance += diff * diff;
+                }
+
+                if (distance < minDistance)
+                {
+                    minDistance = distance;
+                    minFrameIndex = row;
+                }
+            }
+            return minFrameIndex;
+        }
+
+        static constexpr size_t s_numFrames = 1000; // Not a multiple of the block size on purpose.
+        static constexpr size_t s_numColumns = 7;
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<size_t> m_columns;
+    };
+
+    TEST_F(QuantizedFeatureMatrixFixture, Init)
+    {
+        QuantizedFeatureMatrix quantizedMatrix;
+        EXPECT_FALSE(quantizedMatrix.IsInitialized());
+        EXPECT_TRUE(quantizedMatrix.Init(m_featureMatrix, m_columns));
+        EXPECT_TRUE(quantizedMatrix.IsInitialized());
+        EXPECT_EQ(quantizedMatrix.GetNumFrames(), s_numFrames);
+        EXPECT_EQ(quantizedMatrix.GetNumDimensions(), m_columns.size());
+
+        quantizedMatrix.Clear();
+        EXPECT_FALSE(quantizedMatrix.IsInitialized());
+    }
+
+    TEST_F(QuantizedFeatureMatrixFixture, InvalidColumn)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        QuantizedFeatureMatrix quantizedMatrix;
+        EXPECT_FALSE(quantizedMatrix.Init(m_featureMatrix, AZStd::vector<size_t>{ s_numColumns }));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+
+    TEST_F(QuantizedFeatureMatrixFixture, DequantizedValues)
+    {
+        QuantizedFeatureMatrix quantizedMatrix;
+        ASSERT_TRUE(quantizedMatrix.Init(m_featureMatrix, m_columns));
+
+        // The values span a range of 10 units, quantized into 65536 steps.
+        const float tolerance = 10.0f / 65535.0f;
+        for (size_t row = 0; row < s_numFrames; ++row)
+        {
+            for (size_t i = 0; i < m_columns.size(); ++i)
+            {
+                EXPECT_NEAR(quantizedMatrix.GetValue(row, i), m_featureMatrix(row, m_columns[i]), tolerance);
+            }
+        }
+    }
+
+    TEST_F(QuantizedFeatureMatrixFixture, FindNearestFrames)
+    {
+        QuantizedFeatureMatrix quantizedMatrix;
+        ASSERT_TRUE(quantizedMatrix.Init(m_featureMatrix, m_columns));
+
+        // Querying an existing frame has to return that frame first.
+        AZStd::vector<float> query(m_columns.size());
+        AZStd::vector<size_t> result;
+        for (size_t frameIndex : { size_t{0}, size_t{255}, size_t{256}, s_numFrames - 1 })
+        {
+            for (size_t i = 0; i < m_columns.size(); ++i)
+            {
+                query[i] = m_featureMatrix(frameIndex, m_columns[i]);
+            }
+
+            quantizedMatrix.FindNearestFrames(query.data(), 10, result);
+            ASSERT_EQ(result.size(), 10);
+            EXPECT_EQ(result[0], frameIndex);
+            EXPECT_EQ(result[0], FindNearestFrameExact(query.data()));
+        }
+
+        // Asking for more frames than available returns all of them, without the padding.
+        quantizedMatrix.FindNearestFrames(query.data(), s_numFrames * 2, result);
+        EXPECT_EQ(result.size(), s_numFrames);
+    }
+
+    TEST_F(QuantizedFeatureMatrixFixture, FindNearestFramesBatched)
+    {
+        QuantizedFeatureMatrix quantizedMatrix;
+        ASSERT_TRUE(quantizedMatrix.Init(m_featureMatrix, m_columns));
+
+        // Use a number of queries that is not a multiple of the batch size.
+        const size_t numQueries = QuantizedFeatureMatrix::s_numQueriesPerBatch * 2 + 1;
+        const size_t numDimensions = m_columns.size();
+        AZ::SimpleLcgRandom random(5678);
+        AZStd::vector<float> queries(numQueries * numDimensions);
+        for (float& value : queries)
+        {
+            value = random.GetRandomFloat() * 10.0f - 5.0f;
+        }
+
+        AZStd::vector<AZStd::vector<size_t>> batchedResults;
+        quantizedMatrix.FindNearestFramesBatched(queries.data(), numQueries, 16, batchedResults);
+        ASSERT_EQ(batchedResults.size(), numQueries);
+
+        AZStd::vector<size_t> result;
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            quantizedMatrix.FindNearestFrames(&queries[q * numDimensions], 16, result);
+            EXPECT_EQ(batchedResults[q], result);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
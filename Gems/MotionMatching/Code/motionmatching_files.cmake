@@ -45,6 +45,8 @@ set(FILES
     Source/PoseDataJointVelocities.h
     Source/QueryVector.cpp
     Source/QueryVector.h
+    Source/QuantizedFeatureMatrix.cpp
+    Source/QuantizedFeatureMatrix.h
     Source/TrajectoryHistory.cpp
     Source/TrajectoryHistory.h
     Source/TrajectoryQuery.cpp
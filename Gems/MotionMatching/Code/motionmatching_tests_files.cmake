@@ -12,5 +12,7 @@ set(FILES
     Tests/FeatureSchemaTests.cpp
     Tests/MinMaxScalerTests.cpp
     Tests/MotionMatchingTest.cpp
+    Tests/QuantizedFeatureMatrixBenchmarks.cpp
+    Tests/QuantizedFeatureMatrixTests.cpp
     Tests/StandardScalerTests.cpp
 )
\ No newline at end of file
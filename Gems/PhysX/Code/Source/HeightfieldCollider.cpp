@@ -288,11 +288,14 @@ namespace PhysX
 
         if (!m_jobContext->IsCanceled() && (numRows > 0) && (numColumns > 0))
         {
-            // Refresh a subset of the PhysX heightfield.
+            // Patch a subset of the PhysX heightfield samples in place.
             // This assumes that the shape configuration for this region has already been updated.
+            // The shape in the scene only picks up the new samples once RefreshComplete refreshes its geometry, which lets us
+            // take the scene write lock once per refresh instead of once per block of rows.
             // NOTE: For a given heightfield, only one of these calls should be executed at a time, since the underlying PhysX
             // heightfield has no thread safety protections and modifies min/max height data global to the heightfield on every refresh.
-            Utils::RefreshHeightfieldShape(scene, &(*shape), *m_shapeConfig, startColumn, startRow, numColumns, numRows);
+            Utils::ModifyHeightfieldSamples(*m_shapeConfig, startColumn, startRow, numColumns, numRows);
+            m_heightfieldSamplesModified = true;
 
             // Reduce our dirty region by the number of rows that we're processing in this piece of the update job chain.
             // We've updated both the shape configuration and the PhysX heightfield at this point, so those rows have completed
@@ -304,13 +307,22 @@ namespace PhysX
         }
     }
 
-    void HeightfieldCollider::RefreshComplete()
+    void HeightfieldCollider::RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape)
     {
         // This method is called by an update job to signal that the chain of update jobs have completed.
 
-        // If the job hasn't been canceled, notify any listeners that the collider has changed.
+        // If the job hasn't been canceled, refresh the shape in the scene with the patched samples and notify any listeners that
+        // the collider has changed.
+        // A canceled job leaves the scene alone, since whoever canceled it is blocking on it and is about to either remove the shape
+        // or start a new refresh. Any samples it did patch stay flagged, so that the next refresh applies them to the scene.
         if (!m_jobContext->IsCanceled())
         {
+            if (m_heightfieldSamplesModified)
+            {
+                Utils::RefreshHeightfieldShapeGeometry(scene, &(*shape), *m_shapeConfig);
+                m_heightfieldSamplesModified = false;
+            }
+
             m_dirtyRegion.SetNull();
             Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
         }
@@ -403,6 +415,7 @@ namespace PhysX
         {
             // Destroy the existing heightfield. This will completely remove it from the world.
             ClearHeightfield();
+            m_heightfieldSamplesModified = false;
 
             *m_shapeConfig = Utils::CreateBaseHeightfieldShapeConfiguration(m_entityId);
             size_t numSamples = m_shapeConfig->GetNumRowVertices() * m_shapeConfig->GetNumColumnVertices();
@@ -446,17 +459,24 @@ namespace PhysX
         size_t numColumns = m_dirtyRegion.m_maxColumnVertex - m_dirtyRegion.m_minColumnVertex;
         size_t numRows = m_dirtyRegion.m_maxRowVertex - m_dirtyRegion.m_minRowVertex;
 
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* scene = physicsSystem->GetScene(m_attachedSceneHandle);
+
+        auto shape = GetHeightfieldShape();
+
         // If our dirty region is too small to affect any vertices, early-out.
         if ((numRows == 0) || (numColumns == 0))
         {
+            // A canceled refresh may have patched the last of its rows without applying them to the scene, and there's no
+            // job chain left to do it, so do it here. No jobs are running at this point.
+            if (m_heightfieldSamplesModified && shape)
+            {
+                Utils::RefreshHeightfieldShapeGeometry(scene, &(*shape), *m_shapeConfig);
+                m_heightfieldSamplesModified = false;
+            }
             return;
         }
 
-        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
-        auto* scene = physicsSystem->GetScene(m_attachedSceneHandle);
-
-        auto shape = GetHeightfieldShape();
-
         // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
         // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
         // regardless of size, there would be a lot more work that needs to complete before we could cancel a job.
@@ -473,8 +493,9 @@ namespace PhysX
         // 
         // For each block of rows being processed we do the following:
         // UpdateShapeConfigJob -> (UpdateHeightsAndMaterialsAsync) -> UpdateShapeConfigCompleteJob -> UpdatePhysXHeightfieldJob
-        // i.e. we update the shape configuration, then we update the PhysX Heightfield
-        // The final UpdatePhysXHeightfieldJob triggers the RefreshCompleteJob to signify that all the work is completed.
+        // i.e. we update the shape configuration, then we patch the PhysX Heightfield samples
+        // The final UpdatePhysXHeightfieldJob triggers the RefreshCompleteJob, which refreshes the shape in the scene once
+        // and signifies that all the work is completed.
         // 
         // For simplicity in managing the job chain, the entire chain of jobs is still triggered on cancellation, but all
         // of the updating logic is skipped.
@@ -535,7 +556,7 @@ namespace PhysX
             // Set up the final completion job and dependency:
             // UpdatePhysXHeightfieldJob -> RefreshCompleteJob
             auto* refreshCompleteJob =
-                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this), autoDelete, m_jobContext.get());
+                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this, scene, shape), autoDelete, m_jobContext.get());
             updatePhysXHeightfieldJobs.back()->SetDependent(refreshCompleteJob);
 
             // Track that we're starting our refresh job chain.
@@ -108,7 +108,7 @@ namespace PhysX
         void UpdateShapeConfigRows(
             AZ::Job* updateCompleteJob, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
-        //! Updates a subset of rows in the PhysX heightfield based on the data in the heightfield shape configuration.
+        //! Patches a subset of rows in the PhysX heightfield based on the data in the heightfield shape configuration.
         //! Note that while this takes in column ranges, the expectation is that it is processing all the dirty columns for each
         //! row being updated. If this assumption changes, the dirty region tracking logic will also need to change.
         void UpdatePhysXHeightfieldRows(
@@ -116,7 +116,8 @@ namespace PhysX
             size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
         //! Called once all of the asynchronous update jobs have completed.
-        void RefreshComplete();
+        //! Refreshes the heightfield shape in the scene if any of the PhysX heightfield samples were patched.
+        void RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape);
 
         //! Helper class to manage the spawned physics update jobs.
         class HeightfieldUpdateJobContext : public AZ::JobContext
@@ -192,6 +193,11 @@ namespace PhysX
         };
 
         DirtyHeightfieldRegion m_dirtyRegion;
+
+        //! Tracks whether the PhysX heightfield samples were patched and the shape in the scene still needs a refresh.
+        //! Only accessed from the sequential UpdatePhysXHeightfield and RefreshComplete jobs, or from RefreshHeightfield once those
+        //! have completed.
+        bool m_heightfieldSamplesModified = false;
         
         //! Specifies the way of creating Heightfield Collider.
         DataSource m_dataSourceType = DataSource::GenerateNewHeightfield;
@@ -219,6 +219,29 @@ namespace PhysX
             const size_t numColsToUpdate,
             const size_t numRowsToUpdate);
 
+        //! Patch a portion of the PhysX heightfield in place with the data in the HeightfieldShapeConfiguration.
+        //! Shapes that reference the heightfield need a call to RefreshHeightfieldShapeGeometry once all of the patches are done.
+        //! @param heightfield The updated shape configuration that contains the new data and the cached PhysX heightfield.
+        //! @param startCol The starting column of the heightfield to patch
+        //! @param startRow The starting row of the heightfield to patch
+        //! @param numColsToUpdate The number of columns to patch
+        //! @param numRowsToUpdate The number of rows to patch
+        void ModifyHeightfieldSamples(
+            Physics::HeightfieldShapeConfiguration& heightfield,
+            const size_t startCol,
+            const size_t startRow,
+            const size_t numColsToUpdate,
+            const size_t numRowsToUpdate);
+
+        //! Refresh the internal data of a heightfield shape in the scene after its PhysX heightfield samples were modified.
+        //! @param physicsScene The scene that the shape is located in. (Needed for write-locking the scene in the thread)
+        //! @param heightfieldShape The shape containing the heightfield in the scene.
+        //! @param heightfield The shape configuration that contains the cached PhysX heightfield.
+        void RefreshHeightfieldShapeGeometry(
+            AzPhysics::Scene* physicsScene,
+            Physics::Shape* heightfieldShape,
+            Physics::HeightfieldShapeConfiguration& heightfield);
+
         //! Sets an array of material slots from Physics Asset.
         //! If the configuration indicates that it should use the physics materials
         //! assignment from the physics asset it will also use those materials for the slots.
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzFramework/Physics/HeightfieldProviderBus.h>
+#include <Tests/PhysXGenericTestFixture.h>
+
+#include <PhysX/MockPhysXHeightfieldProviderComponent.h>
+#include <HeightfieldCollider.h>
+
+namespace PhysX::Benchmarks
+{
+    using ::testing::NiceMock;
+    using ::testing::Return;
+
+    //! Sets up a square heightfield collider in the test scene, fed by a mock heightfield provider with a grid spacing of 1.
+    //! Accepts 1 parameter from \state.
+    //!
+    //! \state.range(0) - number of vertices along each side of the heightfield
+    class PhysXHeightfieldBenchmarkFixture
+        : public benchmark::Fixture
+        , public PhysX::GenericPhysicsFixture
+    {
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            PhysX::GenericPhysicsFixture::SetUpInternal();
+
+            m_gridSize = aznumeric_cast<size_t>(state.range(0));
+            const float maxVertex = aznumeric_cast<float>(m_gridSize - 1);
+
+            m_heightfieldProvider = AZStd::make_unique<NiceMock<UnitTest::MockPhysXHeightfieldProvider>>(m_entityId);
+            auto& provider = *m_heightfieldProvider;
+
+            ON_CALL(provider, GetHeightfieldTransform).WillByDefault(Return(AZ::Transform::CreateIdentity()));
+            ON_CALL(provider, GetHeightfieldGridSpacing).WillByDefault(Return(AZ::Vector2(1.0f)));
+            ON_CALL(provider, GetHeightfieldAabb)
+                .WillByDefault(Return(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, -1.0f, maxVertex, maxVertex, 1.0f)));
+            ON_CALL(provider, GetMaterialList)
+                .WillByDefault(Return(AZStd::vector<AZ::Data::Asset<Physics::MaterialAsset>>{ AZ::Data::Asset<Physics::MaterialAsset>() }));
+            ON_CALL(provider, GetHeightfieldGridSize)
+                .WillByDefault(
+                    [this](size_t& numColumns, size_t& numRows)
+                    {
+                        numColumns = m_gridSize;
+                        numRows = m_gridSize;
+                    });
+            ON_CALL(provider, GetHeightfieldHeightBounds)
+                .WillByDefault(
+                    [](float& minHeightBounds, float& maxHeightBounds)
+                    {
+                        minHeightBounds = -1.0f;
+                        maxHeightBounds = 1.0f;
+                    });
+            ON_CALL(provider, GetHeightfieldIndicesFromRegion)
+                .WillByDefault(
+                    [this](const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows)
+                    {
+                        // With a grid spacing of 1 at the origin, vertex indices are the same as world positions.
+                        auto toIndex = [this](float position)
+                        {
+                            return AZStd::clamp(aznumeric_cast<size_t>(AZStd::max(position, 0.0f)), size_t(0), m_gridSize - 1);
+                        };
+
+                        startColumn = toIndex(region.GetMin().GetX());
+                        startRow = toIndex(region.GetMin().GetY());
+                        numColumns = toIndex(region.GetMax().GetX()) - startColumn + 1;
+                        numRows = toIndex(region.GetMax().GetY()) - startRow + 1;
+                    });
+
+            // Alternate the heights on every update, so that every refresh has new samples to patch into the heightfield.
+            ON_CALL(provider, UpdateHeightsAndMaterialsAsync)
+                .WillByDefault(
+                    [this](const Physics::UpdateHeightfieldSampleFunction& updateHeightsMaterialsCallback,
+                        const Physics::UpdateHeightfieldCompleteFunction& updateHeightsMaterialsCompleteCallback,
+                        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+                    {
+                        const float height = m_heightToggle ? 0.5f : -0.5f;
+                        for (size_t row = startRow; row < startRow + numRows; row++)
+                        {
+                            for (size_t column = startColumn; column < startColumn + numColumns; column++)
+                            {
+                                updateHeightsMaterialsCallback(
+                                    column, row, { height, Physics::QuadMeshType::SubdivideUpperLeftToBottomRight, 0 });
+                            }
+                        }
+
+                        updateHeightsMaterialsCompleteCallback();
+                    });
+
+            // Creating the collider kicks off a refresh of the whole heightfield, which isn't part of what gets measured.
+            m_heightfieldCollider = AZStd::make_unique<HeightfieldCollider>(
+                m_entityId, "HeightfieldBenchmarkEntity", m_testSceneHandle,
+                AZStd::make_shared<Physics::ColliderConfiguration>(), AZStd::make_shared<Physics::HeightfieldShapeConfiguration>(),
+                HeightfieldCollider::DataSource::GenerateNewHeightfield);
+            m_heightfieldCollider->BlockOnPendingJobs();
+        }
+
+        void internalTearDown()
+        {
+            m_heightfieldCollider.reset();
+            m_heightfieldProvider.reset();
+            PhysX::GenericPhysicsFixture::TearDownInternal();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        const AZ::EntityId m_entityId = AZ::EntityId(AZ::Crc32("HeightfieldBenchmarkEntity"));
+        size_t m_gridSize = 0;
+        bool m_heightToggle = false;
+        AZStd::unique_ptr<NiceMock<UnitTest::MockPhysXHeightfieldProvider>> m_heightfieldProvider;
+        AZStd::unique_ptr<HeightfieldCollider> m_heightfieldCollider;
+    };
+
+    //! Measures a heightfield collider refresh for a dirty region of terrain, from the collider requesting the new heights through
+    //! patching the PhysX heightfield samples to refreshing the shape geometry in the scene.
+    //! The cost should scale with the size of the dirty region, not with the size of the whole heightfield.
+    //!
+    //! \state.range(1) - size of the dirty region, centered in the heightfield
+    BENCHMARK_DEFINE_F(PhysXHeightfieldBenchmarkFixture, BM_UpdatePhysicsColliderRegion)(benchmark::State& state)
+    {
+        const float halfGridSize = aznumeric_cast<float>(m_gridSize) / 2.0f;
+        const float halfDirtyRegionSize = aznumeric_cast<float>(state.range(1)) / 2.0f;
+        const AZ::Aabb dirtyRegion = AZ::Aabb::CreateCenterHalfExtents(
+            AZ::Vector3(halfGridSize, halfGridSize, 0.0f), AZ::Vector3(halfDirtyRegionSize, halfDirtyRegionSize, 1.0f));
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_heightToggle = !m_heightToggle;
+
+            m_heightfieldCollider->RefreshHeightfield(
+                Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData, dirtyRegion);
+            m_heightfieldCollider->BlockOnPendingJobs();
+        }
+    }
+
+    BENCHMARK_REGISTER_F(PhysXHeightfieldBenchmarkFixture, BM_UpdatePhysicsColliderRegion)
+        ->Args({ 4096, 16 })
+        ->Args({ 4096, 256 })
+        ->Args({ 4096, 4096 })
+        ->Unit(benchmark::kMillisecond);
+} // namespace PhysX::Benchmarks
+#endif //HAVE_BENCHMARK
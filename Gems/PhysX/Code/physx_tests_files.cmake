@@ -46,6 +46,7 @@ set(FILES
     Tests/Benchmarks/PhysXCharactersBenchmarks.cpp
     Tests/Benchmarks/PhysXCharactersRagdollBenchmarks.cpp
     Tests/Benchmarks/PhysXGenericBenchmarks.cpp
+    Tests/Benchmarks/PhysXHeightfieldBenchmarks.cpp
     Tests/Benchmarks/PhysXSceneQueryBenchmarks.cpp
     Tests/Benchmarks/PhysXRigidBodyBenchmarks.cpp
     Tests/Benchmarks/PhysXJointBenchmarks.cpp
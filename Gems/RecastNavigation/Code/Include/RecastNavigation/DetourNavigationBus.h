@@ -11,9 +11,17 @@
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/functional.h>
 
 namespace RecastNavigation
 {
+    //! Identifies an asynchronous path request. @InvalidPathRequestId is never returned for a scheduled request.
+    using PathRequestId = AZ::u64;
+    static constexpr PathRequestId InvalidPathRequestId = 0;
+
+    //! Receives the waypoints of an asynchronous path request on the main thread. The vector is empty if a path was not found.
+    using PathFoundCallback = AZStd::function<void(const AZStd::vector<AZ::Vector3>& path)>;
+
     //! Interface for path finding API.
     class DetourNavigationRequests
         : public AZ::ComponentBus
@@ -38,6 +46,27 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Non-blocking version of @FindPathBetweenEntities. Paths are found on worker threads in batches across all of the agents,
+        //! within a time budget per frame, and @callback is invoked on the main thread once the path is ready.
+        //! @param fromEntity The starting point of the path from the position of this entity.
+        //! @param toEntity The end point of the path is at the position of this entity.
+        //! @param callback Receives the waypoints of the path, or an empty vector if a path was not found.
+        //! @return the id of the request, or @InvalidPathRequestId if the callback was already invoked.
+        virtual PathRequestId FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity, PathFoundCallback callback) = 0;
+
+        //! Non-blocking version of @FindPathBetweenPositions. Paths are found on worker threads in batches across all of the agents,
+        //! within a time budget per frame, and @callback is invoked on the main thread once the path is ready.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @param callback Receives the waypoints of the path, or an empty vector if a path was not found.
+        //! @return the id of the request, or @InvalidPathRequestId if the callback was already invoked.
+        virtual PathRequestId FindPathBetweenPositionsAsync(
+            const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, PathFoundCallback callback) = 0;
+
+        //! Cancels a request made with @FindPathBetweenEntitiesAsync or @FindPathBetweenPositionsAsync. Its callback will not be invoked.
+        //! @param requestId the id returned when the request was made.
+        virtual void CancelPathRequest(PathRequestId requestId) = 0;
     };
 
     //! Request EBus for a path finding component.
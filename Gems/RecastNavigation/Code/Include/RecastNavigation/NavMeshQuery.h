@@ -9,6 +9,9 @@
 #pragma once
 
 #include <DetourNavMesh.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <RecastNavigation/RecastSmartPointer.h>
 
 namespace RecastNavigation
@@ -16,12 +19,15 @@ namespace RecastNavigation
     //! Holds pointers to Recast navigation mesh objects and the associated mutex.
     //! This structure should be used when performing operations on a navigation mesh.
     //! In order to access NavMesh or NavMeshQuery objects, use the object LockGuard(NavMeshQuery&).
+    //! Path finding with separate dtNavMeshQuery objects, for example on worker threads, can use SharedLockGuard(NavMeshQuery&) instead.
     class NavMeshQuery
     {
     public:
         class LockGuard;
+        class SharedLockGuard;
 
         NavMeshQuery(dtNavMesh* navMesh, dtNavMeshQuery* navQuery)
+            : m_generation(NextGeneration())
         {
             m_mesh.reset(navMesh);
             m_query.reset(navQuery);
@@ -37,9 +43,29 @@ namespace RecastNavigation
             //! @param navMesh navigation mesh to hold on to
             explicit LockGuard(NavMeshQuery& navMesh)
                 : m_lock(navMesh.m_mutex)
+                , m_navMeshQuery(navMesh)
                 , m_mesh(navMesh.m_mesh.get())
                 , m_query(navMesh.m_query.get())
             {
+                // The mutex is recursive, only the outermost lock on this thread has to exclude the shared locks.
+                if (m_navMeshQuery.m_lockDepth++ == 0)
+                {
+                    m_navMeshQuery.m_sharedMutex.lock();
+                }
+            }
+
+            ~LockGuard()
+            {
+                if (--m_navMeshQuery.m_lockDepth == 0)
+                {
+                    m_navMeshQuery.m_sharedMutex.unlock();
+                }
+            }
+
+            //! Call after adding or removing tiles, so that path queries and cached paths based on the old tiles are discarded.
+            void OnTilesChanged()
+            {
+                m_navMeshQuery.m_generation = NextGeneration();
             }
 
             //! Navigation mesh accessor.
@@ -56,13 +82,56 @@ namespace RecastNavigation
 
         private:
             AZStd::lock_guard<AZStd::recursive_mutex> m_lock;
+            NavMeshQuery& m_navMeshQuery;
             dtNavMesh* m_mesh = nullptr;
             dtNavMeshQuery* m_query = nullptr;
 
             AZ_DISABLE_COPY_MOVE(LockGuard);
         };
 
+        //! A lock guard for reading the navigation mesh with a separately owned dtNavMeshQuery object.
+        //! Any number of shared locks can be held at the same time, while @LockGuard waits for all of them to be released.
+        //! Do not create a @LockGuard on a thread that holds a shared lock.
+        class SharedLockGuard
+        {
+        public:
+            //! Grabs a shared lock on a mutex in @NavMeshQuery
+            //! @param navMesh navigation mesh to hold on to
+            explicit SharedLockGuard(NavMeshQuery& navMesh)
+                : m_lock(navMesh.m_sharedMutex)
+                , m_mesh(navMesh.m_mesh.get())
+            {
+            }
+
+            //! Navigation mesh accessor.
+            const dtNavMesh* GetNavMesh() const
+            {
+                return m_mesh;
+            }
+
+        private:
+            AZStd::shared_lock<AZStd::shared_mutex> m_lock;
+            const dtNavMesh* m_mesh = nullptr;
+
+            AZ_DISABLE_COPY_MOVE(SharedLockGuard);
+        };
+
+        //! @returns a number that identifies the current tiles of this navigation mesh. It changes whenever tiles are added
+        //! or removed, and is never shared with another navigation mesh, including ones that were destroyed before.
+        AZ::u64 GetGeneration() const
+        {
+            return m_generation;
+        }
+
     private:
+        //! Generations are handed out from a single counter, so that a navigation mesh created at the address of a destroyed
+        //! one can't be mistaken for it.
+        static AZ::u64 NextGeneration()
+        {
+            static AZStd::atomic<AZ::u64> s_lastGeneration{ 0 };
+            return ++s_lastGeneration;
+        }
+
         //! Recast navigation mesh object.
         RecastPointer<dtNavMesh> m_mesh;
 
@@ -71,5 +140,13 @@ namespace RecastNavigation
 
         //! A mutex for accessing and modifying the navigation mesh.
         AZStd::recursive_mutex m_mutex;
+
+        //! Held exclusively by the outermost @LockGuard and shared by @SharedLockGuard.
+        AZStd::shared_mutex m_sharedMutex;
+
+        //! The number of @LockGuard objects on the thread that holds @m_mutex.
+        int m_lockDepth = 0;
+
+        AZStd::atomic<AZ::u64> m_generation;
     };
 } // namespace RecastNavigation
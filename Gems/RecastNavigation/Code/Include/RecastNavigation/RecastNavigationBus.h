@@ -10,6 +10,8 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <RecastNavigation/DetourNavigationBus.h>
+#include <RecastNavigation/NavMeshQuery.h>
 
 namespace RecastNavigation
 {
@@ -18,6 +20,19 @@ namespace RecastNavigation
     public:
         AZ_RTTI(RecastNavigationRequests, "{d1c2f552-287d-4aa1-a5b8-5b234c9106f3}");
         virtual ~RecastNavigationRequests() = default;
+
+        //! Queues a path request for the shared pool of path finding workers.
+        //! @param navMeshQuery the navigation mesh to find the path on.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @param nearestDistance distance to use when finding the nearest points on the navigation mesh.
+        //! @param callback invoked on the main thread with the waypoints of the path.
+        //! @return the id of the request, or @InvalidPathRequestId if path requests cannot be processed.
+        virtual PathRequestId RequestPath(AZStd::shared_ptr<NavMeshQuery> navMeshQuery, const AZ::Vector3& fromWorldPosition,
+            const AZ::Vector3& toWorldPosition, float nearestDistance, PathFoundCallback callback) = 0;
+
+        //! Cancels a request made with @RequestPath. Its callback will not be invoked.
+        virtual void CancelPathRequest(PathRequestId requestId) = 0;
     };
 
     class RecastNavigationBusTraits
@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Components/DetourNavigationComponent.h>
 #include <RecastNavigation/RecastHelpers.h>
+#include <RecastNavigation/RecastNavigationBus.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_DECLARE_BUDGET(Navigation);
@@ -142,6 +143,56 @@ namespace RecastNavigation
         return pathPoints;
     }
 
+    PathRequestId DetourNavigationComponent::FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity, PathFoundCallback callback)
+    {
+        if (fromEntity.IsValid() && toEntity.IsValid())
+        {
+            AZ::Vector3 start = AZ::Vector3::CreateZero(), end = AZ::Vector3::CreateZero();
+            AZ::TransformBus::EventResult(start, fromEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+            AZ::TransformBus::EventResult(end, toEntity, &AZ::TransformBus::Events::GetWorldTranslation);
+
+            return FindPathBetweenPositionsAsync(start, end, AZStd::move(callback));
+        }
+
+        if (callback)
+        {
+            callback({});
+        }
+        return InvalidPathRequestId;
+    }
+
+    PathRequestId DetourNavigationComponent::FindPathBetweenPositionsAsync(
+        const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, PathFoundCallback callback)
+    {
+        AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+        RecastNavigationMeshRequestBus::EventResult(navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+
+        if (RecastNavigationRequests* pathService = RecastNavigationInterface::Get(); pathService && navMeshQuery)
+        {
+            const PathRequestId requestId = pathService->RequestPath(navMeshQuery, fromWorldPosition, toWorldPosition,
+                m_nearestDistance, callback);
+            if (requestId != InvalidPathRequestId)
+            {
+                return requestId;
+            }
+        }
+
+        // Without the path finding service, find the path right away.
+        if (callback)
+        {
+            callback(FindPathBetweenPositions(fromWorldPosition, toWorldPosition));
+        }
+        return InvalidPathRequestId;
+    }
+
+    void DetourNavigationComponent::CancelPathRequest(PathRequestId requestId)
+    {
+        if (RecastNavigationRequests* pathService = RecastNavigationInterface::Get())
+        {
+            pathService->CancelPathRequest(requestId);
+        }
+    }
+
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
     {
         m_navQueryEntityId = navMeshEntity;
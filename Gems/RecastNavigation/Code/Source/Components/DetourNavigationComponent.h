@@ -34,6 +34,10 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZ::Vector3> FindPathBetweenEntities(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+        PathRequestId FindPathBetweenEntitiesAsync(AZ::EntityId fromEntity, AZ::EntityId toEntity, PathFoundCallback callback) override;
+        PathRequestId FindPathBetweenPositionsAsync(
+            const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, PathFoundCallback callback) override;
+        void CancelPathRequest(PathRequestId requestId) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
         //! @}
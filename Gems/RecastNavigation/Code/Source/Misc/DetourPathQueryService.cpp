@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <Misc/DetourPathQueryService.h>
+
+AZ_DECLARE_BUDGET(Navigation);
+
+AZ_CVAR(
+    float, bg_navmesh_pathfindingBudgetMs, 1.f, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Time budget in milliseconds per frame for each path finding thread. Searches that run out of time continue on the next frame");
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathCacheSize, 4096, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of cached paths between navigation mesh polygons, 0 disables the cache");
+
+namespace RecastNavigation
+{
+    namespace
+    {
+        //! The size of the node pool of each dtNavMeshQuery object, which limits the search space of a single path.
+        constexpr int MaxSearchNodes = 2048;
+
+        //! The number of A* iterations between checks of the time budget.
+        constexpr int IterationsPerSlice = 32;
+
+        //! Maximum number of polygons in a path corridor.
+        constexpr int MaxPathPolys = 256;
+
+        //! Maximum number of waypoints in a path.
+        constexpr int MaxPathPoints = 256;
+    }
+
+    size_t DetourPathQueryService::PathCacheKeyHash::operator()(const PathCacheKey& key) const
+    {
+        size_t seed = 0;
+        AZStd::hash_combine(seed, key.m_navMeshGeneration);
+        AZStd::hash_combine(seed, key.m_startPoly);
+        AZStd::hash_combine(seed, key.m_endPoly);
+        return seed;
+    }
+
+    DetourPathQueryService::DetourPathQueryService(AZ::u32 workerCount)
+        : m_taskExecutor(AZStd::max<AZ::u32>(workerCount, 1))
+    {
+        for (AZ::u32 i = 0; i < AZStd::max<AZ::u32>(workerCount, 1); ++i)
+        {
+            auto worker = AZStd::make_unique<Worker>();
+            worker->m_query.reset(dtAllocNavMeshQuery());
+            m_workers.push_back(AZStd::move(worker));
+        }
+    }
+
+    DetourPathQueryService::~DetourPathQueryService()
+    {
+        if (m_taskGraphEvent)
+        {
+            m_taskGraphEvent->Wait();
+        }
+    }
+
+    PathRequestId DetourPathQueryService::RequestPath(AZStd::shared_ptr<NavMeshQuery> navMeshQuery, const AZ::Vector3& fromWorldPosition,
+        const AZ::Vector3& toWorldPosition, float nearestDistance, PathFoundCallback callback)
+    {
+        auto request = AZStd::make_shared<PathRequest>();
+        request->m_navMeshQuery = AZStd::move(navMeshQuery);
+        request->m_start = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
+        request->m_end = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
+        request->m_nearestDistance = nearestDistance;
+        request->m_callback = AZStd::move(callback);
+
+        AZStd::lock_guard lock(m_requestMutex);
+        request->m_id = ++m_lastRequestId;
+        m_requests.emplace(request->m_id, request);
+        m_pendingRequests.push_back(request);
+        return request->m_id;
+    }
+
+    void DetourPathQueryService::CancelPathRequest(PathRequestId requestId)
+    {
+        AZStd::lock_guard lock(m_requestMutex);
+        if (auto it = m_requests.find(requestId); it != m_requests.end())
+        {
+            // Workers skip cancelled requests, or drop them at the next check of the time budget.
+            it->second->m_cancelled = true;
+            m_requests.erase(it);
+        }
+    }
+
+    size_t DetourPathQueryService::GetNumberOfRequests() const
+    {
+        AZStd::lock_guard lock(m_requestMutex);
+        return m_requests.size();
+    }
+
+    void DetourPathQueryService::ProcessRequests()
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: ProcessPathRequests");
+
+        AZStd::vector<AZStd::shared_ptr<PathRequest>> finishedRequests;
+        bool hasPendingRequests = false;
+        {
+            AZStd::lock_guard lock(m_requestMutex);
+            finishedRequests.swap(m_finishedRequests);
+            for (const AZStd::shared_ptr<PathRequest>& request : finishedRequests)
+            {
+                m_requests.erase(request->m_id);
+            }
+            hasPendingRequests = !m_pendingRequests.empty();
+        }
+
+        // Callbacks are invoked outside of the lock, so that they can make new requests.
+        for (const AZStd::shared_ptr<PathRequest>& request : finishedRequests)
+        {
+            if (!request->m_cancelled && request->m_callback)
+            {
+                request->m_callback(request->m_path);
+            }
+        }
+
+        if (m_taskGraphEvent && !m_taskGraphEvent->IsSignaled())
+        {
+            // The workers are still busy with the previous batch.
+            return;
+        }
+
+        const bool hasActiveRequests = AZStd::any_of(m_workers.begin(), m_workers.end(),
+            [](const AZStd::unique_ptr<Worker>& worker)
+            {
+                return worker->m_activeRequest != nullptr;
+            });
+        if (!hasPendingRequests && !hasActiveRequests)
+        {
+            return;
+        }
+
+        const AZStd::chrono::microseconds budget(aznumeric_cast<AZ::s64>(bg_navmesh_pathfindingBudgetMs * 1000.f));
+        const Deadline deadline = AZStd::chrono::steady_clock::now() + budget;
+
+        m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation Path Finding Wait");
+        m_taskGraph.Reset();
+        for (AZStd::unique_ptr<Worker>& worker : m_workers)
+        {
+            m_taskGraph.AddTask(
+                m_taskDescriptor, [this, workerPtr = worker.get(), deadline]()
+                {
+                    RunWorker(*workerPtr, deadline);
+                });
+        }
+        m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
+    }
+
+    void DetourPathQueryService::RunWorker(Worker& worker, Deadline deadline)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: task - finding paths");
+
+        while (true)
+        {
+            if (!worker.m_activeRequest)
+            {
+                worker.m_activeRequest = PopPendingRequest();
+                if (!worker.m_activeRequest)
+                {
+                    return;
+                }
+            }
+
+            if (worker.m_activeRequest->m_cancelled || AdvanceRequest(worker, *worker.m_activeRequest, deadline))
+            {
+                FinishRequest(AZStd::move(worker.m_activeRequest));
+                worker.m_activeRequest = {};
+            }
+
+            if (AZStd::chrono::steady_clock::now() >= deadline)
+            {
+                return;
+            }
+        }
+    }
+
+    bool DetourPathQueryService::AdvanceRequest(Worker& worker, PathRequest& request, Deadline deadline)
+    {
+        // Any number of workers can read the navigation mesh at the same time, while tile updates wait for them.
+        NavMeshQuery::SharedLockGuard lock(*request.m_navMeshQuery);
+        if (!lock.GetNavMesh() || !worker.m_query)
+        {
+            return true;
+        }
+
+        dtNavMeshQuery& query = *worker.m_query;
+        if (worker.m_navMesh != lock.GetNavMesh())
+        {
+            if (dtStatusFailed(query.init(lock.GetNavMesh(), MaxSearchNodes)))
+            {
+                return true;
+            }
+            worker.m_navMesh = lock.GetNavMesh();
+        }
+
+        const dtQueryFilter filter;
+        const AZ::u64 navMeshGeneration = request.m_navMeshQuery->GetGeneration();
+
+        // Start the search, or start over if tiles were replaced since the previous frame.
+        if (!request.m_searchStarted || request.m_navMeshGeneration != navMeshGeneration)
+        {
+            request.m_searchStarted = false;
+            request.m_navMeshGeneration = navMeshGeneration;
+
+            const float halfExtents[3] = { request.m_nearestDistance, request.m_nearestDistance, request.m_nearestDistance };
+            dtStatus result = query.findNearestPoly(request.m_start.GetData(), halfExtents, &filter,
+                &request.m_startPoly, request.m_nearestStart.GetData());
+            if (dtStatusFailed(result) || request.m_startPoly == 0)
+            {
+                return true;
+            }
+
+            result = query.findNearestPoly(request.m_end.GetData(), halfExtents, &filter,
+                &request.m_endPoly, request.m_nearestEnd.GetData());
+            if (dtStatusFailed(result) || request.m_endPoly == 0)
+            {
+                return true;
+            }
+
+            const PathCacheKey key{ navMeshGeneration, request.m_startPoly, request.m_endPoly };
+            AZStd::vector<dtPolyRef> cachedPolys;
+            if (FindCachedPath(key, cachedPolys) && AZStd::all_of(cachedPolys.begin(), cachedPolys.end(),
+                [&query, &filter](dtPolyRef poly)
+                {
+                    return query.isValidPolyRef(poly, &filter);
+                }))
+            {
+                FindStraightPath(query, request, cachedPolys.data(), aznumeric_cast<int>(cachedPolys.size()));
+                return true;
+            }
+
+            result = query.initSlicedFindPath(request.m_startPoly, request.m_endPoly,
+                request.m_nearestStart.GetData(), request.m_nearestEnd.GetData(), &filter);
+            if (dtStatusFailed(result))
+            {
+                return true;
+            }
+
+            request.m_searchStarted = true;
+        }
+
+        dtStatus result = DT_IN_PROGRESS;
+        while (dtStatusInProgress(result))
+        {
+            if (AZStd::chrono::steady_clock::now() >= deadline)
+            {
+                // Out of time budget, the search continues on the next frame.
+                return false;
+            }
+
+            result = query.updateSlicedFindPath(IterationsPerSlice, nullptr);
+        }
+
+        AZStd::array<dtPolyRef, MaxPathPolys> polys;
+        int polyCount = 0;
+        if (dtStatusFailed(result) || dtStatusFailed(query.finalizeSlicedFindPath(polys.data(), &polyCount, MaxPathPolys)))
+        {
+            return true;
+        }
+
+        StorePathInCache({ navMeshGeneration, request.m_startPoly, request.m_endPoly }, polys.data(), polyCount);
+        FindStraightPath(query, request, polys.data(), polyCount);
+        return true;
+    }
+
+    void DetourPathQueryService::FindStraightPath(dtNavMeshQuery& query, PathRequest& request, const dtPolyRef* polys, int polyCount)
+    {
+        AZStd::array<RecastVector3, MaxPathPoints> detailedPath;
+        AZStd::array<AZ::u8, MaxPathPoints> detailedPathFlags;
+        AZStd::array<dtPolyRef, MaxPathPoints> detailedPolyPathRefs;
+        int detailedPathCount = 0;
+
+        const dtStatus result = query.findStraightPath(request.m_start.GetData(), request.m_end.GetData(), polys, polyCount,
+            detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
+            &detailedPathCount, MaxPathPoints, DT_STRAIGHTPATH_ALL_CROSSINGS);
+        if (dtStatusFailed(result))
+        {
+            return;
+        }
+
+        request.m_path.reserve(detailedPathCount);
+        // Note: Recast uses +Y, O3DE used +Z as up vectors.
+        for (int i = 0; i < detailedPathCount; ++i)
+        {
+            request.m_path.push_back(detailedPath[i].AsVector3WithZup());
+        }
+    }
+
+    AZStd::shared_ptr<DetourPathQueryService::PathRequest> DetourPathQueryService::PopPendingRequest()
+    {
+        AZStd::lock_guard lock(m_requestMutex);
+        while (!m_pendingRequests.empty())
+        {
+            AZStd::shared_ptr<PathRequest> request = AZStd::move(m_pendingRequests.front());
+            m_pendingRequests.pop_front();
+            if (!request->m_cancelled)
+            {
+                return request;
+            }
+        }
+        return {};
+    }
+
+    void DetourPathQueryService::FinishRequest(AZStd::shared_ptr<PathRequest> request)
+    {
+        // The navigation mesh is released on the worker thread, not the main thread.
+        request->m_navMeshQuery = {};
+
+        AZStd::lock_guard lock(m_requestMutex);
+        if (!request->m_cancelled)
+        {
+            m_finishedRequests.push_back(AZStd::move(request));
+        }
+    }
+
+    bool DetourPathQueryService::FindCachedPath(const PathCacheKey& key, AZStd::vector<dtPolyRef>& polys)
+    {
+        AZStd::lock_guard lock(m_pathCacheMutex);
+        auto it = m_pathCache.find(key);
+        if (it == m_pathCache.end())
+        {
+            return false;
+        }
+
+        polys = it->second;
+        return true;
+    }
+
+    void DetourPathQueryService::StorePathInCache(const PathCacheKey& key, const dtPolyRef* polys, int polyCount)
+    {
+        if (bg_navmesh_pathCacheSize == 0 || polyCount <= 0)
+        {
+            return;
+        }
+
+        AZStd::lock_guard lock(m_pathCacheMutex);
+        if (m_pathCache.size() >= bg_navmesh_pathCacheSize)
+        {
+            m_pathCache.clear();
+        }
+
+        m_pathCache[key].assign(polys, polys + polyCount);
+    }
+} // namespace RecastNavigation
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <RecastNavigation/DetourNavigationBus.h>
+#include <RecastNavigation/NavMeshQuery.h>
+#include <RecastNavigation/RecastHelpers.h>
+
+namespace RecastNavigation
+{
+    //! Finds paths for many agents at once on a pool of worker threads.
+    //! Each worker owns a dtNavMeshQuery object and runs sliced A* searches within a time budget per frame,
+    //! so that a long search is resumed on the next frame instead of stalling the frame.
+    //! Path corridors are cached by their start and end polygons until tiles of the navigation mesh change.
+    class DetourPathQueryService final
+    {
+    public:
+        //! @param workerCount the number of threads to find paths on, each with its own dtNavMeshQuery object.
+        explicit DetourPathQueryService(AZ::u32 workerCount);
+        ~DetourPathQueryService();
+
+        //! Queues a path request. Thread safe.
+        //! @param navMeshQuery the navigation mesh to find the path on.
+        //! @param fromWorldPosition The starting point of the path.
+        //! @param toWorldPosition The end point of the path to find.
+        //! @param nearestDistance distance to use when finding the nearest points on the navigation mesh.
+        //! @param callback invoked from @ProcessRequests with the waypoints of the path.
+        //! @returns the id of the new request.
+        PathRequestId RequestPath(AZStd::shared_ptr<NavMeshQuery> navMeshQuery, const AZ::Vector3& fromWorldPosition,
+            const AZ::Vector3& toWorldPosition, float nearestDistance, PathFoundCallback callback);
+
+        //! Cancels a request made with @RequestPath. Thread safe.
+        void CancelPathRequest(PathRequestId requestId);
+
+        //! Invokes the callbacks of finished requests and starts the next batch of work, unless the workers are still busy.
+        //! Call once per frame from the main thread.
+        void ProcessRequests();
+
+        //! @returns the number of requests that have not been delivered or cancelled yet.
+        size_t GetNumberOfRequests() const;
+
+    private:
+        struct PathRequest
+        {
+            PathRequestId m_id = InvalidPathRequestId;
+            AZStd::shared_ptr<NavMeshQuery> m_navMeshQuery;
+            RecastVector3 m_start;
+            RecastVector3 m_end;
+            float m_nearestDistance = 0.f;
+            PathFoundCallback m_callback;
+            AZStd::atomic<bool> m_cancelled{ false };
+
+            //! The state of the search, only accessed by the worker that processes the request.
+            //! @{
+            bool m_searchStarted = false;
+            AZ::u64 m_navMeshGeneration = 0;
+            dtPolyRef m_startPoly = 0;
+            dtPolyRef m_endPoly = 0;
+            RecastVector3 m_nearestStart;
+            RecastVector3 m_nearestEnd;
+            //! @}
+
+            AZStd::vector<AZ::Vector3> m_path;
+        };
+
+        struct Worker
+        {
+            RecastPointer<dtNavMeshQuery> m_query;
+            //! The navigation mesh @m_query was initialized with.
+            const dtNavMesh* m_navMesh = nullptr;
+            //! A request with a search that ran out of time budget and continues on the next frame.
+            AZStd::shared_ptr<PathRequest> m_activeRequest;
+        };
+
+        //! Path corridors are cached per generation of a navigation mesh (see @NavMeshQuery::GetGeneration) by their start and
+        //! end polygons. Paths cached for older generations are never found again and are dropped along with the rest of the
+        //! cache once it's full.
+        struct PathCacheKey
+        {
+            AZ::u64 m_navMeshGeneration = 0;
+            dtPolyRef m_startPoly = 0;
+            dtPolyRef m_endPoly = 0;
+
+            bool operator==(const PathCacheKey& other) const
+            {
+                return m_navMeshGeneration == other.m_navMeshGeneration && m_startPoly == other.m_startPoly &&
+                    m_endPoly == other.m_endPoly;
+            }
+        };
+
+        struct PathCacheKeyHash
+        {
+            size_t operator()(const PathCacheKey& key) const;
+        };
+
+        using Deadline = AZStd::chrono::steady_clock::time_point;
+
+        //! Processes requests on a worker thread until there are no more requests or the time budget runs out.
+        void RunWorker(Worker& worker, Deadline deadline);
+
+        //! Advances the search of a request.
+        //! @returns true if the request is finished, false if the search has to be continued on the next frame.
+        bool AdvanceRequest(Worker& worker, PathRequest& request, Deadline deadline);
+
+        //! Turns a corridor of polygons into waypoints of @request.
+        void FindStraightPath(dtNavMeshQuery& query, PathRequest& request, const dtPolyRef* polys, int polyCount);
+
+        AZStd::shared_ptr<PathRequest> PopPendingRequest();
+        void FinishRequest(AZStd::shared_ptr<PathRequest> request);
+
+        bool FindCachedPath(const PathCacheKey& key, AZStd::vector<dtPolyRef>& polys);
+        void StorePathInCache(const PathCacheKey& key, const dtPolyRef* polys, int polyCount);
+
+        //! Guards the request containers below.
+        mutable AZStd::mutex m_requestMutex;
+        PathRequestId m_lastRequestId = InvalidPathRequestId;
+        AZStd::deque<AZStd::shared_ptr<PathRequest>> m_pendingRequests;
+        AZStd::vector<AZStd::shared_ptr<PathRequest>> m_finishedRequests;
+        //! All of the requests that have not been delivered or cancelled yet.
+        AZStd::unordered_map<PathRequestId, AZStd::shared_ptr<PathRequest>> m_requests;
+
+        AZStd::mutex m_pathCacheMutex;
+        AZStd::unordered_map<PathCacheKey, AZStd::vector<dtPolyRef>, PathCacheKeyHash> m_pathCache;
+
+        AZStd::vector<AZStd::unique_ptr<Worker>> m_workers;
+
+        //! Task graph objects to run the workers.
+        AZ::TaskGraph m_taskGraph{ "RecastNavigation Path Finding" };
+        AZ::TaskExecutor m_taskExecutor;
+        AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
+        AZ::TaskDescriptor m_taskDescriptor{ "Finding Paths", "Recast Navigation" };
+    };
+} // namespace RecastNavigation
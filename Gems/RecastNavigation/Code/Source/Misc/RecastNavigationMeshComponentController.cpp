@@ -29,6 +29,9 @@ AZ_CVAR(
 AZ_CVAR(
     AZ::u32, bg_navmesh_threads, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
     "Number of threads to use to process tiles for each RecastNavigationMeshComponentController");
+AZ_CVAR(
+    bool, bg_navmesh_incrementalUpdates, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "If enabled, async navigation mesh updates only rebuild the tiles affected by collider changes since the previous update");
 
 namespace RecastNavigation
 {
@@ -82,34 +85,21 @@ namespace RecastNavigation
         {
             for (AZStd::shared_ptr<TileGeometry>& tile : tiles)
             {
-                {
-                    NavMeshQuery::LockGuard lock(*m_navObject);
-                    // If a tile at the location already exists, remove it before updating the data.
-                    if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                    {
-                        lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                    }
-                }
-
-                if (tile->IsEmpty())
-                {
-                    continue;
-                }
-
                 // Given geometry create Recast tile structure.
-                NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
-                    m_configuration, m_context.get());
-
                 // A tile might have no geometry at all if no objects were found there.
-                if (navigationTileData.IsValid())
+                NavigationTileData navigationTileData;
+                if (!tile->IsEmpty())
                 {
-                    AttachNavigationTileToMesh(navigationTileData);
+                    navigationTileData = CreateNavigationTile(tile.get(), m_configuration, m_context.get());
                 }
+
+                ReplaceNavigationTile(tile->m_tileX, tile->m_tileY, navigationTileData);
             }
         }
 
         RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
             &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
+        m_hasAllTiles = true;
         m_updateInProgress = false;
         return true;
     }
@@ -121,9 +111,13 @@ namespace RecastNavigation
         {
             AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync");
 
+            // Once all the tiles have been built, only the tiles that changed since need to be rebuilt.
+            m_fullUpdateInProgress = !(bg_navmesh_incrementalUpdates && m_hasAllTiles);
+
             bool operationScheduled = false;
             RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
-                &RecastNavigationProviderRequests::CollectGeometryAsync,
+                m_fullUpdateInProgress ? &RecastNavigationProviderRequests::CollectGeometryAsync
+                                       : &RecastNavigationProviderRequests::CollectChangedGeometryAsync,
                 m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize,
                 [this](AZStd::shared_ptr<TileGeometry> tile)
                 {
@@ -182,6 +176,7 @@ namespace RecastNavigation
         m_navObject.reset();
         m_taskGraphEvent.reset();
         m_updateInProgress = false;
+        m_hasAllTiles = false;
 
         RecastNavigationMeshRequestBus::Handler::BusDisconnect();
     }
@@ -200,6 +195,11 @@ namespace RecastNavigation
     {
         if (m_updateInProgress)
         {
+            if (m_fullUpdateInProgress)
+            {
+                m_hasAllTiles = true;
+            }
+
             RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
                 &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
             m_updateInProgress = false;
@@ -368,6 +368,7 @@ namespace RecastNavigation
 
         m_shouldProcessTiles = false;
         m_updateInProgress = false;
+        m_hasAllTiles = false;
 
         return true;
     }
@@ -388,9 +389,32 @@ namespace RecastNavigation
             return false;
         }
 
+        lock.OnTilesChanged();
         return true;
     }
 
+    bool RecastNavigationMeshComponentController::ReplaceNavigationTile(int tileX, int tileY, NavigationTileData& navigationTileData)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: replaceTile");
+
+        // The navigation mesh lock is recursive, so it is held while @AttachNavigationTileToMesh locks it again.
+        NavMeshQuery::LockGuard lock(*m_navObject);
+
+        // If a tile at the location already exists, remove it before updating the data.
+        if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tileX, tileY, 0))
+        {
+            lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
+            lock.OnTilesChanged();
+        }
+
+        if (navigationTileData.IsValid())
+        {
+            return AttachNavigationTileToMesh(navigationTileData);
+        }
+
+        return false;
+    }
+
     void RecastNavigationMeshComponentController::ReceivedAllNewTilesImpl(const RecastNavigationMeshConfig& config, AZ::ScheduledEvent& sendNotificationEvent)
     {
         if (m_shouldProcessTiles && (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled()))
@@ -424,23 +448,8 @@ namespace RecastNavigation
                         NavigationTileData navigationTileData = CreateNavigationTile(tile.get(),
                             config, m_context.get());
 
-                        {
-                            NavMeshQuery::LockGuard lock(*m_navObject);
-                            if (const dtTileRef tileRef = lock.GetNavMesh()->getTileRefAt(tile->m_tileX, tile->m_tileY, 0))
-                            {
-                                lock.GetNavMesh()->removeTile(tileRef, nullptr, nullptr);
-                            }
-                        }
-
-                        if (navigationTileData.IsValid())
-                        {
-                            AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshAsync - tile callback");
-
-                            if (navigationTileData.IsValid())
-                            {
-                                AttachNavigationTileToMesh(navigationTileData);
-                            }
-                        }
+                        // Tiles are built outside of the lock, only the swap itself blocks navigation queries.
+                        ReplaceNavigationTile(tile->m_tileX, tile->m_tileY, navigationTileData);
                     });
 
                 tileTaskTokens.push_back(AZStd::move(token));
@@ -56,6 +56,14 @@ namespace RecastNavigation
         //! @return true if successful.
         bool AttachNavigationTileToMesh(NavigationTileData& navigationTileData);
 
+        //! Replaces the tile at the given tile coordinates, holding the lock of the navigation mesh for the whole operation,
+        //! so that queries never see the navigation mesh with the old tile removed and the new tile not yet attached.
+        //! @param tileX tile coordinate within the navigation grid along X-axis
+        //! @param tileY tile coordinate within the navigation grid along Y-axis
+        //! @param navigationTileData the raw data of the new Recast tile, if invalid the old tile is only removed
+        //! @return true if the new tile was attached.
+        bool ReplaceNavigationTile(int tileX, int tileY, NavigationTileData& navigationTileData);
+
         //! Given a set of geometry and configuration create a Recast tile that can be attached using @AttachNavigationTileToMesh.
         //! @param geom A set of geometry, triangle data.
         //! @param meshConfig Recast navigation mesh configuration.
@@ -126,5 +134,12 @@ namespace RecastNavigation
 
         //! If true, an update operation is in progress.
         AZStd::atomic<bool> m_updateInProgress{ false };
+
+        //! If true, the update in progress collects all of the tiles.
+        bool m_fullUpdateInProgress = false;
+
+        //! If true, all of the tiles have been built at least once since the navigation mesh was created,
+        //! so later updates only need to rebuild the tiles that changed.
+        bool m_hasAllTiles = false;
     };
 } // namespace RecastNavigation
@@ -8,7 +8,11 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Shape.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
 #include <DebugDraw/DebugDrawBus.h>
@@ -29,6 +33,30 @@ AZ_DECLARE_BUDGET(Navigation);
 
 namespace RecastNavigation
 {
+    namespace
+    {
+        // Same as PhysX::NativeTypeIdentifiers::RigidBodyStatic. Only static bodies are collected for the navigation mesh.
+        constexpr AZ::Crc32 StaticRigidBodyNativeType = AZ_CRC_CE("PhysXRigidBodyStatic");
+
+        AZ::u64 GetTrackedBodyKey(const AzPhysics::SimulatedBodyHandle& bodyHandle)
+        {
+            const AZ::u32 crc = AZStd::get<AzPhysics::HandleTypeIndex::Crc>(bodyHandle);
+            const AZ::u32 index = static_cast<AZ::u32>(AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle));
+            return (static_cast<AZ::u64>(crc) << 32) | index;
+        }
+
+        bool HasSameGeometry(const TileGeometry& lhs, const TileGeometry& rhs)
+        {
+            if (lhs.m_vertices.size() != rhs.m_vertices.size() || lhs.m_indices != rhs.m_indices)
+            {
+                return false;
+            }
+
+            return lhs.m_vertices.empty() ||
+                memcmp(lhs.m_vertices.data(), rhs.m_vertices.data(), lhs.m_vertices.size() * sizeof(RecastVector3)) == 0;
+        }
+    }
+
     void RecastNavigationPhysXProviderComponentController::Reflect(AZ::ReflectContext* context)
     {
         RecastNavigationPhysXProviderConfig::Reflect(context);
@@ -78,6 +106,18 @@ namespace RecastNavigation
         m_shouldProcessTiles = true;
         m_updateInProgress = false;
         OnConfigurationChanged();
+
+        // The physics scene might not have been created yet, in which case the body handlers are registered once it is added.
+        if (AzPhysics::SystemInterface* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            physicsSystem->RegisterSceneAddedEvent(m_sceneAddedHandler);
+        }
+
+        if (AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            RegisterBodyHandlers(sceneInterface->GetSceneHandle(GetSceneName()));
+        }
+
         RecastNavigationProviderRequestBus::Handler::BusConnect(m_entityComponentIdPair.GetEntityId());
     }
 
@@ -107,6 +147,15 @@ namespace RecastNavigation
         RecastNavigationProviderRequestBus::Handler::BusDisconnect();
         // The event is used to detect if tasks are already in progress.
         m_taskGraphEvent.reset();
+
+        m_sceneAddedHandler.Disconnect();
+        m_bodyAddedHandler.Disconnect();
+        m_bodyRemovedHandler.Disconnect();
+        ResetTileCache({});
+        {
+            AZStd::lock_guard lock(m_changeTrackingMutex);
+            m_trackedBodies.clear();
+        }
     }
 
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometry(
@@ -124,6 +173,14 @@ namespace RecastNavigation
         return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
     }
 
+    bool RecastNavigationPhysXProviderComponentController::CollectChangedGeometryAsync(
+        float tileSize,
+        float borderSize,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        return CollectChangedGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
+    }
+
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
     {
         AZ::Aabb worldBounds = AZ::Aabb::CreateNull();
@@ -265,101 +322,119 @@ namespace RecastNavigation
         }
     }
 
+    // Adjust the origin, so that any tile over-extension is even across all sides.
+    // Note, navigation mesh is made up of square tiles. Recast does not support uneven tiles,
+    // so the best we can do is even them out. Additionally, users can set their own tile size on @RecastNavigationMeshComponent.
+    AZ::Vector3 GetAdjustedOriginBasedOnTileSize(const AZ::Aabb& worldVolume, float tileSize)
+    {
+        if (tileSize <= 0.f)
+        {
+            AZ_Warning("Recast Navigation", true, "Tile size is invalid. It should be a positive number.");
+            return AZ::Vector3::CreateZero();
+        }
+
+        AZ::Vector3 origin = worldVolume.GetMin();
+        const AZ::Vector3& extents = worldVolume.GetExtents();
+
+        const float tileOverExtensionOnX = AZStd::ceil(extents.GetX() / tileSize) * tileSize - extents.GetX();
+        origin.SetX(origin.GetX() - tileOverExtensionOnX / 2.f);
+
+        const float tileOverExtensionOnY = AZStd::ceil(extents.GetY() / tileSize) * tileSize - extents.GetY();
+        origin.SetY(origin.GetY() - tileOverExtensionOnY / 2.f);
+
+        return origin;
+    }
+
     AZStd::vector<AZStd::shared_ptr<TileGeometry>> RecastNavigationPhysXProviderComponentController::CollectGeometryImpl(
         float tileSize, float borderSize, const AZ::Aabb& worldVolume)
     {
         AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometry");
 
-        bool notInProgress = false;
-        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        if (tileSize <= 0.f)
         {
             return {};
         }
 
-        if (tileSize <= 0.f)
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
             return {};
         }
 
-        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
+        ResetTileCache(CreateTileGrid(worldVolume, GetAdjustedOriginBasedOnTileSize(worldVolume, tileSize), tileSize, borderSize));
 
-        const AZ::Vector3 extents = worldVolume.GetExtents();
-        int tilesAlongX = aznumeric_cast<int>(AZStd::ceil(extents.GetX() / tileSize));
-        int tilesAlongY = aznumeric_cast<int>(AZStd::ceil(extents.GetY() / tileSize));
-
-        const AZ::Vector3& worldMin = worldVolume.GetMin();
-        const AZ::Vector3& worldMax = worldVolume.GetMax();
-
-        const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
+        tiles.reserve(m_tileCache.size());
 
         // Find all geometry one tile at a time.
-        for (int y = 0; y < tilesAlongY; ++y)
+        for (int y = 0; y < m_tileGrid.m_tilesAlongY; ++y)
         {
-            for (int x = 0; x < tilesAlongX; ++x)
+            for (int x = 0; x < m_tileGrid.m_tilesAlongX; ++x)
             {
-                const AZ::Vector3 tileMin{
-                    worldMin.GetX() + aznumeric_cast<float>(x) * tileSize,
-                    worldMin.GetY() + aznumeric_cast<float>(y) * tileSize,
-                    worldMin.GetZ()
-                };
-
-                const AZ::Vector3 tileMax{
-                    worldMin.GetX() + aznumeric_cast<float>(x + 1) * tileSize,
-                    worldMin.GetY() + aznumeric_cast<float>(y + 1) * tileSize,
-                    worldMax.GetZ()
-                };
-
-                // Recast wants extra triangle data around each tile, so that each tile can connect to each other.
-                AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
-                AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
-
-                QueryHits results;
-                CollectCollidersWithinVolume(scanVolume, results);
-
-                AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
-                geometryData->m_worldBounds = tileVolume;
-                geometryData->m_scanBounds = scanVolume;
-                AppendColliderGeometry(*geometryData, results);
-
-                geometryData->m_tileX = x;
-                geometryData->m_tileY = y;
+                const int tileIndex = x + y * m_tileGrid.m_tilesAlongX;
+
+                AZStd::shared_ptr<TileGeometry> geometryData = CreateTileGeometry(m_tileGrid, x, y);
+                CollectTileGeometry(*geometryData, m_foundBodies[tileIndex]);
+
+                m_tileCache[tileIndex] = geometryData;
                 tiles.push_back(geometryData);
             }
         }
 
+        TrackFoundBodies();
+
         m_updateInProgress = false;
         return tiles;
     }
 
-    // Adjust the origin, so that any tile over-extension is even across all sides.
-    // Note, navigation mesh is made up of square tiles. Recast does not support uneven tiles,
-    // so the best we can do is even them out. Additionally, users can set their own tile size on @RecastNavigationMeshComponent.
-    AZ::Vector3 GetAdjustedOriginBasedOnTileSize(const AZ::Aabb& worldVolume, float tileSize)
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryAsyncImpl(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& worldVolume,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
-        if (tileSize <= 0.f)
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
-            AZ_Warning("Recast Navigation", true, "Tile size is invalid. It should be a positive number.");
-            return AZ::Vector3::CreateZero();
+            return false;
         }
 
-        AZ::Vector3 origin = worldVolume.GetMin();
-        const AZ::Vector3& extents = worldVolume.GetExtents();
+        if (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled())
+        {
+            AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometryAsync");
 
-        const float tileOverExtensionOnX = AZStd::ceil(extents.GetX() / tileSize) * tileSize - extents.GetX();
-        origin.SetX(origin.GetX() - tileOverExtensionOnX / 2.f);
+            ResetTileCache(CreateTileGrid(worldVolume, GetAdjustedOriginBasedOnTileSize(worldVolume, tileSize), tileSize, borderSize));
 
-        const float tileOverExtensionOnY = AZStd::ceil(extents.GetY() / tileSize) * tileSize - extents.GetY();
-        origin.SetY(origin.GetY() - tileOverExtensionOnY / 2.f);
+            AZStd::vector<int> tileIndices(m_tileCache.size());
+            AZStd::iota(tileIndices.begin(), tileIndices.end(), 0);
 
-        return origin;
+            SubmitTileTasks(AZStd::move(tileIndices), false, AZStd::move(tileCallback));
+            return true;
+        }
+
+        m_updateInProgress = false;
+        return false;
     }
 
-    bool RecastNavigationPhysXProviderComponentController::CollectGeometryAsyncImpl(
+    bool RecastNavigationPhysXProviderComponentController::CollectChangedGeometryAsyncImpl(
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
+        bool hasCachedTiles = false;
+        {
+            const TileGrid grid = CreateTileGrid(worldVolume, GetAdjustedOriginBasedOnTileSize(worldVolume, tileSize), tileSize, borderSize);
+            AZStd::lock_guard lock(m_changeTrackingMutex);
+            hasCachedTiles = grid.IsValid() && grid.IsSameGrid(m_tileGrid);
+        }
+
+        if (!hasCachedTiles)
+        {
+            // The cached tiles were collected for a different grid (or not at all), collect everything again.
+            return CollectGeometryAsyncImpl(tileSize, borderSize, worldVolume, AZStd::move(tileCallback));
+        }
+
         bool notInProgress = false;
         if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
         {
@@ -368,87 +443,328 @@ namespace RecastNavigation
 
         if (!m_taskGraphEvent || m_taskGraphEvent->IsSignaled())
         {
-            AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectGeometryAsync");
+            AZ_PROFILE_SCOPE(Navigation, "Navigation: CollectChangedGeometryAsync");
 
-            m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation PhysX Wait");
-            m_taskGraph.Reset();
+            CheckTrackedBodies();
 
-            AZStd::vector<AZStd::shared_ptr<TileGeometry>> tiles;
+            AZStd::vector<int> tileIndices;
+            {
+                AZStd::lock_guard lock(m_changeTrackingMutex);
+                tileIndices.assign(m_dirtyTiles.begin(), m_dirtyTiles.end());
+                m_dirtyTiles.clear();
+            }
+
+            SubmitTileTasks(AZStd::move(tileIndices), true, AZStd::move(tileCallback));
+            return true;
+        }
+
+        m_updateInProgress = false;
+        return false;
+    }
 
+    RecastNavigationPhysXProviderComponentController::TileGrid RecastNavigationPhysXProviderComponentController::CreateTileGrid(
+        const AZ::Aabb& worldVolume, const AZ::Vector3& origin, float tileSize, float borderSize)
+    {
+        TileGrid grid;
+        if (tileSize > 0.f && worldVolume.IsValid())
+        {
             const AZ::Vector3 extents = worldVolume.GetExtents();
-            int tilesAlongX = aznumeric_cast<int>(AZStd::ceil(extents.GetX() / tileSize));
-            int tilesAlongY = aznumeric_cast<int>(AZStd::ceil(extents.GetY() / tileSize));
-            
-            const AZ::Vector3 worldOrigin = GetAdjustedOriginBasedOnTileSize(worldVolume, tileSize);
-            const AZ::Vector3 worldMax(
-                worldOrigin.GetX() + tileSize * aznumeric_cast<float>(tilesAlongX),
-                worldOrigin.GetY() + tileSize * aznumeric_cast<float>(tilesAlongY),
-                worldVolume.GetMax().GetZ());
+            grid.m_worldVolume = worldVolume;
+            grid.m_origin = origin;
+            grid.m_tileSize = tileSize;
+            grid.m_borderSize = borderSize;
+            grid.m_tilesAlongX = aznumeric_cast<int>(AZStd::ceil(extents.GetX() / tileSize));
+            grid.m_tilesAlongY = aznumeric_cast<int>(AZStd::ceil(extents.GetY() / tileSize));
+        }
+        return grid;
+    }
+
+    AZStd::shared_ptr<TileGeometry> RecastNavigationPhysXProviderComponentController::CreateTileGeometry(const TileGrid& grid, int x, int y)
+    {
+        const AZ::Vector3 tileMin{
+            grid.m_origin.GetX() + aznumeric_cast<float>(x) * grid.m_tileSize,
+            grid.m_origin.GetY() + aznumeric_cast<float>(y) * grid.m_tileSize,
+            grid.m_worldVolume.GetMin().GetZ()
+        };
+
+        const AZ::Vector3 tileMax{
+            grid.m_origin.GetX() + aznumeric_cast<float>(x + 1) * grid.m_tileSize,
+            grid.m_origin.GetY() + aznumeric_cast<float>(y + 1) * grid.m_tileSize,
+            grid.m_worldVolume.GetMax().GetZ()
+        };
 
-            const AZ::Vector3 border = AZ::Vector3::CreateOne() * borderSize;
+        // Recast wants extra triangle data around each tile, so that each tile can connect to each other.
+        const AZ::Vector3 border = AZ::Vector3::CreateOne() * grid.m_borderSize;
+
+        AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_shared<TileGeometry>();
+        geometryData->m_worldBounds = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
+        geometryData->m_scanBounds = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+        geometryData->m_tileX = x;
+        geometryData->m_tileY = y;
+        return geometryData;
+    }
+
+    void RecastNavigationPhysXProviderComponentController::CollectTileGeometry(TileGeometry& geometry, AZStd::vector<TrackedBody>& foundBodies)
+    {
+        QueryHits results;
+        CollectCollidersWithinVolume(geometry.m_scanBounds, results);
+        AppendColliderGeometry(geometry, results);
 
-            AZStd::vector<AZ::TaskToken> tileTaskTokens;
+        foundBodies.clear();
+        if (results.empty())
+        {
+            return;
+        }
+
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
+
+        for (const AzPhysics::SceneQueryHit& hit : results)
+        {
+            // A body with several shapes is found once per shape.
+            const auto isSameBody = [&hit](const TrackedBody& trackedBody)
+            {
+                return trackedBody.m_handle == hit.m_bodyHandle;
+            };
 
-            // Create tasks for each tile and a finish task.
-            for (int y = 0; y < tilesAlongY; ++y)
+            if (AZStd::find_if(foundBodies.begin(), foundBodies.end(), isSameBody) == foundBodies.end())
             {
-                for (int x = 0; x < tilesAlongX; ++x)
+                if (const AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, hit.m_bodyHandle))
                 {
-                    const AZ::Vector3 tileMin{
-                        worldOrigin.GetX() + aznumeric_cast<float>(x) * tileSize,
-                        worldOrigin.GetY() + aznumeric_cast<float>(y) * tileSize,
-                        worldOrigin.GetZ()
-                    };
-
-                    const AZ::Vector3 tileMax{
-                        worldOrigin.GetX() + aznumeric_cast<float>(x + 1) * tileSize,
-                        worldOrigin.GetY() + aznumeric_cast<float>(y + 1) * tileSize,
-                        worldMax.GetZ()
-                    };
-
-                    AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
-                    AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
-                    AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
-                    geometryData->m_tileCallback = tileCallback;
-                    geometryData->m_worldBounds = tileVolume;
-                    geometryData->m_scanBounds = scanVolume;
-                    geometryData->m_tileX = x;
-                    geometryData->m_tileY = y;
-
-                    AZ::TaskToken token = m_taskGraph.AddTask(
-                        m_taskDescriptor, [this, geometryData]()
-                        {
-                            if (m_shouldProcessTiles)
-                            {
-                                AZ_PROFILE_SCOPE(Navigation, "Navigation: collecting geometry for a tile");
-                                QueryHits results;
-                                CollectCollidersWithinVolume(geometryData->m_scanBounds, results);
-                                AppendColliderGeometry(*geometryData, results);
-                                geometryData->m_tileCallback(geometryData);
-                            }
-                        });
-
-                    tileTaskTokens.push_back(AZStd::move(token));
+                    foundBodies.push_back({ hit.m_bodyHandle, body->GetAabb() });
                 }
             }
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::SubmitTileTasks(
+        AZStd::vector<int> tileIndices,
+        bool onlyChangedTiles,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        m_taskGraphEvent = AZStd::make_unique<AZ::TaskGraphEvent>("RecastNavigation PhysX Wait");
+        m_taskGraph.Reset();
 
-            AZ::TaskToken finishToken = m_taskGraph.AddTask(
-                m_taskDescriptor, [this, tileCallback]()
+        AZStd::vector<AZ::TaskToken> tileTaskTokens;
+        tileTaskTokens.reserve(tileIndices.size());
+
+        // Create tasks for each tile and a finish task.
+        for (const int tileIndex : tileIndices)
+        {
+            AZStd::shared_ptr<TileGeometry> geometryData =
+                CreateTileGeometry(m_tileGrid, tileIndex % m_tileGrid.m_tilesAlongX, tileIndex / m_tileGrid.m_tilesAlongX);
+            geometryData->m_tileCallback = tileCallback;
+
+            AZ::TaskToken token = m_taskGraph.AddTask(
+                m_taskDescriptor, [this, geometryData, tileIndex, onlyChangedTiles]()
                 {
-                    tileCallback({}); // Notifies the caller that the operation is done.
-                    m_updateInProgress = false;
+                    if (m_shouldProcessTiles)
+                    {
+                        AZ_PROFILE_SCOPE(Navigation, "Navigation: collecting geometry for a tile");
+                        CollectTileGeometry(*geometryData, m_foundBodies[tileIndex]);
+
+                        // A dirty tile might end up with the same geometry, for example when a collider moved within a tile
+                        // and back again, or only changed within a border of the tile that did not affect its geometry.
+                        AZStd::shared_ptr<TileGeometry>& cachedTile = m_tileCache[tileIndex];
+                        const bool hasChanged = !onlyChangedTiles || !cachedTile || !HasSameGeometry(*cachedTile, *geometryData);
+                        cachedTile = geometryData;
+
+                        if (hasChanged)
+                        {
+                            geometryData->m_tileCallback(geometryData);
+                        }
+                    }
                 });
 
-            for (AZ::TaskToken& task : tileTaskTokens)
+            tileTaskTokens.push_back(AZStd::move(token));
+        }
+
+        AZ::TaskToken finishToken = m_taskGraph.AddTask(
+            m_taskDescriptor, [this, tileCallback]()
             {
-                task.Precedes(finishToken);
+                TrackFoundBodies();
+                tileCallback({}); // Notifies the caller that the operation is done.
+                m_updateInProgress = false;
+            });
+
+        for (AZ::TaskToken& task : tileTaskTokens)
+        {
+            task.Precedes(finishToken);
+        }
+
+        AZ_Assert(m_taskGraphEvent->IsSignaled() == false, "RecastNavigationPhysXProviderComponentController might be runtime two async gather operations, which is not supported.");
+        m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
+    }
+
+    void RecastNavigationPhysXProviderComponentController::ResetTileCache(const TileGrid& grid)
+    {
+        AZStd::lock_guard lock(m_changeTrackingMutex);
+
+        m_tileGrid = grid;
+        m_dirtyTiles.clear();
+
+        const size_t numberOfTiles = grid.IsValid() ? aznumeric_cast<size_t>(grid.GetNumberOfTiles()) : 0;
+        m_tileCache.clear();
+        m_tileCache.resize(numberOfTiles);
+        m_foundBodies.clear();
+        m_foundBodies.resize(numberOfTiles);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::TrackFoundBodies()
+    {
+        AZStd::lock_guard lock(m_changeTrackingMutex);
+
+        for (AZStd::vector<TrackedBody>& foundBodies : m_foundBodies)
+        {
+            for (const TrackedBody& foundBody : foundBodies)
+            {
+                m_trackedBodies[GetTrackedBodyKey(foundBody.m_handle)] = foundBody;
             }
+            foundBodies.clear();
+        }
+    }
 
-            AZ_Assert(m_taskGraphEvent->IsSignaled() == false, "RecastNavigationPhysXProviderComponentController might be runtime two async gather operations, which is not supported.");
-            m_taskGraph.SubmitOnExecutor(m_taskExecutor, m_taskGraphEvent.get());
-            return true;
+    void RecastNavigationPhysXProviderComponentController::CheckTrackedBodies()
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: CheckTrackedBodies");
+
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (!sceneInterface)
+        {
+            return;
         }
 
-        return false;
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(GetSceneName());
+
+        AZStd::lock_guard lock(m_changeTrackingMutex);
+        for (auto it = m_trackedBodies.begin(); it != m_trackedBodies.end();)
+        {
+            TrackedBody& trackedBody = it->second;
+            const AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, trackedBody.m_handle);
+            if (!body)
+            {
+                // The body is gone without a notification, for example because the whole scene was cleared.
+                MarkDirtyTiles(trackedBody.m_aabb);
+                it = m_trackedBodies.erase(it);
+                continue;
+            }
+
+            // Bounds change whenever a body is moved, rotated, or its colliders are changed.
+            const AZ::Aabb aabb = body->GetAabb();
+            if (!aabb.IsClose(trackedBody.m_aabb))
+            {
+                MarkDirtyTiles(trackedBody.m_aabb);
+                MarkDirtyTiles(aabb);
+                trackedBody.m_aabb = aabb;
+            }
+            ++it;
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::InvalidateVolume(const AZ::Aabb& volume)
+    {
+        AZStd::lock_guard lock(m_changeTrackingMutex);
+        MarkDirtyTiles(volume);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::MarkDirtyTiles(const AZ::Aabb& volume)
+    {
+        if (!m_tileGrid.IsValid() || !volume.IsValid())
+        {
+            return;
+        }
+
+        // A tile also has to be collected again if the volume only overlaps its border,
+        // since the border geometry is what allows Recast to connect the tile to its neighbors.
+        const float border = m_tileGrid.m_borderSize;
+        const AZ::Aabb& worldVolume = m_tileGrid.m_worldVolume;
+        if (volume.GetMax().GetZ() + border < worldVolume.GetMin().GetZ() || volume.GetMin().GetZ() - border > worldVolume.GetMax().GetZ())
+        {
+            return;
+        }
+
+        const auto toTileCoordinate = [this](float value, float origin, int tilesAlong)
+        {
+            // Clamp before converting, so that very large volumes cannot overflow the integer conversion.
+            const float tile = AZStd::floor((value - origin) / m_tileGrid.m_tileSize);
+            return aznumeric_cast<int>(AZStd::clamp(tile, -1.f, aznumeric_cast<float>(tilesAlong)));
+        };
+
+        const int minX = toTileCoordinate(volume.GetMin().GetX() - border, m_tileGrid.m_origin.GetX(), m_tileGrid.m_tilesAlongX);
+        const int maxX = toTileCoordinate(volume.GetMax().GetX() + border, m_tileGrid.m_origin.GetX(), m_tileGrid.m_tilesAlongX);
+        const int minY = toTileCoordinate(volume.GetMin().GetY() - border, m_tileGrid.m_origin.GetY(), m_tileGrid.m_tilesAlongY);
+        const int maxY = toTileCoordinate(volume.GetMax().GetY() + border, m_tileGrid.m_origin.GetY(), m_tileGrid.m_tilesAlongY);
+
+        for (int y = AZStd::max(minY, 0); y <= AZStd::min(maxY, m_tileGrid.m_tilesAlongY - 1); ++y)
+        {
+            for (int x = AZStd::max(minX, 0); x <= AZStd::min(maxX, m_tileGrid.m_tilesAlongX - 1); ++x)
+            {
+                m_dirtyTiles.insert(x + y * m_tileGrid.m_tilesAlongX);
+            }
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::RegisterBodyHandlers(AzPhysics::SceneHandle sceneHandle)
+    {
+        if (sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            return;
+        }
+
+        m_bodyAddedHandler.Disconnect();
+        m_bodyRemovedHandler.Disconnect();
+
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        sceneInterface->RegisterSimulationBodyAddedHandler(sceneHandle, m_bodyAddedHandler);
+        sceneInterface->RegisterSimulationBodyRemovedHandler(sceneHandle, m_bodyRemovedHandler);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnSceneAdded(AzPhysics::SceneHandle sceneHandle)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (sceneInterface && sceneHandle == sceneInterface->GetSceneHandle(GetSceneName()))
+        {
+            // The scene is still empty, so every static body it gets from now on is seen by the body added handler.
+            RegisterBodyHandlers(sceneHandle);
+        }
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnSimulatedBodyAdded(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle);
+        if (!body || body->GetNativeType() != StaticRigidBodyNativeType)
+        {
+            return;
+        }
+
+        const TrackedBody trackedBody{ bodyHandle, body->GetAabb() };
+
+        AZStd::lock_guard lock(m_changeTrackingMutex);
+        m_trackedBodies[GetTrackedBodyKey(bodyHandle)] = trackedBody;
+        MarkDirtyTiles(trackedBody.m_aabb);
+    }
+
+    void RecastNavigationPhysXProviderComponentController::OnSimulatedBodyRemoved(
+        AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        AZStd::lock_guard lock(m_changeTrackingMutex);
+
+        const auto it = m_trackedBodies.find(GetTrackedBodyKey(bodyHandle));
+        if (it == m_trackedBodies.end())
+        {
+            return;
+        }
+
+        MarkDirtyTiles(it->second.m_aabb);
+        m_trackedBodies.erase(it);
+
+        // The body is still in the scene at this point and might have been moved since it was last checked.
+        AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (const AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle))
+        {
+            MarkDirtyTiles(body->GetAabb());
+        }
     }
 } // namespace RecastNavigation
@@ -11,6 +11,10 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <Misc/RecastNavigationPhysXProviderConfig.h>
@@ -20,6 +24,10 @@ namespace RecastNavigation
 {
     //! Common logic for Recast navigation tiled collector components. Recommended use is as a base class.
     //! The method provided are not thread-safe. Synchronize as necessary at the higher level.
+    //!
+    //! The geometry of each tile is cached between collections. Static PhysX bodies that were found during a collection
+    //! or added to the scene afterwards are tracked, and their changes mark the overlapping tiles as dirty,
+    //! so that @CollectChangedGeometryAsync only has to collect those tiles again.
     class RecastNavigationPhysXProviderComponentController
         : public RecastNavigationProviderRequestBus::Handler
     {
@@ -47,6 +55,7 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZStd::shared_ptr<TileGeometry>> CollectGeometry(float tileSize, float borderSize) override;
         bool CollectGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
+        bool CollectChangedGeometryAsync(float tileSize, float borderSize, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) override;
         AZ::Aabb GetWorldBounds() const override;
         int GetNumberOfTiles(float tileSize) const override;
         //! @}
@@ -85,6 +94,27 @@ namespace RecastNavigation
             const AZ::Aabb& worldVolume,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
 
+        //! Variant of @CollectGeometryAsyncImpl that only collects the tiles marked as dirty since the previous collection.
+        //!   Dirty tiles with the same geometry as in the cache are not passed to @tileCallback.
+        //!   Falls back to @CollectGeometryAsyncImpl if the cached geometry was collected for a different tile grid.
+        //!
+        //! @param tileSize the result is packaged in tiles, which are squares covering the provided volume of @worldVolume
+        //! @param borderSize an additional extend in all direction around the tile volume
+        //! @param worldVolume worldVolume the overall volume to collect static PhysX geometry
+        //! @param tileCallback an empty tile indicates the end of the operation, otherwise a valid shared_ptr is returned with tile geometry
+        //! @returns true if an async operation was scheduled, false otherwise
+        bool CollectChangedGeometryAsyncImpl(
+            float tileSize,
+            float borderSize,
+            const AZ::Aabb& worldVolume,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+
+        //! Marks the tiles overlapping a volume as dirty, including the tiles that only overlap it with their border.
+        //! Changes of tracked static PhysX bodies are detected automatically, this is meant for any other changes.
+        //! Has no effect until a collection has established the tile grid.
+        //! @param volume world volume that has changed
+        void InvalidateVolume(const AZ::Aabb& volume);
+
         //! Finds all the static PhysX colliders within a given volume.
         //! @param volume the world to look for static colliders
         //! @param overlapHits (out) found colliders will be attached to this container
@@ -101,6 +131,82 @@ namespace RecastNavigation
     protected:
         void OnConfigurationChanged();
 
+        //! A static PhysX body and its bounds at the time it was last checked for changes.
+        struct TrackedBody
+        {
+            AzPhysics::SimulatedBodyHandle m_handle = AzPhysics::InvalidSimulatedBodyHandle;
+            AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+        };
+
+        //! The grid of tiles used by the last collection. Cached geometry belongs to this grid and changes are mapped onto it.
+        struct TileGrid
+        {
+            bool IsValid() const { return m_tilesAlongX > 0 && m_tilesAlongY > 0; }
+            int GetNumberOfTiles() const { return m_tilesAlongX * m_tilesAlongY; }
+
+            bool IsSameGrid(const TileGrid& other) const
+            {
+                return m_worldVolume == other.m_worldVolume && m_origin == other.m_origin && m_tileSize == other.m_tileSize &&
+                    m_borderSize == other.m_borderSize;
+            }
+
+            AZ::Aabb m_worldVolume = AZ::Aabb::CreateNull();
+            AZ::Vector3 m_origin = AZ::Vector3::CreateZero();
+            float m_tileSize = 0.f;
+            float m_borderSize = 0.f;
+            int m_tilesAlongX = 0;
+            int m_tilesAlongY = 0;
+        };
+
+        //! Creates a grid of tiles with the size of @tileSize covering @worldVolume, starting at @origin.
+        static TileGrid CreateTileGrid(const AZ::Aabb& worldVolume, const AZ::Vector3& origin, float tileSize, float borderSize);
+
+        //! Creates a tile without any geometry at the grid coordinates (@x, @y).
+        static AZStd::shared_ptr<TileGeometry> CreateTileGeometry(const TileGrid& grid, int x, int y);
+
+        //! Collects the geometry of a tile and records the static bodies that were found, so that their changes can be tracked.
+        void CollectTileGeometry(TileGeometry& geometry, AZStd::vector<TrackedBody>& foundBodies);
+
+        //! Schedules tasks on @m_taskGraph to collect geometry for the given tiles of @m_tileGrid, followed by a finish task.
+        //! @param onlyChangedTiles if true, tiles with the same geometry as in the cache are not passed to @tileCallback
+        void SubmitTileTasks(
+            AZStd::vector<int> tileIndices, bool onlyChangedTiles, AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback);
+
+        //! Drops all the cached tiles and dirty tiles and starts over with a new grid.
+        void ResetTileCache(const TileGrid& grid);
+
+        //! Starts tracking the bodies found by the last collection. Called once no tile tasks are running.
+        void TrackFoundBodies();
+
+        //! Checks all the tracked bodies for changes in their bounds and marks the affected tiles as dirty.
+        void CheckTrackedBodies();
+
+        //! Marks the tiles overlapping a volume as dirty. Expects @m_changeTrackingMutex to be locked.
+        void MarkDirtyTiles(const AZ::Aabb& volume);
+
+        //! Starts listening to static bodies being added to or removed from the scene. Does nothing if the scene handle is invalid.
+        void RegisterBodyHandlers(AzPhysics::SceneHandle sceneHandle);
+
+        void OnSceneAdded(AzPhysics::SceneHandle sceneHandle);
+        void OnSimulatedBodyAdded(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+        void OnSimulatedBodyRemoved(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        AzPhysics::SystemEvents::OnSceneAddedEvent::Handler m_sceneAddedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle)
+            {
+                OnSceneAdded(sceneHandle);
+            } };
+        AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler m_bodyAddedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyAdded(sceneHandle, bodyHandle);
+            } };
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_bodyRemovedHandler{
+            [this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+            {
+                OnSimulatedBodyRemoved(sceneHandle, bodyHandle);
+            } };
+
         AZ::EntityComponentIdPair m_entityComponentIdPair;
         RecastNavigationPhysXProviderConfig m_config;
 
@@ -117,5 +223,18 @@ namespace RecastNavigation
         AZ::TaskExecutor m_taskExecutor;
         AZStd::unique_ptr<AZ::TaskGraphEvent> m_taskGraphEvent;
         AZ::TaskDescriptor m_taskDescriptor{ "Collect Geometry", "Recast Navigation" };
+
+        //! Geometry of each tile from the last time it was collected, indexed by x + y * tilesAlongX.
+        //! Each element is only accessed by the task collecting that tile.
+        AZStd::vector<AZStd::shared_ptr<TileGeometry>> m_tileCache;
+
+        //! Static bodies found by the tile tasks of the current collection, indexed the same as @m_tileCache.
+        AZStd::vector<AZStd::vector<TrackedBody>> m_foundBodies;
+
+        //! Guards @m_tileGrid, @m_dirtyTiles and @m_trackedBodies, which are updated from physics events and the collection tasks.
+        AZStd::mutex m_changeTrackingMutex;
+        TileGrid m_tileGrid;
+        AZStd::unordered_set<int> m_dirtyTiles;
+        AZStd::unordered_map<AZ::u64, TrackedBody> m_trackedBodies;
     };
 } // namespace RecastNavigation
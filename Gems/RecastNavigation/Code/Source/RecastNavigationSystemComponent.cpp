@@ -7,8 +7,14 @@
  */
 
 #include <RecastNavigationSystemComponent.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <Misc/DetourPathQueryService.h>
+
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathfindingThreads, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of threads to use to find paths for asynchronous path requests");
 
 namespace RecastNavigation
 {
@@ -70,6 +76,8 @@ namespace RecastNavigation
 
     void RecastNavigationSystemComponent::Activate()
     {
+        m_pathQueryService = AZStd::make_unique<DetourPathQueryService>(bg_navmesh_pathfindingThreads);
+
         RecastNavigationRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
     }
@@ -78,10 +86,37 @@ namespace RecastNavigation
     {
         AZ::TickBus::Handler::BusDisconnect();
         RecastNavigationRequestBus::Handler::BusDisconnect();
+
+        // Waits for the path finding workers to finish, pending requests are dropped without invoking their callbacks.
+        m_pathQueryService = {};
+    }
+
+    PathRequestId RecastNavigationSystemComponent::RequestPath(AZStd::shared_ptr<NavMeshQuery> navMeshQuery,
+        const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, float nearestDistance, PathFoundCallback callback)
+    {
+        if (!m_pathQueryService || !navMeshQuery)
+        {
+            return InvalidPathRequestId;
+        }
+
+        return m_pathQueryService->RequestPath(AZStd::move(navMeshQuery), fromWorldPosition, toWorldPosition, nearestDistance,
+            AZStd::move(callback));
+    }
+
+    void RecastNavigationSystemComponent::CancelPathRequest(PathRequestId requestId)
+    {
+        if (m_pathQueryService)
+        {
+            m_pathQueryService->CancelPathRequest(requestId);
+        }
     }
 
     void RecastNavigationSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        if (m_pathQueryService)
+        {
+            m_pathQueryService->ProcessRequests();
+        }
     }
 
 } // namespace RecastNavigation
@@ -14,6 +14,8 @@
 
 namespace RecastNavigation
 {
+    class DetourPathQueryService;
+
     class RecastNavigationSystemComponent
         : public AZ::Component
         , protected RecastNavigationRequestBus::Handler
@@ -32,6 +34,13 @@ namespace RecastNavigation
         RecastNavigationSystemComponent();
         ~RecastNavigationSystemComponent() override;
 
+        //! RecastNavigationRequestBus overrides ...
+        //! @{
+        PathRequestId RequestPath(AZStd::shared_ptr<NavMeshQuery> navMeshQuery, const AZ::Vector3& fromWorldPosition,
+            const AZ::Vector3& toWorldPosition, float nearestDistance, PathFoundCallback callback) override;
+        void CancelPathRequest(PathRequestId requestId) override;
+        //! @}
+
     protected:
         //! AZ::Component overrides ...
         void Init() override;
@@ -40,6 +49,9 @@ namespace RecastNavigation
 
         //! AZTickBus overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        //! Finds paths for asynchronous path requests of all of the agents.
+        AZStd::unique_ptr<DetourPathQueryService> m_pathQueryService;
     };
 
 } // namespace RecastNavigation
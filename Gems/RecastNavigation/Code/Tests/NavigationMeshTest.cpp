@@ -12,15 +12,22 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/Math/Random.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/Mocks/MockITime.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
 #include <Components/DetourNavigationComponent.h>
 #include <Components/RecastNavigationMeshComponent.h>
 #include <Components/RecastNavigationPhysXProviderComponent.h>
+#include <DetourAlloc.h>
+#include <Misc/DetourPathQueryService.h>
 #include <PhysX/MockPhysicsShape.h>
 #include <PhysX/MockSceneInterface.h>
 #include <PhysX/MockSimulatedBody.h>
@@ -531,6 +538,96 @@ namespace RecastNavigationTests
         EXPECT_GT(waypoints.size(), 0);
     }
 
+    /*
+     * Ticks the path finding service until the callback of an async path request is invoked.
+     */
+    TEST_F(NavigationTest, FindPathAsyncMatchesBlockingPath)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        AZStd::vector<AZ::Vector3> expectedWaypoints;
+        DetourNavigationRequestBus::EventResult(expectedWaypoints, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositions,
+            AZ::Vector3(0.f, 0, 0), AZ::Vector3(2.f, 2, 0));
+        ASSERT_GT(expectedWaypoints.size(), 0);
+
+        // The second request between the same polygons is served from the path cache.
+        for (int request = 0; request < 2; ++request)
+        {
+            bool pathFound = false;
+            AZStd::vector<AZ::Vector3> waypoints;
+            RecastNavigation::PathRequestId requestId = RecastNavigation::InvalidPathRequestId;
+            DetourNavigationRequestBus::EventResult(requestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+                AZ::Vector3(0.f, 0, 0), AZ::Vector3(2.f, 2, 0), [&pathFound, &waypoints](const AZStd::vector<AZ::Vector3>& path)
+                {
+                    pathFound = true;
+                    waypoints = path;
+                });
+            EXPECT_NE(requestId, RecastNavigation::InvalidPathRequestId);
+
+            for (int tick = 0; tick < 1000 && !pathFound; ++tick)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+
+            ASSERT_TRUE(pathFound);
+            ASSERT_EQ(waypoints.size(), expectedWaypoints.size());
+            for (size_t i = 0; i < waypoints.size(); ++i)
+            {
+                EXPECT_TRUE(waypoints[i].IsClose(expectedWaypoints[i]));
+            }
+        }
+    }
+
+    /*
+     * The callback of a cancelled async path request is never invoked.
+     */
+    TEST_F(NavigationTest, FindPathAsyncCancelled)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        bool callbackInvoked = false;
+        RecastNavigation::PathRequestId requestId = RecastNavigation::InvalidPathRequestId;
+        DetourNavigationRequestBus::EventResult(requestId, AZ::EntityId(1), &DetourNavigationRequests::FindPathBetweenPositionsAsync,
+            AZ::Vector3(0.f, 0, 0), AZ::Vector3(2.f, 2, 0), [&callbackInvoked](const AZStd::vector<AZ::Vector3>&)
+            {
+                callbackInvoked = true;
+            });
+        DetourNavigationRequestBus::Event(AZ::EntityId(1), &DetourNavigationRequests::CancelPathRequest, requestId);
+
+        for (int tick = 0; tick < 10; ++tick)
+        {
+            AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.1f, AZ::ScriptTimePoint{});
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        EXPECT_FALSE(callbackInvoked);
+    }
+
     /*
      * Test with one of the point being way outside of the range of the navigation mesh.
      */
@@ -658,6 +755,165 @@ namespace RecastNavigationTests
         EXPECT_EQ(strcmp(test.TYPEINFO_Name(), "RecastNavigationPhysXProviderComponentController"), 0);
     }
 
+    //! Collects tiles from a navigation provider, blocking until the async operation is done.
+    class TileCollector
+    {
+    public:
+        using TileCallback = AZStd::function<void(AZStd::shared_ptr<RecastNavigation::TileGeometry>)>;
+
+        AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> Collect(const AZStd::function<bool(TileCallback)>& collect)
+        {
+            m_tiles.clear();
+            const TileCallback callback = [this](AZStd::shared_ptr<RecastNavigation::TileGeometry> tile)
+            {
+                if (tile)
+                {
+                    AZStd::lock_guard lock(m_tilesMutex);
+                    m_tiles.push_back(tile);
+                }
+                else
+                {
+                    m_done.release();
+                }
+            };
+
+            // The previous operation might still be finishing up right after its last callback.
+            bool scheduled = collect(callback);
+            for (int attempt = 0; attempt < 1000 && !scheduled; ++attempt)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                scheduled = collect(callback);
+            }
+
+            if (scheduled)
+            {
+                m_done.acquire();
+            }
+
+            AZStd::lock_guard lock(m_tilesMutex);
+            return AZStd::move(m_tiles);
+        }
+
+    private:
+        AZStd::mutex m_tilesMutex;
+        AZStd::semaphore m_done;
+        AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> m_tiles;
+    };
+
+    TEST_F(NavigationTest, CollectChangedGeometryOnlyReturnsTilesAffectedByMovedCollider)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+        ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne() * 2.5f)));
+
+        // The world of the mock shape is 20x20, which makes a grid of 4x4 tiles.
+        constexpr float tileSize = 5.f;
+        constexpr float borderSize = 0.5f;
+        const auto collect = [&e](bool onlyChangedTiles)
+        {
+            TileCollector collector;
+            return collector.Collect([&e, onlyChangedTiles](TileCollector::TileCallback callback)
+                {
+                    bool scheduled = false;
+                    RecastNavigation::RecastNavigationProviderRequestBus::EventResult(scheduled, e.GetId(),
+                        onlyChangedTiles ? &RecastNavigation::RecastNavigationProviderRequests::CollectChangedGeometryAsync
+                                         : &RecastNavigation::RecastNavigationProviderRequests::CollectGeometryAsync,
+                        tileSize, borderSize, callback);
+                    return scheduled;
+                });
+        };
+
+        EXPECT_EQ(collect(false).size(), 16);
+
+        // Nothing has changed since.
+        EXPECT_EQ(collect(true).size(), 0);
+
+        // Move the collider into a corner. Its old bounds overlap 2x2 tiles (including the border) and the new bounds overlap one tile.
+        const AZ::Vector3 newPosition(7.5f, 7.5f, 0.f);
+        ON_CALL(*m_mockSimulatedBody, GetPosition()).WillByDefault(Return(newPosition));
+        ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(
+            AZ::Aabb::CreateCenterHalfExtents(newPosition, AZ::Vector3::CreateOne() * 0.5f)));
+
+        const AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> changedTiles = collect(true);
+        EXPECT_EQ(changedTiles.size(), 5);
+        for (const AZStd::shared_ptr<RecastNavigation::TileGeometry>& tile : changedTiles)
+        {
+            const bool isOldTile = tile->m_tileX >= 1 && tile->m_tileX <= 2 && tile->m_tileY >= 1 && tile->m_tileY <= 2;
+            const bool isNewTile = tile->m_tileX == 3 && tile->m_tileY == 3;
+            EXPECT_TRUE(isOldTile || isNewTile);
+        }
+
+        EXPECT_EQ(collect(true).size(), 0);
+    }
+
+    TEST_F(NavigationTest, CollectChangedGeometryAfterBlockingCollectOnlyReturnsTilesAffectedByMovedCollider)
+    {
+        Entity e;
+        PopulateEntity(e);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+        ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne() * 2.5f)));
+
+        // The world of the mock shape is 20x20, which makes a grid of 4x4 tiles that over-extends the world by 2 on each side.
+        // Both the blocking and the async collection have to use the same grid, otherwise the tiles cached by the blocking
+        // collection cannot be reused.
+        constexpr float tileSize = 6.f;
+        constexpr float borderSize = 0.5f;
+
+        AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> tiles;
+        RecastNavigation::RecastNavigationProviderRequestBus::EventResult(tiles, e.GetId(),
+            &RecastNavigation::RecastNavigationProviderRequests::CollectGeometry,
+            tileSize, borderSize);
+        EXPECT_EQ(tiles.size(), 16);
+
+        const auto collectChanged = [&e]()
+        {
+            TileCollector collector;
+            return collector.Collect([&e](TileCollector::TileCallback callback)
+                {
+                    bool scheduled = false;
+                    RecastNavigation::RecastNavigationProviderRequestBus::EventResult(scheduled, e.GetId(),
+                        &RecastNavigation::RecastNavigationProviderRequests::CollectChangedGeometryAsync,
+                        tileSize, borderSize, callback);
+                    return scheduled;
+                });
+        };
+
+        // Nothing has changed since.
+        EXPECT_EQ(collectChanged().size(), 0);
+
+        // Move the collider into a corner. Its old bounds overlap 2x2 tiles (including the border) and the new bounds overlap one tile.
+        const AZ::Vector3 newPosition(7.5f, 7.5f, 0.f);
+        ON_CALL(*m_mockSimulatedBody, GetPosition()).WillByDefault(Return(newPosition));
+        ON_CALL(*m_mockSimulatedBody, GetAabb()).WillByDefault(Return(
+            AZ::Aabb::CreateCenterHalfExtents(newPosition, AZ::Vector3::CreateOne() * 0.5f)));
+
+        const AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> changedTiles = collectChanged();
+        EXPECT_EQ(changedTiles.size(), 5);
+        for (const AZStd::shared_ptr<RecastNavigation::TileGeometry>& tile : changedTiles)
+        {
+            const bool isOldTile = tile->m_tileX >= 1 && tile->m_tileX <= 2 && tile->m_tileY >= 1 && tile->m_tileY <= 2;
+            const bool isNewTile = tile->m_tileX == 3 && tile->m_tileY == 3;
+            EXPECT_TRUE(isOldTile || isNewTile);
+        }
+    }
+
     TEST_F(NavigationTest, DISABLED_AsyncOnNavigationMeshUpdatedIsCalled)
     {
         Entity e;
@@ -936,4 +1192,312 @@ namespace RecastNavigationTests
             AZ::Vector3(0.f, 0.f, 0.f), AZ::Vector3(2.f, 2.f, 0.f));
         EXPECT_EQ(waypoints.size(), 0);
     }
+
+    TEST_F(NavigationTest, NavMeshGenerationsAreNeverReused)
+    {
+        // Cached paths are keyed on the generation, which must not repeat, even for a navigation mesh created where a destroyed one was.
+        AZ::u64 destroyedGeneration = 0;
+        {
+            NavMeshQuery destroyedNavMesh(dtAllocNavMesh(), dtAllocNavMeshQuery());
+            destroyedGeneration = destroyedNavMesh.GetGeneration();
+        }
+
+        NavMeshQuery navMesh(dtAllocNavMesh(), dtAllocNavMeshQuery());
+        EXPECT_GT(navMesh.GetGeneration(), destroyedGeneration);
+
+        const AZ::u64 generationBeforeTilesChanged = navMesh.GetGeneration();
+        {
+            NavMeshQuery::LockGuard lock(navMesh);
+            lock.OnTilesChanged();
+        }
+        EXPECT_GT(navMesh.GetGeneration(), generationBeforeTilesChanged);
+
+        NavMeshQuery otherNavMesh(dtAllocNavMesh(), dtAllocNavMeshQuery());
+        EXPECT_GT(otherNavMesh.GetGeneration(), navMesh.GetGeneration());
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! A flat floor covering the whole world and a crate that moves around, as a door or a piece of cover would.
+    class NavigationMeshRebuildBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+        , public LmbrCentral::ShapeComponentRequestsBus::Handler
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_mockSceneInterface = AZStd::make_unique<NiceMock<UnitTest::MockSceneInterface>>();
+            m_floorShape = AZStd::make_unique<NiceMock<UnitTest::MockPhysicsShape>>();
+            m_floorBody = AZStd::make_unique<NiceMock<UnitTest::MockSimulatedBody>>();
+            m_crateShape = AZStd::make_unique<NiceMock<UnitTest::MockPhysicsShape>>();
+            m_crateBody = AZStd::make_unique<NiceMock<UnitTest::MockSimulatedBody>>();
+            m_cratePosition = AZ::Vector3::CreateZero();
+
+            ON_CALL(*m_mockSceneInterface, QueryScene(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, const AzPhysics::SceneQueryRequest* request)
+                {
+                    const AzPhysics::OverlapRequest* overlapRequest = static_cast<const AzPhysics::OverlapRequest*>(request);
+                    const auto* box = static_cast<const Physics::BoxShapeConfiguration*>(overlapRequest->m_shapeConfiguration.get());
+                    const AZ::Aabb volume = AZ::Aabb::CreateCenterHalfExtents(overlapRequest->m_pose.GetTranslation(), box->m_dimensions * 0.5f);
+
+                    overlapRequest->m_unboundedOverlapHitCallback(CreateHit(m_floorShape.get(), FloorIndex));
+                    if (volume.Overlaps(GetCrateAabb()))
+                    {
+                        overlapRequest->m_unboundedOverlapHitCallback(CreateHit(m_crateShape.get(), CrateIndex));
+                    }
+                    return AzPhysics::SceneQueryHits();
+                }));
+            ON_CALL(*m_mockSceneInterface, GetSimulatedBodyFromHandle(_, _)).WillByDefault(Invoke([this]
+            (AzPhysics::SceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle) -> AzPhysics::SimulatedBody*
+                {
+                    return AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle) == CrateIndex ? m_crateBody.get() : m_floorBody.get();
+                }));
+
+            // The floor returns a quad covering the requested volume.
+            ON_CALL(*m_floorShape, GetGeometry(_, _, _)).WillByDefault(Invoke([]
+            (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb* bounds)
+                {
+                    const AZ::Vector3& min = bounds->GetMin();
+                    const AZ::Vector3& max = bounds->GetMax();
+                    vertices = { AZ::Vector3(min.GetX(), min.GetY(), 0.f), AZ::Vector3(max.GetX(), min.GetY(), 0.f),
+                                 AZ::Vector3(max.GetX(), max.GetY(), 0.f), AZ::Vector3(min.GetX(), max.GetY(), 0.f) };
+                    indices = { 0, 1, 2, 0, 2, 3 };
+                }));
+            ON_CALL(*m_floorBody, GetPosition()).WillByDefault(Return(AZ::Vector3::CreateZero()));
+            ON_CALL(*m_floorBody, GetOrientation()).WillByDefault(Return(AZ::Quaternion::CreateIdentity()));
+            ON_CALL(*m_floorBody, GetAabb()).WillByDefault(Invoke([this]() { return GetEncompassingAabb(); }));
+
+            ON_CALL(*m_crateShape, GetGeometry(_, _, _)).WillByDefault(Invoke([]
+            (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+                {
+                    vertices = {
+                        AZ::Vector3(-CrateHalfSize, -CrateHalfSize, 0.f), AZ::Vector3(CrateHalfSize, -CrateHalfSize, 0.f),
+                        AZ::Vector3(CrateHalfSize, CrateHalfSize, 0.f), AZ::Vector3(-CrateHalfSize, CrateHalfSize, 0.f),
+                        AZ::Vector3(-CrateHalfSize, -CrateHalfSize, 2.f * CrateHalfSize), AZ::Vector3(CrateHalfSize, -CrateHalfSize, 2.f * CrateHalfSize),
+                        AZ::Vector3(CrateHalfSize, CrateHalfSize, 2.f * CrateHalfSize), AZ::Vector3(-CrateHalfSize, CrateHalfSize, 2.f * CrateHalfSize)
+                    };
+                    indices = { 4, 5, 6, 4, 6, 7, 0, 1, 5, 0, 5, 4, 1, 2, 6, 1, 6, 5, 2, 3, 7, 2, 7, 6, 3, 0, 4, 3, 4, 7 };
+                }));
+            ON_CALL(*m_crateBody, GetPosition()).WillByDefault(Invoke([this]() { return m_cratePosition; }));
+            ON_CALL(*m_crateBody, GetOrientation()).WillByDefault(Return(AZ::Quaternion::CreateIdentity()));
+            ON_CALL(*m_crateBody, GetAabb()).WillByDefault(Invoke([this]() { return GetCrateAabb(); }));
+
+            LmbrCentral::ShapeComponentRequestsBus::Handler::BusConnect(m_providerEntityId);
+
+            m_config.m_tileSize = 8.f;
+            m_provider = AZStd::make_unique<RecastNavigation::RecastNavigationPhysXProviderComponentController>();
+            m_provider->Activate(AZ::EntityComponentIdPair(m_providerEntityId, 0));
+            m_meshController = AZStd::make_unique<RecastNavigation::RecastNavigationMeshComponentController>(m_config);
+            m_context = AZStd::make_unique<rcContext>();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_context = {};
+            m_meshController = {};
+            m_provider->Deactivate();
+            m_provider = {};
+
+            LmbrCentral::ShapeComponentRequestsBus::Handler::BusDisconnect();
+
+            m_crateBody = {};
+            m_crateShape = {};
+            m_floorBody = {};
+            m_floorShape = {};
+            m_mockSceneInterface = {};
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! LmbrCentral::ShapeComponentRequestsBus overrides ...
+        //! @{
+        AZ::Crc32 GetShapeType() override { return AZ_CRC_CE("Box"); }
+        AZ::Aabb GetEncompassingAabb() override
+        {
+            return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(64.f, 64.f, 8.f));
+        }
+        void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override
+        {
+            transform = AZ::Transform::CreateIdentity();
+            bounds = GetEncompassingAabb();
+        }
+        bool IsPointInside(const AZ::Vector3& point) override { return GetEncompassingAabb().Contains(point); }
+        float DistanceSquaredFromPoint(const AZ::Vector3& point) override { return GetEncompassingAabb().GetDistanceSq(point); }
+        //! @}
+
+    protected:
+        //! Collects the tiles of the navigation mesh and builds them, as @RecastNavigationMeshComponentController would.
+        //! @returns the number of tiles that were built.
+        size_t RebuildTiles(bool onlyChangedTiles)
+        {
+            const float borderSize = aznumeric_cast<float>(m_config.m_borderSize) * m_config.m_cellSize;
+            const AZ::Aabb worldVolume = GetEncompassingAabb();
+
+            TileCollector collector;
+            const AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> tiles = collector.Collect(
+                [this, onlyChangedTiles, borderSize, &worldVolume](TileCollector::TileCallback callback)
+                {
+                    return onlyChangedTiles
+                        ? m_provider->CollectChangedGeometryAsyncImpl(m_config.m_tileSize, borderSize, worldVolume, AZStd::move(callback))
+                        : m_provider->CollectGeometryAsyncImpl(m_config.m_tileSize, borderSize, worldVolume, AZStd::move(callback));
+                });
+
+            for (const AZStd::shared_ptr<RecastNavigation::TileGeometry>& tile : tiles)
+            {
+                RecastNavigation::NavigationTileData tileData = m_meshController->CreateNavigationTile(tile.get(), m_config, m_context.get());
+                dtFree(tileData.m_data);
+            }
+
+            return tiles.size();
+        }
+
+        AZ::Aabb GetCrateAabb() const
+        {
+            return AZ::Aabb::CreateFromMinMax(
+                m_cratePosition - AZ::Vector3(CrateHalfSize, CrateHalfSize, 0.f),
+                m_cratePosition + AZ::Vector3(CrateHalfSize, CrateHalfSize, 2.f * CrateHalfSize));
+        }
+
+        static AzPhysics::SceneQueryHit CreateHit(Physics::Shape* shape, AzPhysics::SimulatedBodyIndex bodyIndex)
+        {
+            AzPhysics::SceneQueryHit hit;
+            hit.m_resultFlags = AzPhysics::SceneQuery::EntityId;
+            hit.m_entityId = AZ::EntityId{ 2 };
+            hit.m_bodyHandle = AzPhysics::SimulatedBodyHandle(AZ::Crc32(1), bodyIndex);
+            hit.m_shape = shape;
+            return hit;
+        }
+
+        static constexpr AzPhysics::SimulatedBodyIndex FloorIndex = 0;
+        static constexpr AzPhysics::SimulatedBodyIndex CrateIndex = 1;
+        static constexpr float CrateHalfSize = 1.f;
+
+        const AZ::EntityId m_providerEntityId{ 1 };
+
+        unique_ptr<UnitTest::MockSceneInterface> m_mockSceneInterface;
+        unique_ptr<UnitTest::MockPhysicsShape> m_floorShape;
+        unique_ptr<UnitTest::MockSimulatedBody> m_floorBody;
+        unique_ptr<UnitTest::MockPhysicsShape> m_crateShape;
+        unique_ptr<UnitTest::MockSimulatedBody> m_crateBody;
+        AZ::Vector3 m_cratePosition;
+
+        RecastNavigation::RecastNavigationMeshConfig m_config;
+        unique_ptr<RecastNavigation::RecastNavigationPhysXProviderComponentController> m_provider;
+        unique_ptr<RecastNavigation::RecastNavigationMeshComponentController> m_meshController;
+        unique_ptr<rcContext> m_context;
+    };
+
+    BENCHMARK_DEFINE_F(NavigationMeshRebuildBenchmark, RebuildAfterColliderMoved)(benchmark::State& state)
+    {
+        const bool onlyChangedTiles = state.range(0) != 0;
+
+        // The initial build of all the tiles.
+        RebuildTiles(false);
+
+        size_t tilesBuilt = 0;
+        int step = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Move the crate back and forth by a couple of meters.
+            m_cratePosition = AZ::Vector3(aznumeric_cast<float>((step++ % 2) * 3), 0.f, 0.f);
+            tilesBuilt += RebuildTiles(onlyChangedTiles);
+        }
+
+        state.counters["TilesBuilt"] = benchmark::Counter(aznumeric_cast<double>(tilesBuilt), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(NavigationMeshRebuildBenchmark, RebuildAfterColliderMoved)
+        ->ArgName("OnlyChangedTiles")
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMillisecond);
+
+    //! Many agents requesting paths across the same world at once.
+    class PathFindingBenchmark
+        : public NavigationMeshRebuildBenchmark
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            NavigationMeshRebuildBenchmark::SetUp(state);
+
+            m_meshController->CreateNavigationMesh(m_providerEntityId);
+
+            const float borderSize = aznumeric_cast<float>(m_config.m_borderSize) * m_config.m_cellSize;
+            const AZ::Aabb worldVolume = GetEncompassingAabb();
+
+            TileCollector collector;
+            const AZStd::vector<AZStd::shared_ptr<RecastNavigation::TileGeometry>> tiles = collector.Collect(
+                [this, borderSize, &worldVolume](TileCollector::TileCallback callback)
+                {
+                    return m_provider->CollectGeometryAsyncImpl(m_config.m_tileSize, borderSize, worldVolume, AZStd::move(callback));
+                });
+
+            for (const AZStd::shared_ptr<RecastNavigation::TileGeometry>& tile : tiles)
+            {
+                RecastNavigation::NavigationTileData tileData = m_meshController->CreateNavigationTile(tile.get(), m_config, m_context.get());
+                m_meshController->ReplaceNavigationTile(tile->m_tileX, tile->m_tileY, tileData);
+            }
+
+            m_pathQueryService = AZStd::make_unique<RecastNavigation::DetourPathQueryService>(aznumeric_cast<AZ::u32>(state.range(0)));
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_pathQueryService = {};
+
+            NavigationMeshRebuildBenchmark::TearDown(state);
+        }
+
+    protected:
+        static constexpr int AgentCount = 1000;
+
+        unique_ptr<RecastNavigation::DetourPathQueryService> m_pathQueryService;
+    };
+
+    BENCHMARK_DEFINE_F(PathFindingBenchmark, FindPathsForManyAgents)(benchmark::State& state)
+    {
+        const AZStd::shared_ptr<NavMeshQuery> navMeshQuery = m_meshController->GetNavigationObject();
+        AZ::SimpleLcgRandom random(1234);
+        const auto randomPosition = [&random]()
+        {
+            return AZ::Vector3(random.GetRandomFloat() * 120.f - 60.f, random.GetRandomFloat() * 120.f - 60.f, 0.f);
+        };
+
+        int pathsFound = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int agent = 0; agent < AgentCount; ++agent)
+            {
+                m_pathQueryService->RequestPath(navMeshQuery, randomPosition(), randomPosition(), 3.f,
+                    [&pathsFound](const AZStd::vector<AZ::Vector3>& path)
+                    {
+                        if (!path.empty())
+                        {
+                            ++pathsFound;
+                        }
+                    });
+            }
+
+            // Run frames until all of the agents have their paths.
+            while (m_pathQueryService->GetNumberOfRequests() > 0)
+            {
+                m_pathQueryService->ProcessRequests();
+                AZStd::this_thread::yield();
+            }
+        }
+
+        state.counters["PathsPerSecond"] = benchmark::Counter(aznumeric_cast<double>(state.iterations() * AgentCount), benchmark::Counter::kIsRate);
+        state.counters["PathsFound"] = benchmark::Counter(aznumeric_cast<double>(pathsFound), benchmark::Counter::kAvgIterations);
+    }
+
+    BENCHMARK_REGISTER_F(PathFindingBenchmark, FindPathsForManyAgents)
+        ->ArgName("Workers")
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+#endif
 }
@@ -18,6 +18,8 @@ set(FILES
     Source/Components/RecastNavigationPhysXProviderComponent.h
     Source/Components/RecastNavigationPhysXProviderComponent.cpp
 
+    Source/Misc/DetourPathQueryService.h
+    Source/Misc/DetourPathQueryService.cpp
     Source/Misc/RecastNavigationConstants.h
     Source/Misc/RecastNavigationDebugDraw.h
     Source/Misc/RecastNavigationDebugDraw.cpp
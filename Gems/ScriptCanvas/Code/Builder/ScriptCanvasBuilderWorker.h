@@ -147,8 +147,12 @@ namespace ScriptCanvasBuilder
 
     AZ::Outcome<void, AZStd::string> SaveRuntimeAsset(ProcessTranslationJobInput& input, ScriptCanvas::RuntimeData& runtimeData);
 
+    AZ::Outcome<void, AZStd::string> SaveNativeTranslation(const ScriptCanvas::Translation::Result& translationResult, const AZStd::string& fileNameOnly);
+
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request);
 
+    ScriptCanvas::Translation::Result TranslateToLuaAndCPlusPlus(ScriptCanvas::Grammar::Request& request);
+
     class Worker
         : public AssetBuilderSDK::AssetBuilderCommandBus::Handler
     {
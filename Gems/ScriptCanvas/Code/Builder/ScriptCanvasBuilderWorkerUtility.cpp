@@ -10,10 +10,12 @@
 #include <Asset/AssetDescription.h>
 #include <AssetBuilderSDK/SerializationDependencies.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/IOUtils.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzFramework/Script/ScriptComponent.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <Builder/ScriptCanvasBuilderWorker.h>
@@ -32,6 +34,11 @@
 
 namespace ScriptCanvasBuilder
 {
+    AZ_CVAR(bool, g_translateToNativeCode, false, {}, AZ::ConsoleFunctorFlags::Null
+        , "Also translate graphs to C++, to be compiled into a project module that ScriptCanvas will execute natively when it is loaded.");
+    AZ_CVAR(AZ::CVarFixedString, g_nativeCodeOutputFolder, "@projectroot@/ScriptCanvasNative", {}, AZ::ConsoleFunctorFlags::Null
+        , "The folder to which the C++ translations of graphs are written, when g_translateToNativeCode is enabled.");
+
     AssetHandlers::AssetHandlers(SharedHandlers& source)
         : m_editorFunctionAssetHandler(source.m_editorFunctionAssetHandler.first)
         , m_runtimeAssetHandler(source.m_runtimeAssetHandler.first)
@@ -220,13 +227,23 @@ namespace ScriptCanvasBuilder
         request.rawSaveDebugOutput = ScriptCanvas::Grammar::g_saveRawTranslationOuputToFile;
         request.printModelToConsole = ScriptCanvas::Grammar::g_printAbstractCodeModel;
 
-        ScriptCanvas::Translation::Result translationResult = TranslateToLua(request);
+        ScriptCanvas::Translation::Result translationResult = g_translateToNativeCode ? TranslateToLuaAndCPlusPlus(request) : TranslateToLua(request);
         auto outcome = translationResult.IsSuccess(ScriptCanvas::Translation::TargetFlags::Lua);
         if (!outcome.IsSuccess())
         {
             return AZ::Failure(outcome.GetError());
         }
 
+        if (g_translateToNativeCode)
+        {
+            // the C++ translation is optional, graphs that it does not support are executed by the interpreted runtime
+            auto nativeOutcome = SaveNativeTranslation(translationResult, input.fileNameOnly);
+            if (!nativeOutcome.IsSuccess())
+            {
+                AZ_TracePrintf(s_scriptCanvasBuilder, "%s will not be executed natively: %s", input.fullPath.c_str(), nativeOutcome.GetError().c_str());
+            }
+        }
+
         const auto& translation = translationResult.m_translations.find(ScriptCanvas::Translation::TargetFlags::Lua)->second;
 
         AZ::IO::MemoryStream inputStream(translation.m_text.data(), translation.m_text.size());
@@ -395,9 +412,62 @@ namespace ScriptCanvasBuilder
         return AZ::Success();
     }
 
+    AZ::Outcome<void, AZStd::string> SaveNativeTranslation(const ScriptCanvas::Translation::Result& translationResult, const AZStd::string& fileNameOnly)
+    {
+        using namespace ScriptCanvas::Translation;
+
+        auto outcome = translationResult.IsSuccess(TargetFlags::Cpp);
+        if (!outcome.IsSuccess())
+        {
+            return outcome;
+        }
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (!fileIO)
+        {
+            return AZ::Failure(AZStd::string("FileIOBase unavailable"));
+        }
+
+        char outputFolder[AZ_MAX_PATH_LEN];
+        if (!fileIO->ResolvePath(static_cast<AZ::CVarFixedString>(g_nativeCodeOutputFolder).c_str(), outputFolder, AZ_MAX_PATH_LEN))
+        {
+            return AZ::Failure(AZStd::string::format("Failed to resolve native code folder: %s", static_cast<AZ::CVarFixedString>(g_nativeCodeOutputFolder).c_str()));
+        }
+
+        const AZStd::string safeName = ScriptCanvas::Grammar::ToSafeName(fileNameOnly);
+        const AZStd::pair<TargetFlags, const char*> files[] = { { TargetFlags::Hpp, "h" }, { TargetFlags::Cpp, "cpp" } };
+
+        for (const auto& file : files)
+        {
+            auto translation = translationResult.m_translations.find(file.first);
+            if (translation == translationResult.m_translations.end())
+            {
+                return AZ::Failure(AZStd::string::format("Missing .%s translation", file.second));
+            }
+
+            AZStd::string filePath;
+            AzFramework::StringFunc::Path::Join(outputFolder, AZStd::string::format("%s.%s", safeName.c_str(), file.second).c_str(), filePath);
+
+            auto writeOutcome = AZ::Utils::WriteFile(translation->second.m_text, filePath);
+            if (!writeOutcome.IsSuccess())
+            {
+                return writeOutcome;
+            }
+        }
+
+        return AZ::Success();
+    }
+
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
         return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
     }
+
+    ScriptCanvas::Translation::Result TranslateToLuaAndCPlusPlus(ScriptCanvas::Grammar::Request& request)
+    {
+        using namespace ScriptCanvas::Translation;
+        request.translationTargetFlags = TargetFlags::Lua | TargetFlags::Cpp | TargetFlags::Hpp;
+        return ParseAndTranslateGraph(request);
+    }
 }
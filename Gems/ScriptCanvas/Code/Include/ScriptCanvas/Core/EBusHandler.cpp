@@ -8,6 +8,7 @@
 
 #include "EBusHandler.h"
 #include <AzCore/Script/lua/lua.h>
+#include <ScriptCanvas/Execution/ExecutionSampler.h>
 
 namespace ScriptCanvas
 {
@@ -118,6 +119,7 @@ namespace ScriptCanvas
         AZ_PROFILE_SCOPE(ScriptCanvas, "EBusEventHandler::OnEvent %s", eventName);
         auto handler = reinterpret_cast<EBusHandler*>(userData);
         SCRIPT_CANVAS_PERFORMANCE_SCOPE_LATENT(handler->GetExecutionState());
+        Execution::HandlerSampleScope sampleScope(*handler, eventName, eventIndex);
         handler->OnEvent(nullptr, eventIndex, result, numParameters, parameters);
     }
 
@@ -14,6 +14,7 @@
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h>
+#include <ScriptCanvas/Execution/Native/NativeGraphRegistry.h>
 
 #include <ScriptCanvas/Execution/ExecutionContext.h>
 
@@ -196,7 +197,18 @@ namespace ScriptCanvas
                 break;
 
             case Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart:
-                runtimeData.m_createExecution = &Execution::CreatePureOnGraphStart;
+                // graphs whose C++ translation was compiled into a loaded module run natively, the rest fall back to the interpreter
+                if (NativeGraphStart onGraphStart = FindNativeGraph(runtimeData.m_script.GetId().m_guid))
+                {
+                    runtimeData.m_createExecution = [onGraphStart](Execution::StateStorage& storage, ExecutionStateConfig& config)
+                    {
+                        return Execution::CreateNativePureOnGraphStart(storage, config, onGraphStart);
+                    };
+                }
+                else
+                {
+                    runtimeData.m_createExecution = &Execution::CreatePureOnGraphStart;
+                }
                 break;
 
             case Grammar::ExecutionStateSelection::InterpretedObject:
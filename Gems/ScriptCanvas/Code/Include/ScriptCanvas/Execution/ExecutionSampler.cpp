@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Metrics/IEventLoggerFactory.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
+#include <ScriptCanvas/Core/EBusHandler.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+
+#include "ExecutionSampler.h"
+
+namespace ExecutionSamplerCpp
+{
+    constexpr size_t k_maxOpenNodes = 64;
+
+    AZStd::atomic<AZ::u64> s_nextSamplerId{ 0 };
+
+    void OnExecutionSamplingEnabledChanged(const bool& isEnabled)
+    {
+        ScriptCanvas::Execution::ExecutionSampler::GetInstance()->OnSamplingEnabledChanged(isEnabled);
+    }
+
+    template<typename t_Key, typename t_Sample>
+    AZStd::vector<AZStd::pair<t_Key, t_Sample>> SortByEstimatedTime(AZStd::unordered_map<t_Key, t_Sample>&& samples, size_t count)
+    {
+        AZStd::vector<AZStd::pair<t_Key, t_Sample>> sorted;
+        sorted.reserve(samples.size());
+
+        for (auto& sample : samples)
+        {
+            sorted.emplace_back(sample.first, AZStd::move(sample.second));
+        }
+
+        AZStd::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs)
+        {
+            return lhs.second.m_statistics.GetEstimatedMicroseconds() > rhs.second.m_statistics.GetEstimatedMicroseconds();
+        });
+
+        if (sorted.size() > count)
+        {
+            sorted.resize(count);
+        }
+
+        return sorted;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        AZ_CVAR(bool, g_executionSamplingEnabled, false, &ExecutionSamplerCpp::OnExecutionSamplingEnabledChanged, AZ::ConsoleFunctorFlags::Null
+            , "Sample the call counts and execution time of the nodes and EBus event handlers of ScriptCanvas graphs. Per node samples are "
+              "only reported by graphs that are loaded after sampling was enabled.");
+        AZ_CVAR(AZ::u32, g_executionSamplingPeriod, 16, {}, AZ::ConsoleFunctorFlags::Null
+            , "All sampled calls are counted, but only one in this many calls on each thread is timed.");
+        AZ_CVAR(AZ::u32, g_executionSamplingReportPeriodMs, 5000, {}, AZ::ConsoleFunctorFlags::Null
+            , "How often, in milliseconds, the hottest ScriptCanvas nodes and EBus event handlers are exported.");
+        AZ_CVAR(AZ::u32, g_executionSamplingReportCount, 32, {}, AZ::ConsoleFunctorFlags::Null
+            , "The number of the hottest ScriptCanvas nodes, and of the hottest EBus event handlers, exported by each report.");
+        AZ_CVAR(AZ::CVarFixedString, g_executionSamplingMetricsFile, "scriptcanvas_execution_metrics.json", {}, AZ::ConsoleFunctorFlags::Null
+            , "The file that ScriptCanvas execution samples are exported to, placed under <ProjectFolder>/user/Metrics, unless an event "
+              "logger for them was already registered.");
+
+        static constexpr const char ExecutionSamplerName[] = "ScriptCanvasExecutionSampler";
+
+        double SampleStatistics::GetEstimatedMicroseconds() const
+        {
+            if (m_sampledCount == 0)
+            {
+                return 0.0;
+            }
+
+            const double sampledMicroseconds = aznumeric_cast<double>(m_sampledTicks) * 1000000.0 / aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond());
+            return sampledMicroseconds * aznumeric_cast<double>(m_callCount) / aznumeric_cast<double>(m_sampledCount);
+        }
+
+        SampleStatistics& SampleStatistics::operator+=(const SampleStatistics& rhs)
+        {
+            m_callCount += rhs.m_callCount;
+            m_sampledCount += rhs.m_sampledCount;
+            m_sampledTicks += rhs.m_sampledTicks;
+            return *this;
+        }
+
+        bool NodeSampleKey::operator==(const NodeSampleKey& rhs) const
+        {
+            return m_assetId == rhs.m_assetId && m_debugIndex == rhs.m_debugIndex;
+        }
+
+        bool HandlerSampleKey::operator==(const HandlerSampleKey& rhs) const
+        {
+            return m_assetId == rhs.m_assetId && m_ebusName == rhs.m_ebusName && m_eventIndex == rhs.m_eventIndex;
+        }
+
+        void SampleReport::Merge(SampleReport&& source)
+        {
+            for (auto& node : source.m_nodes)
+            {
+                auto [iter, isInserted] = m_nodes.try_emplace(node.first, AZStd::move(node.second));
+                if (!isInserted)
+                {
+                    iter->second.m_statistics += node.second.m_statistics;
+                }
+            }
+
+            for (auto& handler : source.m_handlers)
+            {
+                auto [iter, isInserted] = m_handlers.try_emplace(handler.first, AZStd::move(handler.second));
+                if (!isInserted)
+                {
+                    iter->second.m_statistics += handler.second.m_statistics;
+                }
+            }
+        }
+
+        struct ExecutionSampler::ThreadBuffer
+        {
+            struct OpenNode
+            {
+                size_t m_debugIndex;
+                bool m_isSampled;
+                AZStd::sys_time_t m_startTicks;
+            };
+
+            // only contended when the samples are collected
+            AZStd::mutex m_mutex;
+            SampleReport m_report;
+
+            // only accessed by the owning thread
+            AZStd::fixed_vector<OpenNode, ExecutionSamplerCpp::k_maxOpenNodes> m_openNodes;
+            AZ::u32 m_countdown = 0;
+        };
+
+        AZ_THREAD_LOCAL AZ::u64 ExecutionSampler::s_threadBufferOwner = 0;
+        AZ_THREAD_LOCAL ExecutionSampler::ThreadBuffer* ExecutionSampler::s_threadBuffer = nullptr;
+
+        ExecutionSampler* ExecutionSampler::GetInstance()
+        {
+            static AZ::EnvironmentVariable<ExecutionSampler> g_executionSampler;
+
+            if (!g_executionSampler)
+            {
+                g_executionSampler = AZ::Environment::FindVariable<ExecutionSampler>(ExecutionSamplerName);
+            }
+
+            if (!g_executionSampler)
+            {
+                g_executionSampler = AZ::Environment::CreateVariable<ExecutionSampler>(ExecutionSamplerName);
+            }
+
+            return &(g_executionSampler.Get());
+        }
+
+        ExecutionSampler::ExecutionSampler()
+            : m_id(++ExecutionSamplerCpp::s_nextSamplerId)
+        {
+        }
+
+        ExecutionSampler::~ExecutionSampler()
+        {
+            AZ::SystemTickBus::Handler::BusDisconnect();
+        }
+
+        void ExecutionSampler::Activate()
+        {
+            m_isActive = true;
+
+            if (g_executionSamplingEnabled)
+            {
+                StartSampling();
+            }
+        }
+
+        void ExecutionSampler::Deactivate()
+        {
+            StopSampling();
+            m_isActive = false;
+        }
+
+        void ExecutionSampler::OnSamplingEnabledChanged(bool isEnabled)
+        {
+            if (!m_isActive)
+            {
+                return;
+            }
+
+            if (isEnabled)
+            {
+                StartSampling();
+            }
+            else
+            {
+                StopSampling();
+            }
+        }
+
+        void ExecutionSampler::BeginNode(size_t debugIndex)
+        {
+            ThreadBuffer& buffer = GetThreadBuffer();
+
+            if (buffer.m_openNodes.size() == buffer.m_openNodes.capacity())
+            {
+                // the calls were abandoned by runtime errors
+                buffer.m_openNodes.clear();
+            }
+
+            const bool isSampled = SelectSample(buffer);
+            buffer.m_openNodes.push_back({ debugIndex, isSampled, isSampled ? AZStd::GetTimeNowTicks() : 0 });
+        }
+
+        void ExecutionSampler::EndNode(const AZ::Data::AssetId& assetId, size_t debugIndex, const ExecutionState* executionState)
+        {
+            ThreadBuffer& buffer = GetThreadBuffer();
+
+            // calls abandoned by runtime errors are never ended, discard them
+            while (!buffer.m_openNodes.empty() && buffer.m_openNodes.back().m_debugIndex != debugIndex)
+            {
+                buffer.m_openNodes.pop_back();
+            }
+
+            if (buffer.m_openNodes.empty())
+            {
+                return;
+            }
+
+            const ThreadBuffer::OpenNode openNode = buffer.m_openNodes.back();
+            buffer.m_openNodes.pop_back();
+            const AZStd::sys_time_t ticks = openNode.m_isSampled ? AZStd::GetTimeNowTicks() - openNode.m_startTicks : 0;
+
+            AZStd::lock_guard<AZStd::mutex> lock(buffer.m_mutex);
+            auto [iter, isInserted] = buffer.m_report.m_nodes.try_emplace(NodeSampleKey{ assetId, debugIndex });
+            NodeSample& sample = iter->second;
+
+            if (isInserted)
+            {
+                const Grammar::DebugExecution* symbol = executionState ? executionState->GetDebugSymbolIn(debugIndex) : nullptr;
+                if (symbol)
+                {
+                    sample.m_nodeId = symbol->m_namedEndpoint.GetNodeId();
+                    sample.m_nodeName = symbol->m_namedEndpoint.GetNodeName();
+                }
+                else
+                {
+                    sample.m_nodeName = AZStd::string::format("Node %zu", debugIndex);
+                }
+            }
+
+            ++sample.m_statistics.m_callCount;
+
+            if (openNode.m_isSampled)
+            {
+                ++sample.m_statistics.m_sampledCount;
+                sample.m_statistics.m_sampledTicks += ticks;
+            }
+        }
+
+        void ExecutionSampler::RecordHandler(const HandlerSampleKey& key, const char* eventName, bool isSampled, AZStd::sys_time_t ticks)
+        {
+            ThreadBuffer& buffer = GetThreadBuffer();
+
+            AZStd::lock_guard<AZStd::mutex> lock(buffer.m_mutex);
+            auto [iter, isInserted] = buffer.m_report.m_handlers.try_emplace(key);
+            HandlerSample& sample = iter->second;
+
+            if (isInserted)
+            {
+                sample.m_ebusName = key.m_ebusName ? *key.m_ebusName : AZStd::string();
+                sample.m_eventName = eventName ? eventName : AZStd::string::format("Event %d", key.m_eventIndex);
+            }
+
+            ++sample.m_statistics.m_callCount;
+
+            if (isSampled)
+            {
+                ++sample.m_statistics.m_sampledCount;
+                sample.m_statistics.m_sampledTicks += ticks;
+            }
+        }
+
+        bool ExecutionSampler::SelectSample()
+        {
+            return SelectSample(GetThreadBuffer());
+        }
+
+        bool ExecutionSampler::SelectSample(ThreadBuffer& buffer)
+        {
+            if (buffer.m_countdown == 0)
+            {
+                buffer.m_countdown = AZStd::max(static_cast<AZ::u32>(g_executionSamplingPeriod), 1u) - 1;
+                return true;
+            }
+
+            --buffer.m_countdown;
+            return false;
+        }
+
+        SampleReport ExecutionSampler::Collect()
+        {
+            SampleReport report;
+            AZStd::lock_guard<AZStd::mutex> buffersLock(m_buffersMutex);
+
+            for (auto& buffer : m_buffers)
+            {
+                SampleReport threadReport;
+
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(buffer->m_mutex);
+                    threadReport = AZStd::move(buffer->m_report);
+                    buffer->m_report = {};
+                }
+
+                report.Merge(AZStd::move(threadReport));
+            }
+
+            return report;
+        }
+
+        void ExecutionSampler::RecordMetrics()
+        {
+            auto eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get();
+            AZ::Metrics::IEventLogger* eventLogger = eventLoggerFactory ? eventLoggerFactory->FindEventLogger(ExecutionSamplingMetricsId) : nullptr;
+            SampleReport report = Collect();
+
+            if (!eventLogger)
+            {
+                return;
+            }
+
+            const size_t reportCount = static_cast<AZ::u32>(g_executionSamplingReportCount);
+
+            for (const auto& [key, node] : ExecutionSamplerCpp::SortByEstimatedTime(AZStd::move(report.m_nodes), reportCount))
+            {
+                const AZStd::string assetId = key.m_assetId.ToString<AZStd::string>();
+                const AZStd::string nodeId = node.m_nodeId.ToString();
+
+                AZ::Metrics::EventObjectStorage argsContainer;
+                argsContainer.emplace_back("asset", assetId);
+                argsContainer.emplace_back("node", nodeId);
+                argsContainer.emplace_back("calls", node.m_statistics.m_callCount);
+                argsContainer.emplace_back("timedCalls", node.m_statistics.m_sampledCount);
+                argsContainer.emplace_back("estimatedTimeUs", node.m_statistics.GetEstimatedMicroseconds());
+
+                AZ::Metrics::CounterArgs counterArgs;
+                counterArgs.m_name = node.m_nodeName;
+                counterArgs.m_cat = "ScriptCanvasNode";
+                counterArgs.m_args = argsContainer;
+                eventLogger->RecordCounterEvent(counterArgs);
+            }
+
+            for (const auto& [key, handler] : ExecutionSamplerCpp::SortByEstimatedTime(AZStd::move(report.m_handlers), reportCount))
+            {
+                const AZStd::string assetId = key.m_assetId.ToString<AZStd::string>();
+                const AZStd::string name = AZStd::string::format("%s::%s", handler.m_ebusName.c_str(), handler.m_eventName.c_str());
+
+                AZ::Metrics::EventObjectStorage argsContainer;
+                argsContainer.emplace_back("asset", assetId);
+                argsContainer.emplace_back("calls", handler.m_statistics.m_callCount);
+                argsContainer.emplace_back("timedCalls", handler.m_statistics.m_sampledCount);
+                argsContainer.emplace_back("estimatedTimeUs", handler.m_statistics.GetEstimatedMicroseconds());
+
+                AZ::Metrics::CounterArgs counterArgs;
+                counterArgs.m_name = name;
+                counterArgs.m_cat = "ScriptCanvasEBusHandler";
+                counterArgs.m_args = argsContainer;
+                eventLogger->RecordCounterEvent(counterArgs);
+            }
+        }
+
+        ExecutionSampler::ThreadBuffer& ExecutionSampler::GetThreadBuffer()
+        {
+            if (s_threadBufferOwner != m_id)
+            {
+                auto buffer = AZStd::make_unique<ThreadBuffer>();
+                s_threadBuffer = buffer.get();
+                s_threadBufferOwner = m_id;
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_buffersMutex);
+                m_buffers.push_back(AZStd::move(buffer));
+            }
+
+            return *s_threadBuffer;
+        }
+
+        void ExecutionSampler::OnSystemTick()
+        {
+            const AZStd::sys_time_t now = AZStd::GetTimeNowTicks();
+            const AZStd::sys_time_t reportPeriod = AZStd::GetTimeTicksPerSecond() * static_cast<AZ::u32>(g_executionSamplingReportPeriodMs) / 1000;
+
+            if (now - m_lastRecordTicks >= reportPeriod)
+            {
+                m_lastRecordTicks = now;
+                RecordMetrics();
+            }
+        }
+
+        void ExecutionSampler::StartSampling()
+        {
+            if (m_isSampling)
+            {
+                return;
+            }
+
+            m_isSampling = true;
+
+            if (auto eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get();
+                eventLoggerFactory && !eventLoggerFactory->FindEventLogger(ExecutionSamplingMetricsId))
+            {
+                const AZ::IO::FixedMaxPath metricsFilepath = AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / "user/Metrics"
+                    / static_cast<AZ::CVarFixedString>(g_executionSamplingMetricsFile);
+                constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+
+                auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(metricsFilepath.c_str(), openMode);
+                AZ::Metrics::JsonTraceEventLoggerConfig config{ "ScriptCanvas" };
+                auto eventLogger = AZStd::make_unique<AZ::Metrics::JsonTraceEventLogger>(AZStd::move(stream), config);
+                m_ownsEventLogger = eventLoggerFactory->RegisterEventLogger(ExecutionSamplingMetricsId, AZStd::move(eventLogger)).IsSuccess();
+            }
+
+            // only the performance configuration of interpreted graphs samples its nodes, the previous one is restored once sampling stops
+            m_previousExecutionMode = GetInterpretedExecutionMode();
+            SetInterpretedExecutionMode(BuildConfiguration::Performance);
+
+            m_lastRecordTicks = AZStd::GetTimeNowTicks();
+            AZ::SystemTickBus::Handler::BusConnect();
+        }
+
+        void ExecutionSampler::StopSampling()
+        {
+            if (!m_isSampling)
+            {
+                return;
+            }
+
+            m_isSampling = false;
+            AZ::SystemTickBus::Handler::BusDisconnect();
+            RecordMetrics();
+
+            // leave the execution mode alone if it was changed while sampling
+            if (GetInterpretedExecutionMode() == BuildConfiguration::Performance)
+            {
+                SetInterpretedExecutionMode(m_previousExecutionMode);
+            }
+
+            if (m_ownsEventLogger)
+            {
+                if (auto eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get())
+                {
+                    eventLoggerFactory->UnregisterEventLogger(ExecutionSamplingMetricsId);
+                }
+
+                m_ownsEventLogger = false;
+            }
+        }
+
+        HandlerSampleScope::HandlerSampleScope(const EBusHandler& handler, const char* eventName, int eventIndex)
+        {
+            if (g_executionSamplingEnabled)
+            {
+                if (ExecutionStateWeakConstPtr executionState = handler.GetExecutionState())
+                {
+                    // the handler and its execution state may be destroyed by the event, so everything is captured up front
+                    m_key = HandlerSampleKey{ executionState->GetAssetId(), &handler.GetEBusName(), eventIndex };
+                    m_eventName = eventName;
+                    m_isEnabled = true;
+                    m_isSampled = ExecutionSampler::GetInstance()->SelectSample();
+                    m_startTicks = m_isSampled ? AZStd::GetTimeNowTicks() : 0;
+                }
+            }
+        }
+
+        HandlerSampleScope::~HandlerSampleScope()
+        {
+            if (m_isEnabled)
+            {
+                const AZStd::sys_time_t ticks = m_isSampled ? AZStd::GetTimeNowTicks() - m_startTicks : 0;
+                ExecutionSampler::GetInstance()->RecordHandler(m_key, m_eventName, m_isSampled, ticks);
+            }
+        }
+    }
+}
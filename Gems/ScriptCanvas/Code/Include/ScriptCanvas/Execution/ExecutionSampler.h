@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Metrics/IEventLogger.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+namespace ScriptCanvas
+{
+    class EBusHandler;
+    class ExecutionState;
+
+    namespace Execution
+    {
+        AZ_CVAR_EXTERNED(bool, g_executionSamplingEnabled);
+
+        //! The id of the event logger that execution samples are exported to.
+        constexpr AZ::Metrics::EventLoggerId ExecutionSamplingMetricsId{ static_cast<AZ::u32>(AZStd::hash<AZStd::string_view>{}("ScriptCanvasExecution")) };
+
+        struct SampleStatistics
+        {
+            AZ::u64 m_callCount = 0;
+            AZ::u64 m_sampledCount = 0;
+            AZStd::sys_time_t m_sampledTicks = 0;
+
+            //! The total execution time of all calls, extrapolated from the timed ones.
+            double GetEstimatedMicroseconds() const;
+
+            SampleStatistics& operator+=(const SampleStatistics& rhs);
+        };
+
+        //! Nodes are identified by the index of their debug symbol, so that no lookup is required while sampling them.
+        struct NodeSampleKey
+        {
+            AZ::Data::AssetId m_assetId;
+            size_t m_debugIndex = 0;
+
+            bool operator==(const NodeSampleKey& rhs) const;
+        };
+
+        struct NodeSample
+        {
+            AZ::EntityId m_nodeId;
+            AZStd::string m_nodeName;
+            SampleStatistics m_statistics;
+        };
+
+        //! EBus event handlers are identified by the name of their bus, which is owned by the BehaviorEBus, and the event index.
+        struct HandlerSampleKey
+        {
+            AZ::Data::AssetId m_assetId;
+            const AZStd::string* m_ebusName = nullptr;
+            int m_eventIndex = 0;
+
+            bool operator==(const HandlerSampleKey& rhs) const;
+        };
+
+        struct HandlerSample
+        {
+            AZStd::string m_ebusName;
+            AZStd::string m_eventName;
+            SampleStatistics m_statistics;
+        };
+    }
+}
+
+namespace AZStd
+{
+    template<>
+    struct hash<ScriptCanvas::Execution::NodeSampleKey>
+    {
+        size_t operator()(const ScriptCanvas::Execution::NodeSampleKey& key) const
+        {
+            size_t seed = 0;
+            hash_combine(seed, key.m_assetId, key.m_debugIndex);
+            return seed;
+        }
+    };
+
+    template<>
+    struct hash<ScriptCanvas::Execution::HandlerSampleKey>
+    {
+        size_t operator()(const ScriptCanvas::Execution::HandlerSampleKey& key) const
+        {
+            size_t seed = 0;
+            hash_combine(seed, key.m_assetId, key.m_ebusName, key.m_eventIndex);
+            return seed;
+        }
+    };
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        struct SampleReport
+        {
+            AZStd::unordered_map<NodeSampleKey, NodeSample> m_nodes;
+            AZStd::unordered_map<HandlerSampleKey, HandlerSample> m_handlers;
+
+            void Merge(SampleReport&& source);
+        };
+
+        //! ExecutionSampler
+        //! Low overhead sampling of the nodes and EBus event handlers of running graphs, cheap enough to leave enabled in shipping
+        //! builds. Every call is counted, but only one in g_executionSamplingPeriod calls on a thread is timed. Samples are aggregated
+        //! in per thread buffers, which are only contended when they are collected, and the hottest nodes and handlers are periodically
+        //! exported through the AZ::Metrics::IEventLogger registered with ExecutionSamplingMetricsId.
+        //!
+        //! Nodes are sampled by the performance configuration of interpreted graphs, which is selected while sampling is enabled, so
+        //! only graphs loaded after sampling was enabled report per node samples.
+        class ExecutionSampler
+            : public AZ::SystemTickBus::Handler
+        {
+        public:
+            static ExecutionSampler* GetInstance();
+
+            ExecutionSampler();
+            ~ExecutionSampler();
+
+            //! Called by the ScriptCanvas SystemComponent, sampling only starts when the sampler is active and sampling is enabled.
+            void Activate();
+            void Deactivate();
+            void OnSamplingEnabledChanged(bool isEnabled);
+
+            //! Marks the start of a node call on this thread, must be paired with EndNode.
+            void BeginNode(size_t debugIndex);
+
+            //! Counts a node call on this thread, and times it if it was selected for sampling. The execution state is only used to look
+            //! up the name of the node the first time that it is sampled, and may be null.
+            void EndNode(const AZ::Data::AssetId& assetId, size_t debugIndex, const ExecutionState* executionState);
+
+            //! Counts an EBus event handler call on this thread, with the duration that it was timed for, if it was sampled.
+            void RecordHandler(const HandlerSampleKey& key, const char* eventName, bool isSampled, AZStd::sys_time_t ticks);
+
+            //! Returns true if the next call on this thread should be timed.
+            bool SelectSample();
+
+            //! Returns the samples recorded on all threads since the last collection, and clears them.
+            SampleReport Collect();
+
+            //! Exports the hottest nodes and handlers recorded since the last collection.
+            void RecordMetrics();
+
+        private:
+            struct ThreadBuffer;
+
+            // samplers are identified by an id rather than their address, which may be reused by a later sampler
+            static AZ_THREAD_LOCAL AZ::u64 s_threadBufferOwner;
+            static AZ_THREAD_LOCAL ThreadBuffer* s_threadBuffer;
+
+            ThreadBuffer& GetThreadBuffer();
+
+            bool SelectSample(ThreadBuffer& buffer);
+
+            // AZ::SystemTickBus::Handler...
+            void OnSystemTick() override;
+            ////
+
+            void StartSampling();
+            void StopSampling();
+
+            const AZ::u64 m_id;
+            AZStd::mutex m_buffersMutex;
+            AZStd::vector<AZStd::unique_ptr<ThreadBuffer>> m_buffers;
+            AZStd::sys_time_t m_lastRecordTicks = 0;
+            BuildConfiguration m_previousExecutionMode = BuildConfiguration::Debug;
+            bool m_isActive = false;
+            bool m_isSampling = false;
+            bool m_ownsEventLogger = false;
+        };
+
+        //! Samples the EBus event handler call in its scope, when execution sampling is enabled.
+        class HandlerSampleScope
+        {
+        public:
+            HandlerSampleScope(const EBusHandler& handler, const char* eventName, int eventIndex);
+            ~HandlerSampleScope();
+
+        private:
+            HandlerSampleKey m_key;
+            const char* m_eventName = nullptr;
+            bool m_isEnabled = false;
+            bool m_isSampled = false;
+            AZStd::sys_time_t m_startTicks = 0;
+        };
+    }
+}
@@ -12,6 +12,12 @@ namespace ScriptCanvas
 {
     namespace Execution
     {
+        ExecutionState* CreateNativePureOnGraphStart(StateStorage& storage, ExecutionStateConfig& config, NativeGraphStart onGraphStart)
+        {
+            new (&storage.data) ExecutionStateNativePureOnGraphStart(config, onGraphStart);
+            return reinterpret_cast<ExecutionState*>(&storage.data);
+        }
+
         ExecutionState* CreatePerActivation(StateStorage& storage, ExecutionStateConfig& config)
         {
             new (&storage.data) ExecutionStateInterpretedPerActivation(config);
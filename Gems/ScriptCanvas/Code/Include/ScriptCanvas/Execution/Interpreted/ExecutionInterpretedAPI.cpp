@@ -15,6 +15,7 @@
 #include <ScriptCanvas/Asset/RuntimeAsset.h>
 #include <ScriptCanvas/Core/Nodeable.h>
 #include <ScriptCanvas/Core/NodeableOut.h>
+#include <ScriptCanvas/Execution/ExecutionSampler.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpreted.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedAPI.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h>
@@ -196,6 +197,22 @@ namespace ScriptCanvas
             RegisterAPI(scriptContext->NativeContext());
         }
 
+        BuildConfiguration GetInterpretedExecutionMode()
+        {
+            AZ::ScriptContext* scriptContext{};
+            AZ::ScriptSystemRequestBus::BroadcastResult(scriptContext, &AZ::ScriptSystemRequests::GetContext, AZ::ScriptContextIds::DefaultScriptContextId);
+            AZ_Assert(scriptContext, "Must have a default script context");
+            lua_State* lua = scriptContext->NativeContext();
+
+            lua_getglobal(lua, Grammar::k_InterpretedConfigurationRelease);
+            const bool isRelease = lua_toboolean(lua, -1);
+            lua_getglobal(lua, Grammar::k_InterpretedConfigurationPerformance);
+            const bool isPerformance = lua_toboolean(lua, -1);
+            lua_pop(lua, 2);
+
+            return isRelease ? BuildConfiguration::Release : (isPerformance ? BuildConfiguration::Performance : BuildConfiguration::Debug);
+        }
+
         void SetInterpretedExecutionMode(BuildConfiguration configuration)
         {
             switch (configuration)
@@ -325,6 +342,8 @@ namespace ScriptCanvas
 #endif
 
             lua_register(lua, k_GetRandomSwitchControlNumberName, &GetRandomSwitchControlNumber);
+            lua_register(lua, k_SampleNodeInName, &SampleNodeIn);
+            lua_register(lua, k_SampleNodeOutName, &SampleNodeOut);
 
             RegisterTypeSafeEBusResultFunctions(lua);
             RegisterComponentAPI(lua);
@@ -350,6 +369,30 @@ namespace ScriptCanvas
             return ErrorHandler(lua);
         }
 
+        int SampleNodeIn(lua_State* lua)
+        {
+            // graphs loaded while sampling was enabled keep calling this after it has been disabled
+            if (g_executionSamplingEnabled)
+            {
+                ExecutionSampler::GetInstance()->BeginNode(aznumeric_caster(lua_tointeger(lua, 2)));
+            }
+
+            return 0;
+        }
+
+        int SampleNodeOut(lua_State* lua)
+        {
+            if (g_executionSamplingEnabled)
+            {
+                if (auto executionState = ExecutionStateRead(lua, 1))
+                {
+                    ExecutionSampler::GetInstance()->EndNode(executionState->GetAssetId(), aznumeric_caster(lua_tointeger(lua, 2)), executionState);
+                }
+            }
+
+            return 0;
+        }
+
         void InitializeInterpretedStatics(RuntimeData& runtimeData)
         {
             AZ_Error("ScriptCanvas", !runtimeData.m_areScriptLocalStaticsInitialized, "ScriptCanvas runtime data already initialized");
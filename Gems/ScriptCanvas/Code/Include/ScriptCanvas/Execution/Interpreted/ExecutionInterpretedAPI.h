@@ -51,12 +51,21 @@ namespace ScriptCanvas
 
         int ReportError(lua_State* lua, AZStd::string_view message);
 
+        // Lua: executionState, (debug in index) number
+        int SampleNodeIn(lua_State* lua);
+
+        // Lua: executionState, (debug in index) number
+        int SampleNodeOut(lua_State* lua);
+
         // Lua: (ebus handler) userdata, (out name) string, (out implementation) function
         int SetExecutionOut(lua_State* lua);
 
         // Lua: (ebus handler) userdata, (out name) string, (out implementation) function
         int SetExecutionOutResult(lua_State* lua);
 
+        //! Returns the configuration that interpreted graphs currently execute in, as set by SetInterpretedExecutionMode.
+        BuildConfiguration GetInterpretedExecutionMode();
+
         void SetInterpretedExecutionMode(BuildConfiguration configuration);
 
         void SetInterpretedExecutionModeDebug();
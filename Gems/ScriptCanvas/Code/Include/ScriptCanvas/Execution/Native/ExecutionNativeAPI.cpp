@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+
+#include "ExecutionNativeAPI.h"
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName)
+        {
+            AZ::BehaviorContext* behaviorContext = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+            SC_RUNTIME_CHECK(behaviorContext, "A BehaviorContext is required to run native ScriptCanvas graphs");
+
+            if (!behaviorContext)
+            {
+                return nullptr;
+            }
+
+            const AZStd::unordered_map<AZStd::string, AZ::BehaviorMethod*>* methods = &behaviorContext->m_methods;
+
+            if (!className.empty())
+            {
+                auto classIter = behaviorContext->m_classes.find(AZStd::string(className));
+                if (classIter == behaviorContext->m_classes.end())
+                {
+                    AZ_Error("ScriptCanvas", false, "Native ScriptCanvas graph requires class %.*s, which is not reflected"
+                        , aznumeric_cast<int>(className.size()), className.data());
+                    return nullptr;
+                }
+
+                methods = &classIter->second->m_methods;
+            }
+
+            auto methodIter = methods->find(AZStd::string(methodName));
+            AZ_Error("ScriptCanvas", methodIter != methods->end(), "Native ScriptCanvas graph requires method %.*s, which is not reflected"
+                , aznumeric_cast<int>(methodName.size()), methodName.data());
+            return methodIter != methods->end() ? methodIter->second : nullptr;
+        }
+    }
+}
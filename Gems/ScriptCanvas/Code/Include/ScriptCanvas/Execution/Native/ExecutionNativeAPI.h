@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/string/string_view.h>
+#include <ScriptCanvas/Execution/ExecutionStateDeclarations.h>
+
+/// The API used by C++ that was generated from ScriptCanvas graphs. Generated code binds each BehaviorContext method it calls once, in a
+/// function local static, and then calls through these helpers, which check the binding and the call the same way the interpreted
+/// runtime does.
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        //! Returns the reflected global method, or a method of a reflected class when className is not empty.
+        const AZ::BehaviorMethod* FindNativeMethod(AZStd::string_view className, AZStd::string_view methodName);
+
+        template<typename... Args>
+        void NativeCall(const AZ::BehaviorMethod* method, Args&&... args)
+        {
+            SC_RUNTIME_CHECK_RETURN(method, "Native ScriptCanvas graph called a BehaviorContext method that is no longer reflected");
+            [[maybe_unused]] const bool result = method->Invoke(AZStd::forward<Args>(args)...);
+            SC_RUNTIME_CHECK(result, "Native ScriptCanvas graph failed to call BehaviorContext method %s", method->m_name.c_str());
+        }
+
+        template<typename R, typename... Args>
+        void NativeCallResult(const AZ::BehaviorMethod* method, R& returnValue, Args&&... args)
+        {
+            SC_RUNTIME_CHECK_RETURN(method, "Native ScriptCanvas graph called a BehaviorContext method that is no longer reflected");
+            [[maybe_unused]] const bool result = method->InvokeResult(returnValue, AZStd::forward<Args>(args)...);
+            SC_RUNTIME_CHECK(result, "Native ScriptCanvas graph failed to call BehaviorContext method %s", method->m_name.c_str());
+        }
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+
+#include "ExecutionStateNative.h"
+
+namespace ScriptCanvas
+{
+    ExecutionStateNativePureOnGraphStart::ExecutionStateNativePureOnGraphStart
+        ( ExecutionStateConfig& config
+        , Execution::NativeGraphStart onGraphStart)
+        : ExecutionState(config)
+        , m_onGraphStart(onGraphStart)
+    {}
+
+    void ExecutionStateNativePureOnGraphStart::Execute()
+    {
+        SC_RUNTIME_CHECK_RETURN(m_onGraphStart, "ExecutionStateNativePureOnGraphStart has no native implementation to execute");
+        Execution::ActivationInputArray storage;
+        Execution::ActivationData data(GetRuntimeDataOverrides(), storage);
+        Execution::ActivationInputRange range = Execution::Context::CreateActivateInputRange(data);
+        m_onGraphStart(*this, range.inputs, range.totalCount);
+    }
+
+    ExecutionMode ExecutionStateNativePureOnGraphStart::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNativePureOnGraphStart::Initialize()
+    {}
+
+    bool ExecutionStateNativePureOnGraphStart::IsPure() const
+    {
+        return true;
+    }
+
+    void ExecutionStateNativePureOnGraphStart::StopExecution()
+    {}
+}
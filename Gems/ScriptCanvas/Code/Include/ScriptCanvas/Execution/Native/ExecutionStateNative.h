@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <ScriptCanvas/Execution/ExecutionState.h>
+#include <ScriptCanvas/Execution/Native/NativeGraphRegistry.h>
+
+namespace ScriptCanvas
+{
+    /// Executes a pure graph that only runs on graph start with the C++ translation of the graph, compiled into a module and found
+    /// in the NativeGraphRegistry. It requires no Lua context, and receives the same activation inputs as the interpreted version.
+    class ExecutionStateNativePureOnGraphStart
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNativePureOnGraphStart, "{5B0B31B4-8E5C-4D8F-9C57-6D7E2F3A1B94}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNativePureOnGraphStart, AZ::SystemAllocator);
+
+        ExecutionStateNativePureOnGraphStart(ExecutionStateConfig& config, Execution::NativeGraphStart onGraphStart);
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        bool IsPure() const override;
+
+        void StopExecution() override;
+
+    private:
+        Execution::NativeGraphStart m_onGraphStart;
+    };
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/parallel/lock.h>
+
+#include "NativeGraphRegistry.h"
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        AZ_CVAR(bool, g_nativeExecutionEnabled, true, {}, AZ::ConsoleFunctorFlags::Null
+            , "Run ScriptCanvas graphs with a registered native C++ implementation natively, instead of interpreting their Lua translation.");
+
+        static constexpr const char NativeGraphRegistryName[] = "ScriptCanvasNativeGraphRegistry";
+
+        NativeGraphRegistry* NativeGraphRegistry::GetInstance()
+        {
+            // Declared inside of GetInstance() for the same reason as the AutoGenRegistryManager: static registrars construct it on
+            // first use, which guarantees that it is destroyed after them.
+            static AZ::EnvironmentVariable<NativeGraphRegistry> g_nativeGraphRegistry;
+
+            if (!g_nativeGraphRegistry)
+            {
+                g_nativeGraphRegistry = AZ::Environment::FindVariable<NativeGraphRegistry>(NativeGraphRegistryName);
+            }
+
+            if (!g_nativeGraphRegistry)
+            {
+                g_nativeGraphRegistry = AZ::Environment::CreateVariable<NativeGraphRegistry>(NativeGraphRegistryName);
+            }
+
+            return &(g_nativeGraphRegistry.Get());
+        }
+
+        NativeGraphStart NativeGraphRegistry::Find(const AZ::Uuid& sourceId) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto iter = m_graphs.find(sourceId);
+            return iter != m_graphs.end() ? iter->second : nullptr;
+        }
+
+        void NativeGraphRegistry::Register(const AZ::Uuid& sourceId, NativeGraphStart onGraphStart)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_graphs.find(sourceId) != m_graphs.end())
+            {
+                // registration happens during static initialization, so the trace system can't be relied upon yet
+                AZ::Debug::Platform::OutputToDebugger(NativeGraphRegistryName
+                    , "A native implementation of this graph was already registered, the newest one will be used.\n");
+            }
+
+            m_graphs[sourceId] = onGraphStart;
+        }
+
+        void NativeGraphRegistry::Unregister(const AZ::Uuid& sourceId, NativeGraphStart onGraphStart)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            // only remove the entry if it still belongs to the caller, a newer module may have replaced it
+            if (auto iter = m_graphs.find(sourceId); iter != m_graphs.end() && iter->second == onGraphStart)
+            {
+                m_graphs.erase(iter);
+            }
+        }
+
+        NativeGraphAutoRegistrar::NativeGraphAutoRegistrar(const AZ::Uuid& sourceId, NativeGraphStart onGraphStart)
+            : m_sourceId(sourceId)
+            , m_onGraphStart(onGraphStart)
+        {
+            NativeGraphRegistry::GetInstance()->Register(m_sourceId, m_onGraphStart);
+        }
+
+        NativeGraphAutoRegistrar::~NativeGraphAutoRegistrar()
+        {
+            NativeGraphRegistry::GetInstance()->Unregister(m_sourceId, m_onGraphStart);
+        }
+
+        NativeGraphStart FindNativeGraph(const AZ::Uuid& sourceId)
+        {
+            return g_nativeExecutionEnabled ? NativeGraphRegistry::GetInstance()->Find(sourceId) : nullptr;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    struct BehaviorArgument;
+}
+
+//! Macro used by C++ generated from ScriptCanvas graphs to self-register the native implementation of a graph.
+//! The registration key is the source graph id, which is shared by the runtime asset and its Lua script asset.
+#define SCRIPT_CANVAS_NATIVE_GRAPH(SOURCE_ID_STRING, ON_GRAPH_START)\
+    static ScriptCanvas::Execution::NativeGraphAutoRegistrar s_scriptCanvasNativeGraphRegistrar(AZ::Uuid(SOURCE_ID_STRING), &ON_GRAPH_START);
+
+namespace ScriptCanvas
+{
+    class ExecutionState;
+
+    namespace Execution
+    {
+        AZ_CVAR_EXTERNED(bool, g_nativeExecutionEnabled);
+
+        //! The signature of the OnGraphStart function of a graph that was translated to C++. The arguments are the activation inputs of
+        //! the graph, in the same order that they would be supplied to the interpreted version of the graph.
+        using NativeGraphStart = void(*)(ExecutionState& executionState, AZ::BehaviorArgument* arguments, size_t argumentCount);
+
+        //! NativeGraphRegistry
+        //! Maps the source ids of ScriptCanvas graphs to native implementations compiled from the C++ translation of those graphs. Graphs
+        //! found here are run natively, all others are run by the interpreted (Lua) execution states.
+        class NativeGraphRegistry
+        {
+        public:
+            static NativeGraphRegistry* GetInstance();
+
+            NativeGraphStart Find(const AZ::Uuid& sourceId) const;
+
+            void Register(const AZ::Uuid& sourceId, NativeGraphStart onGraphStart);
+
+            void Unregister(const AZ::Uuid& sourceId, NativeGraphStart onGraphStart);
+
+        private:
+            mutable AZStd::mutex m_mutex;
+            AZStd::unordered_map<AZ::Uuid, NativeGraphStart> m_graphs;
+        };
+
+        //! Registers a native graph for the lifetime of the module that contains it.
+        class NativeGraphAutoRegistrar
+        {
+        public:
+            NativeGraphAutoRegistrar(const AZ::Uuid& sourceId, NativeGraphStart onGraphStart);
+            ~NativeGraphAutoRegistrar();
+
+        private:
+            AZ::Uuid m_sourceId;
+            NativeGraphStart m_onGraphStart;
+        };
+
+        //! Returns the native implementation of the graph, or nullptr if there is none or native execution is disabled.
+        NativeGraphStart FindNativeGraph(const AZ::Uuid& sourceId);
+    }
+}
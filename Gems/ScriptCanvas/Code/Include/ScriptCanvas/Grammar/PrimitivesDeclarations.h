@@ -76,6 +76,9 @@ namespace ScriptCanvas
         constexpr const char* k_DebugVariableChangeName = "DEBUG_VARIABLE_CHANGE";
         constexpr const char* k_DebugVariableChangeSubgraphName = "DEBUG_VARIABLE_CHANGE_SUBGRAPH";
 
+        constexpr const char* k_SampleNodeInName = "SAMPLE_NODE_IN";
+        constexpr const char* k_SampleNodeOutName = "SAMPLE_NODE_OUT";
+
         constexpr const char* k_DependencySuffix = "_dp";
 
         constexpr const char* k_GetRandomSwitchControlNumberName = "GetRandomSwitchControlNumber";
@@ -82,6 +82,9 @@ namespace ScriptCanvas
         constexpr const char* NotEnoughArgsForArithmeticOperator = "Less than two valid arguments for arithmetic operator";
         constexpr const char* NotEnoughBranchesForReturn = "Not enough branches for defined out return values.";
         constexpr const char* NotEnoughInputForArithmeticOperator = "Not enough input for arithmetic operator";
+        constexpr const char* NativeTranslationUnsupportedGraph = "Native C++ translation only supports pure graphs that execute on graph start, without functions, events, nodeables, entity ids or dependencies.";
+        constexpr const char* NativeTranslationUnsupportedNode = "Native C++ translation does not support this node.";
+        constexpr const char* NativeTranslationUnsupportedType = "Native C++ translation only supports Number, Boolean and String values.";
         constexpr const char* NullEntityInGraph = "Null entity pointer in graph";
         constexpr const char* NullInputKnown = "The input is known to be null, and the node does not accept it";
         constexpr const char* ParseExecutionMultipleOutSyntaxSugarChildExecutionRemovedAndNotReplaced = "ParseExecutionMultipleOutSyntaxSugar: child execution node was removed, and not replaced.";
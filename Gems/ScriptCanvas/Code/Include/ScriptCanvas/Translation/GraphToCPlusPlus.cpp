@@ -0,0 +1,924 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
+#include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
+#include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+#include <ScriptCanvas/Results/ErrorText.h>
+
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
+
+#include <cmath>
+
+namespace GraphToCPlusPlusCpp
+{
+    using namespace ScriptCanvas;
+
+    // the C++ keywords, and the names of the parameters of the generated OnGraphStart function
+    constexpr AZStd::string_view k_reservedWords[] =
+    {
+        "alignas", "alignof", "and", "and_eq", "argumentCount", "arguments", "asm", "auto", "bitand", "bitor", "bool", "break", "case",
+        "catch", "char", "char16_t", "char32_t", "char8_t", "class", "co_await", "co_return", "co_yield", "compl", "concept", "const",
+        "const_cast", "consteval", "constexpr", "constinit", "continue", "decltype", "default", "delete", "do", "double", "dynamic_cast",
+        "else", "enum", "executionState", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int",
+        "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or", "or_eq", "private", "protected",
+        "public", "register", "reinterpret_cast", "requires", "return", "short", "signed", "sizeof", "static", "static_assert",
+        "static_cast", "struct", "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename",
+        "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq",
+    };
+
+    bool IsReservedWord(AZStd::string_view name)
+    {
+        return AZStd::find(k_reservedWords, k_reservedWords + AZ_ARRAY_SIZE(k_reservedWords), name) != k_reservedWords + AZ_ARRAY_SIZE(k_reservedWords);
+    }
+
+    // only global methods, and methods of classes directly reflected to the BehaviorContext, can be looked up by the translated code
+    bool ResolveClassName(Grammar::ExecutionTreeConstPtr execution, AZStd::string& className)
+    {
+        const Grammar::LexicalScope lexicalScope = execution->GetNameLexicalScope();
+
+        if (lexicalScope.m_type == Grammar::LexicalScopeType::Class && lexicalScope.m_namespaces.size() == 1)
+        {
+            className = lexicalScope.m_namespaces.front();
+            return true;
+        }
+        else if (lexicalScope.m_type == Grammar::LexicalScopeType::Namespace && lexicalScope.m_namespaces.empty())
+        {
+            className.clear();
+            return true;
+        }
+
+        return false;
+    }
+
+    AZStd::string ToStringLiteral(AZStd::string_view text)
+    {
+        AZStd::string literal = "\"";
+
+        for (const char character : text)
+        {
+            switch (character)
+            {
+            case '"':
+                literal += "\\\"";
+                break;
+            case '\\':
+                literal += "\\\\";
+                break;
+            case '\n':
+                literal += "\\n";
+                break;
+            case '\r':
+                literal += "\\r";
+                break;
+            case '\t':
+                literal += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20 || character == 0x7F)
+                {
+                    // octal escapes have a maximum length, unlike hexadecimal ones, so they can't consume the following characters
+                    literal += AZStd::string::format("\\%03o", static_cast<unsigned char>(character));
+                }
+                else
+                {
+                    literal += character;
+                }
+                break;
+            }
+        }
+
+        literal += "\"";
+        return literal;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        Configuration CreateCPlusPlusConfig([[maybe_unused]] const Grammar::AbstractCodeModel& source)
+        {
+            Configuration configuration;
+            configuration.m_blockCommentClose = "*/";
+            configuration.m_blockCommentOpen = "/*";
+            configuration.m_dependencyDelimiter = "/";
+            configuration.m_executionStateName = "executionState";
+            configuration.m_executionStateReferenceGraph = "executionState";
+            configuration.m_executionStateReferenceLocal = configuration.m_executionStateName;
+            configuration.m_executionStateScriptCanvasIdName = "m_scriptCanvasId";
+            configuration.m_functionBlockClose = "}";
+            configuration.m_functionBlockOpen = "{";
+            configuration.m_lexicalScopeDelimiter = "::";
+            configuration.m_lexicalScopeVariable = ".";
+            configuration.m_namespaceClose = "}";
+            configuration.m_namespaceOpen = "{";
+            configuration.m_namespaceOpenPrefix = "namespace";
+            configuration.m_scopeClose = "}";
+            configuration.m_scopeOpen = "{";
+            configuration.m_singleLineComment = "//";
+            configuration.m_suffix = "";
+            return configuration;
+        }
+
+        GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& source)
+            : GraphToX(CreateCPlusPlusConfig(source), source)
+        {
+            AZ::ComponentApplicationBus::BroadcastResult(m_behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+            MarkTranslationStart();
+
+            m_namespaceName = AZStd::string::format("%.*s::%s"
+                , aznumeric_cast<int>(GetAutoNativeNamespace().size()), GetAutoNativeNamespace().data()
+                , Grammar::ToSafeName(m_model.GetSource().m_name).c_str());
+
+            if (IsSupportedModel())
+            {
+                TranslateOnGraphStart();
+
+                if (IsSuccessfull())
+                {
+                    WriteHeaderFile();
+                    TranslateSourceFile();
+                }
+            }
+
+            MarkTranslationStop();
+        }
+
+        const AZ::BehaviorMethod* GraphToCPlusPlus::FindMethod(Grammar::ExecutionTreeConstPtr execution)
+        {
+            AZStd::string className;
+
+            if (!m_behaviorContext
+            || execution->GetEventType() != EventType::Count
+            || Grammar::IsUserFunctionCall(execution)
+            || Grammar::IsFunctionCallNullCheckRequired(execution)
+            || Grammar::IsEventConnectCall(execution)
+            || Grammar::IsEventDisconnectCall(execution)
+            || Grammar::IsExecutedPropertyExtraction(execution)
+            || Grammar::IsGlobalPropertyRead(execution)
+            || Grammar::IsClassPropertyRead(execution)
+            || Grammar::IsClassPropertyWrite(execution)
+            || !GraphToCPlusPlusCpp::ResolveClassName(execution, className))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return nullptr;
+            }
+
+            const AZStd::unordered_map<AZStd::string, AZ::BehaviorMethod*>* methods = &m_behaviorContext->m_methods;
+
+            if (!className.empty())
+            {
+                auto classIter = m_behaviorContext->m_classes.find(className);
+                methods = classIter != m_behaviorContext->m_classes.end() ? &classIter->second->m_methods : nullptr;
+            }
+
+            const AZ::BehaviorMethod* method = nullptr;
+
+            if (methods)
+            {
+                auto methodIter = methods->find(execution->GetName());
+                method = methodIter != methods->end() ? methodIter->second : nullptr;
+            }
+
+            if (!method || method->IsMember() || method->HasBusId() || method->GetNumArguments() != execution->GetInputCount())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return nullptr;
+            }
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                const AZ::BehaviorParameter* argument = method->GetArgument(index);
+                const Data::Type& inputType = execution->GetInput(index).m_value->m_datum.GetType();
+
+                // arguments are passed by value, or by const reference, exactly as the interpreted version of the graph passes them
+                const bool isPassedByValue = (argument->m_traits & AZ::BehaviorParameter::TR_POINTER) == 0
+                    && ((argument->m_traits & AZ::BehaviorParameter::TR_REFERENCE) == 0 || (argument->m_traits & AZ::BehaviorParameter::TR_CONST) != 0);
+
+                if (!isPassedByValue || !IsSupportedType(execution, inputType) || argument->m_typeId != inputType.GetAZType())
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                    return nullptr;
+                }
+            }
+
+            return method;
+        }
+
+        const AZStd::string& GraphToCPlusPlus::FindMethodBinding(Grammar::ExecutionTreeConstPtr execution)
+        {
+            AZStd::string className;
+            GraphToCPlusPlusCpp::ResolveClassName(execution, className);
+            const AZStd::string key = AZStd::string::format("%s::%s", className.c_str(), execution->GetName().data());
+
+            auto iter = m_methodBindingNames.find(key);
+            if (iter == m_methodBindingNames.end())
+            {
+                AZStd::string bindingName = AZStd::string::format("s_method%zu", m_methodBindingNames.size());
+                m_methodBindings.WriteLineIndented("static const AZ::BehaviorMethod* const %s = ScriptCanvas::Execution::FindNativeMethod(%s, %s);"
+                    , bindingName.c_str()
+                    , GraphToCPlusPlusCpp::ToStringLiteral(className).c_str()
+                    , GraphToCPlusPlusCpp::ToStringLiteral(execution->GetName()).c_str());
+                iter = m_methodBindingNames.emplace(key, AZStd::move(bindingName)).first;
+            }
+
+            return iter->second;
+        }
+
+        GraphToCPlusPlus::IsNamed GraphToCPlusPlus::IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution)
+        {
+            return input->m_source != execution || input->m_requiresCreationFunction ? IsNamed::Yes : IsNamed::No;
+        }
+
+        bool GraphToCPlusPlus::IsSupportedModel()
+        {
+            const auto& runtimeInputs = m_model.GetRuntimeInputs();
+            auto start = m_model.GetStart();
+
+            const bool isSupported = start
+                && m_model.GetExecutionCharacteristics() == Grammar::ExecutionCharacteristics::Pure
+                && m_model.GetInterface().HasOnGraphStart()
+                && !m_model.GetInterface().RequiresConstructionParametersForDependencies()
+                && !m_model.IsClass()
+                && m_model.GetFunctions().empty()
+                && m_model.GetEBusHandlings().empty()
+                && m_model.GetEventHandlings().empty()
+                && m_model.GetNodeableParse().empty()
+                && m_model.GetStaticVariablesNames().empty()
+                && runtimeInputs.m_nodeables.empty()
+                && runtimeInputs.m_entityIds.empty()
+                && runtimeInputs.m_staticVariables.empty()
+                && !runtimeInputs.m_refersToSelfEntityId
+                && !start->RefersToSelfEntityId()
+                && !start->HasReturnValues();
+
+            if (!isSupported)
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), ParseErrors::NativeTranslationUnsupportedGraph));
+            }
+
+            return isSupported;
+        }
+
+        bool GraphToCPlusPlus::IsSupportedType(Grammar::ExecutionTreeConstPtr execution, const Data::Type& type)
+        {
+            if (type == Data::Type::Number() || type == Data::Type::Boolean() || type == Data::Type::String())
+            {
+                return true;
+            }
+
+            AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId(), ParseErrors::NativeTranslationUnsupportedType));
+            return false;
+        }
+
+        AZStd::pair<TargetResult, TargetResult> GraphToCPlusPlus::MoveResult()
+        {
+            TargetResult hpp;
+            hpp.m_text = m_dotH.MoveOutput();
+            hpp.m_subgraphInterface = m_model.GetInterface();
+            hpp.m_duration = 0;
+
+            TargetResult cpp;
+            cpp.m_text = m_dotCpp.MoveOutput();
+            cpp.m_subgraphInterface = m_model.GetInterface();
+            cpp.m_duration = GetTranslationDuration();
+
+            return { AZStd::move(hpp), AZStd::move(cpp) };
+        }
+
+        AZStd::string GraphToCPlusPlus::ToTypeString(const Data::Type& type) const
+        {
+            if (type == Data::Type::Number())
+            {
+                return "double";
+            }
+            else if (type == Data::Type::Boolean())
+            {
+                return "bool";
+            }
+            else
+            {
+                return "AZStd::string";
+            }
+        }
+
+        AZStd::string GraphToCPlusPlus::ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum)
+        {
+            const Data::Type& type = datum.GetType();
+
+            if (!IsSupportedType(execution, type))
+            {
+                return "";
+            }
+
+            if (type == Data::Type::Number())
+            {
+                const Data::NumberType value = *datum.GetAs<Data::NumberType>();
+
+                if (!(std::isfinite)(value))
+                {
+                    AddError(execution, aznew Internal::ParseError(execution ? execution->GetNodeId() : AZ::EntityId(), ParseErrors::NativeTranslationUnsupportedType));
+                    return "";
+                }
+
+                // enough digits to round trip, and always a floating point literal, so integral values don't change the type of expressions
+                AZStd::string valueString = AZStd::string::format("%.17g", value);
+                if (valueString.find_first_of(".e") == AZStd::string::npos)
+                {
+                    valueString += ".0";
+                }
+
+                return valueString;
+            }
+            else if (type == Data::Type::Boolean())
+            {
+                return *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+            }
+            else
+            {
+                return AZStd::string::format("AZStd::string(%s)", GraphToCPlusPlusCpp::ToStringLiteral(*datum.GetAs<Data::StringType>()).c_str());
+            }
+        }
+
+        AZStd::string GraphToCPlusPlus::ToVariableName(Grammar::VariableConstPtr variable) const
+        {
+            AZStd::string name = variable->m_name;
+
+            if (GraphToCPlusPlusCpp::IsReservedWord(name))
+            {
+                name += Grammar::k_reservedWordProtection;
+            }
+
+            return name;
+        }
+
+        AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model)
+        {
+            GraphToCPlusPlus translation(model);
+
+            if (translation.IsSuccessfull())
+            {
+                return AZ::Success(translation.MoveResult());
+            }
+            else
+            {
+                return AZ::Failure(translation.MoveErrors());
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution, size_t firstChildIndex)
+        {
+            for (size_t childIndex = firstChildIndex; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
+        {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::Break:
+                m_functionBody.WriteLineIndented("break;");
+                break;
+
+            case Grammar::Symbol::IfCondition:
+                TranslateExecutionTreeIfCondition(execution);
+                return;
+
+            case Grammar::Symbol::While:
+                TranslateExecutionTreeWhile(execution);
+                return;
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                const AZStd::string value = ToValueString(execution, variable->m_datum);
+                m_functionBody.WriteLineIndented("[[maybe_unused]] %s %s = %s;"
+                    , ToTypeString(variable->m_datum.GetType()).c_str(), ToVariableName(variable).c_str(), value.c_str());
+                break;
+            }
+
+            case Grammar::Symbol::Cycle:
+            case Grammar::Symbol::ForEach:
+            case Grammar::Symbol::IsNull:
+            case Grammar::Symbol::RandomSwitch:
+            case Grammar::Symbol::Switch:
+            case Grammar::Symbol::UserOut:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return;
+
+            default:
+                break;
+            }
+
+            TranslateExecutionTreeChildren(execution, 0);
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (!execution->GetConversions().empty() || (execution->GetId().m_node && execution->GetId().m_node->ConvertsInputToStrings()))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return;
+            }
+
+            if (Grammar::IsLogicalExpression(execution)
+            || Grammar::IsOperatorArithmetic(execution)
+            || Grammar::IsVariableGet(execution)
+            || Grammar::IsVariableSet(execution)
+            || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+            {
+                // expressions without output have no effect, and writing them would only produce unused value warnings
+                if (execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty())
+                {
+                    m_functionBody.WriteIndent();
+                    WriteVariableWrite(execution, execution->GetChild(0).m_output);
+
+                    if (Grammar::IsLogicalExpression(execution))
+                    {
+                        WriteLogicalExpression(execution);
+                    }
+                    else if (Grammar::IsOperatorArithmetic(execution))
+                    {
+                        WriteOperatorArithmetic(execution);
+                    }
+                    else
+                    {
+                        WriteFunctionCallInput(execution, 0);
+                    }
+
+                    m_functionBody.WriteLine(";");
+                }
+            }
+            else if (execution->GetSymbol() == Grammar::Symbol::FunctionCall && !Grammar::IsWrittenMathExpression(execution))
+            {
+                WriteFunctionCallOfNode(execution);
+            }
+            else
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return;
+            }
+
+            WriteOutputAssignments(execution);
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution)
+        {
+            // unlike the Lua translation, both branches are always scoped explicitly, since either may be empty
+            m_functionBody.WriteIndented("if (");
+            WriteFunctionCallInput(execution);
+            m_functionBody.WriteLine(")");
+
+            for (size_t childIndex = 0; childIndex < AZStd::min(execution->GetChildrenCount(), size_t(2)); ++childIndex)
+            {
+                if (childIndex == 1)
+                {
+                    m_functionBody.WriteLineIndented("else");
+                }
+
+                m_functionBody.WriteLineIndented("{");
+                {
+                    ScopedIndent indent(m_functionBody);
+                    const auto& child = execution->GetChild(childIndex);
+
+                    if (child.m_execution && !child.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+                }
+                m_functionBody.WriteLineIndented("}");
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateExecutionTreeWhile(Grammar::ExecutionTreeConstPtr execution)
+        {
+            m_functionBody.WriteIndented("while (");
+            WriteFunctionCallInput(execution);
+            m_functionBody.WriteLine(")");
+            m_functionBody.WriteLineIndented("{");
+            {
+                ScopedIndent indent(m_functionBody);
+                const auto& loop = execution->GetChild(0);
+
+                if (loop.m_execution && !loop.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(loop.m_execution);
+                }
+            }
+            m_functionBody.WriteLineIndented("}");
+
+            // the finished out
+            TranslateExecutionTreeChildren(execution, 1);
+        }
+
+        void GraphToCPlusPlus::TranslateOnGraphStart()
+        {
+            auto start = m_model.GetStart();
+            // namespace and function body
+            m_methodBindings.SetIndent(2);
+            m_functionBody.SetIndent(2);
+
+            // the arguments are the activation inputs, in the order that the interpreted OnGraphStart receives them
+            const auto& runtimeInputs = m_model.GetRuntimeInputs();
+            AZStd::vector<Grammar::VariableConstPtr> constructionArguments
+                = m_model.CombineVariableLists(runtimeInputs.m_nodeables, runtimeInputs.m_variables, runtimeInputs.m_entityIds);
+
+            m_functionBody.WriteLineIndented("SC_RUNTIME_CHECK_RETURN(argumentCount == %zu, \"%s expected %zu activation arguments\");"
+                , constructionArguments.size(), GetGraphName().data(), constructionArguments.size());
+
+            for (size_t index = 0; index < constructionArguments.size(); ++index)
+            {
+                auto variable = constructionArguments[index];
+
+                if (IsSupportedType(start, variable->m_datum.GetType()))
+                {
+                    const AZStd::string typeString = ToTypeString(variable->m_datum.GetType());
+                    m_functionBody.WriteLineIndented("[[maybe_unused]] %s %s = *arguments[%zu].GetAsUnsafe<%s>();"
+                        , typeString.c_str(), ToVariableName(variable).c_str(), index, typeString.c_str());
+                }
+            }
+
+            WriteOutputAssignments(start);
+            WriteLocalVariableInitializion(start);
+
+            if (start->GetChildrenCount() > 0 && start->GetChild(0).m_execution)
+            {
+                TranslateExecutionTreeEntry(start->GetChild(0).m_execution);
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateSourceFile()
+        {
+            WriteCopyright(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+            WriteDoNotModify(m_dotCpp);
+            m_dotCpp.WriteNewLine();
+            m_dotCpp.WriteLine("#include <AzCore/Math/MathUtils.h>");
+            m_dotCpp.WriteLine("#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>");
+            m_dotCpp.WriteLine("#include <ScriptCanvas/Execution/Native/NativeGraphRegistry.h>");
+            m_dotCpp.WriteNewLine();
+            m_dotCpp.WriteLine("#include \"%s.h\"", Grammar::ToSafeName(m_model.GetSource().m_name).c_str());
+            m_dotCpp.WriteNewLine();
+            OpenNamespace(m_dotCpp, m_namespaceName);
+            {
+                WriteOnGraphStartSignature(m_dotCpp);
+                m_dotCpp.WriteNewLine();
+                m_dotCpp.WriteLineIndented("{");
+                m_dotCpp.Write(m_methodBindings.GetOutput());
+                m_dotCpp.Write(m_functionBody.GetOutput());
+                m_dotCpp.WriteLineIndented("}");
+                m_dotCpp.WriteNewLine();
+                m_dotCpp.WriteLineIndented("SCRIPT_CANVAS_NATIVE_GRAPH(\"%s\", OnGraphStart)"
+                    , m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>().c_str());
+            }
+            CloseNamespace(m_dotCpp, m_namespaceName);
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution)
+        {
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                if (index > 0)
+                {
+                    m_functionBody.Write(", ");
+                }
+
+                WriteFunctionCallInput(execution, index);
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            auto& input = execution->GetInput(index).m_value;
+
+            if (IsInputNamed(input, execution) == IsNamed::Yes)
+            {
+                if (input->m_isMember || !IsSupportedType(execution, input->m_datum.GetType()))
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                    return;
+                }
+
+                m_functionBody.Write(ToVariableName(input));
+            }
+            else
+            {
+                m_functionBody.Write(ToValueString(execution, input->m_datum));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const AZ::BehaviorMethod* method = FindMethod(execution);
+            if (!method)
+            {
+                return;
+            }
+
+            const AZStd::string& bindingName = FindMethodBinding(execution);
+            const auto* output = execution->GetChildrenCount() == 1 ? &execution->GetChild(0).m_output : nullptr;
+
+            if (output && output->size() > 1)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return;
+            }
+
+            if (output && output->size() == 1)
+            {
+                auto result = output->front().second->m_source;
+                const AZ::BehaviorParameter* methodResult = method->HasResult() ? method->GetResult() : nullptr;
+
+                if (result->m_isMember
+                || !IsSupportedType(execution, result->m_datum.GetType())
+                || !methodResult
+                || methodResult->m_typeId != result->m_datum.GetType().GetAZType()
+                || (methodResult->m_traits & (AZ::BehaviorParameter::TR_POINTER | AZ::BehaviorParameter::TR_REFERENCE)) != 0)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                    return;
+                }
+
+                if (result->m_source == execution)
+                {
+                    m_functionBody.WriteLineIndented("[[maybe_unused]] %s %s{};", ToTypeString(result->m_datum.GetType()).c_str(), ToVariableName(result).c_str());
+                }
+
+                m_functionBody.WriteIndented("ScriptCanvas::Execution::NativeCallResult(%s, %s", bindingName.c_str(), ToVariableName(result).c_str());
+            }
+            else
+            {
+                m_functionBody.WriteIndented("ScriptCanvas::Execution::NativeCall(%s", bindingName.c_str());
+            }
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                m_functionBody.Write(", ");
+                WriteFunctionCallInput(execution, index);
+            }
+
+            m_functionBody.WriteLine(");");
+        }
+
+        void GraphToCPlusPlus::WriteHeaderFile()
+        {
+            WriteCopyright(m_dotH);
+            m_dotH.WriteNewLine();
+            WriteDoNotModify(m_dotH);
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#pragma once");
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#include <AzCore/RTTI/BehaviorContext.h>");
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/ExecutionState.h>");
+            m_dotH.WriteNewLine();
+            OpenNamespace(m_dotH, m_namespaceName);
+            {
+                WriteOnGraphStartSignature(m_dotH);
+                m_dotH.WriteLine(";");
+            }
+            CloseNamespace(m_dotH, m_namespaceName);
+        }
+
+        void GraphToCPlusPlus::WriteLocalVariableInitializion(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto& localDeclaredVariables = m_model.GetLocalVariables(execution))
+            {
+                // sorted, so that the generated source doesn't change unless the graph does
+                AZStd::vector<Grammar::VariableConstPtr> variables(localDeclaredVariables->begin(), localDeclaredVariables->end());
+                AZStd::sort(variables.begin(), variables.end(), [](const auto& lhs, const auto& rhs) { return lhs->m_name < rhs->m_name; });
+
+                for (const auto& variable : variables)
+                {
+                    const auto requirement = Grammar::ParseConstructionRequirement(variable);
+
+                    if (requirement == Grammar::VariableConstructionRequirement::None)
+                    {
+                        const AZStd::string value = ToValueString(execution, variable->m_datum);
+                        m_functionBody.WriteLineIndented("[[maybe_unused]] %s %s = %s;"
+                            , ToTypeString(variable->m_datum.GetType()).c_str(), ToVariableName(variable).c_str(), value.c_str());
+                    }
+                    else if (requirement != Grammar::VariableConstructionRequirement::InputVariable)
+                    {
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedGraph));
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetSymbol() == Grammar::Symbol::LogicalNOT)
+            {
+                m_functionBody.Write("!");
+                WriteFunctionCallInput(execution, 0);
+                return;
+            }
+
+            if (execution->GetInputCount() != 2
+            || execution->GetInput(0).m_value->m_datum.GetType() != execution->GetInput(1).m_value->m_datum.GetType())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return;
+            }
+
+            if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // matches the tolerance of the Lua translation
+                m_functionBody.Write("AZ::GetAbs(");
+                WriteFunctionCallInput(execution, 0);
+                m_functionBody.Write(" - ");
+                WriteFunctionCallInput(execution, 1);
+                m_functionBody.Write(execution->GetSymbol() == Grammar::Symbol::CompareEqual ? ") <= %s" : ") > %s", Grammar::k_LuaEpsilonString);
+                return;
+            }
+
+            WriteFunctionCallInput(execution, 0);
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::CompareEqual:
+                m_functionBody.Write(" == ");
+                break;
+            case Grammar::Symbol::CompareGreater:
+                m_functionBody.Write(" > ");
+                break;
+            case Grammar::Symbol::CompareGreaterEqual:
+                m_functionBody.Write(" >= ");
+                break;
+            case Grammar::Symbol::CompareLess:
+                m_functionBody.Write(" < ");
+                break;
+            case Grammar::Symbol::CompareLessEqual:
+                m_functionBody.Write(" <= ");
+                break;
+            case Grammar::Symbol::CompareNotEqual:
+                m_functionBody.Write(" != ");
+                break;
+            case Grammar::Symbol::LogicalAND:
+                m_functionBody.Write(" && ");
+                break;
+            case Grammar::Symbol::LogicalOR:
+                m_functionBody.Write(" || ");
+                break;
+            default:
+                break;
+            }
+
+            WriteFunctionCallInput(execution, 1);
+        }
+
+        void GraphToCPlusPlus::WriteOnGraphStartSignature(Writer& writer)
+        {
+            writer.WriteIndented("void %s([[maybe_unused]] ScriptCanvas::ExecutionState& %s, [[maybe_unused]] AZ::BehaviorArgument* arguments, [[maybe_unused]] size_t argumentCount)"
+                , Grammar::k_OnGraphStartFunctionName, m_configuration.m_executionStateName.data());
+        }
+
+        void GraphToCPlusPlus::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            const Data::Type& type = execution->GetInput(0).m_value->m_datum.GetType();
+            const bool isConcatenation = type == Data::Type::String() && execution->GetSymbol() == Grammar::Symbol::OperatorAddition;
+
+            for (size_t i(0); i < count; ++i)
+            {
+                // Lua coerces mixed operands, C++ would not compile them
+                if (execution->GetInput(i).m_value->m_datum.GetType() != type || (type != Data::Type::Number() && !isConcatenation))
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                    return;
+                }
+            }
+
+            AZStd::string_view operatorString;
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::OperatorAddition:
+                operatorString = " + ";
+                break;
+            case Grammar::Symbol::OperatorDivision:
+                operatorString = " / ";
+                break;
+            case Grammar::Symbol::OperatorMultiplication:
+                operatorString = " * ";
+                break;
+            case Grammar::Symbol::OperatorSubraction:
+                operatorString = " - ";
+                break;
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::UntranslatedArithmetic));
+                return;
+            }
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_functionBody.Write("(");
+            }
+
+            WriteFunctionCallInput(execution, 0);
+            m_functionBody.Write(operatorString);
+            WriteFunctionCallInput(execution, 1);
+            m_functionBody.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_functionBody.Write(operatorString);
+                WriteFunctionCallInput(execution, i);
+                m_functionBody.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto output = execution->GetLocalOutput())
+            {
+                for (auto outputIter : *output)
+                {
+                    if (!outputIter.second->m_sourceConversions.empty())
+                    {
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                        return;
+                    }
+
+                    for (auto& assignment : outputIter.second->m_assignments)
+                    {
+                        if (assignment->m_isMember || assignment->m_datum.GetType() != outputIter.second->m_source->m_datum.GetType())
+                        {
+                            AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                            return;
+                        }
+
+                        m_functionBody.WriteLineIndented("%s = %s;", ToVariableName(assignment).c_str(), ToVariableName(outputIter.second->m_source).c_str());
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::pair<const Slot*, Grammar::OutputAssignmentConstPtr>>& output)
+        {
+            auto target = output[0].second->m_source;
+
+            if (output.size() > 1 || target->m_isMember || !IsSupportedType(execution, target->m_datum.GetType()))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeTranslationUnsupportedNode));
+                return;
+            }
+
+            if (target->m_source == execution)
+            {
+                m_functionBody.Write("[[maybe_unused]] %s %s = ", ToTypeString(target->m_datum.GetType()).c_str(), ToVariableName(target).c_str());
+            }
+            else
+            {
+                m_functionBody.Write("%s = ", ToVariableName(target).c_str());
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <ScriptCanvas/Core/Datum.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+#include "GraphToX.h"
+#include "TranslationResult.h"
+#include "TranslationUtilities.h"
+
+namespace AZ
+{
+    class BehaviorContext;
+}
+
+namespace ScriptCanvas
+{
+    namespace Translation
+    {
+        /// Translates the abstract code model of a graph to C++ that is compiled into a module and executed by
+        /// ExecutionStateNativePureOnGraphStart. The .h and .cpp results are returned as the Hpp and Cpp translation targets.
+        /// Flow control, operators and variables become plain C++, while calls to reflected functions still go through
+        /// BehaviorMethod::Invoke.
+        ///
+        /// Only a subset of graphs is supported: pure graphs that only execute on graph start, whose variables are numbers, booleans or
+        /// strings, and whose nodes are flow control, operators, comparisons, variable access and calls to reflected global or class
+        /// functions taking and returning those types. Any other graph fails translation with an error, and it continues to execute in
+        /// the interpreted runtime.
+        class GraphToCPlusPlus
+            : public GraphToX
+        {
+        public:
+            static AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> Translate(const Grammar::AbstractCodeModel& source);
+
+        protected:
+            enum class IsNamed { No, Yes };
+
+            static IsNamed IsInputNamed(Grammar::VariableConstPtr input, Grammar::ExecutionTreeConstPtr execution);
+
+            AZ::BehaviorContext* m_behaviorContext = nullptr;
+            AZStd::string m_namespaceName;
+            // BehaviorContext methods are bound once per graph, in function local statics, since they can't be found at module load
+            AZStd::unordered_map<AZStd::string, AZStd::string> m_methodBindingNames;
+            Writer m_methodBindings;
+            Writer m_functionBody;
+            Writer m_dotH;
+            Writer m_dotCpp;
+
+            GraphToCPlusPlus(const Grammar::AbstractCodeModel& source);
+
+            const AZ::BehaviorMethod* FindMethod(Grammar::ExecutionTreeConstPtr execution);
+            const AZStd::string& FindMethodBinding(Grammar::ExecutionTreeConstPtr execution);
+            bool IsSupportedModel();
+            bool IsSupportedType(Grammar::ExecutionTreeConstPtr execution, const Data::Type& type);
+            AZStd::pair<TargetResult, TargetResult> MoveResult();
+            AZStd::string ToTypeString(const Data::Type& type) const;
+            AZStd::string ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum);
+            AZStd::string ToVariableName(Grammar::VariableConstPtr variable) const;
+            void TranslateExecutionTreeChildren(Grammar::ExecutionTreeConstPtr execution, size_t firstChildIndex);
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeWhile(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateOnGraphStart();
+            void TranslateSourceFile();
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution);
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution);
+            void WriteHeaderFile();
+            void WriteLocalVariableInitializion(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOnGraphStartSignature(Writer& writer);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, const AZStd::vector<AZStd::pair<const Slot*, Grammar::OutputAssignmentConstPtr>>& output);
+        };
+    }
+}
@@ -676,6 +676,7 @@ namespace ScriptCanvas
         {
             TranslateExecutionOuts(execution->GetNodeable(), execution);
             WriteDebugInfoIn(execution, "TranslateExecutionTreeFunctionCall begin");
+            WriteSampleNodeIn(execution);
             m_dotLua.WriteIndent();
             WriteLocalOutputInitialization(execution);
 
@@ -764,6 +765,7 @@ namespace ScriptCanvas
             }
 
             WriteOutputAssignments(execution);
+            WriteSampleNodeOut(execution);
             WriteDebugInfoOut(execution, 0, "TranslateExecutionTreeFunctionCall end");
         }
 
@@ -2415,6 +2417,29 @@ namespace ScriptCanvas
             m_dotLua.WriteLineIndented("--[[ end switch for Grammar::%s --]]", Grammar::GetSymbolName(symbol));
         }
 
+        void GraphToLua::WriteSampleNodeIn(Grammar::ExecutionTreeConstPtr execution)
+        {
+            // nodes in function graphs are attributed to the node that called the function
+            if (m_buildConfiguration == BuildConfiguration::Performance && !m_model.IsPureLibrary())
+            {
+                if (auto* debugIndex = m_model.GetDebugInfoInIndex(execution))
+                {
+                    m_dotLua.WriteLineIndented("%s(executionState, %d)", Grammar::k_SampleNodeInName, *debugIndex);
+                }
+            }
+        }
+
+        void GraphToLua::WriteSampleNodeOut(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (m_buildConfiguration == BuildConfiguration::Performance && !m_model.IsPureLibrary())
+            {
+                if (auto* debugIndex = m_model.GetDebugInfoInIndex(execution))
+                {
+                    m_dotLua.WriteLineIndented("%s(executionState, %d)", Grammar::k_SampleNodeOutName, *debugIndex);
+                }
+            }
+        }
+
         void GraphToLua::WriteStaticInitializerInput(IsLeadingCommaRequired commaRequired)
         {
             AZ_Assert(!m_runtimeInputs.m_staticVariables.empty(), "don't write static initialization without needing to");
@@ -171,6 +171,8 @@ namespace ScriptCanvas
             void WriteResolvedScope(Grammar::ExecutionTreeConstPtr execution, const Grammar::LexicalScope& lexicalScope);
             void WriteReturnStatement(Grammar::ExecutionTreeConstPtr execution);
             void WriteReturnValueInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteSampleNodeIn(Grammar::ExecutionTreeConstPtr execution);
+            void WriteSampleNodeOut(Grammar::ExecutionTreeConstPtr execution);
             void WriteStaticInitializerInput(IsLeadingCommaRequired commaRequired);
             void WriteSwitchEnd(Grammar::Symbol symbol);
             void WriteVariableRead(Grammar::VariableConstPtr variable);
@@ -18,6 +18,7 @@
 
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
 #include <ScriptCanvas/Translation/GraphToLua.h>
 #include <ScriptCanvas/Core/Graph.h>
 
@@ -26,6 +27,30 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
+    AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    {
+        auto outcome = GraphToCPlusPlus::Translate(model);
+        if (outcome.IsSuccess())
+        {
+            if (rawSave)
+            {
+                auto saveOutcome = SaveDotH(model.GetSource(), outcome.GetValue().first.m_text);
+                if (saveOutcome.IsSuccess())
+                {
+                    saveOutcome = SaveDotCPP(model.GetSource(), outcome.GetValue().second.m_text);
+                }
+
+                AZ_Error("ScriptCanvas", saveOutcome.IsSuccess(), "Failed to save the C++ translation: %s", saveOutcome.GetError().c_str());
+            }
+
+            return AZ::Success(outcome.TakeValue());
+        }
+        else
+        {
+            return AZ::Failure(outcome.TakeError());
+        }
+    }
+
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
         auto outcome = GraphToLua::Translate(model);
@@ -98,32 +123,20 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
-
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.rawSaveDebugOutput);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto hppAndCpp = outcomeCPP.TakeValue();
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
+                    }
+                    else
+                    {
+                        errors.emplace(TargetFlags::Cpp, outcomeCPP.TakeError());
+                    }
+                }
             }
 
             return Result(model, AZStd::move(translations), AZStd::move(errors));
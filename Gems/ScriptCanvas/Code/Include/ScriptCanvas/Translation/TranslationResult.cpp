@@ -79,7 +79,7 @@ namespace ScriptCanvas
             return m_model->IsErrorFree();
         }
 
-        AZ::Outcome<void, AZStd::string> Result::IsSuccess(TargetFlags /*flag*/) const
+        AZ::Outcome<void, AZStd::string> Result::IsSuccess(TargetFlags flag) const
         {
             if (!IsSourceValid())
             {
@@ -89,9 +89,10 @@ namespace ScriptCanvas
             {
                 return AZ::Failure(AZStd::string::format("Graph conversion to abstract code model failed: %s", ErrorsToString().c_str()));
             }
-            else if (!TranslationSucceed(ScriptCanvas::Translation::Lua))
+            else if (!TranslationSucceed(flag))
             {
-                return AZ::Failure(AZStd::string::format("Graph translation to Lua failed: %s", ErrorsToString().c_str()));
+                return AZ::Failure(AZStd::string::format("Graph translation to %s failed: %s"
+                    , flag == ScriptCanvas::Translation::Lua ? "Lua" : "C++", ErrorsToString().c_str()));
             }
             else
             {
@@ -21,6 +21,7 @@
 #include <ScriptCanvas/Core/Nodeable.h>
 #include <ScriptCanvas/Core/Slot.h>
 #include <ScriptCanvas/Execution/ExecutionPerformanceTimer.h>
+#include <ScriptCanvas/Execution/ExecutionSampler.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
 #include <ScriptCanvas/Serialization/DatumSerializer.h>
@@ -171,10 +172,12 @@ namespace ScriptCanvas
         }
 
         SafeRegisterPerformanceTracker();
+        Execution::ExecutionSampler::GetInstance()->Activate();
     }
 
     void SystemComponent::Deactivate()
     {
+        Execution::ExecutionSampler::GetInstance()->Deactivate();
         AZ::BehaviorContextBus::Handler::BusDisconnect();
         SystemRequestBus::Handler::BusDisconnect();
 
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ScriptCanvas/Execution/ExecutionSampler.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <Tests/Framework/ScriptCanvasUnitTestFixture.h>
+#include <Tests/Mocks/ScriptSystemRequestsMock.h>
+
+namespace ScriptCanvasUnitTest
+{
+    using ScriptCanvasExecutionSampler = ScriptCanvasUnitTestFixture;
+
+    namespace ExecutionSamplerTestCpp
+    {
+        const AZ::Data::AssetId k_assetId(AZ::Uuid("{6A1D2F3B-8C47-4E0A-B5D9-2E7F1C4A9B63}"), 0);
+    }
+
+    TEST_F(ScriptCanvasExecutionSampler, EndNode_CallAfterBeginNode_ExpectCallCounted)
+    {
+        using namespace ExecutionSamplerTestCpp;
+        ScriptCanvas::Execution::ExecutionSampler sampler;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            sampler.BeginNode(4);
+            sampler.EndNode(k_assetId, 4, nullptr);
+        }
+
+        auto report = sampler.Collect();
+        ASSERT_EQ(report.m_nodes.size(), 1);
+        const auto& sample = report.m_nodes.begin()->second;
+        EXPECT_EQ(report.m_nodes.begin()->first.m_debugIndex, 4);
+        EXPECT_EQ(sample.m_statistics.m_callCount, 3);
+        EXPECT_GE(sample.m_statistics.m_sampledCount, 1);
+        EXPECT_FALSE(sample.m_nodeName.empty());
+    }
+
+    TEST_F(ScriptCanvasExecutionSampler, EndNode_CallWithAbandonedInnerNode_ExpectOuterNodeCounted)
+    {
+        using namespace ExecutionSamplerTestCpp;
+        ScriptCanvas::Execution::ExecutionSampler sampler;
+
+        sampler.BeginNode(1);
+        sampler.BeginNode(2);
+        sampler.EndNode(k_assetId, 1, nullptr);
+
+        auto report = sampler.Collect();
+        ASSERT_EQ(report.m_nodes.size(), 1);
+        EXPECT_EQ(report.m_nodes.begin()->first.m_debugIndex, 1);
+        EXPECT_EQ(report.m_nodes.begin()->second.m_statistics.m_callCount, 1);
+    }
+
+    TEST_F(ScriptCanvasExecutionSampler, EndNode_CallWithoutBeginNode_ExpectNothingRecorded)
+    {
+        using namespace ExecutionSamplerTestCpp;
+        ScriptCanvas::Execution::ExecutionSampler sampler;
+
+        sampler.EndNode(k_assetId, 1, nullptr);
+        EXPECT_TRUE(sampler.Collect().m_nodes.empty());
+    }
+
+    TEST_F(ScriptCanvasExecutionSampler, Collect_CallTwice_ExpectSamplesCleared)
+    {
+        using namespace ExecutionSamplerTestCpp;
+        ScriptCanvas::Execution::ExecutionSampler sampler;
+
+        sampler.BeginNode(1);
+        sampler.EndNode(k_assetId, 1, nullptr);
+        EXPECT_EQ(sampler.Collect().m_nodes.size(), 1);
+        EXPECT_TRUE(sampler.Collect().m_nodes.empty());
+    }
+
+    TEST_F(ScriptCanvasExecutionSampler, RecordHandler_CallWithSameKey_ExpectStatisticsMerged)
+    {
+        using namespace ExecutionSamplerTestCpp;
+        ScriptCanvas::Execution::ExecutionSampler sampler;
+        const AZStd::string ebusName = "TickBus";
+        const ScriptCanvas::Execution::HandlerSampleKey key{ k_assetId, &ebusName, 0 };
+
+        sampler.RecordHandler(key, "OnTick", true, 10);
+        sampler.RecordHandler(key, "OnTick", false, 0);
+
+        auto report = sampler.Collect();
+        ASSERT_EQ(report.m_handlers.size(), 1);
+        const auto& sample = report.m_handlers.begin()->second;
+        EXPECT_EQ(sample.m_ebusName, ebusName);
+        EXPECT_EQ(sample.m_eventName, "OnTick");
+        EXPECT_EQ(sample.m_statistics.m_callCount, 2);
+        EXPECT_EQ(sample.m_statistics.m_sampledCount, 1);
+        EXPECT_EQ(sample.m_statistics.m_sampledTicks, 10);
+    }
+
+    // The sampler switches interpreted graphs to the performance configuration while it samples, in the default script context
+    class ScriptCanvasExecutionSamplerMode
+        : public ScriptCanvasUnitTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            ScriptCanvasUnitTestFixture::SetUp();
+            m_scriptContext = AZStd::make_unique<AZ::ScriptContext>();
+            m_scriptSystem = AZStd::make_unique<testing::NiceMock<ScriptSystemRequestsMock>>();
+            ON_CALL(*m_scriptSystem, GetContext(AZ::ScriptContextIds::DefaultScriptContextId))
+                .WillByDefault(testing::Return(m_scriptContext.get()));
+        }
+
+        void TearDown() override
+        {
+            m_scriptSystem.reset();
+            m_scriptContext.reset();
+            ScriptCanvasUnitTestFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<AZ::ScriptContext> m_scriptContext;
+        AZStd::unique_ptr<testing::NiceMock<ScriptSystemRequestsMock>> m_scriptSystem;
+    };
+
+    TEST_F(ScriptCanvasExecutionSamplerMode, OnSamplingEnabledChanged_DisableAfterEnable_ExpectPreviousModeRestored)
+    {
+        using namespace ScriptCanvas;
+        Execution::SetInterpretedExecutionMode(BuildConfiguration::Release);
+
+        Execution::ExecutionSampler sampler;
+        sampler.Activate();
+        sampler.OnSamplingEnabledChanged(true);
+        EXPECT_EQ(Execution::GetInterpretedExecutionMode(), BuildConfiguration::Performance);
+
+        sampler.OnSamplingEnabledChanged(false);
+        EXPECT_EQ(Execution::GetInterpretedExecutionMode(), BuildConfiguration::Release);
+        sampler.Deactivate();
+    }
+
+    TEST_F(ScriptCanvasExecutionSamplerMode, Deactivate_WhileSampling_ExpectPreviousModeRestored)
+    {
+        using namespace ScriptCanvas;
+        Execution::SetInterpretedExecutionMode(BuildConfiguration::Debug);
+
+        Execution::ExecutionSampler sampler;
+        sampler.Activate();
+        sampler.OnSamplingEnabledChanged(true);
+        sampler.Deactivate();
+        EXPECT_EQ(Execution::GetInterpretedExecutionMode(), BuildConfiguration::Debug);
+    }
+
+    TEST_F(ScriptCanvasExecutionSamplerMode, OnSamplingEnabledChanged_ModeChangedWhileSampling_ExpectChangedModeKept)
+    {
+        using namespace ScriptCanvas;
+        Execution::SetInterpretedExecutionMode(BuildConfiguration::Debug);
+
+        Execution::ExecutionSampler sampler;
+        sampler.Activate();
+        sampler.OnSamplingEnabledChanged(true);
+        Execution::SetInterpretedExecutionMode(BuildConfiguration::Release);
+
+        sampler.OnSamplingEnabledChanged(false);
+        EXPECT_EQ(Execution::GetInterpretedExecutionMode(), BuildConfiguration::Release);
+        sampler.Deactivate();
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <ScriptCanvas/Execution/Native/NativeGraphRegistry.h>
+#include <Tests/Framework/ScriptCanvasUnitTestFixture.h>
+
+namespace ScriptCanvasUnitTest
+{
+    using ScriptCanvasNativeGraphRegistry = ScriptCanvasUnitTestFixture;
+
+    namespace NativeGraphRegistryTestCpp
+    {
+        const AZ::Uuid k_sourceId("{0F4B7E52-5C1A-4B3A-9E5C-3C2D8A6E1F07}");
+
+        void OnGraphStartA(ScriptCanvas::ExecutionState&, AZ::BehaviorArgument*, size_t) {}
+        void OnGraphStartB(ScriptCanvas::ExecutionState&, AZ::BehaviorArgument*, size_t) {}
+    }
+
+    TEST_F(ScriptCanvasNativeGraphRegistry, GetInstance_Call_ExpectToBeConsistent)
+    {
+        auto registry1 = ScriptCanvas::Execution::NativeGraphRegistry::GetInstance();
+        auto registry2 = ScriptCanvas::Execution::NativeGraphRegistry::GetInstance();
+        EXPECT_TRUE(registry1);
+        EXPECT_EQ(registry1, registry2);
+    }
+
+    TEST_F(ScriptCanvasNativeGraphRegistry, Find_CallWithUnregisteredId_ExpectNull)
+    {
+        auto registry = ScriptCanvas::Execution::NativeGraphRegistry::GetInstance();
+        EXPECT_EQ(registry->Find(NativeGraphRegistryTestCpp::k_sourceId), nullptr);
+    }
+
+    TEST_F(ScriptCanvasNativeGraphRegistry, Find_CallWithRegisteredId_ExpectRegisteredFunction)
+    {
+        using namespace NativeGraphRegistryTestCpp;
+        auto registry = ScriptCanvas::Execution::NativeGraphRegistry::GetInstance();
+        registry->Register(k_sourceId, &OnGraphStartA);
+        EXPECT_EQ(registry->Find(k_sourceId), &OnGraphStartA);
+
+        registry->Unregister(k_sourceId, &OnGraphStartA);
+        EXPECT_EQ(registry->Find(k_sourceId), nullptr);
+    }
+
+    TEST_F(ScriptCanvasNativeGraphRegistry, Unregister_CallWithDifferentFunction_ExpectRegisteredFunctionToRemain)
+    {
+        using namespace NativeGraphRegistryTestCpp;
+        auto registry = ScriptCanvas::Execution::NativeGraphRegistry::GetInstance();
+        registry->Register(k_sourceId, &OnGraphStartA);
+        registry->Unregister(k_sourceId, &OnGraphStartB);
+        EXPECT_EQ(registry->Find(k_sourceId), &OnGraphStartA);
+
+        registry->Unregister(k_sourceId, &OnGraphStartA);
+    }
+
+    TEST_F(ScriptCanvasNativeGraphRegistry, AutoRegistrar_Lifetime_ExpectRegisteredWhileAlive)
+    {
+        using namespace NativeGraphRegistryTestCpp;
+        {
+            ScriptCanvas::Execution::NativeGraphAutoRegistrar registrar(k_sourceId, &OnGraphStartA);
+            EXPECT_EQ(ScriptCanvas::Execution::FindNativeGraph(k_sourceId), &OnGraphStartA);
+        }
+
+        EXPECT_EQ(ScriptCanvas::Execution::FindNativeGraph(k_sourceId), nullptr);
+    }
+
+    TEST_F(ScriptCanvasNativeGraphRegistry, FindNativeGraph_CallWithNativeExecutionDisabled_ExpectNull)
+    {
+        using namespace NativeGraphRegistryTestCpp;
+        ScriptCanvas::Execution::NativeGraphAutoRegistrar registrar(k_sourceId, &OnGraphStartA);
+
+        ScriptCanvas::Execution::g_nativeExecutionEnabled = false;
+        EXPECT_EQ(ScriptCanvas::Execution::FindNativeGraph(k_sourceId), nullptr);
+
+        ScriptCanvas::Execution::g_nativeExecutionEnabled = true;
+        EXPECT_EQ(ScriptCanvas::Execution::FindNativeGraph(k_sourceId), &OnGraphStartA);
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+#include <AzTest/AzTest.h>
+#include <AzCore/Script/ScriptSystemBus.h>
+
+namespace ScriptCanvasUnitTest
+{
+    class ScriptSystemRequestsMock : public AZ::ScriptSystemRequestBus::Handler
+    {
+    public:
+        ScriptSystemRequestsMock()
+        {
+            AZ::ScriptSystemRequestBus::Handler::BusConnect();
+        }
+
+        ~ScriptSystemRequestsMock() override
+        {
+            AZ::ScriptSystemRequestBus::Handler::BusDisconnect();
+        }
+
+        MOCK_METHOD2(AddContext, AZ::ScriptContext*(AZ::ScriptContext*, int));
+        MOCK_METHOD1(AddContextWithId, AZ::ScriptContext*(AZ::ScriptContextId));
+        MOCK_METHOD1(RemoveContext, bool(AZ::ScriptContext*));
+        MOCK_METHOD1(RemoveContextWithId, bool(AZ::ScriptContextId));
+        MOCK_METHOD1(GetContext, AZ::ScriptContext*(AZ::ScriptContextId));
+        MOCK_METHOD0(GarbageCollect, void());
+        MOCK_METHOD1(GarbageCollectStep, void(int));
+        MOCK_METHOD2(SetGarbageCollectorBudget, void(AZStd::chrono::microseconds, AZ::ScriptContextId));
+        MOCK_METHOD3(Load, bool(const AZ::Data::Asset<AZ::ScriptAsset>&, const char*, AZ::ScriptContextId));
+        MOCK_METHOD3(LoadAndGetNativeContext, AZ::ScriptLoadResult(const AZ::Data::Asset<AZ::ScriptAsset>&, const char*, AZ::ScriptContextId));
+        MOCK_METHOD1(ClearAssetReferences, void(AZ::Data::AssetId));
+        MOCK_METHOD1(RestoreDefaultRequireHook, void(AZ::ScriptContextId));
+        MOCK_METHOD2(UseInMemoryRequireHook, void(const AZ::InMemoryScriptModules&, AZ::ScriptContextId));
+    };
+}
@@ -65,6 +65,7 @@ set(FILES
     Include/ScriptCanvas/Execution/ExecutionContext.cpp
     Include/ScriptCanvas/Execution/ExecutionObjectCloning.cpp
     Include/ScriptCanvas/Execution/ExecutionPerformanceTimer.cpp
+    Include/ScriptCanvas/Execution/ExecutionSampler.cpp
     Include/ScriptCanvas/Execution/ExecutionState.cpp
     Include/ScriptCanvas/Execution/ExecutionStateHandler.cpp
     Include/ScriptCanvas/Execution/ExecutionStateStorage.cpp
@@ -81,6 +82,9 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionNativeAPI.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.cpp
+    Include/ScriptCanvas/Execution/Native/NativeGraphRegistry.cpp
     Include/ScriptCanvas/Grammar/AbstractCodeModel.cpp
     Include/ScriptCanvas/Grammar/ASTModifications.cpp
     Include/ScriptCanvas/Grammar/DebugMap.cpp
@@ -168,6 +172,7 @@ set(FILES
     Include/ScriptCanvas/Serialization/BehaviorContextObjectSerializer.cpp
     Include/ScriptCanvas/Serialization/DatumSerializer.cpp
     Include/ScriptCanvas/Serialization/RuntimeVariableSerializer.cpp
+    Include/ScriptCanvas/Translation/GraphToCPlusPlus.cpp
     Include/ScriptCanvas/Translation/GraphToLua.cpp
     Include/ScriptCanvas/Translation/GraphToLuaUtility.cpp
     Include/ScriptCanvas/Translation/GraphToX.cpp
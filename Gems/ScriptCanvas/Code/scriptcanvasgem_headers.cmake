@@ -88,6 +88,7 @@ set(FILES
     Include/ScriptCanvas/Execution/ExecutionContext.h
     Include/ScriptCanvas/Execution/ExecutionObjectCloning.h
     Include/ScriptCanvas/Execution/ExecutionPerformanceTimer.h
+    Include/ScriptCanvas/Execution/ExecutionSampler.h
     Include/ScriptCanvas/Execution/ExecutionState.h
     Include/ScriptCanvas/Execution/ExecutionStateDeclarations.h
     Include/ScriptCanvas/Execution/ExecutionStateHandler.h
@@ -106,6 +107,9 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPure.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h
+    Include/ScriptCanvas/Execution/Native/ExecutionNativeAPI.h
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.h
+    Include/ScriptCanvas/Execution/Native/NativeGraphRegistry.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.h
     Include/ScriptCanvas/Grammar/ASTModifications.h
     Include/ScriptCanvas/Grammar/DebugMap.h
@@ -273,6 +277,7 @@ set(FILES
     Include/ScriptCanvas/Serialization/DatumSerializer.h
     Include/ScriptCanvas/Serialization/RuntimeVariableSerializer.h
     Include/ScriptCanvas/Translation/Configuration.h
+    Include/ScriptCanvas/Translation/GraphToCPlusPlus.h
     Include/ScriptCanvas/Translation/GraphToLua.h
     Include/ScriptCanvas/Translation/GraphToLuaUtility.h
     Include/ScriptCanvas/Translation/GraphToX.h
@@ -422,4 +422,28 @@ namespace ScriptCanvasTests
         AZStd::unordered_set< AZ::ComponentDescriptor* > m_descriptors;
 
     };
+
+#if defined(HAVE_BENCHMARK)
+    //! Starts the application of the test fixture for the benchmarks of this module, which don't run the test suite set up.
+    class ScriptCanvasTestBenchmarkEnvironment
+        : public AZ::Test::BenchmarkEnvironmentBase
+    {
+        struct TestSuite
+            : public ScriptCanvasTestFixture
+        {
+            using ScriptCanvasTestFixture::SetUpTestCase;
+            using ScriptCanvasTestFixture::TearDownTestCase;
+        };
+
+        void SetUpBenchmark() override
+        {
+            TestSuite::SetUpTestCase();
+        }
+
+        void TearDownBenchmark() override
+        {
+            TestSuite::TearDownTestCase();
+        }
+    };
+#endif
 }
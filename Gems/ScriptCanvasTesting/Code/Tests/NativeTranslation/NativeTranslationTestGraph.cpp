@@ -0,0 +1,52 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeTranslationTestGraph
+FULL PATH: NativeTranslationTestGraph.scriptcanvas
+Last written: 14:32:07 10-19-2026
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#include <AzCore/Math/MathUtils.h>
+#include <ScriptCanvas/Execution/Native/ExecutionNativeAPI.h>
+#include <ScriptCanvas/Execution/Native/NativeGraphRegistry.h>
+
+#include "NativeTranslationTestGraph.h"
+
+namespace AutoNative::NativeTranslationTestGraph
+{
+	void OnGraphStart([[maybe_unused]] ScriptCanvas::ExecutionState& executionState, [[maybe_unused]] AZ::BehaviorArgument* arguments, [[maybe_unused]] size_t argumentCount)
+	{
+		static const AZ::BehaviorMethod* const s_method0 = ScriptCanvas::Execution::FindNativeMethod("NativeTranslationTestMath", "Accumulate");
+		SC_RUNTIME_CHECK_RETURN(argumentCount == 0, "NativeTranslationTestGraph expected 0 activation arguments");
+		ScriptCanvas::Execution::NativeCall(s_method0, 1.0);
+		ScriptCanvas::Execution::NativeCall(s_method0, 2.0);
+		ScriptCanvas::Execution::NativeCall(s_method0, 3.0);
+		ScriptCanvas::Execution::NativeCall(s_method0, 4.0);
+		ScriptCanvas::Execution::NativeCall(s_method0, 5.0);
+		ScriptCanvas::Execution::NativeCall(s_method0, 6.0);
+		ScriptCanvas::Execution::NativeCall(s_method0, 7.0);
+		ScriptCanvas::Execution::NativeCall(s_method0, 8.0);
+	}
+
+	SCRIPT_CANVAS_NATIVE_GRAPH("{6C1E5A43-2F9B-4D7E-8A35-0B9E4C2D7F18}", OnGraphStart)
+} // namespace AutoNative::NativeTranslationTestGraph
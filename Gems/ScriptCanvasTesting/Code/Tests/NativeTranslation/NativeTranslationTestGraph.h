@@ -0,0 +1,37 @@
+/*
+* Copyright (c) Contributors to the Open 3D Engine Project.
+* For complete copyright and license terms please see the LICENSE at the root of this distribution.
+*
+* SPDX-License-Identifier: Apache-2.0 OR MIT
+*
+*/
+
+/*
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+GRAPH NAME: NativeTranslationTestGraph
+FULL PATH: NativeTranslationTestGraph.scriptcanvas
+Last written: 14:32:07 10-19-2026
+
+DO NOT MODIFY THIS FILE, IT IS AUTO-GENERATED FROM A SCRIPT CANVAS GRAPH!
+
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+***********************************************************************************
+*/
+
+#pragma once
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+
+namespace AutoNative::NativeTranslationTestGraph
+{
+	void OnGraphStart([[maybe_unused]] ScriptCanvas::ExecutionState& executionState, [[maybe_unused]] AZ::BehaviorArgument* arguments, [[maybe_unused]] size_t argumentCount);
+} // namespace AutoNative::NativeTranslationTestGraph
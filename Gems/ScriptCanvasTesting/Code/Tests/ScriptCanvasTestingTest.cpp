@@ -6,5 +6,6 @@
  *
  */
 #include <AzTest/AzTest.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
 
-AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV, ScriptCanvasTests::ScriptCanvasTestBenchmarkEnvironment);
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/ScriptSystemBus.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/Utils/Utils.h>
+#include <ScriptCanvas/Asset/RuntimeAsset.h>
+#include <ScriptCanvas/Core/ModifiableDatumView.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvas/Execution/Native/NativeGraphRegistry.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+#include <ScriptCanvas/Libraries/Core/Start.h>
+#include <ScriptCanvas/Translation/Translation.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+#include <Tests/NativeTranslation/NativeTranslationTestGraph.h>
+
+using namespace ScriptCanvas;
+using namespace ScriptCanvasTests;
+
+class NativeTranslationTestMath
+{
+public:
+    AZ_TYPE_INFO(NativeTranslationTestMath, "{A1D5C3F2-7B4E-4F0A-9C86-2E5B7D9F1A34}");
+    AZ_CLASS_ALLOCATOR(NativeTranslationTestMath, AZ::SystemAllocator);
+
+    static double s_sum;
+
+    static void Accumulate(double value)
+    {
+        s_sum += value;
+    }
+
+    // a Number is a double, which the C++ translation won't convert
+    static void AccumulateFloat(float value)
+    {
+        s_sum += value;
+    }
+
+    static void Reflect(AZ::BehaviorContext* behaviorContext)
+    {
+        // reflected once per application, since the generated C++ binds the method on its first call
+        if (behaviorContext->m_classes.find("NativeTranslationTestMath") == behaviorContext->m_classes.end())
+        {
+            behaviorContext->Class<NativeTranslationTestMath>("NativeTranslationTestMath")
+                ->Method("Accumulate", &Accumulate)
+                ->Method("AccumulateFloat", &AccumulateFloat)
+                ;
+        }
+    }
+};
+
+double NativeTranslationTestMath::s_sum = 0.0;
+
+namespace NativeTranslationTestCpp
+{
+    // the graph translated to Tests/NativeTranslation/NativeTranslationTestGraph.h/.cpp, which are compiled into this module
+    const AZ::Uuid k_graphId("{6C1E5A43-2F9B-4D7E-8A35-0B9E4C2D7F18}");
+    constexpr const char* k_graphName = "NativeTranslationTestGraph";
+    constexpr const char* k_graphPath = "NativeTranslationTestGraph.scriptcanvas";
+    constexpr const char* k_checkedInTranslationPath = "@gemroot:ScriptCanvasTesting@/Code/Tests/NativeTranslation/NativeTranslationTestGraph";
+
+    // Start, then Accumulate(1) through Accumulate(8)
+    constexpr size_t k_callCount = 8;
+    constexpr double k_expectedSum = 36.0;
+
+    Graph* CreateAccumulateGraph(AZStd::string_view methodName)
+    {
+        Graph* graph = nullptr;
+        SystemRequestBus::BroadcastResult(graph, &SystemRequests::MakeGraph);
+        EXPECT_TRUE(graph != nullptr);
+        graph->GetEntity()->Init();
+
+        const ScriptCanvasId& scriptCanvasId = graph->GetScriptCanvasId();
+
+        AZ::Entity* startEntity{ aznew AZ::Entity("Start") };
+        startEntity->Init();
+        AZ::EntityId previousNodeId{ startEntity->GetId() };
+        SystemRequestBus::Broadcast(&SystemRequests::CreateNodeOnEntity, previousNodeId, scriptCanvasId, Nodes::Core::Start::TYPEINFO_Uuid());
+
+        for (size_t index = 1; index <= k_callCount; ++index)
+        {
+            const AZ::EntityId nodeId = CreateClassFunctionNode(scriptCanvasId, "NativeTranslationTestMath", methodName);
+            Node* node = graph->FindNode(nodeId);
+            Node* previousNode = graph->FindNode(previousNodeId);
+
+            ModifiableDatumView datumView;
+            node->FindModifiableDatumView(node->GetAllSlotsByDescriptor(SlotDescriptors::DataIn()).front()->GetId(), datumView);
+            datumView.SetAs(Data::NumberType(index));
+
+            EXPECT_TRUE(graph->ConnectByEndpoint
+                ( previousNode->GetAllSlotsByDescriptor(SlotDescriptors::ExecutionOut()).front()->GetEndpoint()
+                , node->GetAllSlotsByDescriptor(SlotDescriptors::ExecutionIn()).front()->GetEndpoint()));
+
+            previousNodeId = nodeId;
+        }
+
+        graph->GetEntity()->Activate();
+        return graph;
+    }
+
+    void DestroyGraph(Graph* graph)
+    {
+        graph->GetEntity()->Deactivate();
+        delete graph->GetEntity();
+    }
+
+    Translation::Result TranslateGraph(const Graph& graph, AZ::u32 translationTargetFlags)
+    {
+        Grammar::Request request;
+        request.scriptAssetId = AZ::Data::AssetId(k_graphId, RuntimeDataSubId);
+        request.graph = &graph;
+        request.name = k_graphName;
+        request.path = k_graphPath;
+        request.translationTargetFlags = translationTargetFlags;
+        request.addDebugInformation = false;
+        return Translation::ParseAndTranslateGraph(request);
+    }
+
+    // the generated comment at the top of the translation includes the time it was written, so only the code is compared
+    AZStd::string_view SkipGeneratedComment(AZStd::string_view source)
+    {
+        const size_t code = source.find("\n#");
+        return code != AZStd::string_view::npos ? source.substr(code + 1) : source;
+    }
+
+    AZStd::string ReadCheckedInTranslation(AZStd::string_view extension)
+    {
+        AZStd::string path = AZStd::string::format("%s.%.*s", k_checkedInTranslationPath, aznumeric_cast<int>(extension.size()), extension.data());
+        AZ::IO::FixedMaxPath resolvedPath;
+        EXPECT_TRUE(AZ::IO::FileIOBase::GetInstance()->ResolvePath(resolvedPath, AZ::IO::PathView(path))) << "failed to resolve " << path.c_str();
+
+        auto readOutcome = AZ::Utils::ReadFile<AZStd::string>(resolvedPath.Native());
+        EXPECT_TRUE(readOutcome.IsSuccess()) << readOutcome.GetError().c_str();
+
+        AZStd::string source = readOutcome.IsSuccess() ? readOutcome.TakeValue() : AZStd::string();
+        AZStd::erase(source, '\r');
+        return source;
+    }
+
+    RuntimeDataOverrides CreateRuntimeDataOverrides()
+    {
+        RuntimeDataOverrides overrides;
+        overrides.m_runtimeAsset = AZ::Data::Asset<RuntimeAsset>
+            ( aznew RuntimeAsset(AZ::Data::AssetId(k_graphId, RuntimeDataSubId), AZ::Data::AssetData::AssetStatus::Ready)
+            , AZ::Data::AssetLoadBehavior::Default);
+        return overrides;
+    }
+}
+
+class NativeTranslationTest
+    : public ScriptCanvasTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        ScriptCanvasTestFixture::SetUp();
+        NativeTranslationTestMath::Reflect(m_behaviorContext);
+        NativeTranslationTestMath::s_sum = 0.0;
+    }
+};
+
+TEST_F(NativeTranslationTest, TranslateToCPlusPlus_MethodCalls_EmitsBindingAndCallsInExecutionOrder)
+{
+    using namespace NativeTranslationTestCpp;
+
+    Graph* graph = CreateAccumulateGraph("Accumulate");
+    Translation::Result result = TranslateGraph(*graph, Translation::TargetFlags::Cpp | Translation::TargetFlags::Hpp);
+    DestroyGraph(graph);
+
+    ASSERT_TRUE(result.IsSuccess(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+    ASSERT_TRUE(result.IsSuccess(Translation::TargetFlags::Hpp)) << result.ErrorsToString().c_str();
+    const AZStd::string& dotH = result.m_translations.find(Translation::TargetFlags::Hpp)->second.m_text;
+    const AZStd::string& dotCpp = result.m_translations.find(Translation::TargetFlags::Cpp)->second.m_text;
+
+    EXPECT_NE(dotH.find("namespace AutoNative::NativeTranslationTestGraph"), AZStd::string::npos);
+    EXPECT_NE(dotH.find("void OnGraphStart("), AZStd::string::npos);
+
+    // each method is bound once, no matter how often it is called
+    const AZStd::string binding = "static const AZ::BehaviorMethod* const s_method0 = "
+        "ScriptCanvas::Execution::FindNativeMethod(\"NativeTranslationTestMath\", \"Accumulate\");";
+    EXPECT_NE(dotCpp.find(binding), AZStd::string::npos);
+    EXPECT_EQ(dotCpp.find("s_method1"), AZStd::string::npos);
+    EXPECT_NE(dotCpp.find("SC_RUNTIME_CHECK_RETURN(argumentCount == 0,"), AZStd::string::npos);
+
+    size_t position = 0;
+    for (size_t index = 1; index <= k_callCount; ++index)
+    {
+        const AZStd::string call = AZStd::string::format("ScriptCanvas::Execution::NativeCall(s_method0, %zu.0);", index);
+        const size_t callPosition = dotCpp.find(call, position);
+        ASSERT_NE(callPosition, AZStd::string::npos) << call.c_str();
+        position = callPosition + call.size();
+    }
+
+    EXPECT_NE(dotCpp.find("SCRIPT_CANVAS_NATIVE_GRAPH(\"{6C1E5A43-2F9B-4D7E-8A35-0B9E4C2D7F18}\", OnGraphStart)"), AZStd::string::npos);
+}
+
+TEST_F(NativeTranslationTest, TranslateToCPlusPlus_MethodCalls_MatchesCompiledTranslation)
+{
+    using namespace NativeTranslationTestCpp;
+
+    Graph* graph = CreateAccumulateGraph("Accumulate");
+    Translation::Result result = TranslateGraph(*graph, Translation::TargetFlags::Cpp | Translation::TargetFlags::Hpp);
+    DestroyGraph(graph);
+
+    ASSERT_TRUE(result.IsSuccess(Translation::TargetFlags::Cpp)) << result.ErrorsToString().c_str();
+    const AZStd::string& dotH = result.m_translations.find(Translation::TargetFlags::Hpp)->second.m_text;
+    const AZStd::string& dotCpp = result.m_translations.find(Translation::TargetFlags::Cpp)->second.m_text;
+
+    // if this fails, the translator changed: regenerate Tests/NativeTranslation from the output of this graph
+    EXPECT_EQ(SkipGeneratedComment(dotH), SkipGeneratedComment(ReadCheckedInTranslation("h")));
+    EXPECT_EQ(SkipGeneratedComment(dotCpp), SkipGeneratedComment(ReadCheckedInTranslation("cpp")));
+}
+
+TEST_F(NativeTranslationTest, ExecuteNative_CompiledTranslation_CallsMethodsInOrder)
+{
+    using namespace NativeTranslationTestCpp;
+
+    Execution::NativeGraphStart onGraphStart = Execution::FindNativeGraph(k_graphId);
+    ASSERT_EQ(onGraphStart, &AutoNative::NativeTranslationTestGraph::OnGraphStart);
+
+    RuntimeDataOverrides overrides = CreateRuntimeDataOverrides();
+    ExecutionUserData userData;
+    ExecutionStateConfig config(overrides, AZStd::move(userData));
+    ExecutionStateNativePureOnGraphStart executionState(config, onGraphStart);
+    EXPECT_EQ(executionState.GetExecutionMode(), ExecutionMode::Native);
+
+    executionState.Execute();
+    EXPECT_DOUBLE_EQ(NativeTranslationTestMath::s_sum, k_expectedSum);
+}
+
+TEST_F(NativeTranslationTest, TranslateToCPlusPlus_ArgumentRequiresConversion_FailsAndKeepsLuaTranslation)
+{
+    using namespace NativeTranslationTestCpp;
+
+    Graph* graph = CreateAccumulateGraph("AccumulateFloat");
+    Translation::Result result = TranslateGraph(*graph, Translation::TargetFlags::Lua | Translation::TargetFlags::Cpp | Translation::TargetFlags::Hpp);
+    DestroyGraph(graph);
+
+    EXPECT_TRUE(result.IsSuccess(Translation::TargetFlags::Lua)) << result.ErrorsToString().c_str();
+    EXPECT_FALSE(result.IsSuccess(Translation::TargetFlags::Cpp));
+    EXPECT_FALSE(result.TranslationSucceed(Translation::TargetFlags::Hpp));
+}
+
+#if defined(HAVE_BENCHMARK)
+// compares the interpreted and native runtimes on the two translations of the same graph
+class NativeTranslationBenchmarkFixture
+    : public ::benchmark::Fixture
+{
+public:
+    void SetUp(const ::benchmark::State&) override
+    {
+        AZ::BehaviorContext* behaviorContext{};
+        AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+        NativeTranslationTestMath::Reflect(behaviorContext);
+    }
+
+    void TearDown(const ::benchmark::State&) override
+    {}
+};
+
+BENCHMARK_DEFINE_F(NativeTranslationBenchmarkFixture, BM_InterpretedGraphExecution)(benchmark::State& state)
+{
+    using namespace NativeTranslationTestCpp;
+
+    Graph* graph = CreateAccumulateGraph("Accumulate");
+    Translation::Result result = TranslateGraph(*graph, Translation::TargetFlags::Lua);
+    DestroyGraph(graph);
+
+    if (!result.IsSuccess(Translation::TargetFlags::Lua))
+    {
+        state.SkipWithError("Lua translation of the benchmark graph failed");
+        return;
+    }
+
+    AZ::ScriptContext* scriptContext{};
+    AZ::ScriptSystemRequestBus::BroadcastResult(scriptContext, &AZ::ScriptSystemRequests::GetContext, AZ::ScriptContextIds::DefaultScriptContextId);
+    Execution::SetInterpretedExecutionModeRelease();
+    lua_State* lua = scriptContext->NativeContext();
+
+    // Lua: graph_VM
+    const AZStd::string& dotLua = result.m_translations.find(Translation::TargetFlags::Lua)->second.m_text;
+    if (luaL_loadbuffer(lua, dotLua.data(), dotLua.size(), k_graphName) != LUA_OK || lua_pcall(lua, 0, 1, 0) != LUA_OK)
+    {
+        state.SkipWithError("Lua translation of the benchmark graph failed to load");
+        lua_pop(lua, 1);
+        return;
+    }
+
+    // the same call that ExecutionStateInterpretedPureOnGraphStart::Execute makes, without the script asset lookup
+    for ([[maybe_unused]] auto _ : state)
+    {
+        // Lua: graph_VM, graph_VM.OnGraphStart, executionState
+        lua_getfield(lua, -1, Grammar::k_OnGraphStartFunctionName);
+        lua_pushnil(lua);
+        if (Execution::InterpretedSafeCall(lua, 1, 0) != LUA_OK)
+        {
+            lua_pop(lua, 1);
+        }
+    }
+
+    lua_pop(lua, 1);
+    state.SetItemsProcessed(state.iterations() * k_callCount);
+}
+
+BENCHMARK_DEFINE_F(NativeTranslationBenchmarkFixture, BM_NativeGraphExecution)(benchmark::State& state)
+{
+    using namespace NativeTranslationTestCpp;
+
+    RuntimeDataOverrides overrides = CreateRuntimeDataOverrides();
+    ExecutionUserData userData;
+    ExecutionStateConfig config(overrides, AZStd::move(userData));
+    ExecutionStateNativePureOnGraphStart executionState(config, &AutoNative::NativeTranslationTestGraph::OnGraphStart);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        executionState.Execute();
+    }
+
+    benchmark::DoNotOptimize(NativeTranslationTestMath::s_sum);
+    state.SetItemsProcessed(state.iterations() * k_callCount);
+}
+
+BENCHMARK_REGISTER_F(NativeTranslationBenchmarkFixture, BM_InterpretedGraphExecution);
+BENCHMARK_REGISTER_F(NativeTranslationBenchmarkFixture, BM_NativeGraphExecution);
+#endif
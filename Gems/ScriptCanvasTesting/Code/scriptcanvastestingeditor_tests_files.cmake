@@ -22,10 +22,13 @@ set(FILES
     Tests/ScriptCanvas_FileHandling.cpp
     Tests/ScriptCanvas_Math.cpp
     Tests/ScriptCanvas_MethodOverload.cpp
+    Tests/ScriptCanvas_NativeTranslation.cpp
     Tests/ScriptCanvas_RuntimeInterpreted.cpp
     Tests/ScriptCanvas_Slots.cpp
     Tests/ScriptCanvas_StringNodes.cpp
     Tests/ScriptCanvas_UnitTesting.cpp
     Tests/ScriptCanvas_Variables.cpp
     Tests/ScriptCanvas_VM.cpp
+    Tests/NativeTranslation/NativeTranslationTestGraph.h
+    Tests/NativeTranslation/NativeTranslationTestGraph.cpp
 )
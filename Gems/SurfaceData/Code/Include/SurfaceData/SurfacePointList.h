@@ -25,7 +25,7 @@ namespace SurfaceData
     //!
     //! List construction:
     //!   StartListConstruction() - This clears the structure, temporarily holds on to the list of input positions, and preallocates the data.
-    //!   AddSurfacePoint() - Add surface points to the list. They're expected to get added in input position order.
+    //!   AddSurfacePoint() / AddSurfacePoints() - Add surface points to the list. They're expected to get added in input position order.
     //!   ModifySurfaceWeights() - Modify the surface weights for the set of input points.
     //!   FilterPoints() - Remove any generated surface points that don't fit the filter criteria
     //!   EndListConstruction() - "Freeze" and compact the data.
@@ -94,6 +94,26 @@ namespace SurfaceData
         void AddSurfacePoint(const AZ::EntityId& entityId, const AZ::Vector3& inPosition,
             const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& weights);
 
+        //! Add a batch of surface points that share the same surface tags and weights to the list.
+        //! Unlike AddSurfacePoint(), this doesn't need to search for the input position of each point, so providers that already
+        //! know which input position produced each point should prefer it.
+        //! @param entityId - The entity creating the surface points.
+        //! @param inPositionIndices - The index of the input position that produced each surface point, in increasing order.
+        //! @param positions - The positions of the surface points.
+        //! @param normals - The normals for the surface points.
+        //! @param weights - The surface tags and weights for all of the surface points.
+        void AddSurfacePoints(const AZ::EntityId& entityId, AZStd::span<const size_t> inPositionIndices,
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<const AZ::Vector3> normals, const SurfaceTagWeights& weights);
+
+        //! Add a batch of surface points, one for each input position in input position order.
+        //! The first point belongs to the first input position, the second point to the second, and so on.
+        //! @param entityId - The entity creating the surface points.
+        //! @param positions - The positions of the surface points.
+        //! @param normals - The normals for the surface points.
+        //! @param weights - The surface tags and weights for each of the surface points.
+        void AddSurfacePoints(const AZ::EntityId& entityId, AZStd::span<const AZ::Vector3> positions,
+            AZStd::span<const AZ::Vector3> normals, AZStd::span<const SurfaceTagWeights> weights);
+
         //! Modify the surface weights for each surface point in the list.
         //! @param surfaceModifierHandle - The handle to the surface modifier that will modify the surface weights.
         void ModifySurfaceWeights(const SurfaceDataRegistryHandle& surfaceModifierHandle);
@@ -153,6 +173,14 @@ namespace SurfaceData
         //! @return The surface point with the highest Z value for the given input position.
         AzFramework::SurfaceData::SurfacePoint GetHighestSurfacePoint(size_t inputPositionIndex) const;
 
+        //! Get the position and normal of the highest surface point for every input position in a single pass.
+        //! This is cheaper than calling GetHighestSurfacePoint() for each input position, since the surface tag weights aren't copied.
+        //! Entries for input positions that don't have any surface points are left unchanged, so the outputs can be sized to the
+        //! caller's input position list even if the query didn't generate any points at all.
+        //! @outPositions - Receives the highest surface point position for each input position, or empty if the positions aren't needed.
+        //! @outNormals - Receives the highest surface point normal for each input position, or empty if the normals aren't needed.
+        void GetHighestSurfacePoints(AZStd::span<AZ::Vector3> outPositions, AZStd::span<AZ::Vector3> outNormals) const;
+
         //! Get the AABB that encapsulates all of the generated output surface points.
         //! @return The AABB surrounding all the output surface points.
         AZ::Aabb GetSurfacePointAabb() const
@@ -167,6 +195,10 @@ namespace SurfaceData
         // Get the input position index associated with a specific input position.
         size_t GetInPositionIndexFromPosition(const AZ::Vector3& inPosition) const;
 
+        // Add a surface point to the list for an input position index that's already known.
+        void AddSurfacePointAtIndex(const AZ::EntityId& entityId, size_t inPositionIndex,
+            const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& weights);
+
         // Get the first entry in the sortedSurfacePointIndices list for the given input position index.
         size_t GetSurfacePointStartIndexFromInPositionIndex(size_t inPositionIndex) const;
 
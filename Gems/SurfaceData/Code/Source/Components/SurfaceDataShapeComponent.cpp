@@ -170,8 +170,15 @@ namespace SurfaceData
                 // until they get support for it.
                 const AZ::Vector3 surfacePointNormal = AZ::Vector3::CreateAxisZ();
 
-                for (auto& inPosition : inPositions)
+                // Collect the hits so that they can be added to the surface point list as one batch by input position index.
+                AZStd::vector<size_t> hitIndices;
+                AZStd::vector<AZ::Vector3> hitPositions;
+                hitIndices.reserve(inPositions.size());
+                hitPositions.reserve(inPositions.size());
+
+                for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
                 {
+                    const AZ::Vector3& inPosition = inPositions[inPositionIndex];
                     if (SurfaceData::AabbContains2D(m_shapeBounds, inPosition))
                     {
                         const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
@@ -179,11 +186,14 @@ namespace SurfaceData
                         bool hitShape = shape->IntersectRay(rayOrigin, rayDirection, intersectionDistance);
                         if (hitShape)
                         {
-                            AZ::Vector3 position = rayOrigin + intersectionDistance * rayDirection;
-                            surfacePointList.AddSurfacePoint(GetEntityId(), inPosition, position, surfacePointNormal, m_newPointWeights);
+                            hitIndices.emplace_back(inPositionIndex);
+                            hitPositions.emplace_back(rayOrigin + intersectionDistance * rayDirection);
                         }
                     }
                 }
+
+                const AZStd::vector<AZ::Vector3> hitNormals(hitPositions.size(), surfacePointNormal);
+                surfacePointList.AddSurfacePoints(GetEntityId(), hitIndices, hitPositions, hitNormals, m_newPointWeights);
             });
     }
 
@@ -133,6 +133,54 @@ namespace SurfaceData
         // Find the inPositionIndex that matches the inPosition.
         size_t inPositionIndex = GetInPositionIndexFromPosition(inPosition);
 
+        AddSurfacePointAtIndex(entityId, inPositionIndex, position, normal, masks);
+    }
+
+    void SurfacePointList::AddSurfacePoints(
+        const AZ::EntityId& entityId, AZStd::span<const size_t> inPositionIndices,
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<const AZ::Vector3> normals, const SurfaceTagWeights& weights)
+    {
+        AZ_Assert(m_listIsBeingConstructed, "Trying to add surface points to a SurfacePointList that isn't under construction.");
+        AZ_Assert(
+            (inPositionIndices.size() == positions.size()) && (positions.size() == normals.size()),
+            "Sizes of the passed-in spans don't match");
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            AZ_Assert(inPositionIndices[index] < m_inputPositionSize, "Input position index %zu is out of range.", inPositionIndices[index]);
+            AddSurfacePointAtIndex(entityId, inPositionIndices[index], positions[index], normals[index], weights);
+        }
+
+        // Keep AddSurfacePoint() searches starting from where this batch left off.
+        if (!inPositionIndices.empty())
+        {
+            m_lastInputPositionIndex = inPositionIndices.back();
+        }
+    }
+
+    void SurfacePointList::AddSurfacePoints(
+        const AZ::EntityId& entityId, AZStd::span<const AZ::Vector3> positions,
+        AZStd::span<const AZ::Vector3> normals, AZStd::span<const SurfaceTagWeights> weights)
+    {
+        AZ_Assert(m_listIsBeingConstructed, "Trying to add surface points to a SurfacePointList that isn't under construction.");
+        AZ_Assert((positions.size() == normals.size()) && (positions.size() == weights.size()), "Sizes of the passed-in spans don't match");
+        AZ_Assert(positions.size() <= m_inputPositionSize, "Adding more surface points than there are input positions.");
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            AddSurfacePointAtIndex(entityId, index, positions[index], normals[index], weights[index]);
+        }
+
+        if (!positions.empty())
+        {
+            m_lastInputPositionIndex = positions.size() - 1;
+        }
+    }
+
+    void SurfacePointList::AddSurfacePointAtIndex(
+        const AZ::EntityId& entityId, size_t inPositionIndex,
+        const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& masks)
+    {
         // Find the first SurfacePoint that either matches the inPosition, or that starts the range for the next inPosition after this one.
         size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inPositionIndex);
 
@@ -356,4 +404,30 @@ namespace SurfaceData
         return point;
     }
 
+    void SurfacePointList::GetHighestSurfacePoints(AZStd::span<AZ::Vector3> outPositions, AZStd::span<AZ::Vector3> outNormals) const
+    {
+        AZ_Assert(!m_listIsBeingConstructed, "Trying to query a SurfacePointList that's still under construction.");
+        AZ_Assert(outPositions.empty() || (outPositions.size() >= m_inputPositionSize), "Output positions list is too small.");
+        AZ_Assert(outNormals.empty() || (outNormals.size() >= m_inputPositionSize), "Output normals list is too small.");
+
+        // The points for each input position are kept sorted in decreasing Z order, so the highest point is always the first one.
+        for (size_t inputIndex = 0; inputIndex < m_inputPositionSize; inputIndex++)
+        {
+            if (m_numSurfacePointsPerInput[inputIndex] == 0)
+            {
+                continue;
+            }
+
+            const size_t pointIndex = m_sortedSurfacePointIndices[GetSurfacePointStartIndexFromInPositionIndex(inputIndex)];
+            if (!outPositions.empty())
+            {
+                outPositions[inputIndex] = m_surfacePositionList[pointIndex];
+            }
+            if (!outNormals.empty())
+            {
+                outNormals[inputIndex] = m_surfaceNormalList[pointIndex];
+            }
+        }
+    }
+
 }
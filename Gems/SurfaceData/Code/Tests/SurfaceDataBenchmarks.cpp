@@ -23,6 +23,7 @@
 #include <LmbrCentral/Shape/CylinderShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataSystemComponent.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
+#include <SurfaceData/SurfacePointList.h>
 
 namespace UnitTest
 {
@@ -217,6 +218,9 @@ namespace UnitTest
             AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(inRegion, stepSize, filterTags, points);
             benchmark::DoNotOptimize(points);
         }
+
+        // Report the number of input positions processed so that the results can be compared as points/sec.
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
     }
 
     BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePointsFromList)(benchmark::State& state)
@@ -248,6 +252,9 @@ namespace UnitTest
             AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(queryPositions, filterTags, points);
             benchmark::DoNotOptimize(points);
         }
+
+        // Report the number of input positions processed so that the results can be compared as points/sec.
+        state.SetItemsProcessed(state.iterations() * worldSizeInt * worldSizeInt);
     }
 
     BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePoints)
@@ -345,6 +352,183 @@ namespace UnitTest
 
     BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_HasAnyMatchingTags_NoMatches);
 
+    // Input positions and generated points from two surface providers, for benchmarking SurfacePointList directly.
+    // The first provider creates a point for every input position, and the second one creates a point above it for every other one,
+    // which is roughly what a terrain surface with a partial shape surface on top of it would produce.
+    struct SurfacePointListBenchmarkData
+    {
+        explicit SurfacePointListBenchmarkData(size_t numInputs)
+        {
+            m_firstWeights.AddSurfaceTagWeight(AZ::Crc32("terrain"), 1.0f);
+            m_secondWeights.AddSurfaceTagWeight(AZ::Crc32("shape"), 1.0f);
+
+            const size_t inputsPerRow = 1024;
+            for (size_t index = 0; index < numInputs; index++)
+            {
+                const float x = aznumeric_cast<float>(index % inputsPerRow);
+                const float y = aznumeric_cast<float>(index / inputsPerRow);
+                m_inPositions.emplace_back(x, y, 0.0f);
+                m_firstPositions.emplace_back(x, y, 1.0f);
+                m_normals.emplace_back(AZ::Vector3::CreateAxisZ());
+                m_firstWeightsList.emplace_back(m_firstWeights);
+
+                if ((index % 2) == 0)
+                {
+                    m_secondIndices.emplace_back(index);
+                    m_secondPositions.emplace_back(x, y, 2.0f);
+                }
+            }
+        }
+
+        void AddPointsOneAtATime(SurfaceData::SurfacePointList& points) const
+        {
+            for (size_t index = 0; index < m_inPositions.size(); index++)
+            {
+                points.AddSurfacePoint(AZ::EntityId(), m_inPositions[index], m_firstPositions[index], m_normals[index], m_firstWeights);
+            }
+            for (size_t index = 0; index < m_secondIndices.size(); index++)
+            {
+                points.AddSurfacePoint(
+                    AZ::EntityId(), m_inPositions[m_secondIndices[index]], m_secondPositions[index], m_normals[index], m_secondWeights);
+            }
+        }
+
+        void AddPointsInBatches(SurfaceData::SurfacePointList& points) const
+        {
+            points.AddSurfacePoints(AZ::EntityId(), m_firstPositions, m_normals, m_firstWeightsList);
+            points.AddSurfacePoints(
+                AZ::EntityId(), m_secondIndices, m_secondPositions,
+                AZStd::span<const AZ::Vector3>(m_normals.data(), m_secondPositions.size()), m_secondWeights);
+        }
+
+        size_t GetPointCount() const
+        {
+            return m_firstPositions.size() + m_secondPositions.size();
+        }
+
+        AZStd::vector<AZ::Vector3> m_inPositions;
+        AZStd::vector<AZ::Vector3> m_firstPositions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        SurfaceData::SurfaceTagWeights m_firstWeights;
+        AZStd::vector<SurfaceData::SurfaceTagWeights> m_firstWeightsList;
+        AZStd::vector<size_t> m_secondIndices;
+        AZStd::vector<AZ::Vector3> m_secondPositions;
+        SurfaceData::SurfaceTagWeights m_secondWeights;
+    };
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_SurfacePointList_AddSurfacePoint)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const SurfacePointListBenchmarkData data(aznumeric_cast<size_t>(state.range(0)));
+
+        // Declare this outside the loop so that we aren't benchmarking the storage allocations.
+        SurfaceData::SurfacePointList points;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            points.Clear();
+            points.StartListConstruction(data.m_inPositions, 2, {});
+            data.AddPointsOneAtATime(points);
+            points.EndListConstruction();
+            benchmark::DoNotOptimize(points);
+        }
+
+        state.SetItemsProcessed(state.iterations() * data.GetPointCount());
+    }
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_SurfacePointList_AddSurfacePoints)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const SurfacePointListBenchmarkData data(aznumeric_cast<size_t>(state.range(0)));
+
+        // Declare this outside the loop so that we aren't benchmarking the storage allocations.
+        SurfaceData::SurfacePointList points;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            points.Clear();
+            points.StartListConstruction(data.m_inPositions, 2, {});
+            data.AddPointsInBatches(points);
+            points.EndListConstruction();
+            benchmark::DoNotOptimize(points);
+        }
+
+        state.SetItemsProcessed(state.iterations() * data.GetPointCount());
+    }
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_SurfacePointList_AddSurfacePoint)
+        ->Arg(64 * 1024)
+        ->Arg(1024 * 1024)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_SurfacePointList_AddSurfacePoints)
+        ->Arg(64 * 1024)
+        ->Arg(1024 * 1024)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_SurfacePointList_GetHighestSurfacePoint)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const SurfacePointListBenchmarkData data(aznumeric_cast<size_t>(state.range(0)));
+        SurfaceData::SurfacePointList points;
+        points.StartListConstruction(data.m_inPositions, 2, {});
+        data.AddPointsInBatches(points);
+        points.EndListConstruction();
+
+        // Get the highest altitude for every input position the way the altitude gradient used to, one point at a time.
+        AZStd::vector<float> altitudes(data.m_inPositions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < altitudes.size(); index++)
+            {
+                altitudes[index] = points.GetHighestSurfacePoint(index).m_position.GetZ();
+            }
+            benchmark::DoNotOptimize(altitudes.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * altitudes.size());
+    }
+
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_SurfacePointList_GetHighestSurfacePoints)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const SurfacePointListBenchmarkData data(aznumeric_cast<size_t>(state.range(0)));
+        SurfaceData::SurfacePointList points;
+        points.StartListConstruction(data.m_inPositions, 2, {});
+        data.AddPointsInBatches(points);
+        points.EndListConstruction();
+
+        // Get the highest altitude for every input position in a single pass.
+        AZStd::vector<AZ::Vector3> highestPositions(data.m_inPositions.size());
+        AZStd::vector<float> altitudes(data.m_inPositions.size());
+        for ([[maybe_unused]] auto _ : state)
+        {
+            points.GetHighestSurfacePoints(highestPositions, {});
+            for (size_t index = 0; index < altitudes.size(); index++)
+            {
+                altitudes[index] = highestPositions[index].GetZ();
+            }
+            benchmark::DoNotOptimize(altitudes.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * altitudes.size());
+    }
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_SurfacePointList_GetHighestSurfacePoint)
+        ->Arg(64 * 1024)
+        ->Arg(1024 * 1024)
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_SurfacePointList_GetHighestSurfacePoints)
+        ->Arg(64 * 1024)
+        ->Arg(1024 * 1024)
+        ->Unit(::benchmark::kMillisecond);
+
+
 
 
 #endif
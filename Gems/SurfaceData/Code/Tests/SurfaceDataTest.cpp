@@ -1042,5 +1042,181 @@ TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRem
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_SurfacePointListWithManyTags_FiltersPointsCorrectly)
+{
+    // Create a point with a different tag for every input position, to verify that filtering keeps exactly the points
+    // with any of the filter tags.
+    const size_t numPoints = 100;
+    AZStd::vector<AZ::Vector3> inPositions;
+    AZStd::vector<SurfaceData::SurfaceTag> pointTags;
+    for (size_t index = 0; index < numPoints; index++)
+    {
+        inPositions.emplace_back(aznumeric_cast<float>(index));
+        pointTags.emplace_back(AZ::Crc32(AZStd::string::format("tag_%zu", index)));
+    }
+
+    // Filter by two tags that exist on one point each, and a tag that doesn't exist on any point.
+    AZStd::array<SurfaceData::SurfaceTag, 3> filterTags = { pointTags[10], pointTags[90], SurfaceData::SurfaceTag(AZ::Crc32("no_match")) };
+
+    SurfaceData::SurfacePointList testPoints;
+    testPoints.StartListConstruction(inPositions, 1, filterTags);
+    for (size_t index = 0; index < numPoints; index++)
+    {
+        SurfaceData::SurfaceTagWeights weights;
+        weights.AddSurfaceTagWeight(pointTags[index], 1.0f);
+        testPoints.AddSurfacePoint(AZ::EntityId(), inPositions[index], inPositions[index], AZ::Vector3::CreateAxisZ(), weights);
+    }
+    testPoints.EndListConstruction();
+
+    // TEST: Only the points with the two matching tags are kept.
+    EXPECT_EQ(testPoints.GetSize(), 2);
+    EXPECT_EQ(testPoints.GetSize(10), 1);
+    EXPECT_EQ(testPoints.GetSize(90), 1);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_SurfacePointListBatchedInsert_MatchesPerPointInsert)
+{
+    // Add the same points from two providers both one at a time and in batches, and verify that both lists end up with the same
+    // sorted and merged points.
+    const size_t numInputs = 8;
+    AZStd::vector<AZ::Vector3> inPositions;
+    for (size_t index = 0; index < numInputs; index++)
+    {
+        inPositions.emplace_back(aznumeric_cast<float>(index), 0.0f, 0.0f);
+    }
+
+    SurfaceData::SurfaceTagWeights firstWeights;
+    firstWeights.AddSurfaceTagWeight(AZ::Crc32("first"), 1.0f);
+    SurfaceData::SurfaceTagWeights secondWeights;
+    secondWeights.AddSurfaceTagWeight(AZ::Crc32("second"), 0.5f);
+
+    // The first provider creates a point at Z = 1 for every input.
+    // The second provider creates a point for every other input, alternating between a point above the first one at Z = 2 and a point
+    // at Z = 1 that merges with the first one.
+    AZStd::vector<AZ::Vector3> firstPositions;
+    AZStd::vector<AZ::Vector3> firstNormals;
+    AZStd::vector<SurfaceData::SurfaceTagWeights> firstWeightsList;
+    AZStd::vector<size_t> secondIndices;
+    AZStd::vector<AZ::Vector3> secondPositions;
+    AZStd::vector<AZ::Vector3> secondNormals;
+    for (size_t index = 0; index < numInputs; index++)
+    {
+        firstPositions.emplace_back(inPositions[index].GetX(), 0.0f, 1.0f);
+        firstNormals.emplace_back(AZ::Vector3::CreateAxisZ());
+        firstWeightsList.emplace_back(firstWeights);
+
+        if ((index % 2) == 0)
+        {
+            secondIndices.emplace_back(index);
+            secondPositions.emplace_back(inPositions[index].GetX(), 0.0f, ((index % 4) == 0) ? 2.0f : 1.0f);
+            secondNormals.emplace_back(AZ::Vector3::CreateAxisZ());
+        }
+    }
+
+    SurfaceData::SurfacePointList perPointList;
+    perPointList.StartListConstruction(inPositions, 2, {});
+    for (size_t index = 0; index < numInputs; index++)
+    {
+        perPointList.AddSurfacePoint(AZ::EntityId(), inPositions[index], firstPositions[index], firstNormals[index], firstWeights);
+    }
+    for (size_t index = 0; index < secondIndices.size(); index++)
+    {
+        perPointList.AddSurfacePoint(
+            AZ::EntityId(), inPositions[secondIndices[index]], secondPositions[index], secondNormals[index], secondWeights);
+    }
+    perPointList.EndListConstruction();
+
+    SurfaceData::SurfacePointList batchedList;
+    batchedList.StartListConstruction(inPositions, 2, {});
+    batchedList.AddSurfacePoints(AZ::EntityId(), firstPositions, firstNormals, firstWeightsList);
+    batchedList.AddSurfacePoints(AZ::EntityId(), secondIndices, secondPositions, secondNormals, secondWeights);
+    batchedList.EndListConstruction();
+
+    // TEST: Every input has one point, plus one for every fourth input where the second provider's point didn't merge.
+    EXPECT_EQ(batchedList.GetSize(), numInputs + (numInputs / 4));
+    EXPECT_EQ(batchedList.GetSize(), perPointList.GetSize());
+
+    for (size_t index = 0; index < numInputs; index++)
+    {
+        ASSERT_EQ(batchedList.GetSize(index), perPointList.GetSize(index));
+
+        AZStd::vector<AzFramework::SurfaceData::SurfacePoint> perPointPoints;
+        perPointList.EnumeratePoints(index,
+            [&perPointPoints](const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceData::SurfaceTagWeights& weights) -> bool
+            {
+                AzFramework::SurfaceData::SurfacePoint& point = perPointPoints.emplace_back();
+                point.m_position = position;
+                point.m_normal = normal;
+                point.m_surfaceTags = weights.GetSurfaceTagWeightList();
+                return true;
+            });
+
+        size_t pointIndex = 0;
+        batchedList.EnumeratePoints(index,
+            [&perPointPoints, &pointIndex](
+                const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceData::SurfaceTagWeights& weights) -> bool
+            {
+                // TEST: The points are in the same order, with the same merged weights.
+                EXPECT_EQ(position, perPointPoints[pointIndex].m_position);
+                EXPECT_EQ(normal, perPointPoints[pointIndex].m_normal);
+                EXPECT_TRUE(weights.SurfaceWeightsAreEqual(perPointPoints[pointIndex].m_surfaceTags));
+                pointIndex++;
+                return true;
+            });
+    }
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_SurfacePointListGetHighestSurfacePoints_MatchesGetHighestSurfacePoint)
+{
+    // Create three points for every other input, and no points for the rest.
+    const size_t numInputs = 6;
+    AZStd::vector<AZ::Vector3> inPositions;
+    for (size_t index = 0; index < numInputs; index++)
+    {
+        inPositions.emplace_back(aznumeric_cast<float>(index), 0.0f, 0.0f);
+    }
+
+    SurfaceData::SurfacePointList testPoints;
+    testPoints.StartListConstruction(inPositions, 3, {});
+    for (size_t index = 0; index < numInputs; index += 2)
+    {
+        for (float z : { 1.0f, 3.0f, 2.0f })
+        {
+            const AZ::Vector3 normal = AZ::Vector3(0.0f, z, 1.0f).GetNormalized();
+            testPoints.AddSurfacePoint(
+                AZ::EntityId(), inPositions[index], AZ::Vector3(inPositions[index].GetX(), 0.0f, z), normal, SurfaceData::SurfaceTagWeights());
+        }
+    }
+    testPoints.EndListConstruction();
+
+    const AZ::Vector3 unsetValue(-1.0f);
+    AZStd::vector<AZ::Vector3> highestPositions(numInputs, unsetValue);
+    AZStd::vector<AZ::Vector3> highestNormals(numInputs, unsetValue);
+    testPoints.GetHighestSurfacePoints(highestPositions, highestNormals);
+
+    for (size_t index = 0; index < numInputs; index++)
+    {
+        if (testPoints.IsEmpty(index))
+        {
+            // TEST: Inputs without any points are left alone.
+            EXPECT_EQ(highestPositions[index], unsetValue);
+            EXPECT_EQ(highestNormals[index], unsetValue);
+        }
+        else
+        {
+            // TEST: Inputs with points get the same highest point as GetHighestSurfacePoint().
+            const AzFramework::SurfaceData::SurfacePoint highestPoint = testPoints.GetHighestSurfacePoint(index);
+            EXPECT_EQ(highestPositions[index], highestPoint.m_position);
+            EXPECT_EQ(highestNormals[index], highestPoint.m_normal);
+            EXPECT_EQ(highestPositions[index].GetZ(), 3.0f);
+        }
+    }
+
+    // TEST: Either output can be skipped.
+    AZStd::vector<AZ::Vector3> highestPositionsOnly(numInputs, unsetValue);
+    testPoints.GetHighestSurfacePoints(highestPositionsOnly, {});
+    EXPECT_EQ(highestPositionsOnly, highestPositions);
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
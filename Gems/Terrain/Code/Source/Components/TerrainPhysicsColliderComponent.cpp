@@ -331,24 +331,42 @@ namespace Terrain
             queryRegion = m_heightfieldRegion;
         }
 
-
+        // Size the output up front so that the query jobs can write each height directly into its own slot.
         heights.clear();
-        heights.reserve(queryRegion.m_numPointsX * queryRegion.m_numPointsY);
+        heights.resize(queryRegion.m_numPointsX * queryRegion.m_numPointsY);
 
         AZ::Aabb worldSize = GetHeightfieldAabb();
         const float worldCenterZ = worldSize.GetCenter().GetZ();
+        const size_t numPointsX = queryRegion.m_numPointsX;
 
-        auto perPositionHeightCallback = [&heights, worldCenterZ]
-            ([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        auto perPositionHeightCallback = [&heights, worldCenterZ, numPointsX]
+            (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
         {
-            heights.emplace_back(surfacePoint.m_position.GetZ() - worldCenterZ);
+            heights[(yIndex * numPointsX) + xIndex] = surfacePoint.m_position.GetZ() - worldCenterZ;
+        };
+
+        // Spread the height queries across multiple threads and block until they're all complete.
+        AZStd::binary_semaphore wait;
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext;
+
+        auto params = AZStd::make_shared<AzFramework::Terrain::QueryAsyncParams>();
+        params->m_desiredNumberOfJobs = cl_terrainPhysicsColliderMaxJobs;
+        params->m_completionCallback = [&wait]([[maybe_unused]] AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> context)
+        {
+            wait.release();
         };
 
         // We can use the "EXACT" sampler here because our query points are guaranteed to be aligned with terrain grid points.
-        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
-            &AzFramework::Terrain::TerrainDataRequests::QueryRegion, queryRegion,
+        AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+            jobContext, &AzFramework::Terrain::TerrainDataRequests::QueryRegionAsync, queryRegion,
             AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
-            perPositionHeightCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+            perPositionHeightCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, params);
+
+        // If there's no terrain system listening, or the query completed synchronously, there's nothing to wait on.
+        if (jobContext)
+        {
+            wait.acquire();
+        }
     }
 
     uint8_t TerrainPhysicsColliderComponent::GetMaterialIndex(
@@ -155,28 +155,34 @@ namespace Terrain
             return;
         }
 
-        size_t inPositionIndex = 0;
+        // QueryList returns one point per input position in input position order, so the points can be collected and then added to
+        // the surface point list as one batch without looking up the input position of each point.
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<AZ::Vector3> normals;
+        AZStd::vector<SurfaceData::SurfaceTagWeights> weights;
+        positions.reserve(inPositions.size());
+        normals.reserve(inPositions.size());
+        weights.reserve(inPositions.size());
 
         AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
             &AzFramework::Terrain::TerrainDataRequestBus::Events::QueryList, inPositions,
             AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::All,
-            [this, inPositions, &inPositionIndex, &surfacePointList]
+            [&positions, &normals, &weights]
                 (const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
             {
-                AZ_Assert(inPositionIndex < inPositions.size(), "Too many points returned from QueryList");
-
-                SurfaceData::SurfaceTagWeights weights(surfacePoint.m_surfaceTags);
+                SurfaceData::SurfaceTagWeights& pointWeights = weights.emplace_back(surfacePoint.m_surfaceTags);
 
                 // Always add a "terrain" or "terrainHole" tag.
                 const AZ::Crc32 terrainTag = terrainExists ? Constants::s_terrainTagCrc : Constants::s_terrainHoleTagCrc;
-                weights.AddSurfaceTagWeight(terrainTag, 1.0f);
-
-                surfacePointList.AddSurfacePoint(
-                    GetEntityId(), inPositions[inPositionIndex], surfacePoint.m_position, surfacePoint.m_normal, weights);
+                pointWeights.AddSurfaceTagWeight(terrainTag, 1.0f);
 
-                inPositionIndex++;
+                positions.emplace_back(surfacePoint.m_position);
+                normals.emplace_back(surfacePoint.m_normal);
             },
             AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+
+        AZ_Assert(positions.size() <= inPositions.size(), "Too many points returned from QueryList");
+        surfacePointList.AddSurfacePoints(GetEntityId(), positions, normals, weights);
     }
 
 
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainQueryCache.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <TerrainProfiler.h>
+
+namespace Terrain
+{
+    AZ_CVAR(int32_t, bg_terrainQueryCacheMaxHeightTiles, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of height tiles to keep in the terrain query cache. Each tile uses about 20 KB.");
+
+    AZ_CVAR(int32_t, bg_terrainQueryCacheMaxSurfaceTiles, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of surface weight tiles to keep in the terrain query cache. Each tile uses about 550 KB.");
+
+    TerrainQueryCache::HeightSampler::HeightSampler(TerrainQueryCache& cache, const HeightTileFillCallback& fillCallback)
+        : m_cache(cache)
+        , m_fillCallback(fillCallback)
+    {
+    }
+
+    float TerrainQueryCache::HeightSampler::GetHeight(int32_t gridX, int32_t gridY, bool& terrainExists)
+    {
+        int32_t tileX, tileY, pointX, pointY;
+        GetTileIndex(gridX, tileX, pointX);
+        GetTileIndex(gridY, tileY, pointY);
+
+        if (!m_tile || (tileX != m_tileX) || (tileY != m_tileY))
+        {
+            m_tile = m_cache.GetHeightTile(tileX, tileY, m_fillCallback);
+            m_tileX = tileX;
+            m_tileY = tileY;
+        }
+
+        const size_t index = (pointY * TileSize) + pointX;
+        terrainExists = m_tile->m_exists[index];
+        return m_tile->m_heights[index];
+    }
+
+    TerrainQueryCache::SurfaceSampler::SurfaceSampler(TerrainQueryCache& cache, const SurfaceTileFillCallback& fillCallback)
+        : m_cache(cache)
+        , m_fillCallback(fillCallback)
+    {
+    }
+
+    const AzFramework::SurfaceData::SurfaceTagWeightList& TerrainQueryCache::SurfaceSampler::GetSurfaceWeights(
+        int32_t gridX, int32_t gridY)
+    {
+        int32_t tileX, tileY, pointX, pointY;
+        GetTileIndex(gridX, tileX, pointX);
+        GetTileIndex(gridY, tileY, pointY);
+
+        if (!m_tile || (tileX != m_tileX) || (tileY != m_tileY))
+        {
+            m_tile = m_cache.GetSurfaceTile(tileX, tileY, m_fillCallback);
+            m_tileX = tileX;
+            m_tileY = tileY;
+        }
+
+        return m_tile->m_surfaceWeights[(pointY * TileSize) + pointX];
+    }
+
+    void TerrainQueryCache::SetQueryResolutions(float heightQueryResolution, float surfaceDataQueryResolution)
+    {
+        AZStd::unique_lock lock(m_cacheMutex);
+
+        if (m_heightTiles.m_queryResolution != heightQueryResolution)
+        {
+            m_heightTiles.m_tiles.clear();
+            m_heightTiles.m_insertionOrder.clear();
+            m_heightTiles.m_queryResolution = heightQueryResolution;
+            m_heightTiles.m_generation++;
+        }
+
+        if (m_surfaceTiles.m_queryResolution != surfaceDataQueryResolution)
+        {
+            m_surfaceTiles.m_tiles.clear();
+            m_surfaceTiles.m_insertionOrder.clear();
+            m_surfaceTiles.m_queryResolution = surfaceDataQueryResolution;
+            m_surfaceTiles.m_generation++;
+        }
+    }
+
+    void TerrainQueryCache::Invalidate(const AZ::Aabb& dirtyRegion, bool heightsChanged, bool surfacesChanged)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock lock(m_cacheMutex);
+
+        if (heightsChanged)
+        {
+            InvalidateGrid(m_heightTiles, dirtyRegion);
+        }
+
+        if (surfacesChanged)
+        {
+            InvalidateGrid(m_surfaceTiles, dirtyRegion);
+        }
+    }
+
+    void TerrainQueryCache::Clear()
+    {
+        AZStd::unique_lock lock(m_cacheMutex);
+
+        m_heightTiles.m_tiles.clear();
+        m_heightTiles.m_insertionOrder.clear();
+        m_heightTiles.m_generation++;
+
+        m_surfaceTiles.m_tiles.clear();
+        m_surfaceTiles.m_insertionOrder.clear();
+        m_surfaceTiles.m_generation++;
+    }
+
+    bool TerrainQueryCache::IsEmpty() const
+    {
+        AZStd::shared_lock lock(m_cacheMutex);
+        return m_heightTiles.m_tiles.empty() && m_surfaceTiles.m_tiles.empty();
+    }
+
+    void TerrainQueryCache::GetTileIndex(int32_t gridIndex, int32_t& tileIndex, int32_t& pointIndex)
+    {
+        // Round towards negative infinity so that negative grid indices end up in the correct tile.
+        tileIndex = (gridIndex >= 0) ? (gridIndex / TileSize) : (((gridIndex + 1) / TileSize) - 1);
+        pointIndex = gridIndex - (tileIndex * TileSize);
+    }
+
+    AZ::u64 TerrainQueryCache::GetTileKey(int32_t tileX, int32_t tileY)
+    {
+        return (aznumeric_cast<AZ::u64>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+    }
+
+    template<typename TileType>
+    AZStd::shared_ptr<const TileType> TerrainQueryCache::GetTile(
+        TileGrid<TileType>& grid, int32_t tileX, int32_t tileY, size_t maxTiles,
+        const AZStd::function<void(AZStd::span<const AZ::Vector3>, TileType&)>& fillCallback)
+    {
+        const AZ::u64 key = GetTileKey(tileX, tileY);
+        AZ::u64 generation = 0;
+        float queryResolution = 1.0f;
+
+        {
+            AZStd::shared_lock lock(m_cacheMutex);
+            if (auto tile = grid.m_tiles.find(key); tile != grid.m_tiles.end())
+            {
+                return tile->second;
+            }
+
+            generation = grid.m_generation;
+            queryResolution = grid.m_queryResolution;
+        }
+
+        TERRAIN_PROFILE_SCOPE_VERBOSE("TerrainQueryCache-FillTile");
+
+        // Fill the tile outside of the lock so that other queries can keep reading from the cache in the meantime.
+        // If multiple threads miss on the same tile, each of them fills it and the first one to finish gets stored.
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(TilePointCount);
+
+        const int32_t firstGridX = tileX * TileSize;
+        const int32_t firstGridY = tileY * TileSize;
+        for (int32_t y = 0; y < TileSize; y++)
+        {
+            const float fy = aznumeric_cast<float>(firstGridY + y) * queryResolution;
+            for (int32_t x = 0; x < TileSize; x++)
+            {
+                const float fx = aznumeric_cast<float>(firstGridX + x) * queryResolution;
+                positions.emplace_back(fx, fy, 0.0f);
+            }
+        }
+
+        auto newTile = AZStd::make_shared<TileType>();
+        fillCallback(positions, *newTile);
+
+        AZStd::unique_lock lock(m_cacheMutex);
+
+        // If the tile was invalidated while we were filling it, the data might be stale, so don't keep it around.
+        if (grid.m_generation != generation)
+        {
+            return newTile;
+        }
+
+        auto [entry, inserted] = grid.m_tiles.emplace(key, newTile);
+        if (!inserted)
+        {
+            return entry->second;
+        }
+
+        grid.m_insertionOrder.push_back(key);
+        while ((grid.m_tiles.size() > maxTiles) && !grid.m_insertionOrder.empty())
+        {
+            grid.m_tiles.erase(grid.m_insertionOrder.front());
+            grid.m_insertionOrder.pop_front();
+        }
+
+        return newTile;
+    }
+
+    template<typename TileType>
+    void TerrainQueryCache::InvalidateGrid(TileGrid<TileType>& grid, const AZ::Aabb& dirtyRegion)
+    {
+        grid.m_generation++;
+
+        if (grid.m_tiles.empty())
+        {
+            return;
+        }
+
+        // Get the range of grid points touched by the dirty region, then the range of tiles that contain them.
+        const float queryResolution = grid.m_queryResolution;
+        int32_t minTileX, minTileY, maxTileX, maxTileY, pointIndex;
+        GetTileIndex(aznumeric_cast<int32_t>(AZStd::floor(dirtyRegion.GetMin().GetX() / queryResolution)), minTileX, pointIndex);
+        GetTileIndex(aznumeric_cast<int32_t>(AZStd::floor(dirtyRegion.GetMin().GetY() / queryResolution)), minTileY, pointIndex);
+        GetTileIndex(aznumeric_cast<int32_t>(AZStd::ceil(dirtyRegion.GetMax().GetX() / queryResolution)), maxTileX, pointIndex);
+        GetTileIndex(aznumeric_cast<int32_t>(AZStd::ceil(dirtyRegion.GetMax().GetY() / queryResolution)), maxTileY, pointIndex);
+
+        auto tileIsDirty = [minTileX, minTileY, maxTileX, maxTileY](AZ::u64 key)
+        {
+            const int32_t tileX = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+            const int32_t tileY = static_cast<int32_t>(static_cast<uint32_t>(key & 0xFFFFFFFF));
+            return (tileX >= minTileX) && (tileX <= maxTileX) && (tileY >= minTileY) && (tileY <= maxTileY);
+        };
+
+        AZStd::erase_if(grid.m_tiles, [&tileIsDirty](const auto& item) { return tileIsDirty(item.first); });
+        grid.m_insertionOrder.erase(
+            AZStd::remove_if(grid.m_insertionOrder.begin(), grid.m_insertionOrder.end(), tileIsDirty), grid.m_insertionOrder.end());
+    }
+
+    AZStd::shared_ptr<const TerrainQueryCache::HeightTile> TerrainQueryCache::GetHeightTile(
+        int32_t tileX, int32_t tileY, const HeightTileFillCallback& fillCallback)
+    {
+        const size_t maxTiles = aznumeric_cast<size_t>(AZStd::max(static_cast<int32_t>(bg_terrainQueryCacheMaxHeightTiles), 0));
+        return GetTile(m_heightTiles, tileX, tileY, maxTiles, fillCallback);
+    }
+
+    AZStd::shared_ptr<const TerrainQueryCache::SurfaceTile> TerrainQueryCache::GetSurfaceTile(
+        int32_t tileX, int32_t tileY, const SurfaceTileFillCallback& fillCallback)
+    {
+        const size_t maxTiles = aznumeric_cast<size_t>(AZStd::max(static_cast<int32_t>(bg_terrainQueryCacheMaxSurfaceTiles), 0));
+        return GetTile(m_surfaceTiles, tileX, tileY, maxTiles, fillCallback);
+    }
+} // namespace Terrain
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+
+namespace Terrain
+{
+    //! A cache of resolved terrain data at the points of the terrain query grids.
+    //! Heights are cached at the height query resolution and surface weights at the surface data query resolution.
+    //! The data is kept in square tiles of grid points that get filled the first time they're used and dropped whenever
+    //! they overlap a dirty region of the terrain, so that repeated queries over the same area in a frame don't need to
+    //! evaluate the terrain areas again. All of the public methods are thread safe.
+    class TerrainQueryCache
+    {
+    public:
+        //! The number of grid points along each side of a tile.
+        static constexpr int32_t TileSize = 64;
+        static constexpr size_t TilePointCount = TileSize * TileSize;
+
+        struct HeightTile
+        {
+            AZStd::array<float, TilePointCount> m_heights;
+            AZStd::array<bool, TilePointCount> m_exists;
+        };
+
+        struct SurfaceTile
+        {
+            AZStd::array<AzFramework::SurfaceData::SurfaceTagWeightList, TilePointCount> m_surfaceWeights;
+        };
+
+        //! Fills a tile with the terrain data for the given grid point positions, in row-major order.
+        using HeightTileFillCallback = AZStd::function<void(AZStd::span<const AZ::Vector3> positions, HeightTile& tile)>;
+        using SurfaceTileFillCallback = AZStd::function<void(AZStd::span<const AZ::Vector3> positions, SurfaceTile& tile)>;
+
+        //! Looks up individual height grid points, holding onto the most recently used tile so that
+        //! neighboring lookups don't need to go back to the cache.
+        class HeightSampler
+        {
+        public:
+            HeightSampler(TerrainQueryCache& cache, const HeightTileFillCallback& fillCallback);
+
+            //! Get the height at a height grid point, filling the tile that contains it if it isn't cached yet.
+            float GetHeight(int32_t gridX, int32_t gridY, bool& terrainExists);
+
+        private:
+            TerrainQueryCache& m_cache;
+            const HeightTileFillCallback& m_fillCallback;
+            AZStd::shared_ptr<const HeightTile> m_tile;
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+        };
+
+        //! Looks up individual surface data grid points, holding onto the most recently used tile so that
+        //! neighboring lookups don't need to go back to the cache.
+        class SurfaceSampler
+        {
+        public:
+            SurfaceSampler(TerrainQueryCache& cache, const SurfaceTileFillCallback& fillCallback);
+
+            //! Get the ordered surface weights at a surface data grid point, filling the tile that contains it if it isn't cached yet.
+            const AzFramework::SurfaceData::SurfaceTagWeightList& GetSurfaceWeights(int32_t gridX, int32_t gridY);
+
+        private:
+            TerrainQueryCache& m_cache;
+            const SurfaceTileFillCallback& m_fillCallback;
+            AZStd::shared_ptr<const SurfaceTile> m_tile;
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+        };
+
+        //! Set the spacing of the height and surface data grid points. Changing either of them clears the cache.
+        void SetQueryResolutions(float heightQueryResolution, float surfaceDataQueryResolution);
+
+        //! Drop all of the tiles that contain grid points within the dirty region.
+        void Invalidate(const AZ::Aabb& dirtyRegion, bool heightsChanged, bool surfacesChanged);
+
+        //! Drop all of the tiles.
+        void Clear();
+
+        //! Returns true if there aren't any tiles in the cache.
+        bool IsEmpty() const;
+
+        //! Split a grid point index into the index of the tile that contains it and the index of the point within that tile.
+        static void GetTileIndex(int32_t gridIndex, int32_t& tileIndex, int32_t& pointIndex);
+
+    private:
+        template<typename TileType>
+        struct TileGrid
+        {
+            AZStd::unordered_map<AZ::u64, AZStd::shared_ptr<const TileType>> m_tiles;
+            //! The order the tiles were added in, used for dropping the oldest tiles once the grid is over budget.
+            AZStd::deque<AZ::u64> m_insertionOrder;
+            float m_queryResolution = 1.0f;
+            //! Incremented on every invalidation so that tiles that were filled with stale data don't get added.
+            AZ::u64 m_generation = 0;
+        };
+
+        static AZ::u64 GetTileKey(int32_t tileX, int32_t tileY);
+
+        template<typename TileType>
+        AZStd::shared_ptr<const TileType> GetTile(
+            TileGrid<TileType>& grid, int32_t tileX, int32_t tileY, size_t maxTiles,
+            const AZStd::function<void(AZStd::span<const AZ::Vector3>, TileType&)>& fillCallback);
+
+        template<typename TileType>
+        static void InvalidateGrid(TileGrid<TileType>& grid, const AZ::Aabb& dirtyRegion);
+
+        AZStd::shared_ptr<const HeightTile> GetHeightTile(int32_t tileX, int32_t tileY, const HeightTileFillCallback& fillCallback);
+        AZStd::shared_ptr<const SurfaceTile> GetSurfaceTile(int32_t tileX, int32_t tileY, const SurfaceTileFillCallback& fillCallback);
+
+        mutable AZStd::shared_mutex m_cacheMutex;
+        TileGrid<HeightTile> m_heightTiles;
+        TileGrid<SurfaceTile> m_surfaceTiles;
+    };
+} // namespace Terrain
@@ -7,6 +7,8 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +27,13 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+namespace Terrain
+{
+    AZ_CVAR(bool, bg_terrainQueryCacheEnabled, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Cache the heights and surface weights at the terrain query grid points, so that repeated list and region queries "
+        "over the same area don't need to evaluate the terrain areas again.");
+}
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -88,6 +97,7 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_queryCache.Clear();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +148,7 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    m_queryCache.Clear();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -426,7 +437,196 @@ void TerrainSystem::MakeBulkQueries(
     }
 }
 
-void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
+void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
+    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+
+    if (bg_terrainQueryCacheEnabled && GetHeightsFromCache(inPositions, sampler, heights, terrainExists))
+    {
+        return;
+    }
+
+    GetHeightsSynchronousUncached(inPositions, sampler, heights, terrainExists);
+}
+
+bool TerrainSystem::GetHeightsFromCache(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
+    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+
+    // EXACT queries can only be served from the cache if every position falls on a height query grid point.
+    // This is the case for the normal queries and for region queries that step at the query resolution.
+    if ((sampler != Sampler::BILINEAR) && (sampler != Sampler::CLAMP))
+    {
+        for (const auto& position : inPositions)
+        {
+            const float gridX = position.GetX() / queryResolution;
+            const float gridY = position.GetY() / queryResolution;
+            if ((gridX != AZStd::floor(gridX)) || (gridY != AZStd::floor(gridY)))
+            {
+                return false;
+            }
+        }
+    }
+
+    // Missing tiles are filled by querying the terrain areas for every grid point in the tile.
+    TerrainQueryCache::HeightTileFillCallback fillCallback =
+        [this](AZStd::span<const AZ::Vector3> positions, TerrainQueryCache::HeightTile& tile)
+    {
+        GetHeightsSynchronousUncached(
+            positions, Sampler::EXACT, AZStd::span<float>(tile.m_heights.data(), tile.m_heights.size()),
+            AZStd::span<bool>(tile.m_exists.data(), tile.m_exists.size()));
+    };
+    TerrainQueryCache::HeightSampler cacheSampler(m_queryCache, fillCallback);
+
+    switch (sampler)
+    {
+    case Sampler::BILINEAR:
+        GetHeightsFromCacheBilinear(inPositions, cacheSampler, heights, terrainExists);
+        break;
+    case Sampler::CLAMP:
+        // Round to the nearest grid point the same way that RoundPosition does.
+        for (size_t i = 0; i < inPositions.size(); i++)
+        {
+            const int32_t gridX = aznumeric_cast<int32_t>(AZStd::floor((inPositions[i].GetX() / queryResolution) + 0.5f));
+            const int32_t gridY = aznumeric_cast<int32_t>(AZStd::floor((inPositions[i].GetY() / queryResolution) + 0.5f));
+            bool exists = false;
+            heights[i] = cacheSampler.GetHeight(gridX, gridY, exists);
+            terrainExists[i] = exists;
+        }
+        break;
+    case Sampler::EXACT:
+        [[fallthrough]];
+    default:
+        for (size_t i = 0; i < inPositions.size(); i++)
+        {
+            const int32_t gridX = aznumeric_cast<int32_t>(inPositions[i].GetX() / queryResolution);
+            const int32_t gridY = aznumeric_cast<int32_t>(inPositions[i].GetY() / queryResolution);
+            bool exists = false;
+            heights[i] = cacheSampler.GetHeight(gridX, gridY, exists);
+            terrainExists[i] = exists;
+        }
+        break;
+    }
+
+    return true;
+}
+
+void TerrainSystem::GetHeightsFromCacheBilinear(const AZStd::span<const AZ::Vector3>& inPositions,
+    TerrainQueryCache::HeightSampler& cacheSampler, AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    using AZ::Simd::Vec4;
+
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+    const Vec4::FloatType resolution = Vec4::Splat(queryResolution);
+
+    // Process the positions four at a time. The grid cell and lerp amounts are calculated the same way as ClampPosition,
+    // the four corner heights are gathered from the cache, and then all four positions are interpolated at once.
+    // Any position that has missing terrain at one of its corners falls back to InterpolateHeights, which handles
+    // all of the combinations of existence.
+    constexpr size_t BatchSize = Vec4::ElementCount;
+    const size_t batchedPositionCount = inPositions.size() - (inPositions.size() % BatchSize);
+
+    for (size_t batchStart = 0; batchStart < batchedPositionCount; batchStart += BatchSize)
+    {
+        const AZ::Vector3* positions = &inPositions[batchStart];
+        const Vec4::FloatType normalizedX = Vec4::Div(Vec4::LoadImmediate(
+            positions[0].GetX(), positions[1].GetX(), positions[2].GetX(), positions[3].GetX()), resolution);
+        const Vec4::FloatType normalizedY = Vec4::Div(Vec4::LoadImmediate(
+            positions[0].GetY(), positions[1].GetY(), positions[2].GetY(), positions[3].GetY()), resolution);
+        const Vec4::FloatType floorX = Vec4::Floor(normalizedX);
+        const Vec4::FloatType floorY = Vec4::Floor(normalizedY);
+        const Vec4::FloatType lerpX = Vec4::Sub(normalizedX, floorX);
+        const Vec4::FloatType lerpY = Vec4::Sub(normalizedY, floorY);
+
+        AZStd::array<int32_t, BatchSize> gridX;
+        AZStd::array<int32_t, BatchSize> gridY;
+        Vec4::StoreUnaligned(gridX.data(), Vec4::ConvertToInt(floorX));
+        Vec4::StoreUnaligned(gridY.data(), Vec4::ConvertToInt(floorY));
+
+        // The four corners of each grid square, in the same order that InterpolateHeights expects: x0y0, x1y0, x0y1, x1y1
+        AZStd::array<AZStd::array<float, BatchSize>, 4> cornerHeights;
+        AZStd::array<AZStd::array<bool, 4>, BatchSize> cornerExists;
+        bool allCornersExist = true;
+        for (size_t lane = 0; lane < BatchSize; lane++)
+        {
+            cornerHeights[0][lane] = cacheSampler.GetHeight(gridX[lane], gridY[lane], cornerExists[lane][0]);
+            cornerHeights[1][lane] = cacheSampler.GetHeight(gridX[lane] + 1, gridY[lane], cornerExists[lane][1]);
+            cornerHeights[2][lane] = cacheSampler.GetHeight(gridX[lane], gridY[lane] + 1, cornerExists[lane][2]);
+            cornerHeights[3][lane] = cacheSampler.GetHeight(gridX[lane] + 1, gridY[lane] + 1, cornerExists[lane][3]);
+            allCornersExist = allCornersExist &&
+                cornerExists[lane][0] && cornerExists[lane][1] && cornerExists[lane][2] && cornerExists[lane][3];
+        }
+
+        // lerp(lerp(x0y0, x1y0), lerp(x0y1, x1y1))
+        const Vec4::FloatType heightX0Y0 = Vec4::LoadUnaligned(cornerHeights[0].data());
+        const Vec4::FloatType heightX1Y0 = Vec4::LoadUnaligned(cornerHeights[1].data());
+        const Vec4::FloatType heightX0Y1 = Vec4::LoadUnaligned(cornerHeights[2].data());
+        const Vec4::FloatType heightX1Y1 = Vec4::LoadUnaligned(cornerHeights[3].data());
+        const Vec4::FloatType heightXY0 = Vec4::Madd(Vec4::Sub(heightX1Y0, heightX0Y0), lerpX, heightX0Y0);
+        const Vec4::FloatType heightXY1 = Vec4::Madd(Vec4::Sub(heightX1Y1, heightX0Y1), lerpX, heightX0Y1);
+        const Vec4::FloatType interpolatedHeights = Vec4::Madd(Vec4::Sub(heightXY1, heightXY0), lerpY, heightXY0);
+
+        AZStd::array<float, BatchSize> batchHeights;
+        Vec4::StoreUnaligned(batchHeights.data(), interpolatedHeights);
+
+        if (allCornersExist)
+        {
+            for (size_t lane = 0; lane < BatchSize; lane++)
+            {
+                heights[batchStart + lane] = batchHeights[lane];
+                terrainExists[batchStart + lane] = true;
+            }
+        }
+        else
+        {
+            AZStd::array<float, BatchSize> batchLerpX;
+            AZStd::array<float, BatchSize> batchLerpY;
+            Vec4::StoreUnaligned(batchLerpX.data(), lerpX);
+            Vec4::StoreUnaligned(batchLerpY.data(), lerpY);
+
+            for (size_t lane = 0; lane < BatchSize; lane++)
+            {
+                const AZStd::array<float, 4> laneHeights = {
+                    cornerHeights[0][lane], cornerHeights[1][lane], cornerHeights[2][lane], cornerHeights[3][lane] };
+                bool exists = false;
+                InterpolateHeights(
+                    laneHeights, cornerExists[lane], batchLerpX[lane], batchLerpY[lane], heights[batchStart + lane], exists);
+                terrainExists[batchStart + lane] = exists;
+            }
+        }
+    }
+
+    // Handle the remaining positions one at a time.
+    for (size_t i = batchedPositionCount; i < inPositions.size(); i++)
+    {
+        AZ::Vector2 normalizedDelta;
+        AZ::Vector2 pos0;
+        ClampPosition(inPositions[i].GetX(), inPositions[i].GetY(), queryResolution, pos0, normalizedDelta);
+        const int32_t gridX = aznumeric_cast<int32_t>(AZStd::floor(inPositions[i].GetX() / queryResolution));
+        const int32_t gridY = aznumeric_cast<int32_t>(AZStd::floor(inPositions[i].GetY() / queryResolution));
+
+        AZStd::array<bool, 4> exists = { false, false, false, false };
+        const AZStd::array<float, 4> queriedHeights = { cacheSampler.GetHeight(gridX, gridY, exists[0]),
+                                                        cacheSampler.GetHeight(gridX + 1, gridY, exists[1]),
+                                                        cacheSampler.GetHeight(gridX, gridY + 1, exists[2]),
+                                                        cacheSampler.GetHeight(gridX + 1, gridY + 1, exists[3]) };
+
+        bool terrainExistsAtPosition = false;
+        InterpolateHeights(
+            queriedHeights, exists, normalizedDelta.GetX(), normalizedDelta.GetY(), heights[i], terrainExistsAtPosition);
+        terrainExists[i] = terrainExistsAtPosition;
+    }
+}
+
+void TerrainSystem::GetHeightsSynchronousUncached(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
     AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
 {
     TERRAIN_PROFILE_FUNCTION_VERBOSE
@@ -1275,6 +1475,13 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
         GetHeightsSynchronous(inPositions, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, heights, terrainExists);
     }
 
+    // Both the bilinear and clamp samplers clamp the positions to the surface data query grid, so they can use the query cache.
+    if (bg_terrainQueryCacheEnabled && (sampler != Sampler::EXACT))
+    {
+        GetSurfaceWeightsFromCache(inPositions, outSurfaceWeightsList);
+        return;
+    }
+
     // queryPositions contains the modified positions based on our sampler type. For surface queries, we don't currently perform bilinear
     // interpolation of any results, so our query position size will always match our input size.
     AZStd::vector<AZ::Vector3> queryPositions;
@@ -1283,6 +1490,44 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     Sampler querySampler = (sampler == Sampler::EXACT) ? Sampler::EXACT : Sampler::CLAMP;
     GenerateQueryPositions(inPositions, queryPositions, queryResolution, querySampler);
 
+    QueryOrderedSurfaceWeights(queryPositions, outSurfaceWeightsList, terrainExists);
+}
+
+void TerrainSystem::GetSurfaceWeightsFromCache(
+    const AZStd::span<const AZ::Vector3>& inPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    // Missing tiles are filled by querying the terrain areas for every grid point in the tile.
+    TerrainQueryCache::SurfaceTileFillCallback fillCallback =
+        [this](AZStd::span<const AZ::Vector3> positions, TerrainQueryCache::SurfaceTile& tile)
+    {
+        AZStd::vector<bool> unusedTerrainExists(positions.size());
+        QueryOrderedSurfaceWeights(
+            positions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList>(tile.m_surfaceWeights.data(), tile.m_surfaceWeights.size()),
+            unusedTerrainExists);
+    };
+    TerrainQueryCache::SurfaceSampler cacheSampler(m_queryCache, fillCallback);
+
+    // Round to the nearest grid point the same way that RoundPosition does.
+    const float queryResolution = m_currentSettings.m_surfaceDataQueryResolution;
+    for (size_t i = 0; i < inPositions.size(); i++)
+    {
+        const int32_t gridX = aznumeric_cast<int32_t>(AZStd::floor((inPositions[i].GetX() / queryResolution) + 0.5f));
+        const int32_t gridY = aznumeric_cast<int32_t>(AZStd::floor((inPositions[i].GetY() / queryResolution) + 0.5f));
+        outSurfaceWeightsList[i] = cacheSampler.GetSurfaceWeights(gridX, gridY);
+    }
+}
+
+void TerrainSystem::QueryOrderedSurfaceWeights(
+    const AZStd::span<const AZ::Vector3>& queryPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList,
+    AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
     auto callback = [](const AZStd::span<const AZ::Vector3> inPositions,
                         [[maybe_unused]] AZStd::span<AZ::Vector3> outPositions,
                         [[maybe_unused]] AZStd::span<bool> outTerrainExists,
@@ -1686,6 +1931,7 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    m_queryCache.Invalidate(aabb, true, true);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
     m_cachedAreaBounds.AddAabb(aabb);
@@ -1706,6 +1952,7 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                m_queryCache.Invalidate(areaData.m_areaBounds, true, true);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
 
@@ -1759,10 +2006,18 @@ void TerrainSystem::RefreshArea(AZ::EntityId areaId, AzFramework::Terrain::Terra
 void TerrainSystem::RefreshRegion(
     const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask)
 {
+    using AzFramework::Terrain::TerrainDataNotifications;
+
     m_dirtyRegion.AddAabb(dirtyRegion);
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
+
+    // Drop the cached data right away instead of waiting for the notifications on the next tick,
+    // so that queries made before then don't return stale data.
+    m_queryCache.Invalidate(dirtyRegion,
+        (changeMask & TerrainDataNotifications::TerrainDataChangedMask::HeightData) != TerrainDataNotifications::TerrainDataChangedMask::None,
+        (changeMask & TerrainDataNotifications::TerrainDataChangedMask::SurfaceData) != TerrainDataNotifications::TerrainDataChangedMask::None);
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -1804,6 +2059,16 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // Any of the settings can change the data at the query grid points, so the whole query cache needs to be refreshed.
+        m_queryCache.Clear();
+        m_queryCache.SetQueryResolutions(m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution);
+    }
+
+    // Free up the query cache memory if the cache has been turned off.
+    if (!bg_terrainQueryCacheEnabled && !m_queryCache.IsEmpty())
+    {
+        m_queryCache.Clear();
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
@@ -25,6 +25,7 @@
 
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
+#include <TerrainSystem/TerrainQueryCache.h>
 #include <TerrainSystem/TerrainSystemBus.h>
 
 AZ_DECLARE_BUDGET(Terrain);
@@ -246,6 +247,22 @@ namespace Terrain
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<float> heights,
             AZStd::span<bool> terrainExists) const;
+        void GetHeightsSynchronousUncached(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            Sampler sampler, AZStd::span<float> heights,
+            AZStd::span<bool> terrainExists) const;
+
+        //! Get the heights from the query cache. Returns false if the positions can't be served from the cache,
+        //! which happens for EXACT queries that aren't aligned with the height query grid.
+        bool GetHeightsFromCache(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            Sampler sampler, AZStd::span<float> heights,
+            AZStd::span<bool> terrainExists) const;
+        void GetHeightsFromCacheBilinear(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            TerrainQueryCache::HeightSampler& cacheSampler,
+            AZStd::span<float> heights,
+            AZStd::span<bool> terrainExists) const;
         void GetNormalsSynchronous(
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<AZ::Vector3> normals,
@@ -266,6 +283,13 @@ namespace Terrain
             const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler,
             AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList,
             AZStd::span<bool> terrainExists) const;
+        void QueryOrderedSurfaceWeights(
+            const AZStd::span<const AZ::Vector3>& queryPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList,
+            AZStd::span<bool> terrainExists) const;
+        void GetSurfaceWeightsFromCache(
+            const AZStd::span<const AZ::Vector3>& inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const;
         void MakeBulkQueries(
             const AZStd::span<const AZ::Vector3> inPositions,
             AZStd::span<AZ::Vector3> outPositions,
@@ -314,6 +338,9 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        //! Optional cache of heights and surface weights at the query grid points, enabled with bg_terrainQueryCacheEnabled.
+        mutable TerrainQueryCache m_queryCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
@@ -27,12 +28,18 @@
 #include <SurfaceData/SurfaceDataTypes.h>
 
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
+#include <Components/TerrainPhysicsColliderComponent.h>
 #include <MockAxisAlignedBoxShapeComponent.h>
 
 #include <TerrainSystem/TerrainSystem.h>
 #include <TerrainTestFixtures.h>
 #include <benchmark/benchmark.h>
 
+namespace Terrain
+{
+    AZ_CVAR_EXTERNED(bool, bg_terrainQueryCacheEnabled);
+}
+
 namespace UnitTest
 {
     using ::testing::NiceMock;
@@ -1187,6 +1194,131 @@ namespace UnitTest
         ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 4 })
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_QueryPhysicsColliderRegionHeights)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Terrain);
+
+        // Benchmark the cost of querying the terrain heights and materials for a dirty region of a terrain physics collider,
+        // which is the terrain side of what happens every time a terrain edit notifies the collider of a change. The cost should
+        // scale with the size of the dirty region, not with the size of the whole heightfield.
+        // BM_UpdatePhysicsColliderRegion in the PhysX benchmarks measures the rest of the refresh, patching the PhysX heightfield.
+        const float boundsRange = aznumeric_cast<float>(state.range(0));
+        const float dirtyRegionSize = aznumeric_cast<float>(state.range(1));
+
+        AZ::Aabb worldBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-boundsRange / 2.0f), AZ::Vector3(boundsRange / 2.0f));
+        AZ::Aabb dirtyRegion = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(dirtyRegionSize / 2.0f));
+        const float queryResolution = 1.0f;
+
+        // The collider needs to be active before the terrain system is created so that it gets notified of the terrain creation.
+        auto colliderEntity = CreateTestBoxEntity(worldBounds);
+        colliderEntity->CreateComponent<Terrain::TerrainPhysicsColliderComponent>(Terrain::TerrainPhysicsColliderConfig());
+        ActivateEntity(colliderEntity.get());
+
+        CreateTestTerrainSystem(worldBounds, queryResolution, 1);
+
+        AZStd::vector<Physics::HeightMaterialPoint> heightMaterials;
+
+        for ([[maybe_unused]] auto stateIterator : state)
+        {
+            size_t startColumn = 0, startRow = 0, numColumns = 0, numRows = 0;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                colliderEntity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+                dirtyRegion, startColumn, startRow, numColumns, numRows);
+
+            heightMaterials.resize(numColumns * numRows);
+
+            auto updateHeightsMaterialsCallback =
+                [&heightMaterials, startColumn, startRow, numColumns](size_t column, size_t row, const Physics::HeightMaterialPoint& point)
+            {
+                heightMaterials[((row - startRow) * numColumns) + (column - startColumn)] = point;
+            };
+
+            Physics::HeightfieldProviderRequestsBus::Event(
+                colliderEntity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::UpdateHeightsAndMaterials,
+                updateHeightsMaterialsCallback, startColumn, startRow, numColumns, numRows);
+
+            benchmark::DoNotOptimize(heightMaterials.data());
+        }
+
+        DestroyTestTerrainSystem();
+        colliderEntity.reset();
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_QueryPhysicsColliderRegionHeights)
+        ->Args({ 4096, 16 })
+        ->Args({ 4096, 256 })
+        ->Args({ 4096, 4096 })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsListCached)(benchmark::State& state)
+    {
+        // Compare repeated height queries over the same area with and without the terrain query cache.
+        // state.range(3) turns the cache on or off. The positions are offset from the query grid so that
+        // the bilinear sampler needs to blend between grid points.
+        Terrain::bg_terrainQueryCacheEnabled = (state.range(3) != 0);
+
+        RunTerrainApiBenchmark(
+            state,
+            [this](float queryResolution, const AZ::Aabb& worldBounds, AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                AZStd::vector<AZ::Vector3> inPositions;
+                GenerateInputPositionsList(
+                    queryResolution, worldBounds.GetTranslated(AZ::Vector3(queryResolution / 2.0f, queryResolution / 2.0f, 0.0f)),
+                    inPositions);
+
+                auto perPositionCallback = [](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    benchmark::DoNotOptimize(surfacePoint.m_position.GetZ());
+                };
+
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::QueryList, inPositions,
+                    AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback, sampler);
+            }
+        );
+
+        Terrain::bg_terrainQueryCacheEnabled = false;
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsListCached)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 0 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR), 1 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 0 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 1 })
+        ->Unit(::benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfaceWeightsListCached)(benchmark::State& state)
+    {
+        // Compare repeated surface weight queries over the same area with and without the terrain query cache.
+        // state.range(3) turns the cache on or off.
+        Terrain::bg_terrainQueryCacheEnabled = (state.range(3) != 0);
+
+        RunTerrainApiBenchmark(
+            state,
+            [this](float queryResolution, const AZ::Aabb& worldBounds, AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                AZStd::vector<AZ::Vector3> inPositions;
+                GenerateInputPositionsList(queryResolution, worldBounds, inPositions);
+
+                auto perPositionCallback = [](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    benchmark::DoNotOptimize(surfacePoint.m_surfaceTags);
+                };
+
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::QueryList, inPositions,
+                    AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::SurfaceData, perPositionCallback, sampler);
+            }
+        );
+
+        Terrain::bg_terrainQueryCacheEnabled = false;
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessSurfaceWeightsListCached)
+        ->Args({ 256, 4, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 0 })
+        ->Args({ 256, 4, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP), 1 })
+        ->Unit(::benchmark::kMillisecond);
+
 #endif
 
 }
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobManagerComponent.h>
 #include <AzCore/std/parallel/semaphore.h>
 
@@ -35,6 +36,11 @@ using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::SetArgReferee;
 
+namespace Terrain
+{
+    AZ_CVAR_EXTERNED(bool, bg_terrainQueryCacheEnabled);
+}
+
 namespace UnitTest
 {
     class TerrainSystemTest
@@ -1549,4 +1555,133 @@ namespace UnitTest
         // Now wait until the async request has completed after being cancelled.
         asyncRequestCompletedEvent.acquire();
     }
+    TEST_F(TerrainSystemTest, TerrainQueryCacheProducesSameResultsAsUncachedQueries)
+    {
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        const float amplitudeMeters = 10.0f;
+        const float frequencyMeters = 1.0f;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [amplitudeMeters, frequencyMeters](AZ::Vector3& position, bool& terrainExists)
+            {
+                // Generate a height of X + Y with a "spike" between grid points, and a hole in one corner of the terrain
+                // so that the interpolation of partially-existing grid squares gets tested as well.
+                float unexpectedVariance =
+                    amplitudeMeters * (fmodf(position.GetX(), frequencyMeters) + fmodf(position.GetY(), frequencyMeters));
+                position.SetZ(position.GetX() + position.GetY() + unexpectedVariance);
+                terrainExists = (position.GetX() < 4.0f) || (position.GetY() < 4.0f);
+            });
+
+        AzFramework::SurfaceData::SurfaceTagWeightList expectedTags;
+        SetupSurfaceWeightMocks(entity.get(), expectedTags);
+
+        auto terrainSystem = CreateAndActivateTerrainSystem(frequencyMeters);
+
+        // Query points on the grid, between grid points, and on both sides of the terrain edges and holes.
+        AZStd::vector<AZ::Vector3> inPositions;
+        for (float y = -11.0f; y < 11.0f; y += 0.75f)
+        {
+            for (float x = -11.0f; x < 11.0f; x += 0.5f)
+            {
+                inPositions.emplace_back(x, y, 0.0f);
+            }
+        }
+
+        const auto requestedData = AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::All;
+        const AzFramework::Terrain::TerrainDataRequests::Sampler samplers[] = {
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
+        };
+
+        for (auto sampler : samplers)
+        {
+            AZStd::vector<AzFramework::SurfaceData::SurfacePoint> uncachedPoints;
+            AZStd::vector<bool> uncachedExists;
+            Terrain::bg_terrainQueryCacheEnabled = false;
+            terrainSystem->QueryList(
+                inPositions, requestedData,
+                [&uncachedPoints, &uncachedExists](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                {
+                    uncachedPoints.push_back(surfacePoint);
+                    uncachedExists.push_back(terrainExists);
+                },
+                sampler);
+
+            // Query twice with the cache enabled, once to fill the cache and once to read back from it.
+            Terrain::bg_terrainQueryCacheEnabled = true;
+            for (int pass = 0; pass < 2; pass++)
+            {
+                size_t index = 0;
+                terrainSystem->QueryList(
+                    inPositions, requestedData,
+                    [&uncachedPoints, &uncachedExists, &index](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                    {
+                        ASSERT_LT(index, uncachedPoints.size());
+                        constexpr float epsilon = 0.0001f;
+                        EXPECT_THAT(surfacePoint.m_position, UnitTest::IsCloseTolerance(uncachedPoints[index].m_position, epsilon));
+                        EXPECT_THAT(surfacePoint.m_normal, UnitTest::IsCloseTolerance(uncachedPoints[index].m_normal, epsilon));
+                        EXPECT_EQ(terrainExists, uncachedExists[index]);
+                        ASSERT_EQ(surfacePoint.m_surfaceTags.size(), uncachedPoints[index].m_surfaceTags.size());
+                        for (size_t tag = 0; tag < surfacePoint.m_surfaceTags.size(); tag++)
+                        {
+                            EXPECT_EQ(surfacePoint.m_surfaceTags[tag].m_surfaceType, uncachedPoints[index].m_surfaceTags[tag].m_surfaceType);
+                            EXPECT_NEAR(surfacePoint.m_surfaceTags[tag].m_weight, uncachedPoints[index].m_surfaceTags[tag].m_weight, epsilon);
+                        }
+                        index++;
+                    },
+                    sampler);
+                EXPECT_EQ(index, uncachedPoints.size());
+            }
+        }
+
+        Terrain::bg_terrainQueryCacheEnabled = false;
+    }
+
+    TEST_F(TerrainSystemTest, TerrainQueryCacheIsInvalidatedByDirtyRegions)
+    {
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -5.0f, 10.0f, 10.0f, 15.0f);
+        float heightOffset = 0.0f;
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(heightOffset);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+        Terrain::bg_terrainQueryCacheEnabled = true;
+
+        const AZStd::vector<AZ::Vector3> inPositions = { AZ::Vector3(-5.5f, -5.5f, 0.0f), AZ::Vector3(5.5f, 5.5f, 0.0f) };
+        auto queryHeights = [&terrainSystem, &inPositions]()
+        {
+            AZStd::vector<float> heights;
+            terrainSystem->QueryList(
+                inPositions, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+                [&heights](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    heights.push_back(surfacePoint.m_position.GetZ());
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR);
+            return heights;
+        };
+
+        // Fill the cache.
+        EXPECT_THAT(queryHeights(), ::testing::ElementsAre(0.0f, 0.0f));
+
+        // Change the heights without notifying the terrain system. The cached heights should still be returned.
+        heightOffset = 1.0f;
+        EXPECT_THAT(queryHeights(), ::testing::ElementsAre(0.0f, 0.0f));
+
+        // Mark a region around the second position as dirty. Only that position should pick up the new heights.
+        terrainSystem->RefreshRegion(
+            AZ::Aabb::CreateFromMinMaxValues(4.0f, 4.0f, -5.0f, 7.0f, 7.0f, 15.0f),
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        EXPECT_THAT(queryHeights(), ::testing::ElementsAre(0.0f, 1.0f));
+
+        // Turning off the cache should always return the current heights.
+        Terrain::bg_terrainQueryCacheEnabled = false;
+        EXPECT_THAT(queryHeights(), ::testing::ElementsAre(1.0f, 1.0f));
+    }
 } // namespace UnitTest
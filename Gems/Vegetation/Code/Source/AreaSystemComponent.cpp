@@ -22,7 +22,10 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
@@ -143,6 +146,7 @@ namespace Vegetation
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("SectorBatchSize", &AreaSystemConfig::m_sectorBatchSize)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -173,6 +177,9 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_sectorBatchSize, "Sector Batch Size", "The number of sectors whose surface points are gathered in parallel before they get filled, closest sectors first.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, 64)
                 ;
             }
         }
@@ -186,6 +193,7 @@ namespace Vegetation
                 ->Property("sectorDensity", BehaviorValueProperty(&AreaSystemConfig::m_sectorDensity))
                 ->Property("sectorSizeInMeters", BehaviorValueProperty(&AreaSystemConfig::m_sectorSizeInMeters))
                 ->Property("threadProcessingIntervalMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingIntervalMs))
+                ->Property("sectorBatchSize", BehaviorValueProperty(&AreaSystemConfig::m_sectorBatchSize))
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
@@ -779,6 +787,7 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_sectorBatchSize = m_configuration.m_sectorBatchSize;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -1083,6 +1092,14 @@ namespace Vegetation
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+        return AddSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::AddSector(SectorInfo&& sectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        // The claim callbacks capture the sector by reference, so they can only be set up once the sector is in its final location.
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
         return &sectorInfoRef;
@@ -1779,6 +1796,13 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
+            // Sectors that need new surface points are processed in batches so that the surface queries can run in parallel.
+            if ((m_cachedMainThreadData.m_sectorBatchSize > 1) && (m_updateWorkList.back().second != UpdateMode::Fill))
+            {
+                UpdateSectorBatch(threadData, vegTasks);
+                return true;
+            }
+
             auto& updateEntry = m_updateWorkList.back();
             SectorId sectorId = updateEntry.first;
             UpdateMode mode = updateEntry.second;
@@ -1827,4 +1851,125 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+
+        // Don't let the number of active sectors grow more than one batch past the view rectangle.  UpdateOneSector() prioritizes
+        // deletes as soon as there are too many active sectors, so the pending deletes catch up before the next batch starts.
+        const size_t maxBatchSize = static_cast<size_t>(m_cachedMainThreadData.m_sectorBatchSize);
+        size_t activeSectorCount = 0;
+        {
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+            activeSectorCount = vegTasks->m_sectorRollingWindow.size();
+        }
+        const size_t maxActiveSectorCount = m_viewRectSectorCount + maxBatchSize;
+        const size_t maxCreateCount = (activeSectorCount < maxActiveSectorCount) ? (maxActiveSectorCount - activeSectorCount) : 0;
+        size_t createCount = 0;
+
+        // Pull the closest sectors from the end of the work list.  The first one is always taken, which matches what
+        // UpdateOneSector() would have done.
+        m_sectorBatch.clear();
+        while (!m_updateWorkList.empty() && (m_sectorBatch.size() < maxBatchSize))
+        {
+            const auto& updateEntry = m_updateWorkList.back();
+            if (updateEntry.second == UpdateMode::Fill)
+            {
+                break;
+            }
+            if ((updateEntry.second == UpdateMode::Create) && !m_sectorBatch.empty() && (createCount >= maxCreateCount))
+            {
+                break;
+            }
+
+            SectorBatchEntry& batchEntry = m_sectorBatch.emplace_back();
+            batchEntry.m_mode = updateEntry.second;
+            batchEntry.m_sectorInfo.m_id = updateEntry.first;
+            batchEntry.m_sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(updateEntry.first, sectorSizeInMeters);
+            createCount += (updateEntry.second == UpdateMode::Create) ? 1 : 0;
+            m_updateWorkList.pop_back();
+        }
+
+        // Generate the surface points for every sector in the batch.  The sectors are local to the batch at this point, so
+        // nothing else can see them until they get moved into the rolling window below.
+        {
+            AZ_PROFILE_SCOPE(Entity, "Vegetation::AreaSystemComponent::UpdateContext::UpdateSectorBatch-SurfacePoints");
+
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            AZ::Job* currentJob = jobContext ? jobContext->GetJobManager().GetCurrentJob() : nullptr;
+            AZ::JobCompletion* completionJob = (jobContext && !currentJob) ? aznew AZ::JobCompletion() : nullptr;
+
+            for (size_t batchIndex = 1; jobContext && (batchIndex < m_sectorBatch.size()); ++batchIndex)
+            {
+                SectorInfo* sectorInfo = &m_sectorBatch[batchIndex].m_sectorInfo;
+                AZ::Job* sectorJob = AZ::CreateJobFunction(
+                    [vegTasks, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                    {
+                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                    }, true);
+
+                if (currentJob)
+                {
+                    currentJob->StartAsChild(sectorJob);
+                }
+                else
+                {
+                    sectorJob->SetDependent(completionJob);
+                    sectorJob->Start();
+                }
+            }
+
+            // The closest sector is processed on this thread while the jobs are running.
+            vegTasks->UpdateSectorPoints(m_sectorBatch.front().m_sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+
+            if (currentJob)
+            {
+                currentJob->WaitForChildren();
+            }
+            else if (completionJob)
+            {
+                completionJob->StartAndWaitForCompletion();
+                delete completionJob;
+            }
+            else
+            {
+                // Without a job context, fall back to generating the points serially.
+                for (size_t batchIndex = 1; batchIndex < m_sectorBatch.size(); ++batchIndex)
+                {
+                    vegTasks->UpdateSectorPoints(m_sectorBatch[batchIndex].m_sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                }
+            }
+        }
+
+        // Claiming points calls into the vegetation areas, which aren't safe to use from multiple threads at once, so the
+        // sectors are filled one at a time, closest first.
+        for (SectorBatchEntry& batchEntry : m_sectorBatch)
+        {
+            AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+
+            SectorInfo* sectorInfo = nullptr;
+            if (batchEntry.m_mode == UpdateMode::Create)
+            {
+                AZ_Assert(!vegTasks->GetSector(batchEntry.m_sectorInfo.m_id), "Sector update mode is 'Create' but sector already exists");
+                sectorInfo = vegTasks->AddSector(AZStd::move(batchEntry.m_sectorInfo));
+            }
+            else
+            {
+                sectorInfo = vegTasks->GetSector(batchEntry.m_sectorInfo.m_id);
+                AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+
+                // Only swap in the new points; the existing claim callbacks and claims stay with the sector.
+                AZStd::swap(sectorInfo->m_baseContext.m_masks, batchEntry.m_sectorInfo.m_baseContext.m_masks);
+                AZStd::swap(sectorInfo->m_baseContext.m_availablePoints, batchEntry.m_sectorInfo.m_baseContext.m_availablePoints);
+            }
+
+            vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+        }
+
+        m_sectorBatch.clear();
+    }
 }
@@ -49,7 +49,8 @@ namespace Vegetation
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
-                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                   && m_sectorBatchSize == other.m_sectorBatchSize;
         }
 
         int m_viewRectangleSize = 13;
@@ -58,6 +59,7 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        int m_sectorBatchSize = 8;
     private:
         static const int s_maxViewRectangleSize;
         static const int s_maxSectorDensity;
@@ -271,6 +273,7 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_sectorBatchSize = 1;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -292,6 +295,10 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Adds a sector whose points have already been generated to the rolling window.  The rolling window mutex must be held.
+            SectorInfo* AddSector(SectorInfo&& sectorInfo);
+            //! Generates the plantable points for a sector.  This only reads the surface data and doesn't touch any shared state,
+            //! so it can run for several sectors in parallel as long as the sectors aren't in the rolling window yet.
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
@@ -430,6 +437,7 @@ namespace Vegetation
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -446,6 +454,15 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // A batch of sectors taken from the end of m_updateWorkList whose surface points are generated in parallel.
+            // The sectors are stored closest first, and get filled one at a time in that order once all their points are ready.
+            struct SectorBatchEntry
+            {
+                UpdateMode m_mode = UpdateMode::Create;
+                SectorInfo m_sectorInfo;
+            };
+            AZStd::vector<SectorBatchEntry> m_sectorBatch;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
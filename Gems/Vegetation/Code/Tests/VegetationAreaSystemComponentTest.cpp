@@ -22,6 +22,14 @@
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
 
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Components/CameraBus.h>
+#include <VegetationMocks.h>
+
 namespace UnitTest
 {
     // This component meets all the dependencies required to get the Vegetation system activated:
@@ -52,16 +60,22 @@ namespace UnitTest
         static void GetRequiredServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& required) {}
         static void GetDependentServices([[maybe_unused]] AZ::ComponentDescriptor::DependencyArrayType& dependent) {}
 
+        //! The number of job worker threads to start.  The benchmarks raise this so that sectors can be processed in parallel.
+        static inline int s_workerThreadCount = 1;
+
     protected:
         ////////////////////////////////////////////////////////////////////////
         // AZ::Component interface implementation
         void Init() override {}
         void Activate() override
         {
-            // Initialize the job manager with 1 thread for the AssetManager to use.
+            // Initialize the job manager with 1 thread (by default) for the AssetManager to use.
             AZ::JobManagerDesc jobDesc;
             AZ::JobManagerThreadDesc threadDesc;
-            jobDesc.m_workerThreads.push_back(threadDesc);
+            for (int threadIndex = 0; threadIndex < s_workerThreadCount; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
             m_jobManager = aznew AZ::JobManager(jobDesc);
             m_jobContext = aznew AZ::JobContext(*m_jobManager);
             AZ::JobContext::SetGlobalContext(m_jobContext);
@@ -152,5 +166,410 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
-}
 
+    // Surface provider that returns one flat surface point for every position in the queried region.
+    struct FlatSurfaceHandler
+        : public MockSurfaceHandler
+    {
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointList& surfacePointListPerPosition) const override
+        {
+            AZStd::vector<AZ::Vector3> inPositions;
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
+                }
+            }
+
+            surfacePointListPerPosition.Clear();
+            surfacePointListPerPosition.StartListConstruction(inPositions, 1, desiredTags);
+            for (const AZ::Vector3& inPosition : inPositions)
+            {
+                surfacePointListPerPosition.AddSurfacePoint(AZ::EntityId(), inPosition,
+                    AZ::Vector3(inPosition.GetX(), inPosition.GetY(), 0.0f), AZ::Vector3::CreateAxisZ(), m_outMasks);
+            }
+            surfacePointListPerPosition.EndListConstruction();
+        }
+    };
+
+    // Camera whose position drives the vegetation view rectangle.
+    struct MockCamera
+        : public Camera::CameraSystemRequestBus::Handler
+        , public MockTransformBus
+    {
+        MockCamera()
+        {
+            Camera::CameraSystemRequestBus::Handler::BusConnect();
+            AZ::TransformBus::Handler::BusConnect(m_cameraId);
+        }
+
+        ~MockCamera()
+        {
+            AZ::TransformBus::Handler::BusDisconnect();
+            Camera::CameraSystemRequestBus::Handler::BusDisconnect();
+        }
+
+        AZ::EntityId GetActiveCamera() override
+        {
+            return m_cameraId;
+        }
+
+        AZ::Vector3 GetWorldTranslation() override
+        {
+            return m_GetWorldTMOutput.GetTranslation();
+        }
+
+        AZ::EntityId m_cameraId = AZ::EntityId(12345);
+    };
+
+    // Vegetation area that claims every Nth available point and leaves the rest to the areas below it.
+    // An area with a stride of 1 claims all the remaining points.
+    class SyntheticVegetationArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+    public:
+        SyntheticVegetationArea(AZ::EntityId areaId, size_t claimStride)
+            : m_areaId(areaId)
+            , m_claimStride(claimStride)
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_areaId);
+        }
+
+        ~SyntheticVegetationArea()
+        {
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            size_t pointIndex = 0;
+            auto claimedPoints = AZStd::remove_if(context.m_availablePoints.begin(), context.m_availablePoints.end(),
+                [this, &context, &pointIndex](const Vegetation::ClaimPoint& point)
+                {
+                    if ((pointIndex++ % m_claimStride) != 0)
+                    {
+                        return false;
+                    }
+
+                    Vegetation::InstanceData instanceData;
+                    instanceData.m_id = m_areaId;
+                    instanceData.m_position = point.m_position;
+                    instanceData.m_normal = point.m_normal;
+                    if (!context.m_existedCallback(point, instanceData))
+                    {
+                        context.m_createdCallback(point, instanceData);
+                    }
+                    return true;
+                });
+            context.m_availablePoints.erase(claimedPoints, context.m_availablePoints.end());
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+
+    private:
+        AZ::EntityId m_areaId;
+        size_t m_claimStride = 1;
+    };
+
+    // Test harness that fills the view rectangle around the camera on a flat surface from a stack of synthetic areas.
+    class VegetationAreaSystemFillTest
+        : public VegetationTestApp
+    {
+    public:
+        static constexpr int ViewRectangleSize = 5;
+        static constexpr int SectorDensity = 8;
+        static constexpr int SectorSizeInMeters = 16;
+        static constexpr int AreaCount = 3;
+
+        void SetUp() override
+        {
+            // Batched sectors have their surface points gathered on the job worker threads.
+            MockVegetationDependenciesComponent::s_workerThreadCount = 4;
+            VegetationTestApp::SetUp();
+
+            m_surfaceHandler = AZStd::make_unique<FlatSurfaceHandler>();
+            m_camera = AZStd::make_unique<MockCamera>();
+            m_camera->m_GetWorldTMOutput = AZ::Transform::CreateIdentity();
+            m_filledBounds = AZ::Aabb::CreateNull();
+        }
+
+        void TearDown() override
+        {
+            m_systemEntity->Deactivate();
+
+            m_areas.clear();
+            m_camera.reset();
+            m_surfaceHandler.reset();
+
+            m_application.Destroy();
+            MockVegetationDependenciesComponent::s_workerThreadCount = 1;
+        }
+
+        void SetSectorBatchSize(int sectorBatchSize)
+        {
+            Vegetation::AreaSystemConfig config;
+            config.m_viewRectangleSize = ViewRectangleSize;
+            config.m_sectorDensity = SectorDensity;
+            config.m_sectorSizeInMeters = SectorSizeInMeters;
+            config.m_threadProcessingIntervalMs = 0;
+            config.m_sectorBatchSize = sectorBatchSize;
+            Vegetation::SystemConfigurationRequestBus::Broadcast(&Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+
+            if (m_areas.empty())
+            {
+                // Each area in the stack claims a share of the points that are left, and the bottom area claims the rest.
+                const AZ::Aabb areaBounds = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(1000000.0f));
+                for (int areaIndex = 0; areaIndex < AreaCount; ++areaIndex)
+                {
+                    const AZ::EntityId areaId(1000 + areaIndex);
+                    const AZ::u32 priority = static_cast<AZ::u32>(AreaCount - areaIndex);
+                    m_areas.emplace_back(AZStd::make_unique<SyntheticVegetationArea>(areaId, static_cast<size_t>(priority)));
+                    Vegetation::AreaSystemRequestBus::Broadcast(
+                        &Vegetation::AreaSystemRequestBus::Events::RegisterArea, areaId, 0, priority, areaBounds);
+                }
+            }
+        }
+
+        size_t GetInstanceCount(const AZ::Aabb& bounds) const
+        {
+            size_t instanceCount = 0;
+            Vegetation::AreaSystemRequestBus::BroadcastResult(
+                instanceCount, &Vegetation::AreaSystemRequestBus::Events::GetInstanceCountInAabb, bounds);
+            return instanceCount;
+        }
+
+        //! Moves the camera and ticks until the view rectangle around it is filled and the previously filled one is empty.
+        //! Returns the instances around the camera, sorted by area and position.
+        AZStd::vector<Vegetation::InstanceData> FillViewRectangle(const AZ::Vector3& cameraPosition)
+        {
+            // The view rectangle snaps to sector boundaries, so search a region that's twice the size of the view rectangle
+            // to be sure that it's fully covered.
+            const float halfSearchSize = static_cast<float>(ViewRectangleSize * SectorSizeInMeters);
+            const AZ::Aabb searchBounds = AZ::Aabb::CreateCenterHalfExtents(cameraPosition, AZ::Vector3(halfSearchSize, halfSearchSize, 1.0f));
+            m_camera->m_GetWorldTMOutput = AZ::Transform::CreateTranslation(cameraPosition);
+
+            const size_t expectedInstanceCount = static_cast<size_t>(ViewRectangleSize * ViewRectangleSize * SectorDensity * SectorDensity);
+            const auto timeoutTime = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(60);
+            while ((GetInstanceCount(searchBounds) != expectedInstanceCount) || (GetInstanceCount(m_filledBounds) != 0))
+            {
+                if (AZStd::chrono::steady_clock::now() > timeoutTime)
+                {
+                    ADD_FAILURE() << "Timed out filling the view rectangle.";
+                    break;
+                }
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+            m_filledBounds = searchBounds;
+
+            AZStd::vector<Vegetation::InstanceData> instances;
+            Vegetation::AreaSystemRequestBus::BroadcastResult(
+                instances, &Vegetation::AreaSystemRequestBus::Events::GetInstancesInAabb, searchBounds);
+            AZStd::sort(instances.begin(), instances.end(),
+                [](const Vegetation::InstanceData& lhs, const Vegetation::InstanceData& rhs)
+                {
+                    if (lhs.m_id != rhs.m_id)
+                    {
+                        return lhs.m_id < rhs.m_id;
+                    }
+                    if (lhs.m_position.GetY() != rhs.m_position.GetY())
+                    {
+                        return lhs.m_position.GetY() < rhs.m_position.GetY();
+                    }
+                    return lhs.m_position.GetX() < rhs.m_position.GetX();
+                });
+            return instances;
+        }
+
+        AZStd::unique_ptr<FlatSurfaceHandler> m_surfaceHandler;
+        AZStd::unique_ptr<MockCamera> m_camera;
+        AZStd::vector<AZStd::unique_ptr<SyntheticVegetationArea>> m_areas;
+        AZ::Aabb m_filledBounds = AZ::Aabb::CreateNull();
+    };
+
+    TEST_F(VegetationAreaSystemFillTest, Vegetation_AreaSystem_BatchedSectorFill_MatchesUnbatchedFill)
+    {
+        // Gathering the surface points for several sectors at once must place the exact same instances
+        // as filling one sector at a time.
+        const AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+        const AZ::Vector3 otherCameraPosition(static_cast<float>(ViewRectangleSize * SectorSizeInMeters * 4), 0.0f, 0.0f);
+
+        SetSectorBatchSize(1);
+        const AZStd::vector<Vegetation::InstanceData> unbatchedInstances = FillViewRectangle(cameraPosition);
+
+        // Move away first, so that the batched fill starts without any of the sectors around the camera.
+        FillViewRectangle(otherCameraPosition);
+        SetSectorBatchSize(8);
+        const AZStd::vector<Vegetation::InstanceData> batchedInstances = FillViewRectangle(cameraPosition);
+
+        ASSERT_EQ(unbatchedInstances.size(), static_cast<size_t>(ViewRectangleSize * ViewRectangleSize * SectorDensity * SectorDensity));
+        ASSERT_EQ(batchedInstances.size(), unbatchedInstances.size());
+        for (size_t instanceIndex = 0; instanceIndex < unbatchedInstances.size(); ++instanceIndex)
+        {
+            EXPECT_EQ(batchedInstances[instanceIndex].m_id, unbatchedInstances[instanceIndex].m_id);
+            EXPECT_TRUE(batchedInstances[instanceIndex].m_position == unbatchedInstances[instanceIndex].m_position);
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    //! Measures how quickly the vegetation system fills the view rectangle around the camera.
+    //! Every iteration moves the camera to a new location far away from the previous one, which deletes all the existing
+    //! sectors and creates a full view rectangle of new ones that get filled from a stack of synthetic areas.
+    //! Benchmark arguments: sector batch size, number of job worker threads.
+    class VegetationAreaSystemBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int ViewRectangleSize = 13;
+        static constexpr int SectorDensity = 20;
+        static constexpr int SectorSizeInMeters = 16;
+        static constexpr int AreaCount = 4;
+
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            MockVegetationDependenciesComponent::s_workerThreadCount = aznumeric_cast<int>(state.range(1));
+
+            AZ::ComponentApplication::Descriptor appDesc;
+            AZ::ComponentApplication::StartupParameters appStartup;
+            appStartup.m_loadSettingsRegistry = false;
+            appStartup.m_createStaticModulesCallback =
+                [](AZStd::vector<AZ::Module*>& modules)
+            {
+                modules.emplace_back(new MockVegetationDependenciesModule);
+                modules.emplace_back(new Vegetation::VegetationModule);
+            };
+
+            m_application = AZStd::make_unique<AZ::ComponentApplication>();
+            m_systemEntity = m_application->Create(appDesc, appStartup);
+            m_systemEntity->Init();
+            m_systemEntity->Activate();
+
+            m_surfaceHandler = AZStd::make_unique<FlatSurfaceHandler>();
+            m_camera = AZStd::make_unique<MockCamera>();
+
+            Vegetation::AreaSystemConfig config;
+            config.m_viewRectangleSize = ViewRectangleSize;
+            config.m_sectorDensity = SectorDensity;
+            config.m_sectorSizeInMeters = SectorSizeInMeters;
+            config.m_threadProcessingIntervalMs = 0;
+            config.m_sectorBatchSize = aznumeric_cast<int>(state.range(0));
+            Vegetation::SystemConfigurationRequestBus::Broadcast(&Vegetation::SystemConfigurationRequestBus::Events::UpdateSystemConfig, &config);
+
+            // Each area in the stack claims a share of the points that are left, and the bottom area claims the rest.
+            const AZ::Aabb areaBounds = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(1000000.0f));
+            for (int areaIndex = 0; areaIndex < AreaCount; ++areaIndex)
+            {
+                const AZ::EntityId areaId(1000 + areaIndex);
+                const AZ::u32 priority = static_cast<AZ::u32>(AreaCount - areaIndex);
+                m_areas.emplace_back(AZStd::make_unique<SyntheticVegetationArea>(areaId, static_cast<size_t>(priority)));
+                Vegetation::AreaSystemRequestBus::Broadcast(
+                    &Vegetation::AreaSystemRequestBus::Events::RegisterArea, areaId, 0, priority, areaBounds);
+            }
+
+            m_cameraPositionIndex = 0;
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            m_systemEntity->Deactivate();
+
+            m_areas.clear();
+            m_camera.reset();
+            m_surfaceHandler.reset();
+
+            m_application->Destroy();
+            m_application.reset();
+
+            MockVegetationDependenciesComponent::s_workerThreadCount = 1;
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZ::Aabb GetSearchBounds(const AZ::Vector3& cameraPosition) const
+        {
+            // The view rectangle snaps to sector boundaries, so search a region that's twice the size of the view rectangle to be
+            // sure that it's fully covered.  The camera positions are far enough apart that the regions never overlap.
+            const float halfSearchSize = static_cast<float>(ViewRectangleSize * SectorSizeInMeters);
+            return AZ::Aabb::CreateCenterHalfExtents(cameraPosition, AZ::Vector3(halfSearchSize, halfSearchSize, 1.0f));
+        }
+
+        AZ::Vector3 GetCameraPosition(size_t positionIndex) const
+        {
+            const float offset = static_cast<float>(positionIndex * ViewRectangleSize * SectorSizeInMeters * 4);
+            return AZ::Vector3(offset, 0.0f, 0.0f);
+        }
+
+        size_t GetInstanceCount(const AZ::Aabb& bounds) const
+        {
+            size_t instanceCount = 0;
+            Vegetation::AreaSystemRequestBus::BroadcastResult(
+                instanceCount, &Vegetation::AreaSystemRequestBus::Events::GetInstanceCountInAabb, bounds);
+            return instanceCount;
+        }
+
+        //! Moves the camera to the next position and ticks until the new view rectangle is filled and the old one is empty.
+        void FillNextViewRectangle()
+        {
+            const AZ::Aabb previousSearchBounds = GetSearchBounds(GetCameraPosition(m_cameraPositionIndex));
+            m_cameraPositionIndex = (m_cameraPositionIndex + 1) % 2;
+            const AZ::Vector3 cameraPosition = GetCameraPosition(m_cameraPositionIndex);
+            const AZ::Aabb searchBounds = GetSearchBounds(cameraPosition);
+            m_camera->m_GetWorldTMOutput = AZ::Transform::CreateTranslation(cameraPosition);
+
+            const size_t expectedInstanceCount = static_cast<size_t>(ViewRectangleSize * ViewRectangleSize * SectorDensity * SectorDensity);
+            while (true)
+            {
+                AZ::TickBus::Broadcast(&AZ::TickBus::Events::OnTick, 0.0f, AZ::ScriptTimePoint{});
+                if ((GetInstanceCount(searchBounds) == expectedInstanceCount) && (GetInstanceCount(previousSearchBounds) == 0))
+                {
+                    break;
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+
+        AZStd::unique_ptr<AZ::ComponentApplication> m_application;
+        AZ::Entity* m_systemEntity = nullptr;
+        AZStd::unique_ptr<FlatSurfaceHandler> m_surfaceHandler;
+        AZStd::unique_ptr<MockCamera> m_camera;
+        AZStd::vector<AZStd::unique_ptr<SyntheticVegetationArea>> m_areas;
+        size_t m_cameraPositionIndex = 0;
+    };
+
+    BENCHMARK_DEFINE_F(VegetationAreaSystemBenchmark, FillViewRectangle)(benchmark::State& state)
+    {
+        // The first fill around the starting position isn't measured.
+        FillNextViewRectangle();
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            FillNextViewRectangle();
+        }
+
+        const double sectorsPerIteration = ViewRectangleSize * ViewRectangleSize;
+        const double instancesPerIteration = sectorsPerIteration * SectorDensity * SectorDensity;
+        state.counters["Sectors"] = benchmark::Counter(sectorsPerIteration * state.iterations(), benchmark::Counter::kIsRate);
+        state.counters["Instances"] = benchmark::Counter(instancesPerIteration * state.iterations(), benchmark::Counter::kIsRate);
+    }
+
+    BENCHMARK_REGISTER_F(VegetationAreaSystemBenchmark, FillViewRectangle)
+        ->Args({ 1, 4 })
+        ->Args({ 8, 1 })
+        ->Args({ 8, 4 })
+        ->Args({ 16, 8 })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
+}